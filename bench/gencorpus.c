@@ -0,0 +1,798 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdarg.h>
+
+/*****************************************************************************************************
+                            PRIVATE GENCORPUS FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Seed used when `--seed` is not given, so every run writes the same corpus
+ */
+#define DEFAULT_SEED 20240601u
+
+/**
+ * Deepest nesting of statements and expressions the generator writes
+ */
+#define MAX_STATEMENT_DEPTH 4
+#define MAX_EXPRESSION_DEPTH 4
+
+/**
+ * Number of earlier structs, enums and functions a new declaration can refer to
+ */
+#define REFERENCE_WINDOW 64
+
+/**
+ * Represents the state of the generator.
+ */
+typedef struct generator
+{
+    FILE *file;             /** The file the corpus is written to. */
+    uint64_t state;         /** The state of the random number generator. */
+    uint64_t written;       /** The number of bytes written so far. */
+    unsigned structCount;   /** The number of structs declared so far. */
+    unsigned enumCount;     /** The number of enums declared so far. */
+    unsigned tableCount;    /** The number of tables declared so far. */
+    unsigned functionCount; /** The number of functions defined so far. */
+    unsigned paramCount;    /** The number of parameters of the function being written. */
+    unsigned localCount;    /** The number of locals of the function being written. */
+} Generator;
+
+static uint64_t nextRandom(Generator *const generator);
+
+static unsigned randomBelow(Generator *const generator, const unsigned bound);
+
+static int chance(Generator *const generator, const unsigned percent);
+
+static void emit(Generator *const generator, const char *const format, ...) __attribute__((format(printf, 2, 3)));
+
+static void emitIndent(Generator *const generator, const unsigned depth);
+
+static void emitType(Generator *const generator);
+
+static void emitVariable(Generator *const generator);
+
+static void emitConstant(Generator *const generator);
+
+static void emitExpression(Generator *const generator, const unsigned depth);
+
+static void emitStatement(Generator *const generator, const unsigned depth);
+
+static void emitBlock(Generator *const generator, const unsigned depth);
+
+static void emitStruct(Generator *const generator);
+
+static void emitEnum(Generator *const generator);
+
+static void emitTable(Generator *const generator);
+
+static void emitFunction(Generator *const generator);
+
+static int parseSize(const char *const text, uint64_t *const size);
+
+/*****************************************************************************************************
+                                PRIVATE GENCORPUS FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Returns the next number of a xorshift64* generator, which gives the same sequence on every
+ * platform for the same seed.
+ *
+ * @param generator The generator.
+ *
+ * @return The next random number.
+ */
+static uint64_t nextRandom(Generator *const generator)
+{
+    generator->state ^= generator->state >> 12;
+    generator->state ^= generator->state << 25;
+    generator->state ^= generator->state >> 27;
+    return generator->state * 0x2545F4914F6CDD1Dull;
+}
+
+/**
+ * Returns a random number below a bound.
+ *
+ * @param generator The generator.
+ *
+ * @param bound The bound, greater than 0.
+ *
+ * @return A number in `[0, bound)`.
+ */
+static unsigned randomBelow(Generator *const generator, const unsigned bound)
+{
+    return (unsigned)((nextRandom(generator) >> 32) % bound);
+}
+
+/**
+ * Decides randomly whether to do something.
+ *
+ * @param generator The generator.
+ *
+ * @param percent The chance in percent.
+ *
+ * @return 1 with the given chance, 0 otherwise.
+ */
+static int chance(Generator *const generator, const unsigned percent)
+{
+    return randomBelow(generator, 100) < percent;
+}
+
+/**
+ * Writes formatted text to the corpus and counts its bytes.
+ *
+ * @param generator The generator.
+ *
+ * @param format The `printf` format.
+ */
+static void emit(Generator *const generator, const char *const format, ...)
+{
+    va_list arguments;
+    va_start(arguments, format);
+    int written = vfprintf(generator->file, format, arguments);
+    va_end(arguments);
+    if (written > 0)
+    {
+        generator->written += (uint64_t)written;
+    }
+}
+
+/**
+ * Writes the indentation of a nesting depth.
+ *
+ * @param generator The generator.
+ *
+ * @param depth The nesting depth.
+ */
+static void emitIndent(Generator *const generator, const unsigned depth)
+{
+    for (unsigned i = 0; i < depth; i++)
+    {
+        emit(generator, "    ");
+    }
+}
+
+/**
+ * Writes a type, a basic type or one of the structs declared so far.
+ *
+ * @param generator The generator.
+ */
+static void emitType(Generator *const generator)
+{
+    static const char *const basicTypes[] = {
+        "int", "unsigned int", "long", "unsigned long", "char", "short", "double", "float", "const char", "unsigned char",
+    };
+
+    if (generator->structCount > 0 && chance(generator, 25))
+    {
+        unsigned window = generator->structCount < REFERENCE_WINDOW ? generator->structCount : REFERENCE_WINDOW;
+        emit(generator, "struct s%u", generator->structCount - 1 - randomBelow(generator, window));
+        return;
+    }
+    emit(generator, "%s", basicTypes[randomBelow(generator, sizeof(basicTypes) / sizeof(basicTypes[0]))]);
+}
+
+/**
+ * Writes a parameter or local of the function being written.
+ *
+ * @param generator The generator.
+ */
+static void emitVariable(Generator *const generator)
+{
+    unsigned count = generator->paramCount + generator->localCount;
+    if (count == 0)
+    {
+        emit(generator, "g%u", randomBelow(generator, 16));
+        return;
+    }
+
+    unsigned index = randomBelow(generator, count);
+    if (index < generator->paramCount)
+    {
+        emit(generator, "p%u", index);
+    }
+    else
+    {
+        emit(generator, "l%u", index - generator->paramCount);
+    }
+}
+
+/**
+ * Writes a literal: a decimal, hexadecimal or floating point number, a character or a string.
+ *
+ * @param generator The generator.
+ */
+static void emitConstant(Generator *const generator)
+{
+    static const char *const strings[] = {
+        "\"\"", "\"ok\"", "\"out of memory\\n\"", "\"%s: %d\\n\"", "\"unexpected token\"", "\"\\tindex %u\"",
+    };
+    static const char *const characters[] = {
+        "'a'", "'0'", "'\\n'", "'\\''", "' '",
+    };
+
+    switch (randomBelow(generator, 10))
+    {
+        case 0:
+            emit(generator, "0x%X", randomBelow(generator, 65536));
+            break;
+        case 1:
+            //The lexer reads a leading 0 as the start of a hexadecimal or octal number
+            emit(generator, "%u.%u", randomBelow(generator, 999) + 1, randomBelow(generator, 100));
+            break;
+        case 2:
+            emit(generator, "%s", characters[randomBelow(generator, sizeof(characters) / sizeof(characters[0]))]);
+            break;
+        case 3:
+            emit(generator, "%s", strings[randomBelow(generator, sizeof(strings) / sizeof(strings[0]))]);
+            break;
+        default:
+            emit(generator, "%u", randomBelow(generator, chance(generator, 80) ? 16 : 100000));
+            break;
+    }
+}
+
+/**
+ * Writes an expression. Deeper expressions are more likely to be plain variables and literals,
+ * so expressions stay short like in real code.
+ *
+ * @param generator The generator.
+ *
+ * @param depth The nesting depth of the expression.
+ */
+static void emitExpression(Generator *const generator, const unsigned depth)
+{
+    static const char *const binaryOperators[] = {
+        "+", "-", "*", "/", "%", "<<", ">>", "<", "<=", ">", ">=", "==", "!=", "&", "|", "^", "&&", "||",
+    };
+    static const char *const unaryOperators[] = {
+        "-", "!", "~", "*", "&", "++", "--",
+    };
+
+    unsigned kind = depth >= MAX_EXPRESSION_DEPTH ? randomBelow(generator, 2) : randomBelow(generator, 4 + 10 / (depth + 1));
+    switch (kind)
+    {
+        case 0:
+            emitVariable(generator);
+            break;
+        case 1:
+            emitConstant(generator);
+            break;
+        case 2:
+            //Member access, array indexing or postfix increment
+            emitVariable(generator);
+            switch (randomBelow(generator, 4))
+            {
+                case 0:
+                    emit(generator, "->f%u", randomBelow(generator, 6));
+                    break;
+                case 1:
+                    emit(generator, ".f%u", randomBelow(generator, 6));
+                    break;
+                case 2:
+                    emit(generator, "[");
+                    emitExpression(generator, depth + 1);
+                    emit(generator, "]");
+                    break;
+                default:
+                    emit(generator, "++");
+                    break;
+            }
+            break;
+        case 3:
+            emit(generator, "%s", unaryOperators[randomBelow(generator, sizeof(unaryOperators) / sizeof(unaryOperators[0]))]);
+            emitVariable(generator);
+            break;
+        case 4:
+            //A call to an earlier function
+            if (generator->functionCount == 0)
+            {
+                emit(generator, "puts(");
+                emitExpression(generator, depth + 1);
+                emit(generator, ")");
+                break;
+            }
+            {
+                unsigned window = generator->functionCount < REFERENCE_WINDOW ? generator->functionCount : REFERENCE_WINDOW;
+                emit(generator, "f%u(", generator->functionCount - 1 - randomBelow(generator, window));
+                unsigned argumentCount = randomBelow(generator, 4);
+                for (unsigned i = 0; i < argumentCount; i++)
+                {
+                    emit(generator, i > 0 ? ", " : "");
+                    emitExpression(generator, depth + 1);
+                }
+                emit(generator, ")");
+            }
+            break;
+        case 5:
+            emit(generator, "(");
+            emitExpression(generator, depth + 1);
+            emit(generator, ") ? ");
+            emitExpression(generator, depth + 1);
+            emit(generator, " : ");
+            emitExpression(generator, depth + 1);
+            break;
+        case 6:
+            emit(generator, "sizeof(");
+            emitVariable(generator);
+            emit(generator, ")");
+            break;
+        case 7:
+            emit(generator, "sizeof(");
+            emitType(generator);
+            emit(generator, ")");
+            break;
+        default:
+            if (chance(generator, 30))
+            {
+                emit(generator, "(");
+                emitExpression(generator, depth + 1);
+                emit(generator, ")");
+            }
+            else
+            {
+                emitExpression(generator, depth + 1);
+            }
+            emit(generator, " %s ", binaryOperators[randomBelow(generator, sizeof(binaryOperators) / sizeof(binaryOperators[0]))]);
+            emitExpression(generator, depth + 1);
+            break;
+    }
+}
+
+/**
+ * Writes a statement. Control flow nests up to `MAX_STATEMENT_DEPTH` deep.
+ *
+ * @param generator The generator.
+ *
+ * @param depth The nesting depth of the statement.
+ */
+static void emitStatement(Generator *const generator, const unsigned depth)
+{
+    static const char *const assignmentOperators[] = {
+        "=", "=", "=", "+=", "-=", "|=", "&=", "<<=", "^=",
+    };
+
+    unsigned kind = depth >= MAX_STATEMENT_DEPTH ? randomBelow(generator, 4) : randomBelow(generator, 12);
+    emitIndent(generator, depth);
+    switch (kind)
+    {
+        case 0:
+        case 1:
+            emitVariable(generator);
+            emit(generator, " %s ", assignmentOperators[randomBelow(generator, sizeof(assignmentOperators) / sizeof(assignmentOperators[0]))]);
+            emitExpression(generator, 0);
+            emit(generator, ";\n");
+            break;
+        case 2:
+            emitExpression(generator, 1);
+            emit(generator, ";\n");
+            break;
+        case 3:
+            if (chance(generator, 50))
+            {
+                emit(generator, "return ");
+                emitExpression(generator, 0);
+                emit(generator, ";\n");
+            }
+            else
+            {
+                emit(generator, chance(generator, 50) ? "continue;\n" : "break;\n");
+            }
+            break;
+        case 4:
+        case 5:
+            emit(generator, "if (");
+            emitExpression(generator, 0);
+            emit(generator, ")\n");
+            emitBlock(generator, depth);
+            if (chance(generator, 40))
+            {
+                emitIndent(generator, depth);
+                emit(generator, "else\n");
+                emitBlock(generator, depth);
+            }
+            break;
+        case 6:
+            emit(generator, "for (");
+            emitVariable(generator);
+            emit(generator, " = 0; ");
+            emitVariable(generator);
+            emit(generator, " < %u; ", randomBelow(generator, 256) + 1);
+            emitVariable(generator);
+            emit(generator, "++)\n");
+            emitBlock(generator, depth);
+            break;
+        case 7:
+            emit(generator, "while (");
+            emitExpression(generator, 0);
+            emit(generator, ")\n");
+            emitBlock(generator, depth);
+            break;
+        case 8:
+            emit(generator, "do\n");
+            emitBlock(generator, depth);
+            emitIndent(generator, depth);
+            emit(generator, "while (");
+            emitExpression(generator, 1);
+            emit(generator, ");\n");
+            break;
+        case 9:
+        {
+            emit(generator, "switch (");
+            emitVariable(generator);
+            emit(generator, ")\n");
+            emitIndent(generator, depth);
+            emit(generator, "{\n");
+            unsigned caseCount = randomBelow(generator, 5) + 1;
+            for (unsigned i = 0; i < caseCount; i++)
+            {
+                emitIndent(generator, depth + 1);
+                emit(generator, "case %u:\n", i * (randomBelow(generator, 3) + 1));
+                unsigned statementCount = randomBelow(generator, 3) + 1;
+                for (unsigned j = 0; j < statementCount; j++)
+                {
+                    emitStatement(generator, depth + 2);
+                }
+                emitIndent(generator, depth + 2);
+                emit(generator, "break;\n");
+            }
+            emitIndent(generator, depth + 1);
+            emit(generator, "default:\n");
+            emitStatement(generator, depth + 2);
+            emitIndent(generator, depth);
+            emit(generator, "}\n");
+            break;
+        }
+        case 10:
+            emit(generator, "goto cleanup;\n");
+            break;
+        default:
+            emit(generator, "/* ");
+            emitExpression(generator, 2);
+            emit(generator, " */\n");
+            emitStatement(generator, depth);
+            break;
+    }
+}
+
+/**
+ * Writes a compound statement of a few statements.
+ *
+ * @param generator The generator.
+ *
+ * @param depth The nesting depth of the braces.
+ */
+static void emitBlock(Generator *const generator, const unsigned depth)
+{
+    emitIndent(generator, depth);
+    emit(generator, "{\n");
+    unsigned statementCount = randomBelow(generator, 4) + 1;
+    for (unsigned i = 0; i < statementCount; i++)
+    {
+        emitStatement(generator, depth + 1);
+    }
+    emitIndent(generator, depth);
+    emit(generator, "}\n");
+}
+
+/**
+ * Writes a struct declaration, with pointers, arrays, bit fields and nested unions among its
+ * members.
+ *
+ * @param generator The generator.
+ */
+static void emitStruct(Generator *const generator)
+{
+    unsigned index = generator->structCount;
+    int isTypedef = chance(generator, 30);
+    emit(generator, "%sstruct s%u\n{\n", isTypedef ? "typedef " : "", index);
+
+    unsigned memberCount = randomBelow(generator, 6) + 2;
+    for (unsigned i = 0; i < memberCount; i++)
+    {
+        emit(generator, "    ");
+        switch (randomBelow(generator, 6))
+        {
+            case 0:
+                emit(generator, "struct s%u *f%u;\n", index, i);
+                break;
+            case 1:
+                emitType(generator);
+                emit(generator, " f%u[%u];\n", i, randomBelow(generator, 64) + 1);
+                break;
+            case 2:
+                emit(generator, "unsigned int f%u : %u;\n", i, randomBelow(generator, 16) + 1);
+                break;
+            case 3:
+                emit(generator, "union\n    {\n        int f%u;\n        double g%u;\n        void *h%u;\n    } u%u;\n", i, i, i, i);
+                break;
+            default:
+                emitType(generator);
+                emit(generator, chance(generator, 30) ? " *f%u;\n" : " f%u;\n", i);
+                break;
+        }
+    }
+    emit(generator, isTypedef ? "} S%u;\n\n" : "};\n\n", index);
+    generator->structCount++;
+}
+
+/**
+ * Writes an enum declaration, some of its constants with explicit values.
+ *
+ * @param generator The generator.
+ */
+static void emitEnum(Generator *const generator)
+{
+    unsigned index = generator->enumCount++;
+    emit(generator, "enum e%u\n{\n", index);
+    unsigned constantCount = randomBelow(generator, 12) + 2;
+    for (unsigned i = 0; i < constantCount; i++)
+    {
+        emit(generator, i > 0 ? ",\n    E%u_%u" : "    E%u_%u", index, i);
+        if (chance(generator, 25))
+        {
+            emit(generator, " = %u", i * 4);
+        }
+    }
+    emit(generator, "\n};\n\n");
+}
+
+/**
+ * Writes a large initialized table: an array of numbers, of strings or of structs.
+ *
+ * @param generator The generator.
+ */
+static void emitTable(Generator *const generator)
+{
+    unsigned index = generator->tableCount++;
+    unsigned entryCount = randomBelow(generator, chance(generator, 10) ? 1024 : 128) + 8;
+    switch (randomBelow(generator, 3))
+    {
+        case 0:
+            emit(generator, "static const unsigned int t%u[%u] = {", index, entryCount);
+            for (unsigned i = 0; i < entryCount; i++)
+            {
+                //The lexer reads hexadecimal numbers into an int
+                emit(generator, "%s%s0x%07X", i > 0 ? "," : "", i % 8 == 0 ? "\n    " : " ", (unsigned)nextRandom(generator) & 0xFFFFFFFu);
+            }
+            break;
+        case 1:
+            emit(generator, "static const char *t%u[] = {", index);
+            for (unsigned i = 0; i < entryCount; i++)
+            {
+                emit(generator, "%s%s\"entry %u of t%u\"", i > 0 ? "," : "", i % 4 == 0 ? "\n    " : " ", i, index);
+            }
+            break;
+        default:
+            emit(generator, "static const struct\n{\n    int key;\n    const char *name;\n    double weight;\n} t%u[] = {", index);
+            for (unsigned i = 0; i < entryCount; i++)
+            {
+                emit(generator, "%s\n    {%u, \"k%u\", %u.%u}", i > 0 ? "," : "", randomBelow(generator, 100000), i, randomBelow(generator, 99) + 1, randomBelow(generator, 1000));
+            }
+            break;
+    }
+    emit(generator, "\n};\n\n");
+}
+
+/**
+ * Writes a function definition with parameters, local declarations and nested control flow.
+ *
+ * @param generator The generator.
+ */
+static void emitFunction(Generator *const generator)
+{
+    unsigned index = generator->functionCount;
+    generator->paramCount = randomBelow(generator, 5);
+    generator->localCount = randomBelow(generator, 6) + 1;
+
+    if (chance(generator, 40))
+    {
+        emit(generator, "static ");
+    }
+    emitType(generator);
+    emit(generator, chance(generator, 20) ? " *f%u(" : " f%u(", index);
+    if (generator->paramCount == 0)
+    {
+        emit(generator, "void");
+    }
+    for (unsigned i = 0; i < generator->paramCount; i++)
+    {
+        emit(generator, i > 0 ? ", " : "");
+        emitType(generator);
+        emit(generator, chance(generator, 40) ? " *p%u" : " p%u", i);
+    }
+    emit(generator, ")\n{\n");
+
+    for (unsigned i = 0; i < generator->localCount; i++)
+    {
+        emit(generator, "    ");
+        emitType(generator);
+        if (chance(generator, 50))
+        {
+            emit(generator, " l%u = ", i);
+            emitExpression(generator, 2);
+            emit(generator, ";\n");
+        }
+        else
+        {
+            emit(generator, " l%u;\n", i);
+        }
+    }
+
+    unsigned statementCount = randomBelow(generator, 8) + 2;
+    for (unsigned i = 0; i < statementCount; i++)
+    {
+        emitStatement(generator, 1);
+    }
+    emit(generator, "cleanup:\n    return ");
+    emitExpression(generator, 1);
+    emit(generator, ";\n}\n\n");
+
+    generator->paramCount = 0;
+    generator->localCount = 0;
+    generator->functionCount++;
+}
+
+/**
+ * Parses a size with an optional `K`, `M` or `G` suffix for powers of 1024.
+ *
+ * @param text The size, e.g. `10K` or `1G`.
+ *
+ * @param size Set to the size in bytes.
+ *
+ * @return 1 on success, 0 if the text is not a size.
+ */
+static int parseSize(const char *const text, uint64_t *const size)
+{
+    char *end;
+    unsigned long long value = strtoull(text, &end, 10);
+    if (end == text)
+    {
+        return 0;
+    }
+
+    switch (*end)
+    {
+        case 'K':
+        case 'k':
+            value *= 1024ull;
+            end++;
+            break;
+        case 'M':
+        case 'm':
+            value *= 1024ull * 1024;
+            end++;
+            break;
+        case 'G':
+        case 'g':
+            value *= 1024ull * 1024 * 1024;
+            end++;
+            break;
+        default:
+            break;
+    }
+    if (*end != '\0' || value == 0)
+    {
+        return 0;
+    }
+
+    *size = value;
+    return 1;
+}
+
+/*****************************************************************************************************
+                                PUBLIC GENCORPUS FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Writes a synthetic C file of roughly the requested size for the benchmarks: structs, enums,
+ * large initialized tables and functions with nested control flow, in the subset of C the
+ * parser accepts. The same size and seed always give the same file.
+ *
+ * Usage: gencorpus <size>[K|M|G] <output.c> [--seed=<n>]
+ *
+ * The file stops at the first top level declaration that reaches the size, so it is at most
+ * a few kilobytes larger.
+ *
+ * @return 0 on success, 1 on failure.
+ */
+int main(int argc, char **argv)
+{
+    uint64_t size = 0;
+    const char *output = NULL;
+    uint64_t seed = DEFAULT_SEED;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--seed=", 7) == 0)
+        {
+            char *end;
+            seed = strtoull(argv[i] + 7, &end, 10);
+            if (end == argv[i] + 7 || *end != '\0')
+            {
+                fprintf(stderr, "Invalid seed %s!\n", argv[i] + 7);
+                return 1;
+            }
+        }
+        else if (size == 0)
+        {
+            if (!parseSize(argv[i], &size))
+            {
+                fprintf(stderr, "Invalid size %s!\n", argv[i]);
+                return 1;
+            }
+        }
+        else if (output == NULL)
+        {
+            output = argv[i];
+        }
+        else
+        {
+            fprintf(stderr, "Unexpected argument %s!\n", argv[i]);
+            return 1;
+        }
+    }
+
+    if (size == 0 || output == NULL)
+    {
+        fprintf(stderr, "Usage: %s <size>[K|M|G] <output.c> [--seed=<n>]\n", argv[0]);
+        return 1;
+    }
+
+    Generator generator;
+    memset(&generator, 0, sizeof(generator));
+    //Spread the seed over the state with a splitmix64 step, xorshift never leaves a zero state
+    generator.state = seed + 0x9E3779B97F4A7C15ull;
+    generator.state = (generator.state ^ (generator.state >> 30)) * 0xBF58476D1CE4E5B9ull;
+    generator.state = (generator.state ^ (generator.state >> 27)) * 0x94D049BB133111EBull;
+    generator.state ^= generator.state >> 31;
+    if (generator.state == 0)
+    {
+        generator.state = 1;
+    }
+    generator.file = fopen(output, "w");
+    if (generator.file == NULL)
+    {
+        fprintf(stderr, "Error opening output file %s!\n", output);
+        return 1;
+    }
+
+    //Line comments would need \r\n endings for the lexer, so only block comments are written
+    emit(&generator, "/* Generated by bench/gencorpus with seed %llu */\n\n", (unsigned long long)seed);
+    for (unsigned i = 0; i < 16; i++)
+    {
+        emit(&generator, "int g%u;\n", i);
+    }
+    emit(&generator, "\n");
+
+    while (generator.written < size)
+    {
+        unsigned kind = randomBelow(&generator, 100);
+        if (kind < 12)
+        {
+            emitStruct(&generator);
+        }
+        else if (kind < 18)
+        {
+            emitEnum(&generator);
+        }
+        else if (kind < 24)
+        {
+            emitTable(&generator);
+        }
+        else
+        {
+            emitFunction(&generator);
+        }
+    }
+
+    int failed = ferror(generator.file);
+    if (fclose(generator.file) != 0 || failed)
+    {
+        fprintf(stderr, "Error writing output file %s!\n", output);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,908 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <pthread.h>
+
+#include "lexer.h"
+#include "parser.h"
+#include "token_queue.h"
+#include "thread_pool.h"
+#include "trace.h"
+
+/*****************************************************************************************************
+                            PRIVATE RUNBENCH FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Defaults of the command line options
+ */
+#define DEFAULT_REPETITIONS 10
+#define DEFAULT_WARMUPS 1
+#define DEFAULT_THRESHOLD 5.0
+
+/**
+ * Number of tokens the token array starts with
+ */
+#define INITIAL_TOKEN_CAPACITY 1024
+
+/**
+ * Number of tokens the queue of the pipelined runs holds, the same as the compiler's
+ */
+#define PIPELINE_QUEUE_CAPACITY 4096
+
+/**
+ * Enumeration of the measured phases.
+ *
+ * - `PHASE_LEX`: Lexing the file into an array of tokens.
+ * - `PHASE_PARSE`: Creating a parser over the tokens and building the AST.
+ */
+typedef enum benchPhase
+{
+    PHASE_LEX,
+    PHASE_PARSE,
+    PHASE_COUNT,
+} BenchPhase;
+
+/**
+ * Represents a throughput measured over the repetitions.
+ *
+ * - `mean`: The mean of the repetitions.
+ * - `margin`: The half width of the 95% confidence interval of the mean.
+ */
+typedef struct throughput
+{
+    double mean;            /** The mean throughput. */
+    double margin;          /** Half width of the 95% confidence interval. */
+} Throughput;
+
+/**
+ * Represents the results of one benchmarked file.
+ *
+ * - `name`: The file name without its directories, which baselines are matched by.
+ * - `bytes`: The size of the file.
+ * - `tokens`: The number of tokens the lexer produced, whitespace and comments included.
+ * - `megabytes`: The MB/s of each phase, indexed by `BenchPhase`.
+ * - `tokensPerSecond`: The tokens/s of each phase, indexed by `BenchPhase`.
+ */
+typedef struct benchResult
+{
+    char name[256];                         /** The base name of the file. */
+    size_t bytes;                           /** The size of the file. */
+    size_t tokens;                          /** The number of tokens. */
+    Throughput megabytes[PHASE_COUNT];      /** MB/s of the phases. */
+    Throughput tokensPerSecond[PHASE_COUNT];/** Tokens/s of the phases. */
+} BenchResult;
+
+/**
+ * Represents the results of one file benchmarked with `--pipeline`.
+ *
+ * - `name`: The file name without its directories.
+ * - `bytes`: The size of the file.
+ * - `tokens`: The number of tokens the lexer produced, whitespace and comments included.
+ * - `sequential`: The milliseconds of lexing the whole file, then parsing it.
+ * - `pipelined`: The milliseconds of lexing on a second thread while the parser reads the tokens.
+ */
+typedef struct pipelineResult
+{
+    char name[256];                         /** The base name of the file. */
+    size_t bytes;                           /** The size of the file. */
+    size_t tokens;                          /** The number of tokens. */
+    Throughput sequential;                  /** Milliseconds of the sequential front end. */
+    Throughput pipelined;                   /** Milliseconds of the pipelined front end. */
+} PipelineResult;
+
+/**
+ * Represents the lexer thread of a pipelined run.
+ *
+ * - `contents`: The contents of the file.
+ * - `queue`: The queue the tokens are pushed to.
+ * - `tokens`: The lexed tokens, owned by the run until the parser is deleted.
+ * - `tokenCount`: The number of lexed tokens.
+ * - `failed`: 1 if lexing failed.
+ */
+typedef struct lexerThread
+{
+    const char *contents;                   /** The contents of the file. */
+    TokenQueue *queue;                      /** The queue the tokens are pushed to. */
+    Token **tokens;                         /** The lexed tokens. */
+    size_t tokenCount;                      /** The number of lexed tokens. */
+    int failed;                             /** Whether lexing failed. */
+} LexerThread;
+
+static const char *const phaseNames[PHASE_COUNT] = {
+    "lex",
+    "parse",
+};
+
+static char *readFile(const char *const fileName, size_t *const size);
+
+static Token **lexTokens(const char *const contents, TokenQueue *const queue, size_t *const count, int *const failed);
+
+static void *runLexerThread(void *argument);
+
+static int runSequential(const char *const contents, size_t *const tokenCount);
+
+static int runPipelined(const char *const contents, size_t *const tokenCount);
+
+static double getStudentT(const size_t degrees);
+
+static Throughput summarize(const double *const samples, const size_t count);
+
+static int benchFile(const char *const fileName, const size_t repetitions, const size_t warmups, BenchResult *const result);
+
+static void printResult(const BenchResult *const result);
+
+static int benchPipeline(const char *const fileName, const size_t repetitions, const size_t warmups, PipelineResult *const result);
+
+static void printPipelineResult(const PipelineResult *const result);
+
+static int saveBaseline(const char *const fileName, const BenchResult *const results, const size_t count, const size_t repetitions);
+
+static int findJsonNumber(const char *const object, const char *const end, const char *const key, double *const value);
+
+static int compareBaseline(const char *const fileName, const BenchResult *const results, const size_t count, const double threshold);
+
+/*****************************************************************************************************
+                                PRIVATE RUNBENCH FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Reads a whole file into memory.
+ *
+ * @param fileName The file to read.
+ *
+ * @param size Set to the size of the file.
+ *
+ * @return The null terminated contents, or NULL on failure. The caller frees them.
+ */
+static char *readFile(const char *const fileName, size_t *const size)
+{
+    FILE *file = fopen(fileName, "rb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Error opening file %s!\n", fileName);
+        return NULL;
+    }
+
+    char *contents = NULL;
+    long length = -1;
+    if (fseek(file, 0, SEEK_END) == 0)
+    {
+        length = ftell(file);
+    }
+    if (length >= 0 && fseek(file, 0, SEEK_SET) == 0)
+    {
+        contents = malloc((size_t)length + 1);
+    }
+    if (contents == NULL || fread(contents, 1, (size_t)length, file) != (size_t)length)
+    {
+        fprintf(stderr, "Error reading file %s!\n", fileName);
+        free(contents);
+        fclose(file);
+        return NULL;
+    }
+    fclose(file);
+
+    contents[length] = '\0';
+    *size = (size_t)length;
+    return contents;
+}
+
+/**
+ * Lexes a file into an array of tokens the same way the compiler does.
+ *
+ * @param contents The contents of the file.
+ *
+ * @param queue The queue every token is also pushed to as soon as it is lexed, or NULL.
+ *
+ * @param count Set to the number of tokens.
+ *
+ * @param failed Set to 1 if lexing fails, 0 otherwise.
+ *
+ * @return The tokens, ending with the end of file token unless lexing failed, or NULL if they
+ *         cannot be allocated. They are returned even if lexing failed, since a parser reading
+ *         the queue may still hold them. The caller frees them with `deleteTokens`.
+ */
+static Token **lexTokens(const char *const contents, TokenQueue *const queue, size_t *const count, int *const failed)
+{
+    *count = 0;
+    *failed = 1;
+    size_t capacity = INITIAL_TOKEN_CAPACITY;
+    Token **tokens = allocateMemory(MEMORY_TOKENS, capacity * sizeof(Token *));
+    Lexer *lexer = createLexer(contents, 0);
+    if (tokens == NULL || lexer == NULL)
+    {
+        fprintf(stderr, "Failed to create Lexer.\n");
+        releaseMemory(MEMORY_TOKENS, tokens);
+        deleteLexer(lexer);
+        return NULL;
+    }
+
+    size_t tokenCount = 0;
+    while (1)
+    {
+        Token *token = lex(lexer);
+        if (token == NULL)
+        {
+            break;
+        }
+
+        if (tokenCount >= capacity)
+        {
+            capacity *= 2;
+            Token **newTokens = reallocateMemory(MEMORY_TOKENS, tokens, capacity * sizeof(Token *));
+            if (newTokens == NULL)
+            {
+                deleteToken(token);
+                break;
+            }
+            tokens = newTokens;
+        }
+
+        tokens[tokenCount++] = token;
+        if (queue != NULL)
+        {
+            pushTokenQueue(queue, token);
+        }
+        if (token->type == TOKEN_EOF)
+        {
+            break;
+        }
+    }
+
+    //The benchmark only makes sense on input the lexer accepts
+    *failed = lexer->diagnostics->count > 0 || tokenCount == 0 || tokens[tokenCount - 1]->type != TOKEN_EOF;
+    deleteLexer(lexer);
+    if (*failed)
+    {
+        fprintf(stderr, "Lexing failed!\n");
+    }
+
+    *count = tokenCount;
+    return tokens;
+}
+
+/**
+ * Lexes the file of a pipelined run and closes its queue afterwards. Used with `pthread_create`.
+ *
+ * @param argument The `LexerThread` of the run. Its tokens and result are set.
+ *
+ * @return Always NULL.
+ */
+static void *runLexerThread(void *argument)
+{
+    LexerThread *thread = argument;
+    thread->tokens = lexTokens(thread->contents, thread->queue, &thread->tokenCount, &thread->failed);
+    closeTokenQueue(thread->queue);
+
+    return NULL;
+}
+
+/**
+ * Runs the front end the default way: lexes the whole file, then parses the tokens.
+ *
+ * @param contents The contents of the file.
+ *
+ * @param tokenCount Set to the number of tokens.
+ *
+ * @return 1 on success, 0 if the file cannot be lexed or parsed.
+ */
+static int runSequential(const char *const contents, size_t *const tokenCount)
+{
+    int failed;
+    Token **tokens = lexTokens(contents, NULL, tokenCount, &failed);
+    if (tokens == NULL)
+    {
+        return 0;
+    }
+
+    Parser *parser = failed ? NULL : createParser(tokens, *tokenCount);
+    int success = parser != NULL && parse(parser);
+    deleteParser(parser);
+    deleteTokens(tokens, *tokenCount);
+    return success;
+}
+
+/**
+ * Runs the front end the way `--pipeline` does: lexes the file on a second thread, which pushes
+ * the tokens to a queue the parser reads while it parses.
+ *
+ * @param contents The contents of the file.
+ *
+ * @param tokenCount Set to the number of tokens.
+ *
+ * @return 1 on success, 0 if the file cannot be lexed or parsed or the thread cannot be started.
+ */
+static int runPipelined(const char *const contents, size_t *const tokenCount)
+{
+    LexerThread thread;
+    memset(&thread, 0, sizeof(LexerThread));
+    thread.contents = contents;
+    thread.queue = createTokenQueue(PIPELINE_QUEUE_CAPACITY);
+    pthread_t lexerThread;
+    if (thread.queue == NULL || pthread_create(&lexerThread, NULL, runLexerThread, &thread) != 0)
+    {
+        fprintf(stderr, "Failed to start the lexer thread.\n");
+        deleteTokenQueue(thread.queue);
+        return 0;
+    }
+
+    Parser *parser = createStreamingParser(thread.queue);
+    int success = parser != NULL && parse(parser);
+
+    //The lexer thread can only finish once the queue has room for its last tokens
+    while (popTokenQueue(thread.queue) != NULL);
+    pthread_join(lexerThread, NULL);
+    deleteParser(parser);
+    deleteTokenQueue(thread.queue);
+    if (thread.tokens != NULL)
+    {
+        deleteTokens(thread.tokens, thread.tokenCount);
+    }
+
+    *tokenCount = thread.tokenCount;
+    return success && !thread.failed;
+}
+
+/**
+ * Returns the critical value of Student's t distribution for a two sided 95% confidence interval.
+ *
+ * @param degrees The degrees of freedom, the number of samples minus one.
+ *
+ * @return The critical value.
+ */
+static double getStudentT(const size_t degrees)
+{
+    static const double values[] = {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
+    };
+
+    if (degrees == 0)
+    {
+        return 0.0;
+    }
+    if (degrees <= sizeof(values) / sizeof(values[0]))
+    {
+        return values[degrees - 1];
+    }
+    return degrees <= 60 ? 2.000 : 1.960;
+}
+
+/**
+ * Computes the mean of samples and the 95% confidence interval around it.
+ *
+ * @param samples The samples.
+ *
+ * @param count The number of samples, at least 1.
+ *
+ * @return The mean and the half width of the interval, 0 for a single sample.
+ */
+static Throughput summarize(const double *const samples, const size_t count)
+{
+    Throughput throughput = {0.0, 0.0};
+    for (size_t i = 0; i < count; i++)
+    {
+        throughput.mean += samples[i];
+    }
+    throughput.mean /= (double)count;
+
+    if (count > 1)
+    {
+        double squares = 0.0;
+        for (size_t i = 0; i < count; i++)
+        {
+            squares += (samples[i] - throughput.mean) * (samples[i] - throughput.mean);
+        }
+        double deviation = sqrt(squares / (double)(count - 1));
+        throughput.margin = getStudentT(count - 1) * deviation / sqrt((double)count);
+    }
+    return throughput;
+}
+
+/**
+ * Lexes and parses a file repeatedly, timing each phase of every repetition.
+ *
+ * @param fileName The file to benchmark.
+ *
+ * @param repetitions The number of timed repetitions.
+ *
+ * @param warmups The number of untimed repetitions before them.
+ *
+ * @param result Set to the throughputs.
+ *
+ * @return 1 on success, 0 if the file cannot be read, lexed or parsed.
+ */
+static int benchFile(const char *const fileName, const size_t repetitions, const size_t warmups, BenchResult *const result)
+{
+    size_t size;
+    char *contents = readFile(fileName, &size);
+    if (contents == NULL)
+    {
+        return 0;
+    }
+
+    double *samples = malloc(2 * PHASE_COUNT * repetitions * sizeof(double));
+    if (samples == NULL)
+    {
+        fprintf(stderr, "Memory allocation for the samples failed!\n");
+        free(contents);
+        return 0;
+    }
+
+    memset(result, 0, sizeof(BenchResult));
+    const char *slash = strrchr(fileName, '/');
+    strncat(result->name, slash != NULL ? slash + 1 : fileName, sizeof(result->name) - 1);
+    result->bytes = size;
+
+    int success = 1;
+    for (size_t run = 0; run < warmups + repetitions && success; run++)
+    {
+        uint64_t start = getTraceTime();
+        size_t tokenCount = 0;
+        int failed;
+        Token **tokens = lexTokens(contents, NULL, &tokenCount, &failed);
+        uint64_t lexed = getTraceTime();
+        if (tokens == NULL || failed)
+        {
+            if (tokens != NULL)
+            {
+                deleteTokens(tokens, tokenCount);
+            }
+            success = 0;
+            break;
+        }
+
+        Parser *parser = createParser(tokens, tokenCount);
+        success = parser != NULL && parse(parser);
+        uint64_t parsed = getTraceTime();
+        if (!success)
+        {
+            fprintf(stderr, "Parsing %s failed!\n", fileName);
+        }
+        deleteParser(parser);
+        deleteTokens(tokens, tokenCount);
+
+        if (run < warmups || !success)
+        {
+            continue;
+        }
+
+        //Each phase keeps its MB/s samples, then its tokens/s samples
+        size_t index = run - warmups;
+        uint64_t durations[PHASE_COUNT] = {lexed - start, parsed - lexed};
+        for (size_t phase = 0; phase < PHASE_COUNT; phase++)
+        {
+            double seconds = (durations[phase] > 0 ? (double)durations[phase] : 1.0) / 1e9;
+            samples[(2 * phase) * repetitions + index] = (double)size / 1e6 / seconds;
+            samples[(2 * phase + 1) * repetitions + index] = (double)tokenCount / seconds;
+        }
+        result->tokens = tokenCount;
+    }
+
+    if (success)
+    {
+        for (size_t phase = 0; phase < PHASE_COUNT; phase++)
+        {
+            result->megabytes[phase] = summarize(samples + (2 * phase) * repetitions, repetitions);
+            result->tokensPerSecond[phase] = summarize(samples + (2 * phase + 1) * repetitions, repetitions);
+        }
+    }
+
+    free(samples);
+    free(contents);
+    return success;
+}
+
+/**
+ * Prints the throughputs of a file as a row of the result table.
+ *
+ * @param result The results of the file.
+ */
+static void printResult(const BenchResult *const result)
+{
+    printf("%-20s %12zu %10zu", result->name, result->bytes, result->tokens);
+    for (size_t phase = 0; phase < PHASE_COUNT; phase++)
+    {
+        printf("  %8.2f ± %-6.2f %8.3f ± %-6.3f", result->megabytes[phase].mean, result->megabytes[phase].margin,
+               result->tokensPerSecond[phase].mean / 1e6, result->tokensPerSecond[phase].margin / 1e6);
+    }
+    printf("\n");
+}
+
+/**
+ * Runs the front end on a file repeatedly, alternating the sequential and the pipelined way, and
+ * times the whole front end of every repetition.
+ *
+ * @param fileName The file to benchmark.
+ *
+ * @param repetitions The number of timed repetitions of each way.
+ *
+ * @param warmups The number of untimed repetitions of each way before them.
+ *
+ * @param result Set to the times.
+ *
+ * @return 1 on success, 0 if the file cannot be read, lexed or parsed.
+ */
+static int benchPipeline(const char *const fileName, const size_t repetitions, const size_t warmups, PipelineResult *const result)
+{
+    size_t size;
+    char *contents = readFile(fileName, &size);
+    if (contents == NULL)
+    {
+        return 0;
+    }
+
+    double *samples = malloc(2 * repetitions * sizeof(double));
+    if (samples == NULL)
+    {
+        fprintf(stderr, "Memory allocation for the samples failed!\n");
+        free(contents);
+        return 0;
+    }
+
+    memset(result, 0, sizeof(PipelineResult));
+    const char *slash = strrchr(fileName, '/');
+    strncat(result->name, slash != NULL ? slash + 1 : fileName, sizeof(result->name) - 1);
+    result->bytes = size;
+
+    //Alternating the two ways spreads any drift of the machine over both
+    int success = 1;
+    for (size_t run = 0; run < warmups + repetitions && success; run++)
+    {
+        uint64_t start = getTraceTime();
+        success = runSequential(contents, &result->tokens);
+        uint64_t sequential = getTraceTime();
+        success = success && runPipelined(contents, &result->tokens);
+        uint64_t pipelined = getTraceTime();
+        if (!success)
+        {
+            fprintf(stderr, "Parsing %s failed!\n", fileName);
+        }
+        else if (run >= warmups)
+        {
+            samples[run - warmups] = (double)(sequential - start) / 1e6;
+            samples[repetitions + run - warmups] = (double)(pipelined - sequential) / 1e6;
+        }
+    }
+
+    if (success)
+    {
+        result->sequential = summarize(samples, repetitions);
+        result->pipelined = summarize(samples + repetitions, repetitions);
+    }
+
+    free(samples);
+    free(contents);
+    return success;
+}
+
+/**
+ * Prints the times of a file benchmarked with `--pipeline` as a row of the result table.
+ *
+ * @param result The results of the file.
+ */
+static void printPipelineResult(const PipelineResult *const result)
+{
+    printf("%-20s %12zu %10zu  %10.3f ± %-8.3f %10.3f ± %-8.3f %7.2fx\n", result->name, result->bytes, result->tokens,
+           result->sequential.mean, result->sequential.margin, result->pipelined.mean, result->pipelined.margin,
+           result->pipelined.mean > 0.0 ? result->sequential.mean / result->pipelined.mean : 0.0);
+}
+
+/**
+ * Writes the results as a baseline JSON file, one object per file.
+ *
+ * @param fileName The file to write.
+ *
+ * @param results The results.
+ *
+ * @param count The number of results.
+ *
+ * @param repetitions The number of repetitions the results were measured with.
+ *
+ * @return 1 on success, 0 on failure.
+ */
+static int saveBaseline(const char *const fileName, const BenchResult *const results, const size_t count, const size_t repetitions)
+{
+    FILE *file = fopen(fileName, "w");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Error opening baseline file %s!\n", fileName);
+        return 0;
+    }
+
+    fprintf(file, "{\n  \"repetitions\": %zu,\n  \"results\": [", repetitions);
+    for (size_t i = 0; i < count; i++)
+    {
+        const BenchResult *result = &results[i];
+        fprintf(file, "%s\n    {\"name\": \"%s\", \"bytes\": %zu, \"tokens\": %zu", i > 0 ? "," : "", result->name, result->bytes, result->tokens);
+        for (size_t phase = 0; phase < PHASE_COUNT; phase++)
+        {
+            fprintf(file, ", \"%sMBps\": %.4f, \"%sMBpsMargin\": %.4f, \"%sTokensPerSecond\": %.1f",
+                    phaseNames[phase], result->megabytes[phase].mean, phaseNames[phase], result->megabytes[phase].margin,
+                    phaseNames[phase], result->tokensPerSecond[phase].mean);
+        }
+        fprintf(file, "}");
+    }
+    fprintf(file, "\n  ]\n}\n");
+
+    int success = !ferror(file);
+    if (fclose(file) != 0 || !success)
+    {
+        fprintf(stderr, "Error writing baseline file %s!\n", fileName);
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * Finds a number in a flat JSON object written by `saveBaseline`.
+ *
+ * @param object The opening brace of the object.
+ *
+ * @param end The closing brace of the object.
+ *
+ * @param key The key of the number.
+ *
+ * @param value Set to the number.
+ *
+ * @return 1 if the key was found with a number, 0 otherwise.
+ */
+static int findJsonNumber(const char *const object, const char *const end, const char *const key, double *const value)
+{
+    char quoted[64];
+    snprintf(quoted, sizeof(quoted), "\"%s\"", key);
+    const char *found = strstr(object, quoted);
+    if (found == NULL || found > end)
+    {
+        return 0;
+    }
+
+    const char *colon = found + strlen(quoted);
+    while (*colon == ' ' || *colon == ':')
+    {
+        colon++;
+    }
+    char *numberEnd;
+    *value = strtod(colon, &numberEnd);
+    return numberEnd != colon && numberEnd <= end;
+}
+
+/**
+ * Compares the results with a baseline file written by `--save-baseline`. A phase regresses if
+ * its mean MB/s is more than the threshold below the baseline and the confidence intervals of the
+ * two do not overlap, so noise on a busy machine is not reported. Files missing from the baseline
+ * are reported and skipped.
+ *
+ * @param fileName The baseline file.
+ *
+ * @param results The results.
+ *
+ * @param count The number of results.
+ *
+ * @param threshold The allowed slowdown in percent.
+ *
+ * @return 1 if no phase regressed, 0 if one did, -1 if the baseline cannot be read.
+ */
+static int compareBaseline(const char *const fileName, const BenchResult *const results, const size_t count, const double threshold)
+{
+    size_t size;
+    char *baseline = readFile(fileName, &size);
+    if (baseline == NULL)
+    {
+        return -1;
+    }
+
+    printf("\nCompared with %s (threshold %.1f%%):\n", fileName, threshold);
+    int passed = 1;
+    for (size_t i = 0; i < count; i++)
+    {
+        const BenchResult *result = &results[i];
+        char quoted[sizeof(result->name) + 16];
+        snprintf(quoted, sizeof(quoted), "\"name\": \"%s\"", result->name);
+        const char *found = strstr(baseline, quoted);
+        const char *object = found;
+        while (object != NULL && object > baseline && *object != '{')
+        {
+            object--;
+        }
+        const char *end = found != NULL ? strchr(found, '}') : NULL;
+        if (object == NULL || end == NULL)
+        {
+            printf("%-20s not in the baseline\n", result->name);
+            continue;
+        }
+
+        for (size_t phase = 0; phase < PHASE_COUNT; phase++)
+        {
+            char key[32];
+            double expected;
+            snprintf(key, sizeof(key), "%sMBps", phaseNames[phase]);
+            if (!findJsonNumber(object, end, key, &expected) || expected <= 0.0)
+            {
+                printf("%-20s %-6s no baseline\n", result->name, phaseNames[phase]);
+                continue;
+            }
+
+            double expectedMargin = 0.0;
+            snprintf(key, sizeof(key), "%sMBpsMargin", phaseNames[phase]);
+            findJsonNumber(object, end, key, &expectedMargin);
+
+            const Throughput *measured = &result->megabytes[phase];
+            double change = (measured->mean - expected) / expected * 100.0;
+            int regressed = change < -threshold && measured->mean + measured->margin < expected - expectedMargin;
+            printf("%-20s %-6s %8.2f MB/s -> %8.2f MB/s  %+6.1f%%%s\n", result->name, phaseNames[phase], expected,
+                   measured->mean, change, regressed ? "  REGRESSION" : "");
+            if (regressed)
+            {
+                passed = 0;
+            }
+        }
+    }
+
+    free(baseline);
+    return passed;
+}
+
+/*****************************************************************************************************
+                                PUBLIC RUNBENCH FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Measures the lexing and parsing throughput of the front end on a set of files, in MB/s and
+ * tokens/s with a 95% confidence interval over the repetitions, and compares it with a baseline.
+ * With `--pipeline` it instead compares the wall-clock time of the whole front end run the
+ * default way and the way `--pipeline` of the compiler runs it.
+ *
+ * Usage: runbench [--reps=<n>] [--warmup=<n>] [--baseline=<file.json>] [--threshold=<percent>]
+ *                 [--save-baseline=<file.json>] [--pipeline] <file.c>...
+ *
+ * @return 0 on success, 1 if a phase regressed beyond the threshold, 2 on failure.
+ */
+int main(int argc, char **argv)
+{
+    size_t repetitions = DEFAULT_REPETITIONS;
+    size_t warmups = DEFAULT_WARMUPS;
+    double threshold = DEFAULT_THRESHOLD;
+    const char *baselineFile = NULL;
+    const char *saveFile = NULL;
+    int pipeline = 0;
+
+    char **files = malloc((size_t)argc * sizeof(char *));
+    if (files == NULL)
+    {
+        fprintf(stderr, "Memory allocation for files failed!\n");
+        return 2;
+    }
+    size_t fileCount = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        char *end = NULL;
+        if (strncmp(argv[i], "--reps=", 7) == 0)
+        {
+            repetitions = strtoul(argv[i] + 7, &end, 10);
+        }
+        else if (strncmp(argv[i], "--warmup=", 9) == 0)
+        {
+            warmups = strtoul(argv[i] + 9, &end, 10);
+            if (end == argv[i] + 9)
+            {
+                end = NULL;
+            }
+        }
+        else if (strncmp(argv[i], "--threshold=", 12) == 0)
+        {
+            threshold = strtod(argv[i] + 12, &end);
+            if (threshold < 0.0)
+            {
+                end = NULL;
+            }
+        }
+        else if (strncmp(argv[i], "--baseline=", 11) == 0)
+        {
+            baselineFile = argv[i] + 11;
+            continue;
+        }
+        else if (strncmp(argv[i], "--save-baseline=", 16) == 0)
+        {
+            saveFile = argv[i] + 16;
+            continue;
+        }
+        else if (strcmp(argv[i], "--pipeline") == 0)
+        {
+            pipeline = 1;
+            continue;
+        }
+        else if (argv[i][0] != '-')
+        {
+            files[fileCount++] = argv[i];
+            continue;
+        }
+
+        if (end == NULL || *end != '\0' || repetitions == 0)
+        {
+            fprintf(stderr, "Invalid option %s!\n", argv[i]);
+            free(files);
+            return 2;
+        }
+    }
+
+    if (fileCount == 0)
+    {
+        fprintf(stderr, "Usage: %s [--reps=<n>] [--warmup=<n>] [--baseline=<file.json>] [--threshold=<percent>] "
+                        "[--save-baseline=<file.json>] [--pipeline] <file.c>...\n", argv[0]);
+        free(files);
+        return 2;
+    }
+
+    if (pipeline)
+    {
+        if (baselineFile != NULL || saveFile != NULL)
+        {
+            fprintf(stderr, "Cannot specify --baseline or --save-baseline with --pipeline!\n");
+            free(files);
+            return 2;
+        }
+
+        //The pipeline can only be faster if the lexer thread gets a processor of its own
+        size_t processors = getProcessorCount();
+        printf("%zu repetitions, mean ± 95%% confidence interval, %zu processor%s online%s\n", repetitions, processors,
+               processors == 1 ? "" : "s", processors < 2 ? ", the pipeline cannot overlap the phases" : "");
+        printf("%-20s %12s %10s  %-21s %-21s %s\n", "File", "Bytes", "Tokens", "Sequential ms", "Pipelined ms", "Speedup");
+        int status = 0;
+        for (size_t i = 0; i < fileCount; i++)
+        {
+            PipelineResult result;
+            if (!benchPipeline(files[i], repetitions, warmups, &result))
+            {
+                status = 2;
+                break;
+            }
+            printPipelineResult(&result);
+            fflush(stdout);
+        }
+
+        free(files);
+        return status;
+    }
+
+    BenchResult *results = malloc(fileCount * sizeof(BenchResult));
+    if (results == NULL)
+    {
+        fprintf(stderr, "Memory allocation for results failed!\n");
+        free(files);
+        return 2;
+    }
+
+    printf("%zu repetitions, mean ± 95%% confidence interval\n", repetitions);
+    printf("%-20s %12s %10s  %-17s %-17s  %-17s %-17s\n", "File", "Bytes", "Tokens", "Lex MB/s", "Lex Mtokens/s", "Parse MB/s", "Parse Mtokens/s");
+    int status = 0;
+    for (size_t i = 0; i < fileCount; i++)
+    {
+        if (!benchFile(files[i], repetitions, warmups, &results[i]))
+        {
+            status = 2;
+            break;
+        }
+        printResult(&results[i]);
+        fflush(stdout);
+    }
+
+    if (status == 0 && saveFile != NULL && !saveBaseline(saveFile, results, fileCount, repetitions))
+    {
+        status = 2;
+    }
+    if (status == 0 && baselineFile != NULL)
+    {
+        int compared = compareBaseline(baselineFile, results, fileCount, threshold);
+        status = compared > 0 ? 0 : compared == 0 ? 1 : 2;
+    }
+
+    free(results);
+    free(files);
+    return status;
+}
@@ -0,0 +1,1127 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+
+#include "lexer.h"
+#include "parser.h"
+#include "trace.h"
+
+#ifndef PARSER_STATS
+#error "The performance fuzzer needs the parser counters, build it with -DPARSER_STATS"
+#endif
+
+/*****************************************************************************************************
+                            PRIVATE PERF FUZZ FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Defaults of the search options
+ */
+#define DEFAULT_ITERATIONS 20000
+#define DEFAULT_MAX_SIZE 256
+#define DEFAULT_POOL_SIZE 32
+#define DEFAULT_KEEP 5
+#define DEFAULT_SEED 1
+
+/**
+ * Milliseconds an input may run before it counts as a hang, while searching and while replaying
+ */
+#define DEFAULT_SEARCH_TIMEOUT 1000
+#define DEFAULT_REPLAY_TIMEOUT 10000
+
+/**
+ * Inputs shorter than this are scored as if they had this many bytes, so a handful of bytes
+ * that start a few rules do not outrank inputs that really make the parser work
+ */
+#define MIN_SCORED_BYTES 16
+
+/**
+ * Number of magnitudes of a counter that are told apart by the coverage feedback
+ */
+#define WORK_BUCKETS 32
+
+/**
+ * Number of tokens the token array starts with
+ */
+#define INITIAL_TOKEN_CAPACITY 256
+
+/**
+ * Represents the work the parser did on an input.
+ *
+ * - `bytes`: The size of the input.
+ * - `lexed`: 1 if the input lexed without errors and was parsed, 0 otherwise.
+ * - `calls`: The number of rule predicates entered.
+ * - `rewinds`: The number of times a predicate moved the position back.
+ * - `rescanned`: The number of tokens given back by the rewinds.
+ * - `work`: `calls` plus `rescanned`, the number the search maximizes per byte.
+ * - `nanoseconds`: The time lexing and parsing took.
+ * - `timedOut`: 1 if the input ran past the timeout and was stopped, 0 otherwise.
+ * - `crashed`: 1 if the process measuring the input died, 0 otherwise.
+ */
+typedef struct parseWork
+{
+    size_t bytes;           /** The size of the input. */
+    int lexed;              /** Whether the input was parsed. */
+    uint64_t calls;         /** Rule predicates entered. */
+    uint64_t rewinds;       /** Position resets. */
+    uint64_t rescanned;     /** Tokens given back by the resets. */
+    uint64_t work;          /** Calls plus rescanned tokens. */
+    uint64_t nanoseconds;   /** Time taken. */
+    int timedOut;           /** Whether the input hung. */
+    int crashed;            /** Whether the input crashed. */
+} ParseWork;
+
+/**
+ * Represents an input of the search pool.
+ */
+typedef struct candidate
+{
+    uint8_t *data;          /** The input. */
+    size_t size;            /** The size of the input. */
+    uint64_t hash;          /** Hash of the input, to keep the pool free of duplicates. */
+    double score;           /** Work per byte. */
+    ParseWork work;         /** The measured work. */
+} Candidate;
+
+/**
+ * Represents the options of the search and the replay.
+ */
+typedef struct fuzzOptions
+{
+    size_t iterations;          /** Mutated inputs to try. */
+    size_t maxSize;             /** Largest input to try. */
+    size_t keep;                /** Inputs to report and save. */
+    uint64_t seed;              /** Seed of the mutations. */
+    unsigned timeout;           /** Milliseconds an input may run, 0 to run it in-process. */
+    double limit;               /** Work per byte a replayed input must not exceed, 0 for none. */
+    const char *saveDirectory;  /** Directory to save the worst inputs to, or NULL. */
+    int printStats;             /** Whether to print the per-rule counters of replayed inputs. */
+} FuzzOptions;
+
+/**
+ * Represents the state of the search.
+ */
+typedef struct search
+{
+    Candidate *pool;        /** The inputs with the highest scores, best first. */
+    size_t poolCount;       /** The number of inputs in the pool. */
+    size_t poolSize;        /** The capacity of the pool. */
+    Candidate *hangs;       /** The inputs that hung or crashed, never mutated. */
+    size_t hangCount;       /** The number of hanging inputs. */
+    size_t hangSize;        /** The capacity of the hanging inputs. */
+    size_t maxSize;         /** The largest input the mutations create. */
+    uint64_t state;         /** The state of the random number generator. */
+} Search;
+
+#ifndef PERF_FUZZ_LIBFUZZER
+/**
+ * Fragments of C the mutations insert, so most mutated inputs still lex and reach the parser
+ */
+static const char *const fragments[] = {
+    "(", ")", "[", "]", "{", "}", ";", ",", "*", "=", ":", "?", "&", "-", "+", "++", "->", ".", "!", "~",
+    "x", "y", "T", "1", "0x1", "'a'", "\"s\"", " ", "\n",
+    "int ", "char ", "long ", "unsigned ", "const ", "volatile ", "static ", "typedef ", "struct s ", "union u ",
+    "enum e ", "sizeof ", "return ", "if (x) ", "else ", "while (x) ", "for (;;) ", "do ", "switch (x) ",
+    "case 1: ", "goto l; ", "(int)", "(T *)", "x = ", "f(", "a[", "int x;", "x;", "{ x; }",
+};
+#endif
+
+#ifdef PERF_FUZZ_LIBFUZZER
+/* Extra coverage counters read by libFuzzer, one per magnitude of the work of every rule */
+__attribute__((section("__libfuzzer_extra_counters")))
+static uint8_t workCounters[(PARSER_RULE_COUNT + 1) * WORK_BUCKETS];
+#endif
+
+#ifdef PERF_FUZZ_LIBFUZZER
+static int getMagnitude(uint64_t value);
+#endif
+
+static int measureWork(const uint8_t *const data, const size_t size, FILE *const statsStream, ParseWork *const result);
+
+static double getScore(const ParseWork *const work);
+
+static double getWorkLimit(void);
+
+/* The search and the replay only run without libFuzzer, which brings its own */
+#ifndef PERF_FUZZ_LIBFUZZER
+static uint64_t hashInput(const uint8_t *const data, const size_t size);
+
+static int measureWorkIsolated(const uint8_t *const data, const size_t size, const unsigned timeout, ParseWork *const result);
+
+static uint64_t nextRandom(Search *const search);
+
+static size_t randomBelow(Search *const search, const size_t bound);
+
+static size_t mutate(Search *const search, const Candidate *const parent, uint8_t *const buffer);
+
+static int offerCandidate(Search *const search, const uint8_t *const data, const size_t size, const ParseWork *const work);
+
+static int offerHang(Search *const search, const uint8_t *const data, const size_t size, const ParseWork *const work);
+
+static uint8_t *readInput(const char *const fileName, size_t *const size);
+
+static int saveCandidates(const Candidate *const candidates, const size_t count, const char *const directory, const char *const prefix);
+
+static int runSearch(char **const files, const size_t fileCount, const FuzzOptions *const options);
+
+static int runReplay(char **const files, const size_t fileCount, const FuzzOptions *const options);
+#endif
+
+/*****************************************************************************************************
+                                PRIVATE PERF FUZZ FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+#ifdef PERF_FUZZ_LIBFUZZER
+/**
+ * Returns the magnitude of a counter, the position of its highest set bit plus one.
+ *
+ * @param value The counter.
+ *
+ * @return 0 for 0, otherwise a number below `WORK_BUCKETS`.
+ */
+static int getMagnitude(uint64_t value)
+{
+    int magnitude = 0;
+    while (value != 0 && magnitude < WORK_BUCKETS - 1)
+    {
+        value >>= 1;
+        magnitude++;
+    }
+    return magnitude;
+}
+#endif
+
+/**
+ * Lexes and parses an input and counts the work the parser did on it. An input the lexer
+ * rejects is not parsed, the same as in the compiler.
+ *
+ * @param data The input. It is cut at the first zero byte, like a source file.
+ *
+ * @param size The size of the input.
+ *
+ * @param statsStream The stream to print the counters of every rule to, or NULL.
+ *
+ * @param result Set to the work.
+ *
+ * @return 1 on success, 0 if memory allocation fails.
+ */
+static int measureWork(const uint8_t *const data, const size_t size, FILE *const statsStream, ParseWork *const result)
+{
+    memset(result, 0, sizeof(ParseWork));
+    result->bytes = size;
+
+    char *input = malloc(size + 1);
+    size_t capacity = INITIAL_TOKEN_CAPACITY;
+    Token **tokens = allocateMemory(MEMORY_TOKENS, capacity * sizeof(Token *));
+    if (input == NULL || tokens == NULL)
+    {
+        fprintf(stderr, "Memory allocation for the input failed!\n");
+        free(input);
+        releaseMemory(MEMORY_TOKENS, tokens);
+        return 0;
+    }
+    memcpy(input, data, size);
+    input[size] = '\0';
+
+    uint64_t start = getTraceTime();
+    Lexer *lexer = createLexer(input, 0);
+    size_t tokenCount = 0;
+    int lexed = lexer != NULL;
+    while (lexed)
+    {
+        Token *token = lex(lexer);
+        if (token == NULL)
+        {
+            lexed = 0;
+            break;
+        }
+
+        if (tokenCount >= capacity)
+        {
+            Token **newTokens = reallocateMemory(MEMORY_TOKENS, tokens, 2 * capacity * sizeof(Token *));
+            if (newTokens == NULL)
+            {
+                deleteToken(token);
+                lexed = 0;
+                break;
+            }
+            tokens = newTokens;
+            capacity *= 2;
+        }
+
+        tokens[tokenCount++] = token;
+        if (token->type == TOKEN_EOF)
+        {
+            break;
+        }
+    }
+    lexed = lexed && lexer->diagnostics->count == 0;
+    deleteLexer(lexer);
+
+    if (lexed)
+    {
+        Parser *parser = createParser(tokens, tokenCount);
+        if (parser != NULL)
+        {
+            parse(parser);
+            for (size_t i = 0; i < PARSER_RULE_COUNT; i++)
+            {
+                result->calls += parser->stats[i].calls;
+                result->rewinds += parser->stats[i].rewinds;
+                result->rescanned += parser->stats[i].tokensRescanned;
+#ifdef PERF_FUZZ_LIBFUZZER
+                workCounters[i * WORK_BUCKETS + getMagnitude(parser->stats[i].rewinds + parser->stats[i].tokensRescanned)] = 1;
+#endif
+            }
+            result->lexed = 1;
+            if (statsStream != NULL)
+            {
+                printParseStats(parser, statsStream);
+            }
+        }
+        deleteParser(parser);
+    }
+    result->work = result->calls + result->rescanned;
+    result->nanoseconds = getTraceTime() - start;
+
+    deleteTokens(tokens, tokenCount);
+    free(input);
+    return 1;
+}
+
+/**
+ * Scores the work of an input by the work per byte.
+ *
+ * @param work The work.
+ *
+ * @return The score, 0 for inputs that were not parsed.
+ */
+static double getScore(const ParseWork *const work)
+{
+    if (!work->lexed)
+    {
+        return 0.0;
+    }
+    return (double)work->work / (double)(work->bytes > MIN_SCORED_BYTES ? work->bytes : MIN_SCORED_BYTES);
+}
+
+/**
+ * Reads the work per byte above which an input counts as a crash from `PERF_FUZZ_LIMIT`, so
+ * fuzzers that only save crashing inputs, like AFL, save the slow ones.
+ *
+ * @return The limit, or 0 if it is not set.
+ */
+static double getWorkLimit(void)
+{
+    const char *limit = getenv("PERF_FUZZ_LIMIT");
+    return limit != NULL ? strtod(limit, NULL) : 0.0;
+}
+
+#ifndef PERF_FUZZ_LIBFUZZER
+/**
+ * Hashes an input with FNV-1a.
+ *
+ * @param data The input.
+ *
+ * @param size The size of the input.
+ *
+ * @return The hash.
+ */
+static uint64_t hashInput(const uint8_t *const data, const size_t size)
+{
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ data[i]) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+/**
+ * Measures the work on an input in a child process, so an input that makes the parser blow up
+ * or crash is stopped and reported instead of stalling the search.
+ *
+ * @param data The input.
+ *
+ * @param size The size of the input.
+ *
+ * @param timeout The milliseconds the input may run, or 0 to measure it in this process.
+ *
+ * @param result Set to the work. `timedOut` or `crashed` is set if the child did not finish.
+ *
+ * @return 1 on success, 0 if the work could not be measured.
+ */
+static int measureWorkIsolated(const uint8_t *const data, const size_t size, const unsigned timeout, ParseWork *const result)
+{
+    int pipeFds[2];
+    if (timeout == 0 || pipe(pipeFds) != 0)
+    {
+        return measureWork(data, size, NULL, result);
+    }
+
+    fflush(stdout);
+    fflush(stderr);
+    pid_t child = fork();
+    if (child < 0)
+    {
+        close(pipeFds[0]);
+        close(pipeFds[1]);
+        return measureWork(data, size, NULL, result);
+    }
+    if (child == 0)
+    {
+        close(pipeFds[0]);
+        ParseWork work;
+        int measured = measureWork(data, size, NULL, &work);
+        if (measured && write(pipeFds[1], &work, sizeof(work)) != (ssize_t)sizeof(work))
+        {
+            measured = 0;
+        }
+        _exit(measured ? 0 : 1);
+    }
+    close(pipeFds[1]);
+
+    uint64_t start = getTraceTime();
+    struct pollfd readable = {pipeFds[0], POLLIN, 0};
+    int ready = poll(&readable, 1, (int)timeout);
+    ssize_t received = ready > 0 ? read(pipeFds[0], result, sizeof(ParseWork)) : -1;
+    if (ready == 0)
+    {
+        kill(child, SIGKILL);
+    }
+    int childStatus = 0;
+    waitpid(child, &childStatus, 0);
+    close(pipeFds[0]);
+
+    if (received == (ssize_t)sizeof(ParseWork))
+    {
+        return 1;
+    }
+    if (ready > 0 && WIFEXITED(childStatus) && WEXITSTATUS(childStatus) != 0)
+    {
+        fprintf(stderr, "Measuring an input failed!\n");
+        return 0;
+    }
+
+    //The child hung or died before it reported
+    memset(result, 0, sizeof(ParseWork));
+    result->bytes = size;
+    result->nanoseconds = getTraceTime() - start;
+    result->timedOut = ready == 0;
+    result->crashed = ready != 0;
+    return 1;
+}
+
+/**
+ * Returns the next number of a xorshift64* generator.
+ *
+ * @param search The search.
+ *
+ * @return The next random number.
+ */
+static uint64_t nextRandom(Search *const search)
+{
+    search->state ^= search->state >> 12;
+    search->state ^= search->state << 25;
+    search->state ^= search->state >> 27;
+    return search->state * 0x2545F4914F6CDD1Dull;
+}
+
+/**
+ * Returns a random number below a bound.
+ *
+ * @param search The search.
+ *
+ * @param bound The bound, greater than 0.
+ *
+ * @return A number in `[0, bound)`.
+ */
+static size_t randomBelow(Search *const search, const size_t bound)
+{
+    return (size_t)((nextRandom(search) >> 16) % bound);
+}
+
+/**
+ * Creates a new input from a pool input by inserting a C fragment, deleting, repeating or
+ * overwriting a piece of it, or splicing in a piece of another pool input. Repeating a piece
+ * is what grows nesting, which is where backtracking parsers tend to blow up.
+ *
+ * @param search The search.
+ *
+ * @param parent The input to mutate.
+ *
+ * @param buffer Set to the new input, `maxSize` bytes long.
+ *
+ * @return The size of the new input.
+ */
+static size_t mutate(Search *const search, const Candidate *const parent, uint8_t *const buffer)
+{
+    size_t size = parent->size < search->maxSize ? parent->size : search->maxSize;
+    memcpy(buffer, parent->data, size);
+
+    size_t mutationCount = 1 + randomBelow(search, 4);
+    for (size_t m = 0; m < mutationCount; m++)
+    {
+        size_t position = randomBelow(search, size + 1);
+        switch (randomBelow(search, 5))
+        {
+            case 0:
+            {
+                //Insert a fragment
+                const char *fragment = fragments[randomBelow(search, sizeof(fragments) / sizeof(fragments[0]))];
+                size_t length = strlen(fragment);
+                if (size + length > search->maxSize)
+                {
+                    break;
+                }
+                memmove(buffer + position + length, buffer + position, size - position);
+                memcpy(buffer + position, fragment, length);
+                size += length;
+                break;
+            }
+            case 1:
+            {
+                //Delete a piece
+                size_t length = randomBelow(search, (size - position) / 2 + 1);
+                memmove(buffer + position, buffer + position + length, size - position - length);
+                size -= length;
+                break;
+            }
+            case 2:
+            {
+                //Repeat a piece a few times
+                size_t length = 1 + randomBelow(search, 8);
+                size_t repeats = 1 + randomBelow(search, 8);
+                if (position + length > size || size + length * repeats > search->maxSize)
+                {
+                    break;
+                }
+                for (size_t r = 0; r < repeats; r++)
+                {
+                    memmove(buffer + position + length, buffer + position, size - position);
+                    size += length;
+                }
+                break;
+            }
+            case 3:
+            {
+                //Overwrite a byte with one of the fragment bytes
+                if (position < size)
+                {
+                    const char *fragment = fragments[randomBelow(search, sizeof(fragments) / sizeof(fragments[0]))];
+                    buffer[position] = (uint8_t)fragment[0];
+                }
+                break;
+            }
+            default:
+            {
+                //Splice in a piece of another pool input
+                const Candidate *other = &search->pool[randomBelow(search, search->poolCount)];
+                size_t from = randomBelow(search, other->size + 1);
+                size_t length = randomBelow(search, other->size - from + 1);
+                if (size + length > search->maxSize)
+                {
+                    break;
+                }
+                memmove(buffer + position + length, buffer + position, size - position);
+                memcpy(buffer + position, other->data + from, length);
+                size += length;
+                break;
+            }
+        }
+    }
+    return size;
+}
+
+/**
+ * Adds an input to the pool if its score beats the worst input of a full pool and it is not
+ * in the pool yet. The pool stays sorted by score.
+ *
+ * @param search The search.
+ *
+ * @param data The input.
+ *
+ * @param size The size of the input.
+ *
+ * @param work The work of the input.
+ *
+ * @return 1 if the input is the new best, 0 otherwise.
+ */
+static int offerCandidate(Search *const search, const uint8_t *const data, const size_t size, const ParseWork *const work)
+{
+    double score = getScore(work);
+    if (search->poolCount == search->poolSize && score <= search->pool[search->poolCount - 1].score)
+    {
+        return 0;
+    }
+
+    uint64_t hash = hashInput(data, size);
+    for (size_t i = 0; i < search->poolCount; i++)
+    {
+        if (search->pool[i].hash == hash && search->pool[i].size == size)
+        {
+            return 0;
+        }
+    }
+
+    uint8_t *copy = malloc(size > 0 ? size : 1);
+    if (copy == NULL)
+    {
+        fprintf(stderr, "Memory allocation for the input failed!\n");
+        return 0;
+    }
+    memcpy(copy, data, size);
+
+    //Drop the worst input of a full pool, then insert the new one in order
+    if (search->poolCount == search->poolSize)
+    {
+        free(search->pool[--search->poolCount].data);
+    }
+    size_t index = search->poolCount++;
+    while (index > 0 && search->pool[index - 1].score < score)
+    {
+        search->pool[index] = search->pool[index - 1];
+        index--;
+    }
+    search->pool[index].data = copy;
+    search->pool[index].size = size;
+    search->pool[index].hash = hash;
+    search->pool[index].score = score;
+    search->pool[index].work = *work;
+    return index == 0;
+}
+
+/**
+ * Keeps an input that hung or crashed, if there is room and it is not kept yet. These inputs
+ * are kept out of the pool, so the search does not spend its time mutating them.
+ *
+ * @param search The search.
+ *
+ * @param data The input.
+ *
+ * @param size The size of the input.
+ *
+ * @param work The work of the input.
+ *
+ * @return 1 if the input was kept, 0 otherwise.
+ */
+static int offerHang(Search *const search, const uint8_t *const data, const size_t size, const ParseWork *const work)
+{
+    uint64_t hash = hashInput(data, size);
+    if (search->hangCount == search->hangSize)
+    {
+        return 0;
+    }
+    for (size_t i = 0; i < search->hangCount; i++)
+    {
+        if (search->hangs[i].hash == hash && search->hangs[i].size == size)
+        {
+            return 0;
+        }
+    }
+
+    uint8_t *copy = malloc(size > 0 ? size : 1);
+    if (copy == NULL)
+    {
+        fprintf(stderr, "Memory allocation for the input failed!\n");
+        return 0;
+    }
+    memcpy(copy, data, size);
+
+    Candidate *hang = &search->hangs[search->hangCount++];
+    hang->data = copy;
+    hang->size = size;
+    hang->hash = hash;
+    hang->score = 0.0;
+    hang->work = *work;
+    return 1;
+}
+
+/**
+ * Reads a whole file.
+ *
+ * @param fileName The file to read.
+ *
+ * @param size Set to the size of the file.
+ *
+ * @return The contents, or NULL on failure. The caller frees them.
+ */
+static uint8_t *readInput(const char *const fileName, size_t *const size)
+{
+    FILE *file = fopen(fileName, "rb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Error opening file %s!\n", fileName);
+        return NULL;
+    }
+
+    uint8_t *data = NULL;
+    long length = -1;
+    if (fseek(file, 0, SEEK_END) == 0)
+    {
+        length = ftell(file);
+    }
+    if (length >= 0 && fseek(file, 0, SEEK_SET) == 0)
+    {
+        data = malloc((size_t)length + 1);
+    }
+    if (data == NULL || fread(data, 1, (size_t)length, file) != (size_t)length)
+    {
+        fprintf(stderr, "Error reading file %s!\n", fileName);
+        free(data);
+        fclose(file);
+        return NULL;
+    }
+    fclose(file);
+
+    *size = (size_t)length;
+    return data;
+}
+
+/**
+ * Writes inputs to a directory as regression cases, named after their hash so the same input
+ * is never saved twice.
+ *
+ * @param candidates The inputs.
+ *
+ * @param count The number of inputs to write.
+ *
+ * @param directory The directory, which must exist.
+ *
+ * @param prefix The start of the file names, `slow`, `timeout` or `crash`.
+ *
+ * @return 1 on success, 0 if a file cannot be written.
+ */
+static int saveCandidates(const Candidate *const candidates, const size_t count, const char *const directory, const char *const prefix)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        const Candidate *candidate = &candidates[i];
+        char fileName[4096];
+        snprintf(fileName, sizeof(fileName), "%s/%s_%016llx.c", directory, prefix, (unsigned long long)candidate->hash);
+
+        FILE *file = fopen(fileName, "wb");
+        if (file == NULL || fwrite(candidate->data, 1, candidate->size, file) != candidate->size)
+        {
+            fprintf(stderr, "Error writing regression case %s!\n", fileName);
+            if (file != NULL)
+            {
+                fclose(file);
+            }
+            return 0;
+        }
+        if (fclose(file) != 0)
+        {
+            fprintf(stderr, "Error writing regression case %s!\n", fileName);
+            return 0;
+        }
+        printf("Saved %s: %zu bytes\n", fileName, candidate->size);
+    }
+    return 1;
+}
+
+/**
+ * Searches for the inputs that make the parser do the most work per byte, starting from seed
+ * files, and optionally saves the worst ones along with the inputs that hung or crashed. The
+ * lexer and parser messages are silenced while the inputs run.
+ *
+ * @param files The seed files.
+ *
+ * @param fileCount The number of seed files.
+ *
+ * @param options The options of the search.
+ *
+ * @return 0 on success, 2 on failure.
+ */
+static int runSearch(char **const files, const size_t fileCount, const FuzzOptions *const options)
+{
+    Search search;
+    search.poolSize = DEFAULT_POOL_SIZE > options->keep ? DEFAULT_POOL_SIZE : options->keep;
+    search.poolCount = 0;
+    search.hangSize = options->keep;
+    search.hangCount = 0;
+    search.maxSize = options->maxSize;
+    search.state = options->seed * 0x9E3779B97F4A7C15ull + 1;
+    search.pool = malloc(search.poolSize * sizeof(Candidate));
+    search.hangs = malloc((search.hangSize > 0 ? search.hangSize : 1) * sizeof(Candidate));
+    uint8_t *buffer = malloc(options->maxSize + 1);
+    if (search.pool == NULL || search.hangs == NULL || buffer == NULL)
+    {
+        fprintf(stderr, "Memory allocation for the search failed!\n");
+        free(search.pool);
+        free(search.hangs);
+        free(buffer);
+        return 2;
+    }
+
+    //Silence the messages of the lexer while the inputs run
+    fflush(stderr);
+    int savedErr = dup(STDERR_FILENO);
+    int devNull = open("/dev/null", O_WRONLY);
+    if (savedErr >= 0 && devNull >= 0)
+    {
+        dup2(devNull, STDERR_FILENO);
+    }
+    int progress = savedErr >= 0 ? savedErr : STDERR_FILENO;
+
+    int status = 0;
+    ParseWork work;
+    for (size_t i = 0; i < fileCount && status == 0; i++)
+    {
+        size_t size = 0;
+        uint8_t *data = readInput(files[i], &size);
+        if (size > options->maxSize)
+        {
+            size = options->maxSize;
+        }
+        if (data == NULL || !measureWorkIsolated(data, size, options->timeout, &work))
+        {
+            status = 2;
+        }
+        else if (work.timedOut || work.crashed)
+        {
+            dprintf(progress, "Seed %s %s!\n", files[i], work.timedOut ? "timed out" : "crashed");
+            offerHang(&search, data, size, &work);
+        }
+        else
+        {
+            offerCandidate(&search, data, size, &work);
+        }
+        free(data);
+    }
+    if (status == 0 && search.poolCount == 0)
+    {
+        //An empty input is enough to start from
+        measureWork((const uint8_t *)"", 0, NULL, &work);
+        offerCandidate(&search, (const uint8_t *)"", 0, &work);
+    }
+
+    uint64_t start = getTraceTime();
+    for (size_t i = 0; i < options->iterations && status == 0; i++)
+    {
+        //Mutate the better of two pool inputs
+        size_t first = randomBelow(&search, search.poolCount);
+        size_t second = randomBelow(&search, search.poolCount);
+        size_t size = mutate(&search, &search.pool[first < second ? first : second], buffer);
+        if (!measureWorkIsolated(buffer, size, options->timeout, &work))
+        {
+            status = 2;
+            break;
+        }
+
+        if (work.timedOut || work.crashed)
+        {
+            if (offerHang(&search, buffer, size, &work))
+            {
+                dprintf(progress, "Iteration %zu: %zu bytes %s\n", i + 1, size, work.timedOut ? "timed out" : "crashed");
+            }
+        }
+        else if (offerCandidate(&search, buffer, size, &work))
+        {
+            dprintf(progress, "Iteration %zu: %zu bytes, %llu work, %.1f work per byte\n",
+                    i + 1, size, (unsigned long long)work.work, getScore(&work));
+        }
+    }
+    uint64_t end = getTraceTime();
+
+    if (savedErr >= 0 && devNull >= 0)
+    {
+        fflush(stderr);
+        dup2(savedErr, STDERR_FILENO);
+    }
+    if (savedErr >= 0)
+    {
+        close(savedErr);
+    }
+    if (devNull >= 0)
+    {
+        close(devNull);
+    }
+
+    if (status == 0)
+    {
+        size_t slowCount = options->keep < search.poolCount ? options->keep : search.poolCount;
+        printf("%zu inputs in %.1f s, the worst:\n", options->iterations, (end - start) / 1e9);
+        printf("%-18s %8s %12s %10s %12s %10s\n", "Hash", "Bytes", "Work", "Rewinds", "Work/byte", "Time (us)");
+        for (size_t i = 0; i < slowCount; i++)
+        {
+            const Candidate *candidate = &search.pool[i];
+            printf("%016llx %8zu %12llu %10llu %12.1f %10.1f\n", (unsigned long long)candidate->hash, candidate->size,
+                   (unsigned long long)candidate->work.work, (unsigned long long)candidate->work.rewinds, candidate->score,
+                   candidate->work.nanoseconds / 1e3);
+        }
+        for (size_t i = 0; i < search.hangCount; i++)
+        {
+            const Candidate *hang = &search.hangs[i];
+            printf("%016llx %8zu %12s\n", (unsigned long long)hang->hash, hang->size, hang->work.timedOut ? "TIMEOUT" : "CRASH");
+        }
+
+        if (options->saveDirectory != NULL && !saveCandidates(search.pool, slowCount, options->saveDirectory, "slow"))
+        {
+            status = 2;
+        }
+
+        //An input past the timeout may still finish, so it is named apart from the ones that crashed
+        for (size_t i = 0; i < search.hangCount && options->saveDirectory != NULL && status == 0; i++)
+        {
+            const char *prefix = search.hangs[i].work.timedOut ? "timeout" : "crash";
+            if (!saveCandidates(&search.hangs[i], 1, options->saveDirectory, prefix))
+            {
+                status = 2;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < search.poolCount; i++)
+    {
+        free(search.pool[i].data);
+    }
+    for (size_t i = 0; i < search.hangCount; i++)
+    {
+        free(search.hangs[i].data);
+    }
+    free(search.pool);
+    free(search.hangs);
+    free(buffer);
+    return status;
+}
+
+/**
+ * Runs saved inputs and reports the work the parser does on each.
+ *
+ * @param files The inputs.
+ *
+ * @param fileCount The number of inputs.
+ *
+ * @param options The options of the replay.
+ *
+ * @return 0 if every input finishes within the limit, 1 if one exceeds it, hangs or crashes,
+ *         2 on failure.
+ */
+static int runReplay(char **const files, const size_t fileCount, const FuzzOptions *const options)
+{
+    int status = 0;
+    printf("%-48s %8s %12s %10s %12s %10s\n", "File", "Bytes", "Work", "Rewinds", "Work/byte", "Time (us)");
+    for (size_t i = 0; i < fileCount; i++)
+    {
+        size_t size;
+        uint8_t *data = readInput(files[i], &size);
+        ParseWork work;
+        if (data == NULL || !measureWorkIsolated(data, size, options->timeout, &work))
+        {
+            free(data);
+            return 2;
+        }
+
+        if (work.timedOut || work.crashed)
+        {
+            printf("%-48s %8zu %12s\n", files[i], size, work.timedOut ? "TIMEOUT" : "CRASH");
+            status = 1;
+            free(data);
+            continue;
+        }
+
+        double score = getScore(&work);
+        int exceeded = options->limit > 0.0 && score > options->limit;
+        printf("%-48s %8zu %12llu %10llu %12.1f %10.1f%s\n", files[i], size, (unsigned long long)work.work,
+               (unsigned long long)work.rewinds, score, work.nanoseconds / 1e3, exceeded ? "  OVER LIMIT" : "");
+        if (exceeded)
+        {
+            status = 1;
+        }
+        if (options->printStats && !measureWork(data, size, stdout, &work))
+        {
+            free(data);
+            return 2;
+        }
+
+        free(data);
+    }
+    return status;
+}
+#endif
+
+/*****************************************************************************************************
+                                PUBLIC PERF FUZZ FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * The entry point of libFuzzer and of AFL++ in its libFuzzer compatible mode. Lexes and parses
+ * one input and turns the magnitude of the work of every rule into coverage counters, so the
+ * fuzzer keeps the inputs that make the parser work harder, not only the ones that reach new
+ * code. If `PERF_FUZZ_LIMIT` is set, inputs with more work per byte abort, so the fuzzer saves
+ * them as crashes. Inputs that blow up completely are caught by the timeout of the fuzzer.
+ *
+ * @param data The input.
+ *
+ * @param size The size of the input.
+ *
+ * @return 0.
+ */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    ParseWork work;
+    if (!measureWork(data, size, NULL, &work))
+    {
+        return 0;
+    }
+
+#ifdef PERF_FUZZ_LIBFUZZER
+    workCounters[PARSER_RULE_COUNT * WORK_BUCKETS + getMagnitude((uint64_t)(getScore(&work) * 4.0))] = 1;
+#endif
+
+    static double limit = -1.0;
+    if (limit < 0.0)
+    {
+        limit = getWorkLimit();
+    }
+    if (limit > 0.0 && getScore(&work) > limit)
+    {
+        fprintf(stderr, "Input of %zu bytes took %llu parser steps, %.1f per byte, above the limit of %.1f!\n",
+                size, (unsigned long long)work.work, getScore(&work), limit);
+        abort();
+    }
+    return 0;
+}
+
+#ifndef PERF_FUZZ_LIBFUZZER
+/**
+ * Without libFuzzer the harness searches for slow inputs itself, replays saved ones, or runs
+ * one input from the standard input for AFL.
+ *
+ * Usage: perf_fuzz --search [--iterations=<n>] [--max-size=<bytes>] [--seed=<n>]
+ *                  [--save=<directory>] [--keep=<n>] [--timeout=<ms>] [seed files...]
+ *        perf_fuzz [--limit=<work per byte>] [--timeout=<ms>] [--stats] <files...>
+ *        perf_fuzz -              (one input from the standard input, for AFL)
+ *
+ * @return 0 on success, 1 if an input exceeds the limit, hangs or crashes, 2 on failure.
+ */
+int main(int argc, char **argv)
+{
+    int search = 0;
+    int timeoutSet = 0;
+    FuzzOptions options;
+    options.iterations = DEFAULT_ITERATIONS;
+    options.maxSize = DEFAULT_MAX_SIZE;
+    options.keep = DEFAULT_KEEP;
+    options.seed = DEFAULT_SEED;
+    options.timeout = 0;
+    options.limit = 0.0;
+    options.saveDirectory = NULL;
+    options.printStats = 0;
+
+    char **files = malloc((size_t)argc * sizeof(char *));
+    if (files == NULL)
+    {
+        fprintf(stderr, "Memory allocation for files failed!\n");
+        return 2;
+    }
+    size_t fileCount = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        char *end = NULL;
+        if (strcmp(argv[i], "--search") == 0)
+        {
+            search = 1;
+            continue;
+        }
+        else if (strcmp(argv[i], "--stats") == 0)
+        {
+            options.printStats = 1;
+            continue;
+        }
+        else if (strcmp(argv[i], "-") == 0)
+        {
+            //Read one input from the standard input, in a loop under AFL++ persistent mode
+#ifdef __AFL_LOOP
+            while (__AFL_LOOP(1000))
+#endif
+            {
+                static uint8_t input[1 << 20];
+                size_t size = fread(input, 1, sizeof(input), stdin);
+                LLVMFuzzerTestOneInput(input, size);
+            }
+            free(files);
+            return 0;
+        }
+        else if (strncmp(argv[i], "--iterations=", 13) == 0)
+        {
+            options.iterations = strtoull(argv[i] + 13, &end, 10);
+        }
+        else if (strncmp(argv[i], "--max-size=", 11) == 0)
+        {
+            options.maxSize = strtoull(argv[i] + 11, &end, 10);
+            if (options.maxSize == 0)
+            {
+                end = NULL;
+            }
+        }
+        else if (strncmp(argv[i], "--keep=", 7) == 0)
+        {
+            options.keep = strtoull(argv[i] + 7, &end, 10);
+        }
+        else if (strncmp(argv[i], "--seed=", 7) == 0)
+        {
+            options.seed = strtoull(argv[i] + 7, &end, 10);
+        }
+        else if (strncmp(argv[i], "--timeout=", 10) == 0)
+        {
+            options.timeout = (unsigned)strtoul(argv[i] + 10, &end, 10);
+            timeoutSet = 1;
+        }
+        else if (strncmp(argv[i], "--limit=", 8) == 0)
+        {
+            options.limit = strtod(argv[i] + 8, &end);
+        }
+        else if (strncmp(argv[i], "--save=", 7) == 0)
+        {
+            options.saveDirectory = argv[i] + 7;
+            continue;
+        }
+        else if (argv[i][0] != '-')
+        {
+            files[fileCount++] = argv[i];
+            continue;
+        }
+
+        if (end == NULL || *end != '\0')
+        {
+            fprintf(stderr, "Invalid option %s!\n", argv[i]);
+            free(files);
+            return 2;
+        }
+    }
+
+    if (!timeoutSet)
+    {
+        options.timeout = search ? DEFAULT_SEARCH_TIMEOUT : DEFAULT_REPLAY_TIMEOUT;
+    }
+
+    int status;
+    if (search)
+    {
+        status = runSearch(files, fileCount, &options);
+    }
+    else if (fileCount > 0)
+    {
+        status = runReplay(files, fileCount, &options);
+    }
+    else
+    {
+        fprintf(stderr, "Usage: %s --search [--iterations=<n>] [--max-size=<bytes>] [--seed=<n>] [--save=<directory>] [--keep=<n>] [--timeout=<ms>] [seed files...]\n"
+                        "       %s [--limit=<work per byte>] [--timeout=<ms>] [--stats] <files...>\n"
+                        "       %s -\n", argv[0], argv[0], argv[0]);
+        status = 2;
+    }
+
+    free(files);
+    return status;
+}
+#endif
@@ -28,10 +28,12 @@ static char peekChar(const Lexer *const lexer);
 
 static void consumeChar(Lexer *const lexer, const int count);
 
-static int addError(Lexer *lexer, Error *error);
+static int addError(Lexer *lexer, const DiagnosticId id, const Token *const token);
 
 static void updateStartingPos(Lexer *lexer);
 
+static char *copyTokenText(const char *const text, const size_t start, const size_t end);
+
 static Token *handleComments(Lexer *const lexer);
 
 static Token *handleWhitespace(Lexer *const lexer);
@@ -211,21 +213,20 @@ static void consumeChar(Lexer *const lexer, const int count)
 }
 
 /**
- * Adds an `Error` object to the `Lexer`'s error list.
+ * Reports a diagnostic of the `Lexer`.
  * 
- * This function appends a new error to the list of errors maintained by the `Lexer`.
- * If necessary, it reallocates memory to expand the `errors` array to accommodate the new error.
+ * Only the ID and the location of the offending token are recorded, the message is formatted
+ * when the diagnostics are printed.
  * 
- * @param lexer Pointer to the `Lexer` object to which the error should be added.
+ * @param lexer Pointer to the `Lexer` object to which the diagnostic should be added.
  * 
- * @param error Pointer to the `Error` object to be added to the `Lexer`'s error list.
+ * @param id The ID of the diagnostic.
  * 
- * @return `1` if the error was successfully added to the list; `0` otherwise.
+ * @param token The offending token, or NULL if the diagnostic has no location.
  * 
- * @note The `Lexer` and `Error` pointers must be valid. The `Lexer`'s `errors` array will be expanded as needed, 
- *       and the function handles memory reallocation internally.
+ * @return `1` if the diagnostic was recorded; `0` otherwise, such as after the error limit.
  */
-static int addError(Lexer *lexer, Error *error)
+static int addError(Lexer *lexer, const DiagnosticId id, const Token *const token)
 {
     if (lexer == NULL)
     {
@@ -233,32 +234,15 @@ static int addError(Lexer *lexer, Error *error)
         return 0;
     }
 
-    if (error == NULL)
-    {
-        fprintf(stderr, "Error is not initialized.\n");
-        return 0;
-    }
-
-    if (lexer->errorCount + 1 >= lexer->errorsSize)
-    {
-        lexer->errorsSize *= 2;
-        Error **newErrors = realloc(lexer->errors, lexer->errorsSize * sizeof(Error *));
-        if (newErrors == NULL)
-        {
-            fprintf(stderr, "Memory reallocation for Errors failed!\n");
-            return 0;
-        }
-        lexer->errors = newErrors;
-    }
-
-    lexer->errors[lexer->errorCount++] = error;
-    return 1;
+    SourceLoc loc = token != NULL ? token->loc : SOURCE_LOC_INVALID;
+    size_t length = token != NULL && token->text != NULL ? strlen(token->text) : 0;
+    return reportDiagnostic(lexer->diagnostics, id, loc, length, NULL, 0);
 }
 
 /**
  * Updates the starting position for tokenization in the `Lexer`.
  * 
- * This function sets the `tokenStartingPos` field of the `Lexer` to the current position.
+ * This function sets the `tokenStartingPos` field of the `Lexer` to the location of the current position.
  * This is typically used to mark the beginning of a new token or to reset the starting position
  * for subsequent tokenization processes.
  * 
@@ -275,7 +259,32 @@ static void updateStartingPos(Lexer *lexer)
         return;
     }
 
-    lexer->tokenStartingPos = lexer->position;
+    lexer->tokenStartingPos = lexer->fileStart + (SourceLoc)lexer->position;
+}
+
+/**
+ * Copies a part of the text of a token, like the contents of a string literal.
+ * 
+ * @param text The text of the token.
+ * 
+ * @param start The index of the first character to copy.
+ * 
+ * @param end The index after the last character to copy.
+ * 
+ * @return The copy, allocated as token text, or NULL if memory allocation fails.
+ */
+static char *copyTokenText(const char *const text, const size_t start, const size_t end)
+{
+    char *copy = allocateMemory(MEMORY_TOKEN_TEXT, end - start + 1);
+    if (copy == NULL)
+    {
+        fprintf(stderr, "Memory allocation for Token text failed!\n");
+        return NULL;
+    }
+
+    memcpy(copy, text + start, end - start);
+    copy[end - start] = '\0';
+    return copy;
 }
 
 /**
@@ -318,7 +327,7 @@ static Token *handleComments(Lexer *const lexer)
     }
 
     size_t size = TEXT_BUFFER_SIZE;
-    char *text = (char *)malloc(size * sizeof(char));
+    char *text = (char *)allocateMemory(MEMORY_TOKEN_TEXT, size * sizeof(char));
     if (text == NULL)
     {
         fprintf(stderr, "Memory allocation for Token text failed!\n");
@@ -345,11 +354,11 @@ static Token *handleComments(Lexer *const lexer)
             if (pos == size - 3)
             {
                 size *= 2;
-                char *extendedText = realloc(text, size * sizeof(char));
+                char *extendedText = reallocateMemory(MEMORY_TOKEN_TEXT, text, size * sizeof(char));
                 if (extendedText == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for Token text failed!\n");
-                    free(text);
+                    releaseMemory(MEMORY_TOKEN_TEXT, text);
                     return NULL;
                 }
                 text = extendedText;
@@ -361,7 +370,7 @@ static Token *handleComments(Lexer *const lexer)
         {
             text[pos] = '\0';
             Token *token = createTokenNone(text, lexer->tokenStartingPos, TOKEN_UNKNOWN);
-            addError(lexer, createError(ERROR_LEXING, "The multi-line comment was not closed!", duplicateToken(token)));
+            addError(lexer, DIAG_UNCLOSED_COMMENT, token);
             return token;
         }
 
@@ -391,11 +400,11 @@ static Token *handleComments(Lexer *const lexer)
             if (pos == size - 3)
             {
                 size *= 2;
-                char *extendedText = realloc(text, size * sizeof(char));
+                char *extendedText = reallocateMemory(MEMORY_TOKEN_TEXT, text, size * sizeof(char));
                 if (extendedText == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for Token text failed!\n");
-                    free(text);
+                    releaseMemory(MEMORY_TOKEN_TEXT, text);
                     return NULL;
                 }
                 text = extendedText;
@@ -449,7 +458,7 @@ static Token *handleWhitespace(Lexer *const lexer)
     }
 
     size_t size = TEXT_BUFFER_SIZE;
-    char *text = (char *)malloc(size * sizeof(char));
+    char *text = (char *)allocateMemory(MEMORY_TOKEN_TEXT, size * sizeof(char));
     if (text == NULL)
     {
         fprintf(stderr, "Memory allocation for Token text failed!\n");
@@ -464,11 +473,11 @@ static Token *handleWhitespace(Lexer *const lexer)
         if (pos == size - 1)
         {
             size *= 2;
-            char *extendedText = realloc(text, size * sizeof(char));
+            char *extendedText = reallocateMemory(MEMORY_TOKEN_TEXT, text, size * sizeof(char));
             if (extendedText == NULL)
             {
                 fprintf(stderr, "Memory reallocation for Token text failed!\n");
-                free(text);
+                releaseMemory(MEMORY_TOKEN_TEXT, text);
                 return NULL;
             }
             text = extendedText;
@@ -511,7 +520,7 @@ static Token *handleIdentifiersAndKeywords(Lexer *const lexer)
     }
 
     size_t size = TEXT_BUFFER_SIZE;
-    char *text = (char *)malloc(size * sizeof(char));
+    char *text = (char *)allocateMemory(MEMORY_TOKEN_TEXT, size * sizeof(char));
     if (text == NULL)
     {
         fprintf(stderr, "Memory allocation for Token text failed!\n");
@@ -527,11 +536,11 @@ static Token *handleIdentifiersAndKeywords(Lexer *const lexer)
         if (pos == size - 1)
         {
             size *= 2;
-            char *extendedText = realloc(text, size * sizeof(char));
+            char *extendedText = reallocateMemory(MEMORY_TOKEN_TEXT, text, size * sizeof(char));
             if (extendedText == NULL)
             {
                 fprintf(stderr, "Memory reallocation for Token text failed!\n");
-                free(text);
+                releaseMemory(MEMORY_TOKEN_TEXT, text);
                 return NULL;
             }
             text = extendedText;
@@ -583,7 +592,7 @@ static Token *handleStrings(Lexer *const lexer)
     }
 
     size_t size = TEXT_BUFFER_SIZE;
-    char *text = (char *)malloc(size * sizeof(char));
+    char *text = (char *)allocateMemory(MEMORY_TOKEN_TEXT, size * sizeof(char));
     if (text == NULL)
     {
         fprintf(stderr, "Memory allocation for Token text failed!\n");
@@ -603,11 +612,11 @@ static Token *handleStrings(Lexer *const lexer)
         if (pos == size - 2)
         {
             size *= 2;
-            char *extendedText = realloc(text, size * sizeof(char));
+            char *extendedText = reallocateMemory(MEMORY_TOKEN_TEXT, text, size * sizeof(char));
             if (extendedText == NULL)
             {
                 fprintf(stderr, "Memory reallocation for Token text failed!\n");
-                free(text);
+                releaseMemory(MEMORY_TOKEN_TEXT, text);
                 return NULL;
             }
             text = extendedText;
@@ -619,7 +628,7 @@ static Token *handleStrings(Lexer *const lexer)
     {
         text[pos] = '\0';
         Token *token = createTokenNone(text, lexer->tokenStartingPos, TOKEN_UNKNOWN);
-        addError(lexer, createError(ERROR_LEXING, "The string wasn't closed!", duplicateToken(token)));
+        addError(lexer, DIAG_UNCLOSED_STRING, token);
         return token;
     }
 
@@ -628,7 +637,7 @@ static Token *handleStrings(Lexer *const lexer)
     consumeChar(lexer, 1);
 
     text[pos] = '\0';
-    return createTokenString(text, lexer->tokenStartingPos, TOKEN_STRING, substring(text, 1, pos - 1));
+    return createTokenString(text, lexer->tokenStartingPos, TOKEN_STRING, copyTokenText(text, 1, pos - 1));
 }
 
 /**
@@ -665,7 +674,7 @@ static Token *handleCharacters(Lexer *const lexer)
     }
 
     size_t size = TEXT_BUFFER_FOR_CHAR;
-    char *text = (char *)malloc(size * sizeof(char));
+    char *text = (char *)allocateMemory(MEMORY_TOKEN_TEXT, size * sizeof(char));
     if (text == NULL)
     {
         fprintf(stderr, "Memory allocation for Token text failed!\n");
@@ -691,7 +700,7 @@ static Token *handleCharacters(Lexer *const lexer)
     {
         text[pos] = '\0';
         Token *token = createTokenNone(text, lexer->tokenStartingPos, TOKEN_UNKNOWN);
-        addError(lexer, createError(ERROR_LEXING, "The character wasn't closed!", duplicateToken(token)));
+        addError(lexer, DIAG_UNCLOSED_CHARACTER, token);
         return token;
     }
 
@@ -705,7 +714,7 @@ static Token *handleCharacters(Lexer *const lexer)
         consumeChar(lexer, 1);
         text[pos] = '\0';
         Token *token = createTokenNone(text, lexer->tokenStartingPos, TOKEN_UNKNOWN);
-        addError(lexer, createError(ERROR_LEXING, "The character wasn't closed!", duplicateToken(token)));
+        addError(lexer, DIAG_UNCLOSED_CHARACTER, token);
         return token;
     }
 
@@ -721,7 +730,7 @@ static Token *handleCharacters(Lexer *const lexer)
         retChar = convertEscapeString(ss);
         if (retChar == '\0')
         {
-            addError(lexer, createError(ERROR_LEXING, "Invalid escape string format.", NULL));
+            addError(lexer, DIAG_INVALID_ESCAPE, NULL);
         }
         free((char *)ss);
     }
@@ -766,7 +775,7 @@ static Token *handleNumbers(Lexer *const lexer)
     }
 
     size_t size = TEXT_BUFFER_SIZE;
-    char *text = (char *)malloc(size * sizeof(char));
+    char *text = (char *)allocateMemory(MEMORY_TOKEN_TEXT, size * sizeof(char));
     if (text == NULL)
     {
         fprintf(stderr, "Memory allocation for Token text failed!\n");
@@ -816,11 +825,11 @@ static Token *handleNumbers(Lexer *const lexer)
             if (pos == size - 1)
             {
                 size *= 2;
-                char *extendedText = realloc(text, size * sizeof(char));
+                char *extendedText = reallocateMemory(MEMORY_TOKEN_TEXT, text, size * sizeof(char));
                 if (extendedText == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for Token text failed!\n");
-                    free(text);
+                    releaseMemory(MEMORY_TOKEN_TEXT, text);
                     return NULL;
                 }
                 text = extendedText;
@@ -834,7 +843,7 @@ static Token *handleNumbers(Lexer *const lexer)
             consumeChar(lexer, 1);
             text[pos] = '\0';
             Token *token = createTokenNone(text, lexer->tokenStartingPos, TOKEN_UNKNOWN);
-            addError(lexer, createError(ERROR_LEXING, "Invalid digit in an octal number", duplicateToken(token)));
+            addError(lexer, DIAG_INVALID_OCTAL_DIGIT, token);
             return token;
         }
 
@@ -854,11 +863,11 @@ static Token *handleNumbers(Lexer *const lexer)
             if (pos == size - 1)
             {
                 size *= 2;
-                char *extendedText = realloc(text, size * sizeof(char));
+                char *extendedText = reallocateMemory(MEMORY_TOKEN_TEXT, text, size * sizeof(char));
                 if (extendedText == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for Token text failed!\n");
-                    free(text);
+                    releaseMemory(MEMORY_TOKEN_TEXT, text);
                     return NULL;
                 }
                 text = extendedText;
@@ -872,7 +881,7 @@ static Token *handleNumbers(Lexer *const lexer)
             consumeChar(lexer, 1);
             text[pos] = '\0';
             Token *token = createTokenNone(text, lexer->tokenStartingPos, TOKEN_UNKNOWN);
-            addError(lexer, createError(ERROR_LEXING, "Invalid character in a hexadecimal number", duplicateToken(token)));
+            addError(lexer, DIAG_INVALID_HEX_DIGIT, token);
             return token;
         }
 
@@ -890,11 +899,11 @@ static Token *handleNumbers(Lexer *const lexer)
         if (pos == size - 3)
         {
             size *= 2;
-            char *extendedText = realloc(text, size * sizeof(char));
+            char *extendedText = reallocateMemory(MEMORY_TOKEN_TEXT, text, size * sizeof(char));
             if (extendedText == NULL)
             {
                 fprintf(stderr, "Memory reallocation for Token text failed!\n");
-                free(text);
+                releaseMemory(MEMORY_TOKEN_TEXT, text);
                 return NULL;
             }
             text = extendedText;
@@ -923,11 +932,11 @@ static Token *handleNumbers(Lexer *const lexer)
         if (pos == size - 1)
         {
             size *= 2;
-            char *extendedText = realloc(text, size * sizeof(char));
+            char *extendedText = reallocateMemory(MEMORY_TOKEN_TEXT, text, size * sizeof(char));
             if (extendedText == NULL)
             {
                 fprintf(stderr, "Memory reallocation for Token text failed!\n");
-                free(text);
+                releaseMemory(MEMORY_TOKEN_TEXT, text);
                 return NULL;
             }
             text = extendedText;
@@ -984,8 +993,9 @@ static Token *handleSimpleCase(Lexer *const lexer)
         return NULL;
     }
 
-    size_t size = 3;
-    char *text = (char *)malloc(size * sizeof(char));
+    //The longest operators, `<<=` and `>>=`, and their terminator
+    size_t size = 4;
+    char *text = (char *)allocateMemory(MEMORY_TOKEN_TEXT, size * sizeof(char));
     if (text == NULL)
     {
         fprintf(stderr, "Memory allocation for Token text failed!\n");
@@ -1098,7 +1108,7 @@ static Token *handleSimpleCase(Lexer *const lexer)
         }
         else if (peekChar(lexer) == '/' || peekChar(lexer) == '*')
         {
-            free(text);
+            releaseMemory(MEMORY_TOKEN_TEXT, text);
             return NULL;
         }
         type = TOKEN_SLASH;
@@ -1226,7 +1236,7 @@ static Token *handleSimpleCase(Lexer *const lexer)
         type = TOKEN_BITWISE_XOR;
         break;
     default:
-        free(text);
+        releaseMemory(MEMORY_TOKEN_TEXT, text);
         return NULL;
     }
 
@@ -1239,7 +1249,7 @@ static Token *handleSimpleCase(Lexer *const lexer)
                                 PUBLIC LEXER FUNCTIONS START HERE                                
  *****************************************************************************************************/
 
-Lexer *createLexer(const char *const input)
+Lexer *createLexer(const char *const input, const SourceLoc fileStart)
 {
     if (input == NULL) {
         fprintf(stderr, "Invalid input.\n");
@@ -1253,7 +1263,8 @@ Lexer *createLexer(const char *const input)
         return NULL;
     }
 
-    lexer->tokenStartingPos = 0;
+    lexer->fileStart = fileStart;
+    lexer->tokenStartingPos = fileStart;
     lexer->input = strdup(input);
     if (lexer->input == NULL)
     {
@@ -1265,9 +1276,13 @@ Lexer *createLexer(const char *const input)
     lexer->charCount = strlen(lexer->input);
     lexer->position = 0;
     
-    lexer->errorsSize = 10;
-    lexer->errors = malloc(lexer->errorsSize * sizeof(Error *));
-    lexer->errorCount = 0;
+    lexer->diagnostics = createDiagnosticEngine();
+    if (lexer->diagnostics == NULL)
+    {
+        free((char *)lexer->input);
+        free(lexer);
+        return NULL;
+    }
 
     return lexer;
 }
@@ -1279,8 +1294,7 @@ void deleteLexer(Lexer *const lexer)
         return;
     }
 
-    deleteErrors(lexer->errors, lexer->errorCount);
-    free(lexer->errors);
+    deleteDiagnosticEngine(lexer->diagnostics);
     
     free((char *)lexer->input);
     free(lexer);
@@ -1294,6 +1308,13 @@ Token *lex(Lexer *const lexer)
         return NULL;
     }
 
+    //Past the error limit the rest of the input is skipped, so the next token is the end of file
+    if (isDiagnosticLimitReached(lexer->diagnostics))
+    {
+        lexer->position = lexer->charCount;
+        updateStartingPos(lexer);
+    }
+
     Token *token = NULL;
 
     if (token == NULL) token = handleSimpleCase(lexer);
@@ -1307,7 +1328,7 @@ Token *lex(Lexer *const lexer)
     //Unknown
     if(token == NULL)
     {
-        char *text = (char *)malloc(2 * sizeof(char));
+        char *text = (char *)allocateMemory(MEMORY_TOKEN_TEXT, 2 * sizeof(char));
         if (text == NULL)
         {
             fprintf(stderr, "Memory allocation for Token text failed!\n");
@@ -1317,7 +1338,7 @@ Token *lex(Lexer *const lexer)
         consumeChar(lexer, 1);
         text[1] = '\0';
         token = createTokenNone(text, lexer->tokenStartingPos, TOKEN_UNKNOWN);
-        addError(lexer, createError(ERROR_LEXING, "Unknown character found while lexing!", duplicateToken(token)));
+        addError(lexer, DIAG_UNKNOWN_CHARACTER, token);
     }
 
     updateStartingPos(lexer);
@@ -7,7 +7,7 @@
 #include <string.h>
 #include "../utils/token.h"
 #include "../utils/my_string.h"
-#include "../utils/error.h"
+#include "../utils/diagnostic.h"
 
 /**
  * Represents a lexical analyzer (lexer) for processing input text.
@@ -15,7 +15,9 @@
  * The `Lexer` structure holds the state and input necessary for tokenizing text.
  * It includes the following fields:
  * 
- * - `tokenStartingPos`: The starting position (index) of the current token being processed in the input string.
+ * - `fileStart`: The `SourceLoc` of the first character of the input, handed out by a `SourceManager`.
+ * 
+ * - `tokenStartingPos`: The `SourceLoc` of the first character of the current token being processed.
  * 
  * - `input`: A pointer to a constant string that contains the text to be lexically analyzed. 
  *            The input string is not modified by the lexer.
@@ -24,11 +26,8 @@
  * 
  * - `position`: The current position (index) in the input string from which the lexer is reading.
  * 
- * - `errors`: An array of pointers to `Error` objects representing any lexical errors encountered during analysis.
- * 
- * - `errorCount`: The number of errors currently stored in the `errors` array.
- * 
- * - `errorsSize`: The allocated size of the `errors` array. This may be larger than `errorCount` to accommodate additional errors.
+ * - `diagnostics`: The `DiagnosticEngine` the lexical errors are recorded in. Once its limit is reached,
+ *                  the rest of the input is skipped.
  * 
  * The `Lexer` struct is used by various functions to perform lexical analysis, including tokenizing and character consumption.
  * 
@@ -37,13 +36,12 @@
  */
 typedef struct lexer
 {
-    int tokenStartingPos;
+    SourceLoc fileStart;    /** The location of the first character of the input. */
+    SourceLoc tokenStartingPos; /** The location of the current token. */
     const char *input;      /** Pointer to the constant input string to be analyzed. */
     size_t charCount;       /** Total number of characters in the input string. */
     size_t position;        /** Current position (index) in the input string. */
-    Error **errors;         /** Array of pointers to `Error` objects representing lexical errors. */
-    size_t errorCount;      /** Number of errors currently stored in the `errors` array. */
-    size_t errorsSize;      /** Allocated size of the `errors` array. */
+    DiagnosticEngine *diagnostics; /** The lexical errors. */
 } Lexer;
 
 /**
@@ -55,10 +53,13 @@ typedef struct lexer
  * @param input A pointer to the input string to be used by the lexer. This string is copied and managed by
  *              the newly created `Lexer` object. The input string must not be NULL.
  * 
+ * @param fileStart The `SourceLoc` the input starts at, as returned by `addSourceFile`. Use 0 for a
+ *                  single input that is not registered with a `SourceManager`.
+ * 
  * @return A pointer to the newly created `Lexer` object, or `NULL` if memory allocation fails or the input
  *         string is NULL. The returned `Lexer` object is initialized with:
  * 
- *         - `tokenStartingPos`: Set to `0`.
+ *         - `fileStart` and `tokenStartingPos`: Set to `fileStart`.
  * 
  *         - `input`: A copy of the provided input string.
  * 
@@ -66,11 +67,7 @@ typedef struct lexer
  * 
  *         - `position`: Initialized to `0`, indicating the starting position in the input string.
  * 
- *         - `errorsSize`: Initialized to `10`, the initial capacity for storing errors.
- * 
- *         - `errors`: Pointer to an array of `Error` pointers, allocated to hold `errorsSize` errors.
- * 
- *         - `errorCount`: Initialized to `0`, indicating no errors have been recorded yet.
+ *         - `diagnostics`: An empty `DiagnosticEngine` with the default error limit.
  * 
  * @note The caller is responsible for managing the lifecycle of the `Lexer` object. When the `Lexer` is
  *       no longer needed, it should be cleaned up using the `deleteLexer` function to free all allocated memory.
@@ -79,7 +76,7 @@ typedef struct lexer
  *       If memory allocation for the `Lexer` or its input fails, appropriate error messages are printed, and
  *       `NULL` is returned.
  */
-Lexer *createLexer(const char *const input);
+Lexer *createLexer(const char *const input, const SourceLoc fileStart);
 
 /**
  * Deletes a `Lexer` object and frees its associated memory.
@@ -88,9 +85,7 @@ Lexer *createLexer(const char *const input);
  * 
  * - The input string (`input`).
  * 
- * - The array of error pointers (`errors`).
- * 
- * It also calls `deleteErrors` to clean up the individual `Error` objects stored in the `errors` array.
+ * - The recorded diagnostics (`diagnostics`).
  * 
  * @param lexer A pointer to the `Lexer` object to be deleted. If `lexer` is `NULL`, the function does nothing.
  */
@@ -116,7 +111,10 @@ void deleteLexer(Lexer *const lexer);
  * - Comments: Single-line (`//`) and multi-line (`/ * ... * /`) comments which are removed from the token stream.
  * 
  * If none of these cases apply, the function defaults to returning an unknown token.
- * 
+ *
+ * Once the error limit of the lexer's `diagnostics` is reached, the rest of the input is skipped
+ * and the end of file token is returned.
+ *
  * @param lexer Pointer to the `Lexer` object that provides access to the input source code stream.
  *              The `Lexer` must be initialized and properly set up before being passed to this function.
  * 
@@ -1,11 +1,55 @@
 #include "parser.h"
+#include "parser_tables.h"
 
 /*****************************************************************************************************
                             PRIVATE PARSER FUNCTIONS DECLARATIONS START HERE
  *****************************************************************************************************/
 
+/* Size of the blocks the AST arena allocates */
+#define PARSER_ARENA_BLOCK_SIZE (64 * 1024)
+
+/* Initial size of the token array of a streaming parser */
+#define PARSER_STREAM_TOKEN_CAPACITY 1024
+
+/* Checks whether the generated prediction table selects only `alternative` of `rule` for the next token */
+#define PARSER_PREDICTS(parser, rule, alternative) (predictAlternative((parser), PREDICT_ROW_##rule) == PREDICT_##rule##_##alternative)
+
+#ifdef PARSER_STATS
+/* Counts a call to the predicate of `rule` */
+#define PARSER_RULE_CALL(parser, rule) ((parser)->stats[(rule)].calls++)
+
+/* Checks the next token against the generated FIRST masks of `rule` and counts a rejected call */
+#define PARSER_RULE_FIRST(parser, rule)                                           \
+    (canStartRule((parser), FIRST_##rule##_TOKENS, FIRST_##rule##_KEYWORDS) ||  \
+     ((parser)->stats[PARSER_RULE_##rule].prefiltered++, 0))
+
+/* Counts a successful recognition of `rule`, evaluates to 1 */
+#define PARSER_RULE_ACCEPT(parser, rule) ((parser)->stats[(rule)].successes++, 1)
+
+/* Resets the position to `lookahead` and counts the rewind and the tokens given back */
+#define PARSER_RULE_REWIND(parser, rule, lookahead)                                     \
+    ((parser)->stats[(rule)].rewinds++,                                                 \
+     (parser)->stats[(rule)].tokensRescanned += (parser)->position - (size_t)(lookahead), \
+     (parser)->position = (lookahead))
+#else
+#define PARSER_RULE_CALL(parser, rule) ((void)0)
+#define PARSER_RULE_FIRST(parser, rule) canStartRule((parser), FIRST_##rule##_TOKENS, FIRST_##rule##_KEYWORDS)
+#define PARSER_RULE_ACCEPT(parser, rule) (1)
+#define PARSER_RULE_REWIND(parser, rule, lookahead) ((parser)->position = (lookahead))
+#endif
+
+static int isParsedToken(const Token *const token);
+
+static Parser *setupParser(Parser *const parser, Token **const tokens, const size_t tokenCount, const size_t tokensSize);
+
+static void pullTokens(Parser *const parser, const size_t count);
+
 static Token *nextToken(const Parser *const parser);
 
+static int canStartRule(const Parser *const parser, const uint64_t tokenMask, const uint64_t keywordMask);
+
+static int predictAlternative(const Parser *const parser, const PredictRow row);
+
 static void consumeToken(Parser *const parser, const size_t count);
 
 static Token *matchToken(Parser *parser, TokenType type);
@@ -14,7 +58,11 @@ static int isNextTokenTypeOf(Parser *parser, TokenType type, int consumeOnSucces
 
 static int isNextTokenKeywordWord(Parser *parser, Keywords keyword, int consumeOnSuccess);
 
-static int addError(Parser *parser, Error *error);
+static int addExpectedError(Parser *parser, const char *const expected);
+
+static ASTNode *createSharedASTNode(Parser *parser, const ASTArenaMark mark, const ASTType type, Token **const tokens, const size_t tokenCount, ASTNode **const children, const size_t childCount);
+
+static uint64_t traceGlobalDeclaration(const Parser *const parser, const size_t first, const uint64_t start);
 
 static ASTNode *parseProgram(Parser *parser);
 
@@ -274,6 +322,227 @@ static ASTNode *parseJumpStatement(Parser *parser);
                                 PRIVATE PARSER FUNCTIONS START HERE
  *****************************************************************************************************/
 
+#ifdef PARSER_STATS
+/**
+ * Lookup table for ParserRule
+ */
+static const char *const parserRuleNames[] = {
+    [PARSER_RULE_GLOBAL_DECLARATION] = "isGlobalDeclaration",
+    [PARSER_RULE_FUNCTION_DEFINITION] = "isFunctionDefinition",
+    [PARSER_RULE_DECLARATION_SPECIFIERS] = "isDeclarationSpecifiers",
+    [PARSER_RULE_STORAGE_CLASS_SPECIFIER] = "isStorageClassSpecifier",
+    [PARSER_RULE_TYPE_SPECIFIER] = "isTypeSpecifier",
+    [PARSER_RULE_STRUCT_OR_UNION_SPECIFIER] = "isStructOrUnionSpecifier",
+    [PARSER_RULE_STRUCT_DECLARATION] = "isStructDeclaration",
+    [PARSER_RULE_SPECIFIER_QUALIFIER] = "isSpecifierQualifier",
+    [PARSER_RULE_TYPE_QUALIFIER] = "isTypeQualifier",
+    [PARSER_RULE_STRUCT_DECLARATOR_LIST] = "isStructDeclaratorList",
+    [PARSER_RULE_STRUCT_DECLARATOR] = "isStructDeclarator",
+    [PARSER_RULE_DECLARATOR] = "isDeclarator",
+    [PARSER_RULE_POINTER] = "isPointer",
+    [PARSER_RULE_DIRECT_DECLARATOR] = "isDirectDeclarator",
+    [PARSER_RULE_DIRECT_DECLARATOR_PRIME] = "isDirectDeclaratorPrime",
+    [PARSER_RULE_ASSIGNMENT_EXPRESSION] = "isAssignmentExpression",
+    [PARSER_RULE_ASSIGNMENT_OPERATOR] = "isAssignmentOperator",
+    [PARSER_RULE_CONDITIONAL_EXPRESSION] = "isConditionalExpression",
+    [PARSER_RULE_LOGICAL_OR_EXPRESSION] = "isLogicalORExpression",
+    [PARSER_RULE_LOGICAL_AND_EXPRESSION] = "isLogicalANDExpression",
+    [PARSER_RULE_BITWISE_OR_EXPRESSION] = "isBitwiseORExpression",
+    [PARSER_RULE_BITWISE_XOR_EXPRESSION] = "isBitwiseXORExpression",
+    [PARSER_RULE_BITWISE_AND_EXPRESSION] = "isBitwiseANDExpression",
+    [PARSER_RULE_EQUALITY_EXPRESSION] = "isEqualityExpression",
+    [PARSER_RULE_EQUALITY_OPERATOR] = "isEqualityOperator",
+    [PARSER_RULE_RELATIONAL_EXPRESSION] = "isRelationalExpression",
+    [PARSER_RULE_RELATIONAL_OPERATOR] = "isRelationalOperator",
+    [PARSER_RULE_SHIFT_EXPRESSION] = "isShiftExpression",
+    [PARSER_RULE_SHIFT_OPERATOR] = "isShiftOperator",
+    [PARSER_RULE_ADDITIVE_EXPRESSION] = "isAdditiveExpression",
+    [PARSER_RULE_ADDITIVE_OPERATOR] = "isAdditiveOperator",
+    [PARSER_RULE_MULTIPLICATIVE_EXPRESSION] = "isMultiplicativeExpression",
+    [PARSER_RULE_MULTIPLICATIVE_OPERATOR] = "isMultiplicativeOperator",
+    [PARSER_RULE_CAST_EXPRESSION] = "isCastExpression",
+    [PARSER_RULE_UNARY_EXPRESSION] = "isUnaryExpression",
+    [PARSER_RULE_PREFIX_UNARY_OPERATOR] = "isPrefixUnaryOperator",
+    [PARSER_RULE_UNARY_OPERATOR] = "isUnaryOperator",
+    [PARSER_RULE_POSTFIX_EXPRESSION] = "isPostfixExpression",
+    [PARSER_RULE_POSTFIX_EXPRESSION_PRIME] = "isPostfixExpressionPrime",
+    [PARSER_RULE_PRIMARY_EXPRESSION] = "isPrimaryExpression",
+    [PARSER_RULE_LITERAL] = "isLiteral",
+    [PARSER_RULE_EXPRESSION] = "isExpression",
+    [PARSER_RULE_TYPE_NAME] = "isTypeName",
+    [PARSER_RULE_ABSTRACT_DECLARATOR] = "isAbstractDeclarator",
+    [PARSER_RULE_DIRECT_ABSTRACT_DECLARATOR] = "isDirectAbstractDeclarator",
+    [PARSER_RULE_DIRECT_ABSTRACT_DECLARATOR_PRIME] = "isDirectAbstractDeclaratorPrime",
+    [PARSER_RULE_PARAMETER_LIST] = "isParameterList",
+    [PARSER_RULE_PARAMETER_DECLARATION] = "isParameterDeclaration",
+    [PARSER_RULE_INITIALIZER_LIST] = "isInitializerList",
+    [PARSER_RULE_DESIGNATION] = "isDesignation",
+    [PARSER_RULE_DESIGNATOR] = "isDesignator",
+    [PARSER_RULE_CONSTANT_EXPRESSION] = "isConstantExpression",
+    [PARSER_RULE_INITIALIZER] = "isInitializer",
+    [PARSER_RULE_IDENTIFIER_LIST] = "isIdentifierList",
+    [PARSER_RULE_ENUM_SPECIFIER] = "isEnumSpecifier",
+    [PARSER_RULE_ENUMERATOR_LIST] = "isEnumeratorList",
+    [PARSER_RULE_ENUMERATOR] = "isEnumerator",
+    [PARSER_RULE_DECLARATION] = "isDeclaration",
+    [PARSER_RULE_INIT_DECLARATOR_LIST] = "isInitDeclaratorList",
+    [PARSER_RULE_INIT_DECLARATOR] = "isInitDeclarator",
+    [PARSER_RULE_STATEMENT] = "isStatement",
+    [PARSER_RULE_LABELED_STATEMENT] = "isLabeledStatement",
+    [PARSER_RULE_COMPOUND_STATEMENT] = "isCompoundStatement",
+    [PARSER_RULE_EXPRESSION_STATEMENT] = "isExpressionStatement",
+    [PARSER_RULE_SELECTION_STATEMENT] = "isSelectionStatement",
+    [PARSER_RULE_ITERATION_STATEMENT] = "isIterationStatement",
+    [PARSER_RULE_FOR_CONTROL] = "isForControl",
+    [PARSER_RULE_JUMP_STATEMENT] = "isJumpStatement",
+};
+
+/**
+ * Checks whether one grammar rule was more expensive than another.
+ * 
+ * A rule is more expensive if its rewinds gave back more tokens; rules that re-scanned the
+ * same number of tokens are ordered by the number of calls. Used by `printParseStats` to
+ * sort the report.
+ * 
+ * @param first The counters of the first rule.
+ * 
+ * @param second The counters of the second rule.
+ * 
+ * @return 1 if `first` is more expensive than `second`, 0 otherwise.
+ */
+static int isRuleMoreExpensive(const ParserRuleStats *const first, const ParserRuleStats *const second)
+{
+    if (first->tokensRescanned != second->tokensRescanned)
+    {
+        return first->tokensRescanned > second->tokensRescanned;
+    }
+
+    return first->calls > second->calls;
+}
+#endif
+
+/**
+ * Checks whether a token is seen by the parser. Whitespace and comments are filtered out.
+ * 
+ * @param token The token to check.
+ * 
+ * @return 1 if the parser keeps the token, 0 otherwise.
+ */
+static int isParsedToken(const Token *const token)
+{
+    return token->type != TOKEN_WHITESPACE && token->type != TOKEN_BLOCK_COMMENT && token->type != TOKEN_LINE_COMMENT;
+}
+
+/**
+ * Initializes the fields of a `Parser` shared by `createParser` and `createStreamingParser`.
+ * 
+ * @param parser The allocated `Parser`.
+ * 
+ * @param tokens The filtered token array. The `Parser` takes ownership of it.
+ * 
+ * @param tokenCount The number of tokens in the array.
+ * 
+ * @param tokensSize The allocated size of the array.
+ * 
+ * @return The `Parser`, or NULL if memory allocation fails. On failure the `Parser` and the
+ *         token array are freed.
+ */
+static Parser *setupParser(Parser *const parser, Token **const tokens, const size_t tokenCount, const size_t tokensSize)
+{
+    parser->tokens = tokens;
+    parser->tokenCount = tokenCount;
+    parser->tokensSize = tokensSize;
+    parser->position = 0;
+    parser->tokenQueue = NULL;
+    parser->tokenStreamFailed = 0;
+    parser->ASTroot = NULL;
+    parser->sharedNodes = NULL;
+
+    parser->arena = createASTArena(PARSER_ARENA_BLOCK_SIZE);
+    if (parser->arena == NULL)
+    {
+        fprintf(stderr, "Memory allocation for Parser->arena failed!\n");
+        releaseMemory(MEMORY_PARSER_SCRATCH, parser->tokens);
+        releaseMemory(MEMORY_PARSER_SCRATCH, parser);
+        return NULL;
+    }
+
+    parser->diagnostics = createDiagnosticEngine();
+    if (parser->diagnostics == NULL)
+    {
+        deleteASTArena(parser->arena);
+        releaseMemory(MEMORY_PARSER_SCRATCH, parser->tokens);
+        releaseMemory(MEMORY_PARSER_SCRATCH, parser);
+        return NULL;
+    }
+
+#ifdef PARSER_STATS
+    memset(parser->stats, 0, sizeof(parser->stats));
+#endif
+
+    return parser;
+}
+
+/**
+ * Pulls tokens from the token queue of a streaming parser until the token array holds `count` tokens.
+ * 
+ * Whitespace and comments are skipped. Pulling stops early at the end of file token, which
+ * detaches the queue from the parser. If the queue is closed without an end of file token, an
+ * end of file token is allocated from the arena instead, so the token array always ends with
+ * one, and `tokenStreamFailed` is set.
+ * 
+ * If the parser has no queue, the function does nothing.
+ * 
+ * @param parser Pointer to the `Parser` object. This pointer is non-const and will be modified by this function.
+ * 
+ * @param count The number of tokens the token array should hold.
+ */
+static void pullTokens(Parser *const parser, const size_t count)
+{
+    while (parser->tokenQueue != NULL && parser->tokenCount < count)
+    {
+        Token *token = popTokenQueue(parser->tokenQueue);
+        if (token == NULL)
+        {
+            parser->tokenQueue = NULL;
+            parser->tokenStreamFailed = 1;
+            token = allocateFromASTArena(parser->arena, sizeof(Token));
+            if (token == NULL)
+            {
+                fprintf(stderr, "Memory allocation for the end of file Token failed!\n");
+                return;
+            }
+            token->text = "";
+            token->loc = SOURCE_LOC_INVALID;
+            token->type = TOKEN_EOF;
+            memset(&token->value, 0, sizeof(token->value));
+        }
+        else if (!isParsedToken(token))
+        {
+            continue;
+        }
+
+        if (parser->tokenCount >= parser->tokensSize)
+        {
+            Token **newTokens = reallocateMemory(MEMORY_PARSER_SCRATCH, parser->tokens, 2 * parser->tokensSize * sizeof(Token *));
+            if (newTokens == NULL)
+            {
+                fprintf(stderr, "Memory reallocation for Parser->tokens failed!\n");
+                parser->tokenStreamFailed = 1;
+                return;
+            }
+            parser->tokens = newTokens;
+            parser->tokensSize *= 2;
+        }
+        parser->tokens[parser->tokenCount++] = token;
+
+        if (token->type == TOKEN_EOF)
+        {
+            parser->tokenQueue = NULL;
+        }
+    }
+}
+
 /**
  * Retrieves the token at the current position in the parser's token array.
  * 
@@ -298,6 +567,60 @@ static Token *nextToken(const Parser *const parser)
     return parser->tokens[parser->position];
 }
 
+/**
+ * Checks whether the next token can start a grammar rule.
+ * 
+ * The masks are the rule's FIRST set generated from `grammar.md` into `parser_tables.h`: a
+ * keyword is looked up in `keywordMask` by its `Keywords` value, every other token in `tokenMask`
+ * by its `TokenType`. The `isX` predicates call this before trying any of their alternatives, so
+ * a rule that cannot match is rejected without recursing into its sub rules.
+ * 
+ * @param parser Pointer to the `Parser` object. This pointer is const and should not be modified by this function.
+ * 
+ * @param tokenMask The `TokenType` bits of the rule's FIRST set.
+ * 
+ * @param keywordMask The `Keywords` bits of the rule's FIRST set.
+ * 
+ * @return 1 if the next token is in the FIRST set, 0 otherwise.
+ */
+static int canStartRule(const Parser *const parser, const uint64_t tokenMask, const uint64_t keywordMask)
+{
+    const Token *token = nextToken(parser);
+    if (token->type == TOKEN_KEYWORD && ((keywordMask >> token->value.keyword) & 1))
+    {
+        return 1;
+    }
+
+    return (tokenMask >> token->type) & 1;
+}
+
+/**
+ * Looks up which alternative of a grammar rule the next token selects.
+ * 
+ * The row is generated from `grammar.md` into `parser_tables.h`: a keyword is looked up in the
+ * keyword columns by its `Keywords` value, every other token in the token columns by its
+ * `TokenType`. The `parseX` functions use this to call the sub parser of the only alternative
+ * that can start with the next token, instead of re-checking the alternatives with the `isX`
+ * predicates, and fall back to the predicates when the token is ambiguous.
+ * 
+ * @param parser Pointer to the `Parser` object. This pointer is const and should not be modified by this function.
+ * 
+ * @param row The prediction row of the rule.
+ * 
+ * @return The 1 based index of the alternative, 0 if no alternative can start with the next token,
+ *         or `PREDICT_AMBIGUOUS` if several can.
+ */
+static int predictAlternative(const Parser *const parser, const PredictRow row)
+{
+    const Token *token = nextToken(parser);
+    if (token->type == TOKEN_KEYWORD && predictionTable[row][PREDICT_KEYWORD_OFFSET + token->value.keyword] != 0)
+    {
+        return predictionTable[row][PREDICT_KEYWORD_OFFSET + token->value.keyword];
+    }
+
+    return predictionTable[row][token->type];
+}
+
 /**
  * Advances the position in the parser’s token array by a specified number of tokens.
  * 
@@ -318,6 +641,9 @@ static void consumeToken(Parser *const parser, const size_t count)
         return;
     }
     
+    //A streaming parser may not have pulled the token yet
+    pullTokens(parser, parser->position + count + 1);
+
     if (parser->position + count >= parser->tokenCount)
     {
         parser->position = parser->tokenCount - 1;
@@ -359,19 +685,24 @@ static Token *matchToken(Parser *parser, const TokenType type)
         return token;
     }
 
-    char *text = strdup(nextToken(parser)->text);
-    if (text == NULL)
+    //The AST keeps an unknown token from the arena that borrows the text of the unexpected one
+    Token *found = nextToken(parser);
+    Token *token = allocateFromASTArena(parser->arena, sizeof(Token));
+    if (token == NULL)
     {
-        fprintf(stderr, "Memory allocation for Token text failed!\n");
+        fprintf(stderr, "Memory allocation for Token failed!\n");
         return NULL;
     }
-    Token *token = createTokenNone(text, nextToken(parser)->start ,TOKEN_UNKNOWN);
+    *token = *found;
+    token->type = TOKEN_UNKNOWN;
+    memset(&token->value, 0, sizeof(token->value));
 
-    char message[128] = "Expected token of type, ";
-    strcat(message, getType(type));
-    strcat(message, " but found:");
-    strcat(message, getType(nextToken(parser)->type));
-    addError(parser, createError(ERROR_PARSING, message, token));
+    DiagnosticArg args[2];
+    args[0].kind = DIAG_ARG_TOKEN_TYPE;
+    args[0].value.tokenType = type;
+    args[1].kind = DIAG_ARG_TOKEN;
+    args[1].value.token = found;
+    reportDiagnostic(parser->diagnostics, DIAG_EXPECTED_TOKEN, found->loc, found->text != NULL ? strlen(found->text) : 0, args, 2);
     return token;
 }
 
@@ -460,27 +791,20 @@ static int isNextTokenKeywordWord(Parser *parser, Keywords keyword, int consumeO
 }
 
 /**
- * Adds an `Error` object to the `Parser`'s error list.
+ * Reports that the `Parser` expected a grammar rule and found the next token instead.
  * 
- * This function appends a new error to the `Parser`'s list of errors. If the internal
- * error storage array is full, it will be dynamically resized to accommodate additional
- * errors. The function ensures that the error list is properly maintained and expanded 
- * as needed.
+ * The name of the rule and a copy of the token are recorded in the `Parser`'s diagnostics,
+ * the message is formatted when they are printed.
  * 
- * @param parser Pointer to the `Parser` object that maintains the list of errors. 
+ * @param parser Pointer to the `Parser` object that records the diagnostics. 
  *               The `Parser` must be initialized before being passed to this function.
  * 
- * @param error  Pointer to the `Error` object to be added to the list. 
- *               The `Error` object must be valid and properly initialized.
+ * @param expected The name of the rule with its article, like `"a Declaration"`. It must be a
+ *                 string literal, only the pointer is recorded.
  * 
- * @return 1 if the error was successfully added to the list; 0 if there was a problem 
- *         (e.g., if the `parser` or `error` is NULL, or if memory allocation fails).
- * 
- * @note If memory needs to be reallocated for the error list and the reallocation fails, 
- *       the function reports the error and returns 0. It is the caller's responsibility to 
- *       ensure that the `Error` objects are managed and freed appropriately.
+ * @return 1 if the diagnostic was recorded; 0 otherwise, such as after the error limit.
  */
-static int addError(Parser *parser, Error *error)
+static int addExpectedError(Parser *parser, const char *const expected)
 {
     if (parser == NULL)
     {
@@ -488,26 +812,96 @@ static int addError(Parser *parser, Error *error)
         return 0;
     }
 
-    if (error == NULL)
+    const Token *found = nextToken(parser);
+    DiagnosticArg args[2];
+    args[0].kind = DIAG_ARG_NAME;
+    args[0].value.name = expected;
+    args[1].kind = DIAG_ARG_TOKEN;
+    args[1].value.token = found;
+    return reportDiagnostic(parser->diagnostics, DIAG_EXPECTED_RULE, found->loc, found->text != NULL ? strlen(found->text) : 0, args, 2);
+}
+
+/**
+ * Creates an `ASTNode` in the parser's arena, sharing an identical node if sharing is enabled.
+ * 
+ * If the parser shares nodes and an earlier node has the same type, tokens and children, the
+ * arena is rewound to `mark`, releasing the arrays allocated for the new node, and the earlier
+ * node is returned. Otherwise the node is created and, if sharing is enabled, remembered.
+ * 
+ * Rewinding is safe because a node can only be identical to an earlier one if its children
+ * are earlier nodes too, so nothing allocated after `mark` is still referenced.
+ * 
+ * @param parser Pointer to the `Parser` object whose arena the node is allocated from.
+ * 
+ * @param mark   The arena position taken before the tokens and children arrays were allocated.
+ * 
+ * @param type       The type of the node.
+ * 
+ * @param tokens     The tokens of the node, allocated from the parser's arena after `mark`.
+ * 
+ * @param tokenCount The number of tokens.
+ * 
+ * @param children   The children of the node, allocated from the parser's arena after `mark`.
+ * 
+ * @param childCount The number of children.
+ * 
+ * @return A pointer to the new or the shared node, or NULL if memory allocation fails.
+ */
+static ASTNode *createSharedASTNode(Parser *parser, const ASTArenaMark mark, const ASTType type, Token **const tokens, const size_t tokenCount, ASTNode **const children, const size_t childCount)
+{
+    if (parser->sharedNodes == NULL)
+    {
+        return createArenaASTNode(parser->arena, type, tokens, tokenCount, children, childCount);
+    }
+
+    ASTNode *sharedNode = findInternedASTNode(parser->sharedNodes, type, tokens, tokenCount, children, childCount);
+    if (sharedNode != NULL)
+    {
+        rewindASTArena(parser->arena, mark);
+        return sharedNode;
+    }
+
+    ASTNode *astNode = createArenaASTNode(parser->arena, type, tokens, tokenCount, children, childCount);
+    if (astNode != NULL && !addInternedASTNode(parser->sharedNodes, astNode))
+    {
+        fprintf(stderr, "Failed to share AST Node, it is kept unshared.\n");
+    }
+
+    return astNode;
+}
+
+/**
+ * Records the global declaration that ends at the current position as a span of the trace,
+ * named after its first identifier, with its token count as the value.
+ *
+ * @param parser The parser that read the declaration.
+ *
+ * @param first The position of the first token of the declaration.
+ *
+ * @param start The time the declaration started at, from `getTraceTime`.
+ *
+ * @return The time the span ended at, the start of the next declaration, or 0 when no trace
+ *         is being recorded.
+ */
+static uint64_t traceGlobalDeclaration(const Parser *const parser, const size_t first, const uint64_t start)
+{
+    if (!isTracing())
     {
-        fprintf(stderr, "Error is not initialized.\n");
         return 0;
     }
 
-    if (parser->errorCount + 1 >= parser->errorsSize)
+    const char *name = NULL;
+    for (size_t i = first; name == NULL && i < parser->position; i++)
     {
-        parser->errorsSize *= 2;
-        Error **newErrors = realloc(parser->errors, parser->errorsSize * sizeof(Error *));
-        if (newErrors == NULL)
+        if (parser->tokens[i]->type == TOKEN_IDENTIFIER)
         {
-            fprintf(stderr, "Memory reallocation for Errors failed!\n");
-            return 0;
+            name = parser->tokens[i]->text;
         }
-        parser->errors = newErrors;
     }
 
-    parser->errors[parser->errorCount++] = error;
-    return 1;
+    uint64_t end = getTraceTime();
+    recordTraceSpan("global declaration", "parser", start, end, name, (int64_t)(parser->position - first));
+    return end;
 }
 
 static ASTNode *parseProgram(Parser *parser)
@@ -520,7 +914,7 @@ static ASTNode *parseProgram(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -528,43 +922,44 @@ static ASTNode *parseProgram(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
 
     //Parsing
+    uint64_t declarationStart = isTracing() ? getTraceTime() : 0;
     while (isGlobalDeclaration(parser, 1))
     {
+        size_t declarationPosition = parser->position;
+
         if (childCount + 1 >= childrenSize)
         {
-            childrenSize *= 2;
-            ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+            ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
             if (newChildren == NULL)
             {
                 fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                free(tokens);
-                free(children);
                 return NULL;
             }
             children = newChildren;
+            childrenSize *= 2;
         }
 
         children[childCount++] = parseGlobalDeclaration(parser);
+        declarationStart = traceGlobalDeclaration(parser, declarationPosition, declarationStart);
     }
 
     if (nextToken(parser)->type != TOKEN_EOF)
     {
-        addError(parser, createError(ERROR_PARSING, "Expected a Global Declaration but found:", duplicateToken(nextToken(parser))));
+        addExpectedError(parser, "a Global Declaration");
         return NULL;
     }
 
     tokens[tokenCount++] = matchToken(parser, TOKEN_EOF);
-    return createASTNode(AST_PROGRAM, tokens, tokenCount, children, childCount);
+    return createArenaASTNode(parser->arena, AST_PROGRAM, tokens, tokenCount, children, childCount);
 }
 
 static int isGlobalDeclaration(Parser *parser, const int resetOnSuccess)
@@ -575,25 +970,31 @@ static int isGlobalDeclaration(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_GLOBAL_DECLARATION);
+    if (!PARSER_RULE_FIRST(parser, GLOBAL_DECLARATION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isFunctionDefinition(parser, 0))
     {
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_GLOBAL_DECLARATION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_GLOBAL_DECLARATION);
     }
     else if (isDeclaration(parser, 0))
     {
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_GLOBAL_DECLARATION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_GLOBAL_DECLARATION);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_GLOBAL_DECLARATION, lookaheadPosition);
     return 0;
 }
 
@@ -616,7 +1017,7 @@ static ASTNode *parseGlobalDeclaration(Parser *parser)
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Global Declaration but found:", duplicateToken(nextToken(parser))));
+    addExpectedError(parser, "a Global Declaration");
     return NULL;
 }
 
@@ -628,6 +1029,12 @@ static int isFunctionDefinition(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_FUNCTION_DEFINITION);
+    if (!PARSER_RULE_FIRST(parser, FUNCTION_DEFINITION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isDeclarationSpecifiers(parser, 0))
     {
@@ -635,18 +1042,18 @@ static int isFunctionDefinition(Parser *parser, const int resetOnSuccess)
         {
             while (isDeclaration(parser, 0));
 
-            if (isCompoundStatement(parser, 1))
+            if (isCompoundStatement(parser, 0))
             {
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_FUNCTION_DEFINITION, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_FUNCTION_DEFINITION);
             }
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_FUNCTION_DEFINITION, lookaheadPosition);
     return 0;
 }
 
@@ -660,7 +1067,7 @@ static ASTNode *parseFunctionDefinition(Parser *parser)
 
     //Allocating memory
     size_t childrenSize = 3;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
@@ -678,15 +1085,14 @@ static ASTNode *parseFunctionDefinition(Parser *parser)
         {
             if (childCount + 2 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
 
             children[childCount++] = parseDeclaration(parser);
@@ -694,12 +1100,11 @@ static ASTNode *parseFunctionDefinition(Parser *parser)
 
         children[childCount++] = parseCompoundStatement(parser);
 
-        return createASTNode(AST_FUNCTION_DEFINITION, NULL, 0, children, childCount);
+        return createArenaASTNode(parser->arena, AST_FUNCTION_DEFINITION, NULL, 0, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Function Definition but found:", duplicateToken(nextToken(parser))));
-    free(children);
+    addExpectedError(parser, "a Function Definition");
     return NULL;
 }
 
@@ -711,6 +1116,12 @@ static int isDeclarationSpecifiers(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_DECLARATION_SPECIFIERS);
+    if (!PARSER_RULE_FIRST(parser, DECLARATION_SPECIFIERS))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isStorageClassSpecifier(parser, 1))
     { }
@@ -720,7 +1131,7 @@ static int isDeclarationSpecifiers(Parser *parser, const int resetOnSuccess)
     { }
     else
     {
-        parser->position = lookaheadPosition;
+        PARSER_RULE_REWIND(parser, PARSER_RULE_DECLARATION_SPECIFIERS, lookaheadPosition);
         return 0;
     }
 
@@ -728,9 +1139,9 @@ static int isDeclarationSpecifiers(Parser *parser, const int resetOnSuccess)
 
     if (resetOnSuccess)
     {
-        parser->position = lookaheadPosition;
+        PARSER_RULE_REWIND(parser, PARSER_RULE_DECLARATION_SPECIFIERS, lookaheadPosition);
     }
-    return 1;
+    return PARSER_RULE_ACCEPT(parser, PARSER_RULE_DECLARATION_SPECIFIERS);
 }
 
 static ASTNode *parseDeclarationSpecifiers(Parser *parser)
@@ -742,8 +1153,9 @@ static ASTNode *parseDeclarationSpecifiers(Parser *parser)
     }
 
     //Allocating memory
+    ASTArenaMark mark = markASTArena(parser->arena);
     size_t tokensSize = 2;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -751,11 +1163,10 @@ static ASTNode *parseDeclarationSpecifiers(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -776,9 +1187,7 @@ static ASTNode *parseDeclarationSpecifiers(Parser *parser)
     else
     {
         //Error
-        addError(parser, createError(ERROR_PARSING, "Expected Declaration Specifiers but found:", duplicateToken(nextToken(parser))));
-        free(tokens);
-        free(children);
+        addExpectedError(parser, "Declaration Specifiers");
         return NULL;
     }
     
@@ -786,29 +1195,25 @@ static ASTNode *parseDeclarationSpecifiers(Parser *parser)
     {
         if (childCount + 1 >= childrenSize)
         {
-            childrenSize *= 2;
-            ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+            ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
             if (newChildren == NULL)
             {
                 fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                free(tokens);
-                free(children);
                 return NULL;
             }
             children = newChildren;
+            childrenSize *= 2;
         }
         if (tokenCount + 1 >= tokensSize)
         {
-            tokensSize *= 2;
-            Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+            Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
             if (newTokens == NULL)
             {
                 fprintf(stderr, "Memory reallocation for Tokens failed!\n");
-                free(tokens);
-                free(children);
                 return NULL;
             }
             tokens = newTokens;
+            tokensSize *= 2;
         }
 
         if (isStorageClassSpecifier(parser, 0) || isNextTokenKeywordWord(parser, KEYWORD_INLINE, 0))
@@ -821,7 +1226,7 @@ static ASTNode *parseDeclarationSpecifiers(Parser *parser)
         }
     }
 
-    return createASTNode(AST_DECLARATION_SPECIFIERS, tokens, tokenCount, children, childCount);
+    return createSharedASTNode(parser, mark, AST_DECLARATION_SPECIFIERS, tokens, tokenCount, children, childCount);
 }
 
 static int isStorageClassSpecifier(Parser *parser, const int consumeOnSuccess)
@@ -832,6 +1237,7 @@ static int isStorageClassSpecifier(Parser *parser, const int consumeOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_STORAGE_CLASS_SPECIFIER);
     if (isNextTokenTypeOf(parser, TOKEN_KEYWORD, 0))
     {
         switch (nextToken(parser)->value.keyword)
@@ -845,7 +1251,7 @@ static int isStorageClassSpecifier(Parser *parser, const int consumeOnSuccess)
             {
                 consumeToken(parser, 1);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_STORAGE_CLASS_SPECIFIER);
         default:
             break;
         }
@@ -862,22 +1268,28 @@ static int isTypeSpecifier(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_TYPE_SPECIFIER);
+    if (!PARSER_RULE_FIRST(parser, TYPE_SPECIFIER))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isStructOrUnionSpecifier(parser, 0))
     {
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_TYPE_SPECIFIER, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_TYPE_SPECIFIER);
     }
     else if (isEnumSpecifier(parser, 0))
     {
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_TYPE_SPECIFIER, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_TYPE_SPECIFIER);
     }
     else if (isNextTokenTypeOf(parser, TOKEN_KEYWORD, 0))
     {
@@ -895,13 +1307,13 @@ static int isTypeSpecifier(Parser *parser, const int resetOnSuccess)
         case KEYWORD_STRING:
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_TYPE_SPECIFIER, lookaheadPosition);
             }
             else
             {
                 consumeToken(parser, 1);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_TYPE_SPECIFIER);
         default:
             break;
         }
@@ -913,13 +1325,13 @@ static int isTypeSpecifier(Parser *parser, const int resetOnSuccess)
             consumeToken(parser, 1);
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_TYPE_SPECIFIER, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_TYPE_SPECIFIER);
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_TYPE_SPECIFIER, lookaheadPosition);
     return 0;
 }
 
@@ -932,8 +1344,9 @@ static ASTNode *parseTypeSpecifier(Parser *parser)
     }
 
     //Allocating memory
+    ASTArenaMark mark = markASTArena(parser->arena);
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -941,11 +1354,10 @@ static ASTNode *parseTypeSpecifier(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -954,17 +1366,17 @@ static ASTNode *parseTypeSpecifier(Parser *parser)
     if (isStructOrUnionSpecifier(parser, 1))
     {
         children[childCount++] = parseStructOrUnionSpecifier(parser);
-        return createASTNode(AST_TYPE_SPECIFIER, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_TYPE_SPECIFIER, tokens, tokenCount, children, childCount);
     }
     else if (isEnumSpecifier(parser , 1))
     {
         children[childCount++] = parseEnumSpecifier(parser);
-        return createASTNode(AST_TYPE_SPECIFIER, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_TYPE_SPECIFIER, tokens, tokenCount, children, childCount);
     }
     else if (isNextTokenTypeOf(parser, TOKEN_IDENTIFIER, 0))
     {
         tokens[tokenCount++] = matchToken(parser, TOKEN_IDENTIFIER);
-        return createASTNode(AST_TYPE_SPECIFIER, tokens, tokenCount, children, childCount);
+        return createSharedASTNode(parser, mark, AST_TYPE_SPECIFIER, tokens, tokenCount, children, childCount);
     }
     else if (isNextTokenTypeOf(parser, TOKEN_KEYWORD, 0))
     {
@@ -981,16 +1393,14 @@ static ASTNode *parseTypeSpecifier(Parser *parser)
         case KEYWORD_UNSIGNED:
         case KEYWORD_STRING:
             tokens[tokenCount++] = matchToken(parser, TOKEN_KEYWORD);
-            return createASTNode(AST_TYPE_SPECIFIER, tokens, tokenCount, children, childCount);
+            return createSharedASTNode(parser, mark, AST_TYPE_SPECIFIER, tokens, tokenCount, children, childCount);
         default:
             break;
         }
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Type Specifier but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Type Specifier");
     return NULL;
 }
 
@@ -1002,6 +1412,12 @@ static int isStructOrUnionSpecifier(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_STRUCT_OR_UNION_SPECIFIER);
+    if (!PARSER_RULE_FIRST(parser, STRUCT_OR_UNION_SPECIFIER))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isNextTokenKeywordWord(parser, KEYWORD_STRUCT, 1) || isNextTokenKeywordWord(parser, KEYWORD_UNION, 1))
     {
@@ -1011,9 +1427,9 @@ static int isStructOrUnionSpecifier(Parser *parser, const int resetOnSuccess)
             {
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_STRUCT_OR_UNION_SPECIFIER, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_STRUCT_OR_UNION_SPECIFIER);
             }
         }
 
@@ -1027,15 +1443,15 @@ static int isStructOrUnionSpecifier(Parser *parser, const int resetOnSuccess)
                 {
                     if (resetOnSuccess)
                     {
-                        parser->position = lookaheadPosition;
+                        PARSER_RULE_REWIND(parser, PARSER_RULE_STRUCT_OR_UNION_SPECIFIER, lookaheadPosition);
                     }
-                    return 1;
+                    return PARSER_RULE_ACCEPT(parser, PARSER_RULE_STRUCT_OR_UNION_SPECIFIER);
                 }
             }
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_STRUCT_OR_UNION_SPECIFIER, lookaheadPosition);
     return 0;
 }
 
@@ -1049,7 +1465,7 @@ static ASTNode *parseStructOrUnionSpecifier(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 4;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -1057,11 +1473,10 @@ static ASTNode *parseStructOrUnionSpecifier(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -1075,8 +1490,7 @@ static ASTNode *parseStructOrUnionSpecifier(Parser *parser)
             tokens[tokenCount++] = matchToken(parser, TOKEN_IDENTIFIER);
             if (!isNextTokenTypeOf(parser, TOKEN_OPEN_CURLY, 0))
             {
-                printf("Here\n");
-                return createASTNode(AST_STRUCT_OR_UNION_SPECIFIER, tokens, tokenCount, children, childCount);
+                return createArenaASTNode(parser->arena, AST_STRUCT_OR_UNION_SPECIFIER, tokens, tokenCount, children, childCount);
             }
         }
 
@@ -1087,29 +1501,25 @@ static ASTNode *parseStructOrUnionSpecifier(Parser *parser)
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
 
             children[childCount++] = parseStructDeclaration(parser);
         }
 
         tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_CURLY);
-        return createASTNode(AST_STRUCT_OR_UNION_SPECIFIER, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_STRUCT_OR_UNION_SPECIFIER, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Struct or Union Specifier but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Struct or Union Specifier");
     return NULL;
 }
 
@@ -1121,6 +1531,12 @@ static int isStructDeclaration(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_STRUCT_DECLARATION);
+    if (!PARSER_RULE_FIRST(parser, STRUCT_DECLARATION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isSpecifierQualifier(parser, 0))
     {
@@ -1132,14 +1548,14 @@ static int isStructDeclaration(Parser *parser, const int resetOnSuccess)
             {
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_STRUCT_DECLARATION, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_STRUCT_DECLARATION);
             }
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_STRUCT_DECLARATION, lookaheadPosition);
     return 0;
 }
 
@@ -1153,7 +1569,7 @@ static ASTNode *parseStructDeclaration(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -1161,11 +1577,10 @@ static ASTNode *parseStructDeclaration(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -1179,16 +1594,14 @@ static ASTNode *parseStructDeclaration(Parser *parser)
         {
             if (childCount + 2 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
 
             children[childCount++] = parseSpecifierQualifier(parser);
@@ -1198,14 +1611,12 @@ static ASTNode *parseStructDeclaration(Parser *parser)
         {
             children[childCount++] = parseStructDeclaratorList(parser);
             tokens[tokenCount++] = matchToken(parser, TOKEN_SEMICOLON);
-            return createASTNode(AST_STRUCT_DECLARATION, tokens, tokenCount, children, childCount);
+            return createArenaASTNode(parser->arena, AST_STRUCT_DECLARATION, tokens, tokenCount, children, childCount);
         }
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Struct Declaration but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Struct Declaration");
     return NULL;
 }
 
@@ -1217,26 +1628,32 @@ static int isSpecifierQualifier(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_SPECIFIER_QUALIFIER);
+    if (!PARSER_RULE_FIRST(parser, SPECIFIER_QUALIFIER))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isTypeSpecifier(parser, 0))
     {
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_SPECIFIER_QUALIFIER, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_SPECIFIER_QUALIFIER);
     }
 
     if (isTypeQualifier(parser, 1))
     {
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_SPECIFIER_QUALIFIER, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_SPECIFIER_QUALIFIER);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_SPECIFIER_QUALIFIER, lookaheadPosition);
     return 0;
 }
 
@@ -1249,8 +1666,9 @@ static ASTNode *parseSpecifierQualifier(Parser *parser)
     }
 
     //Allocating memory
+    ASTArenaMark mark = markASTArena(parser->arena);
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -1258,31 +1676,28 @@ static ASTNode *parseSpecifierQualifier(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
 
     //Parsing
-    if (isTypeSpecifier(parser, 1))
+    if (PARSER_PREDICTS(parser, SPECIFIER_QUALIFIER, TYPE_SPECIFIER) || isTypeSpecifier(parser, 1))
     {
         children[childCount++] = parseTypeSpecifier(parser);
-        return createASTNode(AST_SPECIFIER_QUALIFIER, tokens, tokenCount, children, childCount);
+        return createSharedASTNode(parser, mark, AST_SPECIFIER_QUALIFIER, tokens, tokenCount, children, childCount);
     }
     else if (isTypeQualifier(parser, 0))
     {
         tokens[tokenCount++] = matchToken(parser, TOKEN_KEYWORD);
-        return createASTNode(AST_SPECIFIER_QUALIFIER, tokens, tokenCount, children, childCount);
+        return createSharedASTNode(parser, mark, AST_SPECIFIER_QUALIFIER, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Specifier Qualifier but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Specifier Qualifier");
     return NULL;
 }
 
@@ -1294,19 +1709,20 @@ static int isTypeQualifier(Parser *parser, const int consumeOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_TYPE_QUALIFIER);
     if (isNextTokenKeywordWord(parser, KEYWORD_CONST, consumeOnSuccess))
     {
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_TYPE_QUALIFIER);
     }
 
     if (isNextTokenKeywordWord(parser, KEYWORD_RESTRICT, consumeOnSuccess))
     {
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_TYPE_QUALIFIER);
     }
 
     if (isNextTokenKeywordWord(parser, KEYWORD_VOLATILE, consumeOnSuccess))
     {
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_TYPE_QUALIFIER);
     }
 
     return 0;
@@ -1320,6 +1736,12 @@ static int isStructDeclaratorList(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_STRUCT_DECLARATOR_LIST);
+    if (!PARSER_RULE_FIRST(parser, STRUCT_DECLARATOR_LIST))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isStructDeclarator(parser, 0))
     {
@@ -1327,19 +1749,19 @@ static int isStructDeclaratorList(Parser *parser, const int resetOnSuccess)
         {
             if (!isStructDeclarator(parser, 0))
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_STRUCT_DECLARATOR_LIST, lookaheadPosition);
                 return 0;
             }
         }
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_STRUCT_DECLARATOR_LIST, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_STRUCT_DECLARATOR_LIST);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_STRUCT_DECLARATOR_LIST, lookaheadPosition);
     return 0;
 }
 
@@ -1353,7 +1775,7 @@ static ASTNode *parseStructDeclaratorList(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -1361,11 +1783,10 @@ static ASTNode *parseStructDeclaratorList(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -1378,42 +1799,36 @@ static ASTNode *parseStructDeclaratorList(Parser *parser)
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
             if (tokenCount + 1 >= tokensSize)
             {
-                tokensSize *= 2;
-                Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                 if (newTokens == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for Tokens failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 tokens = newTokens;
+                tokensSize *= 2;
             }
 
             tokens[tokenCount++] = matchToken(parser, TOKEN_COMMA);
             children[childCount++] = parseStructDeclarator(parser);
         }
 
-        return createASTNode(AST_STRUCT_DECLARATOR_LIST, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_STRUCT_DECLARATOR_LIST, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Struct Declarator List but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Struct Declarator List");
     return NULL;
 }
 
@@ -1425,6 +1840,12 @@ static int isStructDeclarator(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_STRUCT_DECLARATOR);
+    if (!PARSER_RULE_FIRST(parser, STRUCT_DECLARATOR))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isDeclarator(parser, 0))
     {
@@ -1434,23 +1855,23 @@ static int isStructDeclarator(Parser *parser, const int resetOnSuccess)
             {
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_STRUCT_DECLARATOR, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_STRUCT_DECLARATOR);
             }
 
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_STRUCT_DECLARATOR, lookaheadPosition);
             return 0;
         }
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_STRUCT_DECLARATOR, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_STRUCT_DECLARATOR);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_STRUCT_DECLARATOR, lookaheadPosition);
     return 0;
 }
 
@@ -1464,7 +1885,7 @@ static ASTNode *parseStructDeclarator(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -1472,11 +1893,10 @@ static ASTNode *parseStructDeclarator(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -1489,16 +1909,14 @@ static ASTNode *parseStructDeclarator(Parser *parser)
         {
             tokens[tokenCount++] = matchToken(parser, TOKEN_COLON);
             children[childCount++] = parseConstantExpression(parser);
-            return createASTNode(AST_STRUCT_DECLARATOR, tokens, tokenCount, children, childCount);
+            return createArenaASTNode(parser->arena, AST_STRUCT_DECLARATOR, tokens, tokenCount, children, childCount);
         }
 
-        return createASTNode(AST_STRUCT_DECLARATOR, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_STRUCT_DECLARATOR, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Struct Declarator but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Struct Declarator");
     return NULL;
 }
 
@@ -1510,6 +1928,12 @@ static int isDeclarator(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_DECLARATOR);
+    if (!PARSER_RULE_FIRST(parser, DECLARATOR))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     isPointer(parser, 0);
 
@@ -1517,12 +1941,12 @@ static int isDeclarator(Parser *parser, const int resetOnSuccess)
     {
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_DECLARATOR, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_DECLARATOR);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_DECLARATOR, lookaheadPosition);
     return 0;
 }
 
@@ -1536,7 +1960,7 @@ static ASTNode *parseDeclarator(Parser *parser)
 
     //Allocating memory
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
@@ -1553,12 +1977,11 @@ static ASTNode *parseDeclarator(Parser *parser)
     if (isDirectDeclarator(parser, 1))
     {
         children[childCount++] = parseDirectDeclarator(parser);
-        return createASTNode(AST_DECLARATOR, NULL, 0, children, childCount);
+        return createArenaASTNode(parser->arena, AST_DECLARATOR, NULL, 0, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Declarator but found:", duplicateToken(nextToken(parser))));
-    free(children);
+    addExpectedError(parser, "a Declarator");
     return NULL;
 }
 
@@ -1570,6 +1993,12 @@ static int isPointer(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_POINTER);
+    if (!PARSER_RULE_FIRST(parser, POINTER))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isNextTokenTypeOf(parser, TOKEN_STAR, 1))
     {
@@ -1582,12 +2011,12 @@ static int isPointer(Parser *parser, const int resetOnSuccess)
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_POINTER, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_POINTER);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_POINTER, lookaheadPosition);
     return 0;
 }
 
@@ -1600,8 +2029,9 @@ static ASTNode *parsePointer(Parser *parser)
     }
 
     //Allocating memory
+    ASTArenaMark mark = markASTArena(parser->arena);
     size_t tokensSize = 2;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -1617,15 +2047,14 @@ static ASTNode *parsePointer(Parser *parser)
         {
             if (tokenCount + 1 >= tokensSize)
             {
-                tokensSize *= 2;
-                Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                 if (newTokens == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for Tokens failed!\n");
-                    free(tokens);
                     return NULL;
                 }
                 tokens = newTokens;
+                tokensSize *= 2;
             }
 
             tokens[tokenCount++] = matchToken(parser, nextToken(parser)->type);
@@ -1635,15 +2064,14 @@ static ASTNode *parsePointer(Parser *parser)
         {
             if (tokenCount + 1 >= tokensSize)
             {
-                tokensSize *= 2;
-                Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                 if (newTokens == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for tokens failed!\n");
-                    free(tokens);
                     return NULL;
                 }
                 tokens = newTokens;
+                tokensSize *= 2;
             }
 
             tokens[tokenCount++] = matchToken(parser, TOKEN_STAR);
@@ -1651,27 +2079,25 @@ static ASTNode *parsePointer(Parser *parser)
             {
                 if (tokenCount + 1 >= tokensSize)
                 {
-                    tokensSize *= 2;
-                    Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                    Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                     if (newTokens == NULL)
                     {
                         fprintf(stderr, "Memory reallocation for Tokens failed!\n");
-                        free(tokens);
                         return NULL;
                     }
                     tokens = newTokens;
+                    tokensSize *= 2;
                 }
 
                 tokens[tokenCount++] = matchToken(parser, nextToken(parser)->type);
             }
         }
 
-        return createASTNode(AST_POINTER, tokens, tokenCount, NULL, 0);
+        return createSharedASTNode(parser, mark, AST_POINTER, tokens, tokenCount, NULL, 0);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Pointer but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
+    addExpectedError(parser, "a Pointer");
     return NULL;
 }
 
@@ -1683,6 +2109,12 @@ static int isDirectDeclarator(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_DIRECT_DECLARATOR);
+    if (!PARSER_RULE_FIRST(parser, DIRECT_DECLARATOR))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isNextTokenTypeOf(parser, TOKEN_IDENTIFIER, 1))
     {
@@ -1690,9 +2122,9 @@ static int isDirectDeclarator(Parser *parser, const int resetOnSuccess)
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_DECLARATOR, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_DIRECT_DECLARATOR);
     }
     else if (isNextTokenTypeOf(parser, TOKEN_OPEN_PARENTHESIS, 1))
     {
@@ -1704,14 +2136,14 @@ static int isDirectDeclarator(Parser *parser, const int resetOnSuccess)
 
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_DECLARATOR, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_DIRECT_DECLARATOR);
             }
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_DECLARATOR, lookaheadPosition);
     return 0;
 }
 
@@ -1725,7 +2157,7 @@ static ASTNode *parseDirectDeclarator(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 2;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -1733,11 +2165,10 @@ static ASTNode *parseDirectDeclarator(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -1750,22 +2181,20 @@ static ASTNode *parseDirectDeclarator(Parser *parser)
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
 
             children[childCount++] = parseDirectDeclaratorPrime(parser);
         }
 
-        return createASTNode(AST_DIRECT_DECLARATOR, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_DIRECT_DECLARATOR, tokens, tokenCount, children, childCount);
     }
     else if (isNextTokenTypeOf(parser, TOKEN_OPEN_PARENTHESIS, 0))
     {
@@ -1776,28 +2205,24 @@ static ASTNode *parseDirectDeclarator(Parser *parser)
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
 
             children[childCount++] = parseDirectDeclaratorPrime(parser);
         }
 
-        return createASTNode(AST_DIRECT_DECLARATOR, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_DIRECT_DECLARATOR, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Direct Declarator but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Direct Declarator");
     return NULL;
 }
 
@@ -1809,6 +2234,12 @@ static int isDirectDeclaratorPrime(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_DIRECT_DECLARATOR_PRIME);
+    if (!PARSER_RULE_FIRST(parser, DIRECT_DECLARATOR_PRIME))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isNextTokenTypeOf(parser, TOKEN_OPEN_BRACKET, 1))
     {
@@ -1822,13 +2253,13 @@ static int isDirectDeclaratorPrime(Parser *parser, const int resetOnSuccess)
                 {
                     if (resetOnSuccess)
                     {
-                        parser->position = lookaheadPosition;
+                        PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_DECLARATOR_PRIME, lookaheadPosition);
                     }
-                    return 1;
+                    return PARSER_RULE_ACCEPT(parser, PARSER_RULE_DIRECT_DECLARATOR_PRIME);
                 }
             }
 
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_DECLARATOR_PRIME, lookaheadPosition);
             return 0;
         }
 
@@ -1844,13 +2275,13 @@ static int isDirectDeclaratorPrime(Parser *parser, const int resetOnSuccess)
                     {
                         if (resetOnSuccess)
                         {
-                            parser->position = lookaheadPosition;
+                            PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_DECLARATOR_PRIME, lookaheadPosition);
                         }
-                        return 1;
+                        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_DIRECT_DECLARATOR_PRIME);
                     }
                 }
 
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_DECLARATOR_PRIME, lookaheadPosition);
                 return 0;
             }
         }
@@ -1861,12 +2292,12 @@ static int isDirectDeclaratorPrime(Parser *parser, const int resetOnSuccess)
             {
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_DECLARATOR_PRIME, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_DIRECT_DECLARATOR_PRIME);
             }
 
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_DECLARATOR_PRIME, lookaheadPosition);
             return 0;
         }
 
@@ -1876,9 +2307,9 @@ static int isDirectDeclaratorPrime(Parser *parser, const int resetOnSuccess)
         {
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_DECLARATOR_PRIME, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_DIRECT_DECLARATOR_PRIME);
         }
     }
     else if (isNextTokenTypeOf(parser, TOKEN_OPEN_PARENTHESIS, 1))
@@ -1889,9 +2320,9 @@ static int isDirectDeclaratorPrime(Parser *parser, const int resetOnSuccess)
             {
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_DECLARATOR_PRIME, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_DIRECT_DECLARATOR_PRIME);
             }
         }
         else
@@ -1902,14 +2333,14 @@ static int isDirectDeclaratorPrime(Parser *parser, const int resetOnSuccess)
             {
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_DECLARATOR_PRIME, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_DIRECT_DECLARATOR_PRIME);
             }
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_DECLARATOR_PRIME, lookaheadPosition);
     return 0;
 }
 
@@ -1923,7 +2354,7 @@ static ASTNode *parseDirectDeclaratorPrime(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 4;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -1931,11 +2362,10 @@ static ASTNode *parseDirectDeclaratorPrime(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -1952,16 +2382,14 @@ static ASTNode *parseDirectDeclaratorPrime(Parser *parser)
             {
                 if (tokenCount + 2 >= tokensSize)
                 {
-                    tokensSize *= 2;
-                    Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                    Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                     if (newTokens == NULL)
                     {
                         fprintf(stderr, "Memory reallocation for tokens failed!\n");
-                        free(tokens);
-                        free(children);
                         return NULL;
                     }
                     tokens = newTokens;
+                    tokensSize *= 2;
                 }
                 
                 tokens[tokenCount++] = matchToken(parser, nextToken(parser)->type);
@@ -1969,7 +2397,7 @@ static ASTNode *parseDirectDeclaratorPrime(Parser *parser)
 
             children[childCount++] = parseAssignmentExpression(parser);
             tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_BRACKET);
-            return createASTNode(AST_DIRECT_DECLARATOR_PRIME, tokens, tokenCount, children, childCount);
+            return createArenaASTNode(parser->arena, AST_DIRECT_DECLARATOR_PRIME, tokens, tokenCount, children, childCount);
         }
         
         if (isTypeQualifier(parser, 0))
@@ -1980,16 +2408,14 @@ static ASTNode *parseDirectDeclaratorPrime(Parser *parser)
             {
                 if (tokenCount + 2 >= tokensSize)
                 {
-                    tokensSize *= 2;
-                    Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                    Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                     if (newTokens == NULL)
                     {
                         fprintf(stderr, "Memory reallocation for tokens failed!\n");
-                        free(tokens);
-                        free(children);
                         return NULL;
                     }
                     tokens = newTokens;
+                    tokensSize *= 2;
                 }
                 
                 tokens[tokenCount++] = matchToken(parser, nextToken(parser)->type);
@@ -2000,7 +2426,7 @@ static ASTNode *parseDirectDeclaratorPrime(Parser *parser)
                 tokens[tokenCount++] = matchToken(parser, TOKEN_KEYWORD);
                 children[childCount++] = parseAssignmentExpression(parser);
                 tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_BRACKET);
-                return createASTNode(AST_DIRECT_DECLARATOR_PRIME, tokens, tokenCount, children, childCount);
+                return createArenaASTNode(parser->arena, AST_DIRECT_DECLARATOR_PRIME, tokens, tokenCount, children, childCount);
             }
         }
 
@@ -2008,7 +2434,7 @@ static ASTNode *parseDirectDeclaratorPrime(Parser *parser)
         {
             tokens[tokenCount++] = matchToken(parser, TOKEN_STAR);
             tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_BRACKET);
-            return createASTNode(AST_DIRECT_DECLARATOR_PRIME, tokens, tokenCount, children, childCount);
+            return createArenaASTNode(parser->arena, AST_DIRECT_DECLARATOR_PRIME, tokens, tokenCount, children, childCount);
         }
         
         if (isAssignmentExpression(parser, 1))
@@ -2019,7 +2445,7 @@ static ASTNode *parseDirectDeclaratorPrime(Parser *parser)
         if (isNextTokenTypeOf(parser, TOKEN_CLOSE_BRACKET, 0))
         {
             tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_BRACKET);
-            return createASTNode(AST_DIRECT_DECLARATOR_PRIME, tokens, tokenCount, children, childCount);
+            return createArenaASTNode(parser->arena, AST_DIRECT_DECLARATOR_PRIME, tokens, tokenCount, children, childCount);
         }
     }
     else if (isNextTokenTypeOf(parser, TOKEN_OPEN_PARENTHESIS, 0))
@@ -2029,7 +2455,7 @@ static ASTNode *parseDirectDeclaratorPrime(Parser *parser)
         {
             children[childCount++] = parseParameterList(parser);
             tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_PARENTHESIS);
-            return createASTNode(AST_DIRECT_DECLARATOR_PRIME, tokens, tokenCount, children, childCount);
+            return createArenaASTNode(parser->arena, AST_DIRECT_DECLARATOR_PRIME, tokens, tokenCount, children, childCount);
         }
         
         if (isIdentifierList(parser, 1))
@@ -2037,13 +2463,11 @@ static ASTNode *parseDirectDeclaratorPrime(Parser *parser)
             children[childCount++] = parseIdentifierList(parser);
         }
         tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_PARENTHESIS);
-        return createASTNode(AST_DIRECT_DECLARATOR_PRIME, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_DIRECT_DECLARATOR_PRIME, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Direct Declarator Prime but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Direct Declarator Prime");
     return NULL;
 }
 
@@ -2055,6 +2479,12 @@ static int isAssignmentExpression(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_ASSIGNMENT_EXPRESSION);
+    if (!PARSER_RULE_FIRST(parser, ASSIGNMENT_EXPRESSION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isUnaryExpression(parser, 0))
     {
@@ -2064,17 +2494,17 @@ static int isAssignmentExpression(Parser *parser, const int resetOnSuccess)
             {
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_ASSIGNMENT_EXPRESSION, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_ASSIGNMENT_EXPRESSION);
             }
 
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_ASSIGNMENT_EXPRESSION, lookaheadPosition);
             return 0;
         }
         else 
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_ASSIGNMENT_EXPRESSION, lookaheadPosition);
         }
     }
 
@@ -2082,12 +2512,12 @@ static int isAssignmentExpression(Parser *parser, const int resetOnSuccess)
     {
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_ASSIGNMENT_EXPRESSION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_ASSIGNMENT_EXPRESSION);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_ASSIGNMENT_EXPRESSION, lookaheadPosition);
     return 0;
 }
 
@@ -2099,6 +2529,7 @@ static int isAssignmentOperator(Parser *parser, int consumeOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_ASSIGNMENT_OPERATOR);
     switch (nextToken(parser)->type)
     {
     case TOKEN_EQUALS:
@@ -2116,7 +2547,7 @@ static int isAssignmentOperator(Parser *parser, int consumeOnSuccess)
         {
             consumeToken(parser, 1);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_ASSIGNMENT_OPERATOR);
     default:
         return 0;
     }
@@ -2132,7 +2563,7 @@ static ASTNode *parseAssignmentExpression(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -2140,11 +2571,10 @@ static ASTNode *parseAssignmentExpression(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -2159,22 +2589,18 @@ static ASTNode *parseAssignmentExpression(Parser *parser)
             children[childCount++] = parseUnaryExpression(parser);
             tokens[tokenCount++] = matchToken(parser, nextToken(parser)->type);
             children[childCount++] = parseAssignmentExpression(parser);
-            return createASTNode(AST_ASSIGNMENT_EXPRESSION, tokens, tokenCount, children, childCount);
+            return createArenaASTNode(parser->arena, AST_ASSIGNMENT_EXPRESSION, tokens, tokenCount, children, childCount);
         }
     }
     parser->position = lookaheadPosition;
 
     if (isConditionalExpression(parser, 1))
     {
-        free(tokens);
-        free(children);
         return parseConditionalExpression(parser);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected an Assignment Expression but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "an Assignment Expression");
     return NULL;
 }
 
@@ -2186,6 +2612,12 @@ static int isConditionalExpression(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_CONDITIONAL_EXPRESSION);
+    if (!PARSER_RULE_FIRST(parser, CONDITIONAL_EXPRESSION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isLogicalORExpression(parser, 0))
     {
@@ -2199,25 +2631,25 @@ static int isConditionalExpression(Parser *parser, const int resetOnSuccess)
                     {
                         if (resetOnSuccess)
                         {
-                            parser->position = lookaheadPosition;
+                            PARSER_RULE_REWIND(parser, PARSER_RULE_CONDITIONAL_EXPRESSION, lookaheadPosition);
                         }
-                        return 1;
+                        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_CONDITIONAL_EXPRESSION);
                     }
                 }    
             }
 
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_CONDITIONAL_EXPRESSION, lookaheadPosition);
             return 0;
         }
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_CONDITIONAL_EXPRESSION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_CONDITIONAL_EXPRESSION);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_CONDITIONAL_EXPRESSION, lookaheadPosition);
     return 0;
 }
 
@@ -2231,7 +2663,7 @@ static ASTNode *parseConditionalExpression(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 2;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -2239,11 +2671,10 @@ static ASTNode *parseConditionalExpression(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 3;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -2254,8 +2685,6 @@ static ASTNode *parseConditionalExpression(Parser *parser)
         ASTNode *child = parseLogicalORExpression(parser);
         if (!isNextTokenTypeOf(parser, TOKEN_QUESTION_MARK, 0))
         {
-            free(tokens);
-            free(children);
             return child;
         }
 
@@ -2264,13 +2693,11 @@ static ASTNode *parseConditionalExpression(Parser *parser)
         children[childCount++] = parseExpression(parser);
         tokens[tokenCount++] = matchToken(parser, TOKEN_COLON);
         children[childCount++] = parseConditionalExpression(parser);
-        return createASTNode(AST_CONDITIONAL_EXPRESSION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_CONDITIONAL_EXPRESSION, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Conditional Expression but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Conditional Expression");
     return NULL;
 }
 
@@ -2282,6 +2709,12 @@ static int isLogicalORExpression(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_LOGICAL_OR_EXPRESSION);
+    if (!PARSER_RULE_FIRST(parser, LOGICAL_OR_EXPRESSION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isLogicalANDExpression(parser, 0))
     {
@@ -2289,19 +2722,19 @@ static int isLogicalORExpression(Parser *parser, const int resetOnSuccess)
         {
             if (!isLogicalANDExpression(parser, 0))
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_LOGICAL_OR_EXPRESSION, lookaheadPosition);
                 return 0;
             }
         }
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_LOGICAL_OR_EXPRESSION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_LOGICAL_OR_EXPRESSION);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_LOGICAL_OR_EXPRESSION, lookaheadPosition);
     return 0;
 }
 
@@ -2315,7 +2748,7 @@ static ASTNode *parseLogicalORExpression(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -2323,11 +2756,10 @@ static ASTNode *parseLogicalORExpression(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -2338,8 +2770,6 @@ static ASTNode *parseLogicalORExpression(Parser *parser)
         ASTNode *child = parseLogicalANDExpression(parser);
         if (!isNextTokenTypeOf(parser, TOKEN_OR, 0))
         {
-            free(tokens);
-            free(children);
             return child;
         }
 
@@ -2348,42 +2778,36 @@ static ASTNode *parseLogicalORExpression(Parser *parser)
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
             if (tokenCount + 1 >= tokensSize)
             {
-                tokensSize *= 2;
-                Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                 if (newTokens == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for Tokens failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 tokens = newTokens;
+                tokensSize *= 2;
             }
 
             tokens[tokenCount++] = matchToken(parser, TOKEN_OR);
             children[childCount++] = parseLogicalANDExpression(parser);
         }
 
-        return createASTNode(AST_LOGICAL_OR_EXPRESSION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_LOGICAL_OR_EXPRESSION, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Logical OR Expression but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Logical OR Expression");
     return NULL;
 }
 
@@ -2395,6 +2819,12 @@ static int isLogicalANDExpression(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_LOGICAL_AND_EXPRESSION);
+    if (!PARSER_RULE_FIRST(parser, LOGICAL_AND_EXPRESSION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isBitwiseORExpression(parser, 0))
     {
@@ -2402,19 +2832,19 @@ static int isLogicalANDExpression(Parser *parser, const int resetOnSuccess)
         {
             if (!isBitwiseORExpression(parser, 0))
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_LOGICAL_AND_EXPRESSION, lookaheadPosition);
                 return 0;
             }
         }
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_LOGICAL_AND_EXPRESSION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_LOGICAL_AND_EXPRESSION);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_LOGICAL_AND_EXPRESSION, lookaheadPosition);
     return 0;
 }
 
@@ -2428,7 +2858,7 @@ static ASTNode *parseLogicalANDExpression(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -2436,11 +2866,10 @@ static ASTNode *parseLogicalANDExpression(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -2451,8 +2880,6 @@ static ASTNode *parseLogicalANDExpression(Parser *parser)
         ASTNode *child = parseBitwiseORExpression(parser);
         if (!isNextTokenTypeOf(parser, TOKEN_AND, 0))
         {
-            free(tokens);
-            free(children);
             return child;
         }
 
@@ -2461,42 +2888,36 @@ static ASTNode *parseLogicalANDExpression(Parser *parser)
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
             if (tokenCount + 1 >= tokensSize)
             {
-                tokensSize *= 2;
-                Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                 if (newTokens == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for Tokens failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 tokens = newTokens;
+                tokensSize *= 2;
             }
 
             tokens[tokenCount++] = matchToken(parser, TOKEN_AND);
             children[childCount++] = parseBitwiseORExpression(parser);
         }
 
-        return createASTNode(AST_LOGICAL_AND_EXPRESSION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_LOGICAL_AND_EXPRESSION, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Logical AND Expression but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Logical AND Expression");
     return NULL;
 }
 
@@ -2508,6 +2929,12 @@ static int isBitwiseORExpression(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_BITWISE_OR_EXPRESSION);
+    if (!PARSER_RULE_FIRST(parser, BITWISE_OR_EXPRESSION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isBitwiseXORExpression(parser, 0))
     {
@@ -2515,19 +2942,19 @@ static int isBitwiseORExpression(Parser *parser, const int resetOnSuccess)
         {
             if (!isBitwiseXORExpression(parser, 0))
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_BITWISE_OR_EXPRESSION, lookaheadPosition);
                 return 0;
             }
         }
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_BITWISE_OR_EXPRESSION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_BITWISE_OR_EXPRESSION);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_BITWISE_OR_EXPRESSION, lookaheadPosition);
     return 0;
 }
 
@@ -2541,7 +2968,7 @@ static ASTNode *parseBitwiseORExpression(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -2549,11 +2976,10 @@ static ASTNode *parseBitwiseORExpression(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -2564,8 +2990,6 @@ static ASTNode *parseBitwiseORExpression(Parser *parser)
         ASTNode *child = parseBitwiseXORExpression(parser);
         if (!isNextTokenTypeOf(parser, TOKEN_BITWISE_OR, 0))
         {
-            free(tokens);
-            free(children);
             return child;
         }
 
@@ -2574,42 +2998,36 @@ static ASTNode *parseBitwiseORExpression(Parser *parser)
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
             if (tokenCount + 1 >= tokensSize)
             {
-                tokensSize *= 2;
-                Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                 if (newTokens == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for Tokens failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 tokens = newTokens;
+                tokensSize *= 2;
             }
 
             tokens[tokenCount++] = matchToken(parser, TOKEN_BITWISE_OR);
             children[childCount++] = parseBitwiseXORExpression(parser);
         }
 
-        return createASTNode(AST_BITWISE_OR_EXPRESSION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_BITWISE_OR_EXPRESSION, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Bitwise OR Expression but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Bitwise OR Expression");
     return NULL;
 }
 
@@ -2621,6 +3039,12 @@ static int isBitwiseXORExpression(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_BITWISE_XOR_EXPRESSION);
+    if (!PARSER_RULE_FIRST(parser, BITWISE_XOR_EXPRESSION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isBitwiseANDExpression(parser, 0))
     {
@@ -2628,19 +3052,19 @@ static int isBitwiseXORExpression(Parser *parser, const int resetOnSuccess)
         {
             if (!isBitwiseANDExpression(parser, 0))
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_BITWISE_XOR_EXPRESSION, lookaheadPosition);
                 return 0;
             }
         }
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_BITWISE_XOR_EXPRESSION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_BITWISE_XOR_EXPRESSION);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_BITWISE_XOR_EXPRESSION, lookaheadPosition);
     return 0;
 }
 
@@ -2654,7 +3078,7 @@ static ASTNode *parseBitwiseXORExpression(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -2662,11 +3086,10 @@ static ASTNode *parseBitwiseXORExpression(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -2677,8 +3100,6 @@ static ASTNode *parseBitwiseXORExpression(Parser *parser)
         ASTNode *child = parseBitwiseANDExpression(parser);
         if (!isNextTokenTypeOf(parser, TOKEN_BITWISE_XOR, 0))
         {
-            free(tokens);
-            free(children);
             return child;
         }
 
@@ -2687,42 +3108,36 @@ static ASTNode *parseBitwiseXORExpression(Parser *parser)
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
             if (tokenCount + 1 >= tokensSize)
             {
-                tokensSize *= 2;
-                Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                 if (newTokens == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for Tokens failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 tokens = newTokens;
+                tokensSize *= 2;
             }
 
             tokens[tokenCount++] = matchToken(parser, TOKEN_BITWISE_XOR);
             children[childCount++] = parseBitwiseANDExpression(parser);
         }
 
-        return createASTNode(AST_BITWISE_XOR_EXPRESSION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_BITWISE_XOR_EXPRESSION, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Bitwise XOR Expression but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Bitwise XOR Expression");
     return NULL;
 }
 
@@ -2734,6 +3149,12 @@ static int isBitwiseANDExpression(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_BITWISE_AND_EXPRESSION);
+    if (!PARSER_RULE_FIRST(parser, BITWISE_AND_EXPRESSION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isEqualityExpression(parser, 0))
     {
@@ -2741,19 +3162,19 @@ static int isBitwiseANDExpression(Parser *parser, const int resetOnSuccess)
         {
             if (!isEqualityExpression(parser, 0))
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_BITWISE_AND_EXPRESSION, lookaheadPosition);
                 return 0;
             }
         }
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_BITWISE_AND_EXPRESSION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_BITWISE_AND_EXPRESSION);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_BITWISE_AND_EXPRESSION, lookaheadPosition);
     return 0;
 }
 
@@ -2767,7 +3188,7 @@ static ASTNode *parseBitwiseANDExpression(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -2775,11 +3196,10 @@ static ASTNode *parseBitwiseANDExpression(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -2790,8 +3210,6 @@ static ASTNode *parseBitwiseANDExpression(Parser *parser)
         ASTNode *child = parseEqualityExpression(parser);
         if (!isNextTokenTypeOf(parser, TOKEN_BITWISE_AND, 0))
         {
-            free(tokens);
-            free(children);
             return child;
         }
 
@@ -2800,42 +3218,36 @@ static ASTNode *parseBitwiseANDExpression(Parser *parser)
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
             if (tokenCount + 1 >= tokensSize)
             {
-                tokensSize *= 2;
-                Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                 if (newTokens == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for Tokens failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 tokens = newTokens;
+                tokensSize *= 2;
             }
 
             tokens[tokenCount++] = matchToken(parser, TOKEN_BITWISE_AND);
             children[childCount++] = parseEqualityExpression(parser);
         }
 
-        return createASTNode(AST_BITWISE_AND_EXPRESSION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_BITWISE_AND_EXPRESSION, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Bitwise AND Expression but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Bitwise AND Expression");
     return NULL;
 }
 
@@ -2847,6 +3259,12 @@ static int isEqualityExpression(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_EQUALITY_EXPRESSION);
+    if (!PARSER_RULE_FIRST(parser, EQUALITY_EXPRESSION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isRelationalExpression(parser, 0))
     {
@@ -2854,19 +3272,19 @@ static int isEqualityExpression(Parser *parser, const int resetOnSuccess)
         {
             if (!isRelationalExpression(parser, 0))
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_EQUALITY_EXPRESSION, lookaheadPosition);
                 return 0;
             }
         }
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_EQUALITY_EXPRESSION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_EQUALITY_EXPRESSION);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_EQUALITY_EXPRESSION, lookaheadPosition);
     return 0;
 }
 
@@ -2878,6 +3296,7 @@ static int isEqualityOperator(Parser *parser, int consumeOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_EQUALITY_OPERATOR);
     switch (nextToken(parser)->type)
     {
     case TOKEN_DOUBLE_EQUALS:
@@ -2886,7 +3305,7 @@ static int isEqualityOperator(Parser *parser, int consumeOnSuccess)
         {
             consumeToken(parser, 1);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_EQUALITY_OPERATOR);
     default:
         return 0;
     }
@@ -2902,7 +3321,7 @@ static ASTNode *parseEqualityExpression(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -2910,11 +3329,10 @@ static ASTNode *parseEqualityExpression(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -2925,8 +3343,6 @@ static ASTNode *parseEqualityExpression(Parser *parser)
         ASTNode *child = parseRelationalExpression(parser);
         if (!isEqualityOperator(parser, 0))
         {
-            free(tokens);
-            free(children);
             return child;
         }
 
@@ -2935,42 +3351,36 @@ static ASTNode *parseEqualityExpression(Parser *parser)
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
             if (tokenCount + 1 >= tokensSize)
             {
-                tokensSize *= 2;
-                Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                 if (newTokens == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for Tokens failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 tokens = newTokens;
+                tokensSize *= 2;
             }
 
             tokens[tokenCount++] = matchToken(parser, nextToken(parser)->type);
             children[childCount++] = parseRelationalExpression(parser);
         }
 
-        return createASTNode(AST_EQUALITY_EXPRESSION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_EQUALITY_EXPRESSION, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected an Equality Expression but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "an Equality Expression");
     return NULL;
 }
 
@@ -2982,6 +3392,12 @@ static int isRelationalExpression(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_RELATIONAL_EXPRESSION);
+    if (!PARSER_RULE_FIRST(parser, RELATIONAL_EXPRESSION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isShiftExpression(parser, 0))
     {
@@ -2989,19 +3405,19 @@ static int isRelationalExpression(Parser *parser, const int resetOnSuccess)
         {
             if (!isShiftExpression(parser, 0))
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_RELATIONAL_EXPRESSION, lookaheadPosition);
                 return 0;
             }
         }
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_RELATIONAL_EXPRESSION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_RELATIONAL_EXPRESSION);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_RELATIONAL_EXPRESSION, lookaheadPosition);
     return 0;
 }
 
@@ -3013,6 +3429,7 @@ static int isRelationalOperator(Parser *parser, int consumeOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_RELATIONAL_OPERATOR);
     switch (nextToken(parser)->type)
     {
     case TOKEN_LESS_THAN:
@@ -3023,7 +3440,7 @@ static int isRelationalOperator(Parser *parser, int consumeOnSuccess)
         {
             consumeToken(parser, 1);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_RELATIONAL_OPERATOR);
     default:
         return 0;
     }
@@ -3039,7 +3456,7 @@ static ASTNode *parseRelationalExpression(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -3047,11 +3464,10 @@ static ASTNode *parseRelationalExpression(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -3062,8 +3478,6 @@ static ASTNode *parseRelationalExpression(Parser *parser)
         ASTNode *child = parseShiftExpression(parser);
         if (!isRelationalOperator(parser, 0))
         {
-            free(tokens);
-            free(children);
             return child;
         }
 
@@ -3072,42 +3486,36 @@ static ASTNode *parseRelationalExpression(Parser *parser)
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
             if (tokenCount + 1 >= tokensSize)
             {
-                tokensSize *= 2;
-                Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                 if (newTokens == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for Tokens failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 tokens = newTokens;
+                tokensSize *= 2;
             }
 
             tokens[tokenCount++] = matchToken(parser, nextToken(parser)->type);
             children[childCount++] = parseShiftExpression(parser);
         }
 
-        return createASTNode(AST_RELATIONAL_EXPRESSION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_RELATIONAL_EXPRESSION, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Relational Expression but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Relational Expression");
     return NULL;
 }
 
@@ -3119,6 +3527,12 @@ static int isShiftExpression(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_SHIFT_EXPRESSION);
+    if (!PARSER_RULE_FIRST(parser, SHIFT_EXPRESSION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isAdditiveExpression(parser, 0))
     {
@@ -3126,19 +3540,19 @@ static int isShiftExpression(Parser *parser, const int resetOnSuccess)
         {
             if (!isAdditiveExpression(parser, 0))
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_SHIFT_EXPRESSION, lookaheadPosition);
                 return 0;
             }
         }
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_SHIFT_EXPRESSION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_SHIFT_EXPRESSION);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_SHIFT_EXPRESSION, lookaheadPosition);
     return 0;
 }
 
@@ -3150,6 +3564,7 @@ static int isShiftOperator(Parser *parser, int consumeOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_SHIFT_OPERATOR);
     switch (nextToken(parser)->type)
     {
     case TOKEN_BITWISE_LEFT_SHIFT:
@@ -3158,7 +3573,7 @@ static int isShiftOperator(Parser *parser, int consumeOnSuccess)
         {
             consumeToken(parser, 1);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_SHIFT_OPERATOR);
     default:
         return 0;
     }
@@ -3174,7 +3589,7 @@ static ASTNode *parseShiftExpression(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -3182,11 +3597,10 @@ static ASTNode *parseShiftExpression(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -3197,8 +3611,6 @@ static ASTNode *parseShiftExpression(Parser *parser)
         ASTNode *child = parseAdditiveExpression(parser);
         if (!isShiftOperator(parser, 0))
         {
-            free(tokens);
-            free(children);
             return child;
         }
 
@@ -3207,42 +3619,36 @@ static ASTNode *parseShiftExpression(Parser *parser)
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
             if (tokenCount + 1 >= tokensSize)
             {
-                tokensSize *= 2;
-                Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                 if (newTokens == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for Tokens failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 tokens = newTokens;
+                tokensSize *= 2;
             }
 
             tokens[tokenCount++] = matchToken(parser, nextToken(parser)->type);
             children[childCount++] = parseAdditiveExpression(parser);
         }
 
-        return createASTNode(AST_SHIFT_EXPRESSION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_SHIFT_EXPRESSION, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Shift Expression but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Shift Expression");
     return NULL;
 }
 
@@ -3254,6 +3660,12 @@ static int isAdditiveExpression(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_ADDITIVE_EXPRESSION);
+    if (!PARSER_RULE_FIRST(parser, ADDITIVE_EXPRESSION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isMultiplicativeExpression(parser, 0))
     {
@@ -3261,19 +3673,19 @@ static int isAdditiveExpression(Parser *parser, const int resetOnSuccess)
         {
             if (!isMultiplicativeExpression(parser, 0))
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_ADDITIVE_EXPRESSION, lookaheadPosition);
                 return 0;
             }
         }
         
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_ADDITIVE_EXPRESSION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_ADDITIVE_EXPRESSION);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_ADDITIVE_EXPRESSION, lookaheadPosition);
     return 0;
 }
 
@@ -3285,6 +3697,7 @@ static int isAdditiveOperator(Parser *parser, int consumeOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_ADDITIVE_OPERATOR);
     switch (nextToken(parser)->type)
     {
     case TOKEN_PLUS:
@@ -3293,7 +3706,7 @@ static int isAdditiveOperator(Parser *parser, int consumeOnSuccess)
         {
             consumeToken(parser, 1);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_ADDITIVE_OPERATOR);
     default:
         return 0;
     }
@@ -3309,7 +3722,7 @@ static ASTNode *parseAdditiveExpression(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -3317,11 +3730,10 @@ static ASTNode *parseAdditiveExpression(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -3332,8 +3744,6 @@ static ASTNode *parseAdditiveExpression(Parser *parser)
         ASTNode *child = parserMultiplicativeExpression(parser);
         if (!isAdditiveOperator(parser, 0))
         {
-            free(tokens);
-            free(children);
             return child;
         }
 
@@ -3342,42 +3752,36 @@ static ASTNode *parseAdditiveExpression(Parser *parser)
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
             if (tokenCount + 1 >= tokensSize)
             {
-                tokensSize *= 2;
-                Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                 if (newTokens == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for Tokens failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 tokens = newTokens;
+                tokensSize *= 2;
             }
 
             tokens[tokenCount++] = matchToken(parser, nextToken(parser)->type);
             children[childCount++] = parserMultiplicativeExpression(parser);
         }
 
-        return createASTNode(AST_ADDITIVE_EXPRESSION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_ADDITIVE_EXPRESSION, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected an Additive Expression but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "an Additive Expression");
     return NULL;
 }
 
@@ -3389,6 +3793,12 @@ static int isMultiplicativeExpression(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_MULTIPLICATIVE_EXPRESSION);
+    if (!PARSER_RULE_FIRST(parser, MULTIPLICATIVE_EXPRESSION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isCastExpression(parser, 0))
     {
@@ -3396,19 +3806,19 @@ static int isMultiplicativeExpression(Parser *parser, const int resetOnSuccess)
         {
             if (!isCastExpression(parser, 0))
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_MULTIPLICATIVE_EXPRESSION, lookaheadPosition);
                 return 0;
             }
         }
         
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_MULTIPLICATIVE_EXPRESSION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_MULTIPLICATIVE_EXPRESSION);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_MULTIPLICATIVE_EXPRESSION, lookaheadPosition);
     return 0;
 }
 
@@ -3420,6 +3830,7 @@ static int isMultiplicativeOperator(Parser *parser, int consumeOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_MULTIPLICATIVE_OPERATOR);
     switch (nextToken(parser)->type)
     {
     case TOKEN_STAR:
@@ -3429,7 +3840,7 @@ static int isMultiplicativeOperator(Parser *parser, int consumeOnSuccess)
         {
             consumeToken(parser, 1);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_MULTIPLICATIVE_OPERATOR);
     default:
         return 0;
     }
@@ -3445,7 +3856,7 @@ static ASTNode *parserMultiplicativeExpression(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -3453,11 +3864,10 @@ static ASTNode *parserMultiplicativeExpression(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -3468,8 +3878,6 @@ static ASTNode *parserMultiplicativeExpression(Parser *parser)
         ASTNode *child = parseCastExpression(parser);
         if (!isMultiplicativeOperator(parser, 0))
         {
-            free(tokens);
-            free(children);
             return child;
         }
 
@@ -3478,42 +3886,36 @@ static ASTNode *parserMultiplicativeExpression(Parser *parser)
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
             if (tokenCount + 1 >= tokensSize)
             {
-                tokensSize *= 2;
-                Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                 if (newTokens == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for Tokens failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 tokens = newTokens;
+                tokensSize *= 2;
             }
 
             tokens[tokenCount++] = matchToken(parser, nextToken(parser)->type);
             children[childCount++] = parseCastExpression(parser);
         }
 
-        return createASTNode(AST_MULTIPLICATIVE_EXPRESSION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_MULTIPLICATIVE_EXPRESSION, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Multiplicative Expression but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Multiplicative Expression");
     return NULL;
 }
 
@@ -3525,14 +3927,20 @@ static int isCastExpression(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_CAST_EXPRESSION);
+    if (!PARSER_RULE_FIRST(parser, CAST_EXPRESSION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isUnaryExpression(parser, 0))
     {
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_CAST_EXPRESSION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_CAST_EXPRESSION);
     }
     else if (isNextTokenTypeOf(parser, TOKEN_OPEN_PARENTHESIS, 1))
     {
@@ -3542,14 +3950,14 @@ static int isCastExpression(Parser *parser, const int resetOnSuccess)
             {
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_CAST_EXPRESSION, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_CAST_EXPRESSION);
             }
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_CAST_EXPRESSION, lookaheadPosition);
     return 0;
 }
 
@@ -3563,7 +3971,7 @@ static ASTNode *parseCastExpression(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 2;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -3571,20 +3979,17 @@ static ASTNode *parseCastExpression(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
 
     //Parsing
-    if (isUnaryExpression(parser, 1))
+    if (PARSER_PREDICTS(parser, CAST_EXPRESSION, UNARY_EXPRESSION) || isUnaryExpression(parser, 1))
     {
-        free(tokens);
-        free(children);
         return parseUnaryExpression(parser);
     }
     else if (isNextTokenTypeOf(parser, TOKEN_OPEN_PARENTHESIS, 0))
@@ -3593,13 +3998,11 @@ static ASTNode *parseCastExpression(Parser *parser)
         children[childCount++] = parseTypeName(parser);
         tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_PARENTHESIS);
         children[childCount++] = parseCastExpression(parser);
-        return createASTNode(AST_CAST_EXPRESSION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_CAST_EXPRESSION, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Cast Expression but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Cast Expression");
     return NULL;
 }
 
@@ -3611,14 +4014,20 @@ static int isUnaryExpression(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_UNARY_EXPRESSION);
+    if (!PARSER_RULE_FIRST(parser, UNARY_EXPRESSION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isPostfixExpression(parser, 0))
     {
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_UNARY_EXPRESSION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_UNARY_EXPRESSION);
     }
     else if (isPrefixUnaryOperator(parser, 1))
     {
@@ -3626,9 +4035,9 @@ static int isUnaryExpression(Parser *parser, const int resetOnSuccess)
         {
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_UNARY_EXPRESSION, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_UNARY_EXPRESSION);
         }
     }
     else if (isUnaryOperator(parser, 1))
@@ -3637,9 +4046,9 @@ static int isUnaryExpression(Parser *parser, const int resetOnSuccess)
         {
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_UNARY_EXPRESSION, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_UNARY_EXPRESSION);
         }
     }
     else if (isNextTokenKeywordWord(parser, KEYWORD_SIZEOF, 1))
@@ -3648,9 +4057,9 @@ static int isUnaryExpression(Parser *parser, const int resetOnSuccess)
         {
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_UNARY_EXPRESSION, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_UNARY_EXPRESSION);
         }
         else if (isNextTokenTypeOf(parser, TOKEN_OPEN_PARENTHESIS, 1))
         {
@@ -3660,15 +4069,15 @@ static int isUnaryExpression(Parser *parser, const int resetOnSuccess)
                 {
                     if (resetOnSuccess)
                     {
-                        parser->position = lookaheadPosition;
+                        PARSER_RULE_REWIND(parser, PARSER_RULE_UNARY_EXPRESSION, lookaheadPosition);
                     }
-                    return 1;
+                    return PARSER_RULE_ACCEPT(parser, PARSER_RULE_UNARY_EXPRESSION);
                 }
             }
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_UNARY_EXPRESSION, lookaheadPosition);
     return 0;
 }
 
@@ -3680,6 +4089,7 @@ static int isPrefixUnaryOperator(Parser *parser, int consumeOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_PREFIX_UNARY_OPERATOR);
     switch (nextToken(parser)->type)
     {
     case TOKEN_DOUBLE_PLUS:
@@ -3688,7 +4098,7 @@ static int isPrefixUnaryOperator(Parser *parser, int consumeOnSuccess)
         {
             consumeToken(parser, 1);
         }
-        return 1;    
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_PREFIX_UNARY_OPERATOR);    
     default:
         return 0;
     }
@@ -3702,6 +4112,7 @@ static int isUnaryOperator(Parser *parser, int consumeOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_UNARY_OPERATOR);
     switch (nextToken(parser)->type)
     {
     case TOKEN_BITWISE_AND:
@@ -3714,7 +4125,7 @@ static int isUnaryOperator(Parser *parser, int consumeOnSuccess)
         {
             consumeToken(parser, 1);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_UNARY_OPERATOR);
     default:
         return 0;
     }
@@ -3729,8 +4140,8 @@ static ASTNode *parseUnaryExpression(Parser *parser)
     }
 
     //Allocating memory
-    size_t tokensSize = 2;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    size_t tokensSize = 3;
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -3738,33 +4149,30 @@ static ASTNode *parseUnaryExpression(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
 
     //Parsing
-    if (isPostfixExpression(parser, 1))
+    if (PARSER_PREDICTS(parser, UNARY_EXPRESSION, POSTFIX_EXPRESSION) || isPostfixExpression(parser, 1))
     {
-        free(tokens);
-        free(children);
         return parsePostfixExpression(parser);
     }
     else if (isPrefixUnaryOperator(parser, 0))
     {
         tokens[tokenCount++] = matchToken(parser, nextToken(parser)->type);
         children[childCount++] = parseUnaryExpression(parser);
-        return createASTNode(AST_UNARY_EXPRESSION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_UNARY_EXPRESSION, tokens, tokenCount, children, childCount);
     }
     else if (isUnaryOperator(parser, 0))
     {
         tokens[tokenCount++] = matchToken(parser, nextToken(parser)->type);
         children[childCount++] = parseCastExpression(parser);
-        return createASTNode(AST_UNARY_EXPRESSION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_UNARY_EXPRESSION, tokens, tokenCount, children, childCount);
     }
     else if (isNextTokenKeywordWord(parser, KEYWORD_SIZEOF, 0))
     {
@@ -3779,13 +4187,11 @@ static ASTNode *parseUnaryExpression(Parser *parser)
             children[childCount++] = parseTypeName(parser);
             tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_PARENTHESIS);
         }
-        return createASTNode(AST_UNARY_EXPRESSION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_UNARY_EXPRESSION, tokens, tokenCount, children, childCount);
     }
     
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Unary Expression but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Unary Expression");
     return NULL;
 }
 
@@ -3797,6 +4203,12 @@ static int isPostfixExpression(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_POSTFIX_EXPRESSION);
+    if (!PARSER_RULE_FIRST(parser, POSTFIX_EXPRESSION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isPrimaryExpression(parser, 0)) 
     {
@@ -3804,9 +4216,9 @@ static int isPostfixExpression(Parser *parser, const int resetOnSuccess)
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_POSTFIX_EXPRESSION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_POSTFIX_EXPRESSION);
     }
     else if (isNextTokenTypeOf(parser, TOKEN_OPEN_PARENTHESIS, 1))
     {
@@ -3826,9 +4238,9 @@ static int isPostfixExpression(Parser *parser, const int resetOnSuccess)
 
                             if (resetOnSuccess)
                             {
-                                parser->position = lookaheadPosition;
+                                PARSER_RULE_REWIND(parser, PARSER_RULE_POSTFIX_EXPRESSION, lookaheadPosition);
                             }
-                            return 1;
+                            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_POSTFIX_EXPRESSION);
                         }
                     }
                 }
@@ -3836,7 +4248,7 @@ static int isPostfixExpression(Parser *parser, const int resetOnSuccess)
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_POSTFIX_EXPRESSION, lookaheadPosition);
     return 0;
 }
 
@@ -3850,7 +4262,7 @@ static ASTNode *parsePostfixExpression(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 5;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -3858,11 +4270,10 @@ static ASTNode *parsePostfixExpression(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 3;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -3874,8 +4285,6 @@ static ASTNode *parsePostfixExpression(Parser *parser)
 
         if (!isPostfixExpressionPrime(parser, 1))
         {
-            free(tokens);
-            free(children);
             return child;
         }
 
@@ -3897,9 +4306,7 @@ static ASTNode *parsePostfixExpression(Parser *parser)
     else
     {
         //Error
-        addError(parser, createError(ERROR_PARSING, "Expected a Primary Expression but found:", duplicateToken(nextToken(parser))));
-        free(tokens);
-        free(children);
+        addExpectedError(parser, "a Primary Expression");
         return NULL;
     }
     
@@ -3907,22 +4314,20 @@ static ASTNode *parsePostfixExpression(Parser *parser)
     {
         if (childCount + 1 >= childrenSize)
         {
-            childrenSize *= 2;
-            ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+            ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
             if (newChildren == NULL)
             {
                 fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                free(tokens);
-                free(children);
                 return NULL;
             }
             children = newChildren;
+            childrenSize *= 2;
         }
 
         children[childCount++] = parsePostfixExpressionPrime(parser);
     }
     
-    return createASTNode(AST_POSTFIX_EXPRESSION, tokens, tokenCount, children, childCount);
+    return createArenaASTNode(parser->arena, AST_POSTFIX_EXPRESSION, tokens, tokenCount, children, childCount);
 }
 
 static int isPostfixExpressionPrime(Parser *parser, const int resetOnSuccess)
@@ -3933,6 +4338,12 @@ static int isPostfixExpressionPrime(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_POSTFIX_EXPRESSION_PRIME);
+    if (!PARSER_RULE_FIRST(parser, POSTFIX_EXPRESSION_PRIME))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isNextTokenTypeOf(parser, TOKEN_OPEN_BRACKET, 1))
     {
@@ -3942,9 +4353,9 @@ static int isPostfixExpressionPrime(Parser *parser, const int resetOnSuccess)
             {
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_POSTFIX_EXPRESSION_PRIME, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_POSTFIX_EXPRESSION_PRIME);
             }
         }
     }
@@ -3954,9 +4365,9 @@ static int isPostfixExpressionPrime(Parser *parser, const int resetOnSuccess)
         {
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_POSTFIX_EXPRESSION_PRIME, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_POSTFIX_EXPRESSION_PRIME);
         }
 
         if (isExpression(parser, 0))
@@ -3965,9 +4376,9 @@ static int isPostfixExpressionPrime(Parser *parser, const int resetOnSuccess)
             {
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_POSTFIX_EXPRESSION_PRIME, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_POSTFIX_EXPRESSION_PRIME);
             }
         }
     }
@@ -3977,21 +4388,21 @@ static int isPostfixExpressionPrime(Parser *parser, const int resetOnSuccess)
         {
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_POSTFIX_EXPRESSION_PRIME, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_POSTFIX_EXPRESSION_PRIME);
         }
     }
     else if (isNextTokenTypeOf(parser, TOKEN_DOUBLE_PLUS, 1) || isNextTokenTypeOf(parser, TOKEN_DOUBLE_MINUS, 1))
     {
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_POSTFIX_EXPRESSION_PRIME, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_POSTFIX_EXPRESSION_PRIME);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_POSTFIX_EXPRESSION_PRIME, lookaheadPosition);
     return 0;
 }
 
@@ -4005,7 +4416,7 @@ static ASTNode *parsePostfixExpressionPrime(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 2;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -4013,11 +4424,10 @@ static ASTNode *parsePostfixExpressionPrime(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -4028,7 +4438,7 @@ static ASTNode *parsePostfixExpressionPrime(Parser *parser)
         tokens[tokenCount++] = matchToken(parser, TOKEN_OPEN_BRACKET);
         children[childCount++] = parseExpression(parser);
         tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_BRACKET);
-        return createASTNode(AST_POSTFIX_EXPRESSION_PRIME, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_POSTFIX_EXPRESSION_PRIME, tokens, tokenCount, children, childCount);
     }
     else if (isNextTokenTypeOf(parser, TOKEN_OPEN_PARENTHESIS, 0))
     {
@@ -4038,24 +4448,22 @@ static ASTNode *parsePostfixExpressionPrime(Parser *parser)
             children[childCount++] = parseExpression(parser);
         }
         tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_PARENTHESIS);
-        return createASTNode(AST_POSTFIX_EXPRESSION_PRIME, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_POSTFIX_EXPRESSION_PRIME, tokens, tokenCount, children, childCount);
     }
     else if (isNextTokenTypeOf(parser, TOKEN_DOT, 0) || isNextTokenTypeOf(parser, TOKEN_ARROW, 0))
     {
         tokens[tokenCount++] = matchToken(parser, nextToken(parser)->type);
         tokens[tokenCount++] = matchToken(parser, TOKEN_IDENTIFIER);
-        return createASTNode(AST_POSTFIX_EXPRESSION_PRIME, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_POSTFIX_EXPRESSION_PRIME, tokens, tokenCount, children, childCount);
     }
     else if (isNextTokenTypeOf(parser, TOKEN_DOUBLE_PLUS, 0) || isNextTokenTypeOf(parser, TOKEN_DOUBLE_MINUS, 0))
     {
         tokens[tokenCount++] = matchToken(parser, nextToken(parser)->type);
-        return createASTNode(AST_POSTFIX_EXPRESSION_PRIME, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_POSTFIX_EXPRESSION_PRIME, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Postfix Expression Prime but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Postfix Expression Prime");
     return NULL;
 }
 
@@ -4067,14 +4475,20 @@ static int isPrimaryExpression(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_PRIMARY_EXPRESSION);
+    if (!PARSER_RULE_FIRST(parser, PRIMARY_EXPRESSION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isNextTokenTypeOf(parser, TOKEN_IDENTIFIER, 1))
     {
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_PRIMARY_EXPRESSION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_PRIMARY_EXPRESSION);
     }
     else if (isNextTokenTypeOf(parser, TOKEN_OPEN_PARENTHESIS, 1))
     {
@@ -4084,9 +4498,9 @@ static int isPrimaryExpression(Parser *parser, const int resetOnSuccess)
             {
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_PRIMARY_EXPRESSION, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_PRIMARY_EXPRESSION);
             }
         }
     }
@@ -4094,12 +4508,12 @@ static int isPrimaryExpression(Parser *parser, const int resetOnSuccess)
     {
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_PRIMARY_EXPRESSION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_PRIMARY_EXPRESSION);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_PRIMARY_EXPRESSION, lookaheadPosition);
     return 0;
 }
 
@@ -4113,7 +4527,7 @@ static ASTNode *parsePrimaryExpression(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 2;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -4121,11 +4535,10 @@ static ASTNode *parsePrimaryExpression(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -4134,12 +4547,10 @@ static ASTNode *parsePrimaryExpression(Parser *parser)
     if (isNextTokenTypeOf(parser, TOKEN_IDENTIFIER, 0))
     {
         tokens[tokenCount++] = matchToken(parser, TOKEN_IDENTIFIER);
-        return createASTNode(AST_PRIMARY_EXPRESSION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_PRIMARY_EXPRESSION, tokens, tokenCount, children, childCount);
     }
     else if (isLiteral(parser, 1))
     {
-        free(tokens);
-        free(children);
         return parseLiteral(parser);
     }
     else if (isNextTokenTypeOf(parser, TOKEN_OPEN_PARENTHESIS, 0))
@@ -4147,13 +4558,11 @@ static ASTNode *parsePrimaryExpression(Parser *parser)
         tokens[tokenCount++] = matchToken(parser, TOKEN_OPEN_PARENTHESIS);
         children[childCount++] = parseExpression(parser);
         tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_PARENTHESIS);
-        return createASTNode(AST_PRIMARY_EXPRESSION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_PRIMARY_EXPRESSION, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    free(tokens);
-    free(children);
-    addError(parser, createError(ERROR_PARSING, "Expected a primary expression but found:", duplicateToken(nextToken(parser))));
+    addExpectedError(parser, "a primary expression");
     return NULL;
 }
 
@@ -4165,6 +4574,7 @@ static int isLiteral(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_LITERAL);
     int lookaheadPosition = parser->position;
     switch (nextToken(parser)->type)
     {
@@ -4176,15 +4586,15 @@ static int isLiteral(Parser *parser, const int resetOnSuccess)
     case TOKEN_OCTAL:
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_LITERAL, lookaheadPosition);
         }
         else
         {
             consumeToken(parser, 1);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_LITERAL);
     default:
-        parser->position = lookaheadPosition;
+        PARSER_RULE_REWIND(parser, PARSER_RULE_LITERAL, lookaheadPosition);
         return 0;
     }
 }
@@ -4199,7 +4609,7 @@ static ASTNode *parseLiteral(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -4211,12 +4621,11 @@ static ASTNode *parseLiteral(Parser *parser)
     if(isLiteral(parser, 1))
     {
         tokens[tokenCount++] = matchToken(parser, nextToken(parser)->type);
-        return createASTNode(AST_LITERAL, tokens, tokenCount, NULL, 0);
+        return createArenaASTNode(parser->arena, AST_LITERAL, tokens, tokenCount, NULL, 0);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a literal but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
+    addExpectedError(parser, "a literal");
     return NULL;
 }
 
@@ -4228,6 +4637,12 @@ static int isExpression(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_EXPRESSION);
+    if (!PARSER_RULE_FIRST(parser, EXPRESSION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isAssignmentExpression(parser, 0))
     {
@@ -4235,19 +4650,19 @@ static int isExpression(Parser *parser, const int resetOnSuccess)
         {
             if (!isAssignmentExpression(parser, 0))
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_EXPRESSION, lookaheadPosition);
                 return 0;
             }
         }
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_EXPRESSION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_EXPRESSION);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_EXPRESSION, lookaheadPosition);
     return 0;
 }
 
@@ -4261,7 +4676,7 @@ static ASTNode *parseExpression(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -4269,11 +4684,10 @@ static ASTNode *parseExpression(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -4284,17 +4698,38 @@ static ASTNode *parseExpression(Parser *parser)
         children[childCount++] = parseAssignmentExpression(parser);
         while (isNextTokenTypeOf(parser, TOKEN_COMMA, 0))
         {
+            if (childCount + 1 >= childrenSize)
+            {
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
+                if (newChildren == NULL)
+                {
+                    fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
+                    return NULL;
+                }
+                children = newChildren;
+                childrenSize *= 2;
+            }
+            if (tokenCount + 1 >= tokensSize)
+            {
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
+                if (newTokens == NULL)
+                {
+                    fprintf(stderr, "Memory reallocation for Tokens failed!\n");
+                    return NULL;
+                }
+                tokens = newTokens;
+                tokensSize *= 2;
+            }
+
             tokens[tokenCount++] = matchToken(parser, TOKEN_COMMA);
             children[childCount++] = parseAssignmentExpression(parser);
         }
 
-        return createASTNode(AST_EXPRESSION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_EXPRESSION, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected an Expression but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "an Expression");
     return NULL;
 }
 
@@ -4306,6 +4741,12 @@ static int isTypeName(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_TYPE_NAME);
+    if (!PARSER_RULE_FIRST(parser, TYPE_NAME))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isSpecifierQualifier(parser, 0))
     {
@@ -4314,12 +4755,12 @@ static int isTypeName(Parser *parser, const int resetOnSuccess)
         isAbstractDeclarator(parser, 0);
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_TYPE_NAME, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_TYPE_NAME);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_TYPE_NAME, lookaheadPosition);
     return 0;
 }
 
@@ -4333,7 +4774,7 @@ static ASTNode *parseTypeName(Parser *parser)
 
     //Allocating memory
     size_t childrenSize = 3;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
@@ -4349,15 +4790,14 @@ static ASTNode *parseTypeName(Parser *parser)
         {
             if (childCount + 2 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
 
             children[childCount++] = parseSpecifierQualifier(parser);
@@ -4368,12 +4808,11 @@ static ASTNode *parseTypeName(Parser *parser)
             children[childCount++] = parseAbstractDeclarator(parser);
         }
 
-        return createASTNode(AST_TYPE_NAME, NULL, 0, children, childCount);
+        return createArenaASTNode(parser->arena, AST_TYPE_NAME, NULL, 0, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Type Name but found:", duplicateToken(nextToken(parser))));
-    free(children);
+    addExpectedError(parser, "a Type Name");
     return NULL;
 }
 
@@ -4385,6 +4824,12 @@ static int isAbstractDeclarator(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_ABSTRACT_DECLARATOR);
+    if (!PARSER_RULE_FIRST(parser, ABSTRACT_DECLARATOR))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isPointer(parser, 0))
     {
@@ -4392,9 +4837,9 @@ static int isAbstractDeclarator(Parser *parser, const int resetOnSuccess)
         {
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_ABSTRACT_DECLARATOR, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_ABSTRACT_DECLARATOR);
             
         }
         
@@ -4404,12 +4849,12 @@ static int isAbstractDeclarator(Parser *parser, const int resetOnSuccess)
     {
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_ABSTRACT_DECLARATOR, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_ABSTRACT_DECLARATOR);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_ABSTRACT_DECLARATOR, lookaheadPosition);
     return 0;
 }
 
@@ -4423,7 +4868,7 @@ static ASTNode *parseAbstractDeclarator(Parser *parser)
 
     //Allocating memory
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
@@ -4437,19 +4882,18 @@ static ASTNode *parseAbstractDeclarator(Parser *parser)
         children[childCount++] = parsePointer(parser);
         if (!isDirectAbstractDeclarator(parser, 1))
         {
-            return createASTNode(AST_ABSTRACT_DECLARATOR, NULL, 0, children, childCount);
+            return createArenaASTNode(parser->arena, AST_ABSTRACT_DECLARATOR, NULL, 0, children, childCount);
         }
     }
 
     if (isDirectAbstractDeclarator(parser, 1))
     {
         children[childCount++] = parseDirectAbstractDeclarator(parser);
-        return createASTNode(AST_ABSTRACT_DECLARATOR, NULL, 0, children, childCount);
+        return createArenaASTNode(parser->arena, AST_ABSTRACT_DECLARATOR, NULL, 0, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected an Abstract Declarator but found:", duplicateToken(nextToken(parser))));
-    free(children);
+    addExpectedError(parser, "an Abstract Declarator");
     return NULL;
 }
 
@@ -4461,6 +4905,12 @@ static int isDirectAbstractDeclarator(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_DIRECT_ABSTRACT_DECLARATOR);
+    if (!PARSER_RULE_FIRST(parser, DIRECT_ABSTRACT_DECLARATOR))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isNextTokenTypeOf(parser, TOKEN_OPEN_PARENTHESIS, 1))
     {
@@ -4472,14 +4922,14 @@ static int isDirectAbstractDeclarator(Parser *parser, const int resetOnSuccess)
 
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_ABSTRACT_DECLARATOR, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_DIRECT_ABSTRACT_DECLARATOR);
             }
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_ABSTRACT_DECLARATOR, lookaheadPosition);
     return 0;
 }
 
@@ -4493,7 +4943,7 @@ static ASTNode *parseDirectAbstractDeclarator(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 2;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -4501,11 +4951,10 @@ static ASTNode *parseDirectAbstractDeclarator(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 3;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -4520,28 +4969,24 @@ static ASTNode *parseDirectAbstractDeclarator(Parser *parser)
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
 
             children[childCount++] = parseDirectAbstractDeclaratorPrime(parser);
         }
 
-        return createASTNode(AST_DIRECT_ABSTRACT_DECLARATOR, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_DIRECT_ABSTRACT_DECLARATOR, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Direct Abstract Declarator but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Direct Abstract Declarator");
     return NULL;
 }
 
@@ -4553,6 +4998,12 @@ static int isDirectAbstractDeclaratorPrime(Parser *parser, const int resetOnSucc
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_DIRECT_ABSTRACT_DECLARATOR_PRIME);
+    if (!PARSER_RULE_FIRST(parser, DIRECT_ABSTRACT_DECLARATOR_PRIME))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isNextTokenTypeOf(parser, TOKEN_OPEN_PARENTHESIS, 1))   
     {
@@ -4562,9 +5013,9 @@ static int isDirectAbstractDeclaratorPrime(Parser *parser, const int resetOnSucc
         {
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_ABSTRACT_DECLARATOR_PRIME, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_DIRECT_ABSTRACT_DECLARATOR_PRIME);
         }
     }
     else if (isNextTokenTypeOf(parser, TOKEN_OPEN_BRACKET, 1))
@@ -4575,12 +5026,12 @@ static int isDirectAbstractDeclaratorPrime(Parser *parser, const int resetOnSucc
             {
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_ABSTRACT_DECLARATOR_PRIME, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_DIRECT_ABSTRACT_DECLARATOR_PRIME);
             }
 
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_ABSTRACT_DECLARATOR_PRIME, lookaheadPosition);
             return 0;
         }
         
@@ -4590,13 +5041,13 @@ static int isDirectAbstractDeclaratorPrime(Parser *parser, const int resetOnSucc
         {
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_ABSTRACT_DECLARATOR_PRIME, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_DIRECT_ABSTRACT_DECLARATOR_PRIME);
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_DIRECT_ABSTRACT_DECLARATOR_PRIME, lookaheadPosition);
     return 0;
 }
 
@@ -4610,7 +5061,7 @@ static ASTNode *parseDirectAbstractDeclaratorPrime(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 3;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -4618,11 +5069,10 @@ static ASTNode *parseDirectAbstractDeclaratorPrime(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -4636,7 +5086,7 @@ static ASTNode *parseDirectAbstractDeclaratorPrime(Parser *parser)
             children[childCount++] = parseParameterList(parser);
         }
         tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_PARENTHESIS);
-        return createASTNode(AST_DIRECT_ABSTRACT_DECLARATOR_PRIME, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_DIRECT_ABSTRACT_DECLARATOR_PRIME, tokens, tokenCount, children, childCount);
     }
     else if (isNextTokenTypeOf(parser, TOKEN_OPEN_BRACKET, 0))
     {
@@ -4645,7 +5095,7 @@ static ASTNode *parseDirectAbstractDeclaratorPrime(Parser *parser)
         {
             tokens[tokenCount++] = matchToken(parser, TOKEN_STAR);
             tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_BRACKET);
-            return createASTNode(AST_DIRECT_ABSTRACT_DECLARATOR_PRIME, tokens, tokenCount, children, childCount);
+            return createArenaASTNode(parser->arena, AST_DIRECT_ABSTRACT_DECLARATOR_PRIME, tokens, tokenCount, children, childCount);
         }
 
         if (isAssignmentExpression(parser, 1))
@@ -4653,13 +5103,11 @@ static ASTNode *parseDirectAbstractDeclaratorPrime(Parser *parser)
             children[childCount++] = parseAssignmentExpression(parser);
         }
         tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_BRACKET);
-        return createASTNode(AST_DIRECT_ABSTRACT_DECLARATOR_PRIME, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_DIRECT_ABSTRACT_DECLARATOR_PRIME, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Direct Abstract Declarator Prime but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Direct Abstract Declarator Prime");
     return NULL;
 }
 
@@ -4671,6 +5119,12 @@ static int isParameterList(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_PARAMETER_LIST);
+    if (!PARSER_RULE_FIRST(parser, PARAMETER_LIST))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isParameterDeclaration(parser, 0))
     {
@@ -4678,19 +5132,19 @@ static int isParameterList(Parser *parser, const int resetOnSuccess)
         {
             if (!isParameterDeclaration(parser, 0))
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_PARAMETER_LIST, lookaheadPosition);
                 return 0;
             }
         }
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_PARAMETER_LIST, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_PARAMETER_LIST);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_PARAMETER_LIST, lookaheadPosition);
     return 0;
 }
 
@@ -4704,7 +5158,7 @@ static ASTNode *parseParameterList(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -4712,11 +5166,10 @@ static ASTNode *parseParameterList(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 3;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -4729,42 +5182,36 @@ static ASTNode *parseParameterList(Parser *parser)
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
             if (tokenCount + 1 >= tokensSize)
             {
-                tokensSize *= 2;
-                Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                 if (newTokens == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for tokens failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 tokens = newTokens;
+                tokensSize *= 2;
             }
 
             tokens[tokenCount++] = matchToken(parser, TOKEN_COMMA);
             children[childCount++] = parseParameterDeclaration(parser);
         }
 
-        return createASTNode(AST_PARAMETER_LIST, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_PARAMETER_LIST, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Parameter List but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Parameter List");
     return NULL;
 }
 
@@ -4776,6 +5223,12 @@ static int isParameterDeclaration(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_PARAMETER_DECLARATION);
+    if (!PARSER_RULE_FIRST(parser, PARAMETER_DECLARATION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isDeclarationSpecifiers(parser, 0))
     {
@@ -4783,20 +5236,20 @@ static int isParameterDeclaration(Parser *parser, const int resetOnSuccess)
         {
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_PARAMETER_DECLARATION, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_PARAMETER_DECLARATION);
         }
 
         isAbstractDeclarator(parser, 0);
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_PARAMETER_DECLARATION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_PARAMETER_DECLARATION);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_PARAMETER_DECLARATION, lookaheadPosition);
     return 0;
 }
 
@@ -4810,7 +5263,7 @@ static ASTNode *parseParameterDeclaration(Parser *parser)
 
     //Allocating memory
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
@@ -4825,7 +5278,7 @@ static ASTNode *parseParameterDeclaration(Parser *parser)
         if (isDeclarator(parser, 1))
         {
             children[childCount++] = parseDeclarator(parser);
-            return createASTNode(AST_PARAMETER_DECLARATION, NULL, 0, children, childCount);
+            return createArenaASTNode(parser->arena, AST_PARAMETER_DECLARATION, NULL, 0, children, childCount);
         }
 
         if (isAbstractDeclarator(parser, 1))
@@ -4833,12 +5286,11 @@ static ASTNode *parseParameterDeclaration(Parser *parser)
             children[childCount++] = parseAbstractDeclarator(parser);
         }
 
-        return createASTNode(AST_PARAMETER_DECLARATION, NULL, 0, children, childCount);
+        return createArenaASTNode(parser->arena, AST_PARAMETER_DECLARATION, NULL, 0, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Parameter Declaration but found:", duplicateToken(nextToken(parser))));
-    free(children);
+    addExpectedError(parser, "a Parameter Declaration");
     return NULL;
 }
 
@@ -4850,6 +5302,12 @@ static int isInitializerList(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_INITIALIZER_LIST);
+    if (!PARSER_RULE_FIRST(parser, INITIALIZER_LIST))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     isDesignation(parser, 0);
 
@@ -4861,19 +5319,19 @@ static int isInitializerList(Parser *parser, const int resetOnSuccess)
 
             if (!isInitializer(parser, 0))
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_INITIALIZER_LIST, lookaheadPosition);
                 return 0;
             }
         }
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_INITIALIZER_LIST, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_INITIALIZER_LIST);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_INITIALIZER_LIST, lookaheadPosition);
     return 0;
 }
 
@@ -4887,7 +5345,7 @@ static ASTNode *parseInitializerList(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -4895,11 +5353,10 @@ static ASTNode *parseInitializerList(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 5;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -4917,29 +5374,25 @@ static ASTNode *parseInitializerList(Parser *parser)
         {
             if (childCount + 2 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
             if (tokenCount + 1 >= tokensSize)
             {
-                tokensSize *= 2;
-                Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                 if (newTokens == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for tokens failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 tokens = newTokens;
+                tokensSize *= 2;
             }
 
             tokens[tokenCount++] = matchToken(parser, TOKEN_COMMA);
@@ -4951,13 +5404,11 @@ static ASTNode *parseInitializerList(Parser *parser)
             children[childCount++] = parseInitializer(parser);
         }
 
-        return createASTNode(AST_INITIALIZER_LIST, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_INITIALIZER_LIST, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected an Initializer List but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "an Initializer List");
     return NULL;
 }
 
@@ -4969,6 +5420,12 @@ static int isDesignation(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_DESIGNATION);
+    if (!PARSER_RULE_FIRST(parser, DESIGNATION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isDesignator(parser, 0))
     {
@@ -4978,13 +5435,13 @@ static int isDesignation(Parser *parser, const int resetOnSuccess)
         {
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_DESIGNATION, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_DESIGNATION);
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_DESIGNATION, lookaheadPosition);
     return 0;
 }
 
@@ -4998,7 +5455,7 @@ static ASTNode *parseDesignation(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -5006,11 +5463,10 @@ static ASTNode *parseDesignation(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -5024,29 +5480,25 @@ static ASTNode *parseDesignation(Parser *parser)
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
 
             children[childCount++] = parseDesignator(parser);
         }
 
         tokens[tokenCount++] = matchToken(parser, TOKEN_EQUALS);
-        return createASTNode(AST_DESIGNATION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_DESIGNATION, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Designation but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Designation");
     return NULL;
 }
 
@@ -5058,6 +5510,12 @@ static int isDesignator(Parser *parser, const int resetOnSucces)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_DESIGNATOR);
+    if (!PARSER_RULE_FIRST(parser, DESIGNATOR))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isNextTokenTypeOf(parser, TOKEN_OPEN_BRACKET, 1))
     {
@@ -5067,9 +5525,9 @@ static int isDesignator(Parser *parser, const int resetOnSucces)
             {
                 if (resetOnSucces)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_DESIGNATOR, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_DESIGNATOR);
             }
         }
     }
@@ -5079,13 +5537,13 @@ static int isDesignator(Parser *parser, const int resetOnSucces)
         {
             if (resetOnSucces)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_DESIGNATOR, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_DESIGNATOR);
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_DESIGNATOR, lookaheadPosition);
     return 0;
 }
 
@@ -5099,7 +5557,7 @@ static ASTNode *parseDesignator(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 2;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -5107,32 +5565,31 @@ static ASTNode *parseDesignator(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
 
     //Parsing
-    if (isNextTokenTypeOf(parser, TOKEN_OPEN_PARENTHESIS, 0))
+    if (isNextTokenTypeOf(parser, TOKEN_OPEN_BRACKET, 0))
     {
-        tokens[tokenCount++] = matchToken(parser, TOKEN_OPEN_PARENTHESIS);
+        tokens[tokenCount++] = matchToken(parser, TOKEN_OPEN_BRACKET);
         children[childCount++] = parseConstantExpression(parser);
-        tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_PARENTHESIS);
+        tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_BRACKET);
+        return createArenaASTNode(parser->arena, AST_DESIGNATOR, tokens, tokenCount, children, childCount);
     }
     else if (isNextTokenTypeOf(parser, TOKEN_DOT, 0))
     {
         tokens[tokenCount++] = matchToken(parser, TOKEN_DOT);
         tokens[tokenCount++] = matchToken(parser, TOKEN_IDENTIFIER);
+        return createArenaASTNode(parser->arena, AST_DESIGNATOR, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Designator but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Designator");
     return NULL;
 }
 
@@ -5144,17 +5601,23 @@ static int isConstantExpression(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_CONSTANT_EXPRESSION);
+    if (!PARSER_RULE_FIRST(parser, CONSTANT_EXPRESSION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isConditionalExpression(parser, 0))
     {
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_CONSTANT_EXPRESSION, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_CONSTANT_EXPRESSION);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_CONSTANT_EXPRESSION, lookaheadPosition);
     return 0;
 }
 
@@ -5168,7 +5631,7 @@ static ASTNode *parseConstantExpression(Parser *parser)
 
     //Allocating memory
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
@@ -5180,12 +5643,11 @@ static ASTNode *parseConstantExpression(Parser *parser)
     if (isConditionalExpression(parser, 1))
     {
         children[childCount++] = parseConditionalExpression(parser);
-        return createASTNode(AST_CONSTANT_EXPRESSION, NULL, 0, children, childCount);
+        return createArenaASTNode(parser->arena, AST_CONSTANT_EXPRESSION, NULL, 0, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Constant Expression but found:", duplicateToken(nextToken(parser))));
-    free(children);
+    addExpectedError(parser, "a Constant Expression");
     return NULL;
 }
 
@@ -5197,32 +5659,38 @@ static int isInitializer(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_INITIALIZER);
+    if (!PARSER_RULE_FIRST(parser, INITIALIZER))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isAssignmentExpression(parser, 0))
     {
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_INITIALIZER, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_INITIALIZER);
     }
-    else if (isNextTokenTypeOf(parser, TOKEN_OPEN_BRACKET, 1))
+    else if (isNextTokenTypeOf(parser, TOKEN_OPEN_CURLY, 1))
     {
-        if (isInitializerList(parser, 1))
+        if (isInitializerList(parser, 0))
         {
-            isNextTokenTypeOf(parser, TOKEN_COMMA, 0);
-            if (isNextTokenTypeOf(parser, TOKEN_CLOSE_BRACKET, 1))
+            isNextTokenTypeOf(parser, TOKEN_COMMA, 1);
+            if (isNextTokenTypeOf(parser, TOKEN_CLOSE_CURLY, 1))
             {
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_INITIALIZER, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_INITIALIZER);
             }
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_INITIALIZER, lookaheadPosition);
     return 0;
 }
 
@@ -5236,7 +5704,7 @@ static ASTNode *parseInitializer(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 3;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -5244,38 +5712,33 @@ static ASTNode *parseInitializer(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
 
     //Parsing
-    if (isAssignmentExpression(parser, 1))
+    if (PARSER_PREDICTS(parser, INITIALIZER, ASSIGNMENT_EXPRESSION) || isAssignmentExpression(parser, 1))
     {
-        free(tokens);
-        free(children);
         return parseAssignmentExpression(parser);
     }
-    else if (isNextTokenTypeOf(parser, TOKEN_OPEN_BRACKET, 0))
+    else if (isNextTokenTypeOf(parser, TOKEN_OPEN_CURLY, 0))
     {
-        tokens[tokenCount++] = matchToken(parser, TOKEN_OPEN_BRACKET);
+        tokens[tokenCount++] = matchToken(parser, TOKEN_OPEN_CURLY);
         children[childCount++] = parseInitializerList(parser);
         if (isNextTokenTypeOf(parser, TOKEN_COMMA, 0))
         {
             tokens[tokenCount++] = matchToken(parser, TOKEN_COMMA);
         }
-        tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_BRACKET);
-        return createASTNode(AST_INITIALIZER, tokens, tokenCount, children, childCount);
+        tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_CURLY);
+        return createArenaASTNode(parser->arena, AST_INITIALIZER, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected an Initializer but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "an Initializer");
     return NULL;
 }
 
@@ -5287,6 +5750,12 @@ static int isIdentifierList(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_IDENTIFIER_LIST);
+    if (!PARSER_RULE_FIRST(parser, IDENTIFIER_LIST))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isNextTokenTypeOf(parser, TOKEN_IDENTIFIER, 1))
     {
@@ -5294,19 +5763,19 @@ static int isIdentifierList(Parser *parser, const int resetOnSuccess)
         {
             if (!isNextTokenTypeOf(parser, TOKEN_IDENTIFIER, 1))
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_IDENTIFIER_LIST, lookaheadPosition);
                 return 0;
             }
         }
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_IDENTIFIER_LIST, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_IDENTIFIER_LIST);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_IDENTIFIER_LIST, lookaheadPosition);
     return 0;
 }
 
@@ -5320,7 +5789,7 @@ static ASTNode *parseIdentifierList(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 4;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -5336,27 +5805,25 @@ static ASTNode *parseIdentifierList(Parser *parser)
         {
             if (tokenCount + 2 >= tokensSize)
             {
-                tokensSize *= 2;
-                Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                 if (newTokens == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for tokens failed!\n");
-                    free(tokens);
                     return NULL;
                 }
                 tokens = newTokens;
+                tokensSize *= 2;
             }
 
             tokens[tokenCount++] = matchToken(parser, TOKEN_COMMA);
             tokens[tokenCount++] = matchToken(parser, TOKEN_IDENTIFIER);
         }
 
-        return createASTNode(AST_IDENTIFIER_LIST, tokens, tokenCount, NULL, 0);
+        return createArenaASTNode(parser->arena, AST_IDENTIFIER_LIST, tokens, tokenCount, NULL, 0);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected an Identifier List but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
+    addExpectedError(parser, "an Identifier List");
     return NULL;
 }
 
@@ -5368,6 +5835,12 @@ static int isEnumSpecifier(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_ENUM_SPECIFIER);
+    if (!PARSER_RULE_FIRST(parser, ENUM_SPECIFIER))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isNextTokenKeywordWord(parser, KEYWORD_ENUM, 1))
     {
@@ -5377,9 +5850,9 @@ static int isEnumSpecifier(Parser *parser, const int resetOnSuccess)
             {
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_ENUM_SPECIFIER, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_ENUM_SPECIFIER);
             }
         }
 
@@ -5392,15 +5865,15 @@ static int isEnumSpecifier(Parser *parser, const int resetOnSuccess)
                 {
                     if (resetOnSuccess)
                     {
-                        parser->position = lookaheadPosition;
+                        PARSER_RULE_REWIND(parser, PARSER_RULE_ENUM_SPECIFIER, lookaheadPosition);
                     }
-                    return 1;
+                    return PARSER_RULE_ACCEPT(parser, PARSER_RULE_ENUM_SPECIFIER);
                 }
             }
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_ENUM_SPECIFIER, lookaheadPosition);
     return 0;
 }
 
@@ -5414,7 +5887,7 @@ static ASTNode *parseEnumSpecifier(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 5;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -5422,11 +5895,10 @@ static ASTNode *parseEnumSpecifier(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -5440,7 +5912,7 @@ static ASTNode *parseEnumSpecifier(Parser *parser)
             tokens[tokenCount++] = matchToken(parser, TOKEN_IDENTIFIER);
             if (!isNextTokenTypeOf(parser, TOKEN_OPEN_CURLY, 0))
             {
-                return createASTNode(AST_ENUM_SPECIFIER, tokens, tokenCount, children, childCount);
+                return createArenaASTNode(parser->arena, AST_ENUM_SPECIFIER, tokens, tokenCount, children, childCount);
             }
         }
 
@@ -5451,13 +5923,11 @@ static ASTNode *parseEnumSpecifier(Parser *parser)
             tokens[tokenCount++] = matchToken(parser, TOKEN_COMMA);
         }
         tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_CURLY);
-        return createASTNode(AST_ENUM_SPECIFIER, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_ENUM_SPECIFIER, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected an Enum Specifier but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "an Enum Specifier");
     return NULL;
 }
 
@@ -5469,6 +5939,12 @@ static int isEnumeratorList(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_ENUMERATOR_LIST);
+    if (!PARSER_RULE_FIRST(parser, ENUMERATOR_LIST))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isEnumerator(parser, 0))
     {
@@ -5476,19 +5952,19 @@ static int isEnumeratorList(Parser *parser, const int resetOnSuccess)
         {
             if (!isEnumerator(parser, 0))
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_ENUMERATOR_LIST, lookaheadPosition);
                 return 0;
             }
         }
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_ENUMERATOR_LIST, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_ENUMERATOR_LIST);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_ENUMERATOR_LIST, lookaheadPosition);
     return 0;
 }
 
@@ -5502,7 +5978,7 @@ static ASTNode *parseEnumeratorList(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 2;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -5510,11 +5986,10 @@ static ASTNode *parseEnumeratorList(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -5527,42 +6002,36 @@ static ASTNode *parseEnumeratorList(Parser *parser)
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
             if (tokenCount + 1 >= tokensSize)
             {
-                tokensSize *= 2;
-                Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                 if (newTokens == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for tokens failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 tokens = newTokens;
+                tokensSize *= 2;
             }
 
             tokens[tokenCount++] = matchToken(parser, TOKEN_COMMA);
             children[childCount++] = parseEnumerator(parser);
         }
 
-        return createASTNode(AST_ENUMERATOR_LIST, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_ENUMERATOR_LIST, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected an Enumerator List but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "an Enumerator List");
     return NULL;
 }
 
@@ -5574,6 +6043,12 @@ static int isEnumerator(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_ENUMERATOR);
+    if (!PARSER_RULE_FIRST(parser, ENUMERATOR))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isNextTokenTypeOf(parser, TOKEN_IDENTIFIER, 1))
     {
@@ -5581,19 +6056,19 @@ static int isEnumerator(Parser *parser, const int resetOnSuccess)
         {
             if (!isConstantExpression(parser, 0))
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_ENUMERATOR, lookaheadPosition);
                 return 0;
             }
         }
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_ENUMERATOR, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_ENUMERATOR);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_ENUMERATOR, lookaheadPosition);
     return 0;
 }
 
@@ -5607,7 +6082,7 @@ static ASTNode *parseEnumerator(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 3;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -5615,11 +6090,10 @@ static ASTNode *parseEnumerator(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -5628,46 +6102,40 @@ static ASTNode *parseEnumerator(Parser *parser)
     if (isNextTokenTypeOf(parser, TOKEN_IDENTIFIER, 0))
     {
         tokens[tokenCount++] = matchToken(parser, TOKEN_IDENTIFIER);    
-        while (isNextTokenTypeOf(parser, TOKEN_EQUALS, 1))
+        while (isNextTokenTypeOf(parser, TOKEN_EQUALS, 0))
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
             if (tokenCount + 1 >= tokensSize)
             {
-                tokensSize *= 2;
-                Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                 if (newTokens == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for tokens failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 tokens = newTokens;
+                tokensSize *= 2;
             }
 
             tokens[tokenCount++] = matchToken(parser, TOKEN_EQUALS);
             children[childCount++] = parseConstantExpression(parser);
         }
 
-        return createASTNode(AST_ENUMERATOR, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_ENUMERATOR, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected an Enumerator but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "an Enumerator");
     return NULL;
 }
 
@@ -5679,6 +6147,12 @@ static int isDeclaration(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_DECLARATION);
+    if (!PARSER_RULE_FIRST(parser, DECLARATION))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isDeclarationSpecifiers(parser, 0))
     {
@@ -5687,13 +6161,13 @@ static int isDeclaration(Parser *parser, const int resetOnSuccess)
         {
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_DECLARATION, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_DECLARATION);
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_DECLARATION, lookaheadPosition);
     return 0;
 }
 
@@ -5707,7 +6181,7 @@ static ASTNode *parseDeclaration(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -5715,11 +6189,10 @@ static ASTNode *parseDeclaration(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -5734,13 +6207,11 @@ static ASTNode *parseDeclaration(Parser *parser)
         }
         
         tokens[tokenCount++] = matchToken(parser, TOKEN_SEMICOLON);
-        return createASTNode(AST_DECLARATION, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_DECLARATION, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Declaration but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Declaration");
     return NULL;
 }
 
@@ -5752,6 +6223,12 @@ static int isInitDeclaratorList(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_INIT_DECLARATOR_LIST);
+    if (!PARSER_RULE_FIRST(parser, INIT_DECLARATOR_LIST))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isInitDeclarator(parser, 0))
     {
@@ -5759,19 +6236,19 @@ static int isInitDeclaratorList(Parser *parser, const int resetOnSuccess)
         {
             if (!isInitDeclarator(parser, 0))
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_INIT_DECLARATOR_LIST, lookaheadPosition);
                 return 0;
             }
         }
 
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_INIT_DECLARATOR_LIST, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_INIT_DECLARATOR_LIST);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_INIT_DECLARATOR_LIST, lookaheadPosition);
     return 0;
 }
 
@@ -5785,7 +6262,7 @@ static ASTNode *parseInitDeclaratorList(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 2;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -5793,11 +6270,10 @@ static ASTNode *parseInitDeclaratorList(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 3;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -5810,43 +6286,37 @@ static ASTNode *parseInitDeclaratorList(Parser *parser)
         {
             if (childCount + 1 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
             if (tokenCount + 1 >= tokensSize)
             {
-                tokensSize *= 2;
-                Token **newTokens = realloc(tokens, tokensSize * sizeof(Token *));
+                Token **newTokens = growFromASTArena(parser->arena, tokens, tokensSize * sizeof(Token *), 2 * tokensSize * sizeof(Token *));
                 if (newTokens == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for tokens failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 tokens = newTokens;
+                tokensSize *= 2;
             }
 
             tokens[tokenCount++] = matchToken(parser, TOKEN_COMMA);
             children[childCount++] = parseInitDeclarator(parser);
         }
 
-        return createASTNode(AST_INIT_DECLARATOR_LIST, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_INIT_DECLARATOR_LIST, tokens, tokenCount, children, childCount);
     }
 
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected an Init Declarator List but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "an Init Declarator List");
     return NULL;
 }
 
@@ -5858,6 +6328,12 @@ static int isInitDeclarator(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_INIT_DECLARATOR);
+    if (!PARSER_RULE_FIRST(parser, INIT_DECLARATOR))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isDeclarator(parser, 0))
     {
@@ -5867,22 +6343,22 @@ static int isInitDeclarator(Parser *parser, const int resetOnSuccess)
             {
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_INIT_DECLARATOR, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_INIT_DECLARATOR);
             }
         }
         else
         {
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_INIT_DECLARATOR, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_INIT_DECLARATOR);
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_INIT_DECLARATOR, lookaheadPosition);
     return 0;
 }
 
@@ -5896,7 +6372,7 @@ static ASTNode *parseInitDeclarator(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -5904,11 +6380,10 @@ static ASTNode *parseInitDeclarator(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -5923,13 +6398,11 @@ static ASTNode *parseInitDeclarator(Parser *parser)
             children[childCount++] = parseInitializer(parser);
         }
 
-        return createASTNode(AST_INIT_DECLARATOR, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_INIT_DECLARATOR, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected an Init Declarator but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "an Init Declarator");
     return NULL;
 }
 
@@ -5941,17 +6414,23 @@ static int isStatement(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_STATEMENT);
+    if (!PARSER_RULE_FIRST(parser, STATEMENT))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isLabeledStatement(parser, 0) || isCompoundStatement(parser, 0) || isExpressionStatement(parser, 0) || isSelectionStatement(parser, 0) || isIterationStatement(parser, 0) || isJumpStatement(parser, 0))
     {
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_STATEMENT, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_STATEMENT);
     }
     
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_STATEMENT, lookaheadPosition);
     return 0;
 }
 
@@ -5964,33 +6443,33 @@ static ASTNode *parseStatement(Parser *parser)
     }
 
     //Parsing
-    if (isLabeledStatement(parser, 1))
+    if (PARSER_PREDICTS(parser, STATEMENT, LABELED_STATEMENT) || isLabeledStatement(parser, 1))
     {
         return parseLabeledStatement(parser);
     }
-    else if (isCompoundStatement(parser, 1))
+    else if (PARSER_PREDICTS(parser, STATEMENT, COMPOUND_STATEMENT) || isCompoundStatement(parser, 1))
     {
         return parseCompoundStatement(parser);
     }
-    else if (isExpressionStatement(parser, 1))
+    else if (PARSER_PREDICTS(parser, STATEMENT, EXPRESSION_STATEMENT) || isExpressionStatement(parser, 1))
     {
         return parseExpressionStatement(parser);
     }
-    else if (isSelectionStatement(parser, 1))
+    else if (PARSER_PREDICTS(parser, STATEMENT, SELECTION_STATEMENT) || isSelectionStatement(parser, 1))
     {
         return parseSelectionStatement(parser);
     }
-    else if (isIterationStatement(parser, 1))
+    else if (PARSER_PREDICTS(parser, STATEMENT, ITERATION_STATEMENT) || isIterationStatement(parser, 1))
     {
         return parseIterationStatement(parser);
     }
-    else if (isJumpStatement(parser, 1))
+    else if (PARSER_PREDICTS(parser, STATEMENT, JUMP_STATEMENT) || isJumpStatement(parser, 1))
     {
         return parseJumpStatement(parser);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Statement but found:", duplicateToken(nextToken(parser))));
+    addExpectedError(parser, "a Statement");
     return NULL;
 }
 
@@ -6002,18 +6481,24 @@ static int isLabeledStatement(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_LABELED_STATEMENT);
+    if (!PARSER_RULE_FIRST(parser, LABELED_STATEMENT))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isNextTokenTypeOf(parser, TOKEN_IDENTIFIER, 1))
     {
         if (isNextTokenTypeOf(parser, TOKEN_COLON, 1))
         {
-            if (isStatement(parser, 1))
+            if (isStatement(parser, 0))
             {
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_LABELED_STATEMENT, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_LABELED_STATEMENT);
             }
         }
     }
@@ -6023,13 +6508,13 @@ static int isLabeledStatement(Parser *parser, const int resetOnSuccess)
         {
             if (isNextTokenTypeOf(parser, TOKEN_COLON, 1))
             {
-                if (isStatement(parser, 1))
+                if (isStatement(parser, 0))
                 {
                     if (resetOnSuccess)
                     {
-                        parser->position = lookaheadPosition;
+                        PARSER_RULE_REWIND(parser, PARSER_RULE_LABELED_STATEMENT, lookaheadPosition);
                     }
-                    return 1;
+                    return PARSER_RULE_ACCEPT(parser, PARSER_RULE_LABELED_STATEMENT);
                 }
             }
         }
@@ -6038,18 +6523,18 @@ static int isLabeledStatement(Parser *parser, const int resetOnSuccess)
     {
         if (isNextTokenTypeOf(parser, TOKEN_COLON, 1))
         {
-            if (isStatement(parser, 1))
+            if (isStatement(parser, 0))
             {
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_LABELED_STATEMENT, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_LABELED_STATEMENT);
             }
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_LABELED_STATEMENT, lookaheadPosition);
     return 0;
 }
 
@@ -6063,7 +6548,7 @@ static ASTNode *parseLabeledStatement(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 2;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -6071,11 +6556,10 @@ static ASTNode *parseLabeledStatement(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -6086,7 +6570,7 @@ static ASTNode *parseLabeledStatement(Parser *parser)
         tokens[tokenCount++] = matchToken(parser, TOKEN_IDENTIFIER);
         tokens[tokenCount++] = matchToken(parser, TOKEN_COLON);
         children[childCount++] = parseStatement(parser);
-        return createASTNode(AST_LABELED_STATEMENT, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_LABELED_STATEMENT, tokens, tokenCount, children, childCount);
     }
     else if (isNextTokenKeywordWord(parser, KEYWORD_CASE, 0))
     {
@@ -6094,20 +6578,18 @@ static ASTNode *parseLabeledStatement(Parser *parser)
         children[childCount++] = parseConstantExpression(parser);
         tokens[tokenCount++] = matchToken(parser, TOKEN_COLON);
         children[childCount++] = parseStatement(parser);
-        return createASTNode(AST_LABELED_STATEMENT, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_LABELED_STATEMENT, tokens, tokenCount, children, childCount);
     }
     else if (isNextTokenKeywordWord(parser, KEYWORD_DEFAULT, 0))
     {
         tokens[tokenCount++] = matchToken(parser, TOKEN_KEYWORD);
         tokens[tokenCount++] = matchToken(parser, TOKEN_COLON);
         children[childCount++] = parseStatement(parser);
-        return createASTNode(AST_LABELED_STATEMENT, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_LABELED_STATEMENT, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Labeled Statement but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Labeled Statement");
     return NULL;
 }
 
@@ -6119,6 +6601,12 @@ static int isCompoundStatement(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_COMPOUND_STATEMENT);
+    if (!PARSER_RULE_FIRST(parser, COMPOUND_STATEMENT))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isNextTokenTypeOf(parser, TOKEN_OPEN_CURLY, 1))
     {
@@ -6128,13 +6616,13 @@ static int isCompoundStatement(Parser *parser, const int resetOnSuccess)
         {
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_COMPOUND_STATEMENT, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_COMPOUND_STATEMENT);
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_COMPOUND_STATEMENT, lookaheadPosition);
     return 0;
 }
 
@@ -6148,7 +6636,7 @@ static ASTNode *parseCompoundStatement(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 2;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -6156,11 +6644,10 @@ static ASTNode *parseCompoundStatement(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 4;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -6173,16 +6660,14 @@ static ASTNode *parseCompoundStatement(Parser *parser)
         {
             if (childCount + 2 >= childrenSize)
             {
-                childrenSize *= 2;
-                ASTNode **newChildren = realloc(children, childrenSize * sizeof(ASTNode *));
+                ASTNode **newChildren = growFromASTArena(parser->arena, children, childrenSize * sizeof(ASTNode *), 2 * childrenSize * sizeof(ASTNode *));
                 if (newChildren == NULL)
                 {
                     fprintf(stderr, "Memory reallocation for ASTNode children failed!\n");
-                    free(tokens);
-                    free(children);
                     return NULL;
                 }
                 children = newChildren;
+                childrenSize *= 2;
             }
 
             if (isDeclaration(parser, 1))
@@ -6196,13 +6681,11 @@ static ASTNode *parseCompoundStatement(Parser *parser)
         }
 
         tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_CURLY);
-        return createASTNode(AST_COMPOUND_STATEMENT, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_COMPOUND_STATEMENT, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Compound Statement but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Compound Statement");
     return NULL;
 }
 
@@ -6214,6 +6697,12 @@ static int isExpressionStatement(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_EXPRESSION_STATEMENT);
+    if (!PARSER_RULE_FIRST(parser, EXPRESSION_STATEMENT))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     isExpression(parser, 0);
     
@@ -6221,12 +6710,12 @@ static int isExpressionStatement(Parser *parser, const int resetOnSuccess)
     {
         if (resetOnSuccess)
         {
-            parser->position = lookaheadPosition;
+            PARSER_RULE_REWIND(parser, PARSER_RULE_EXPRESSION_STATEMENT, lookaheadPosition);
         }
-        return 1;
+        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_EXPRESSION_STATEMENT);
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_EXPRESSION_STATEMENT, lookaheadPosition);
     return 0;
 }
 
@@ -6240,7 +6729,7 @@ static ASTNode *parseExpressionStatement(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 1;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -6248,11 +6737,10 @@ static ASTNode *parseExpressionStatement(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -6264,7 +6752,7 @@ static ASTNode *parseExpressionStatement(Parser *parser)
     }
 
     tokens[tokenCount++] = matchToken(parser, TOKEN_SEMICOLON);
-    return createASTNode(AST_EXPRESSION_STATEMENT, tokens, tokenCount, children, childCount);
+    return createArenaASTNode(parser->arena, AST_EXPRESSION_STATEMENT, tokens, tokenCount, children, childCount);
 }
 
 static int isSelectionStatement(Parser *parser, const int resetOnSuccess)
@@ -6275,6 +6763,12 @@ static int isSelectionStatement(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_SELECTION_STATEMENT);
+    if (!PARSER_RULE_FIRST(parser, SELECTION_STATEMENT))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isNextTokenKeywordWord(parser, KEYWORD_IF, 1))
     {
@@ -6292,18 +6786,18 @@ static int isSelectionStatement(Parser *parser, const int resetOnSuccess)
                             {
                                 if (resetOnSuccess)
                                 {
-                                    parser->position = lookaheadPosition;
+                                    PARSER_RULE_REWIND(parser, PARSER_RULE_SELECTION_STATEMENT, lookaheadPosition);
                                 }
-                                return 1;
+                                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_SELECTION_STATEMENT);
                             }
                         }
                         else
                         {
                             if (resetOnSuccess)
                             {
-                                parser->position = lookaheadPosition;
+                                PARSER_RULE_REWIND(parser, PARSER_RULE_SELECTION_STATEMENT, lookaheadPosition);
                             }
-                            return 1;
+                            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_SELECTION_STATEMENT);
                         }
                     }
                 }
@@ -6322,16 +6816,16 @@ static int isSelectionStatement(Parser *parser, const int resetOnSuccess)
                     {
                         if (resetOnSuccess)
                         {
-                            parser->position = lookaheadPosition;
+                            PARSER_RULE_REWIND(parser, PARSER_RULE_SELECTION_STATEMENT, lookaheadPosition);
                         }
-                        return 1;
+                        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_SELECTION_STATEMENT);
                     }
                 }
             }
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_SELECTION_STATEMENT, lookaheadPosition);
     return 0;
 }
 
@@ -6345,7 +6839,7 @@ static ASTNode *parseSelectionStatement(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 4;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -6353,11 +6847,10 @@ static ASTNode *parseSelectionStatement(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 3;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -6372,12 +6865,12 @@ static ASTNode *parseSelectionStatement(Parser *parser)
         children[childCount++] = parseStatement(parser);
         if (!isNextTokenKeywordWord(parser, KEYWORD_ELSE, 0))
         {
-            return createASTNode(AST_SELECTION_STATEMENT, tokens, tokenCount, children, childCount);
+            return createArenaASTNode(parser->arena, AST_SELECTION_STATEMENT, tokens, tokenCount, children, childCount);
         }
 
         tokens[tokenCount++] = matchToken(parser, TOKEN_KEYWORD);
         children[childCount++] = parseStatement(parser);
-        return createASTNode(AST_SELECTION_STATEMENT, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_SELECTION_STATEMENT, tokens, tokenCount, children, childCount);
     }
     else if (isNextTokenKeywordWord(parser, KEYWORD_SWITCH, 0))
     {
@@ -6386,13 +6879,11 @@ static ASTNode *parseSelectionStatement(Parser *parser)
         children[childCount++] = parseExpression(parser);
         tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_PARENTHESIS);
         children[childCount++] = parseStatement(parser);
-        return createASTNode(AST_SELECTION_STATEMENT, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_SELECTION_STATEMENT, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Selection Statement but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Selection Statement");
     return NULL;
 }
 
@@ -6404,6 +6895,12 @@ static int isIterationStatement(Parser *parser, const int resetOnSucces)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_ITERATION_STATEMENT);
+    if (!PARSER_RULE_FIRST(parser, ITERATION_STATEMENT))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isNextTokenKeywordWord(parser, KEYWORD_FOR, 1))
     {
@@ -6417,9 +6914,9 @@ static int isIterationStatement(Parser *parser, const int resetOnSucces)
                     {
                         if (resetOnSucces)
                         {
-                            parser->position = lookaheadPosition;
+                            PARSER_RULE_REWIND(parser, PARSER_RULE_ITERATION_STATEMENT, lookaheadPosition);
                         }
-                        return 1;
+                        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_ITERATION_STATEMENT);
                     }
                 }
             }
@@ -6437,9 +6934,9 @@ static int isIterationStatement(Parser *parser, const int resetOnSucces)
                     {
                         if (resetOnSucces)
                         {
-                            parser->position = lookaheadPosition;
+                            PARSER_RULE_REWIND(parser, PARSER_RULE_ITERATION_STATEMENT, lookaheadPosition);
                         }
-                        return 1;
+                        return PARSER_RULE_ACCEPT(parser, PARSER_RULE_ITERATION_STATEMENT);
                     }
                 }
             }
@@ -6461,9 +6958,9 @@ static int isIterationStatement(Parser *parser, const int resetOnSucces)
                             {
                                 if (resetOnSucces)
                                 {
-                                    parser->position = lookaheadPosition;
+                                    PARSER_RULE_REWIND(parser, PARSER_RULE_ITERATION_STATEMENT, lookaheadPosition);
                                 }
-                                return 1;
+                                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_ITERATION_STATEMENT);
                             }
                         }
                     }
@@ -6472,7 +6969,7 @@ static int isIterationStatement(Parser *parser, const int resetOnSucces)
         }
     }
 
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_ITERATION_STATEMENT, lookaheadPosition);
     return 0;
 }
 
@@ -6486,7 +6983,7 @@ static ASTNode *parseIterationStatement(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 5;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -6494,11 +6991,10 @@ static ASTNode *parseIterationStatement(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 2;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -6511,7 +7007,7 @@ static ASTNode *parseIterationStatement(Parser *parser)
         children[childCount++] = parseForControl(parser);
         tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_PARENTHESIS);
         children[childCount++] = parseStatement(parser);
-        return createASTNode(AST_ITERATION_STATEMENT, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_ITERATION_STATEMENT, tokens, tokenCount, children, childCount);
     }
     else if (isNextTokenKeywordWord(parser, KEYWORD_WHILE, 0))
     {
@@ -6520,7 +7016,7 @@ static ASTNode *parseIterationStatement(Parser *parser)
         children[childCount++] = parseExpression(parser);
         tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_PARENTHESIS);
         children[childCount++] = parseStatement(parser);
-        return createASTNode(AST_ITERATION_STATEMENT, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_ITERATION_STATEMENT, tokens, tokenCount, children, childCount);
     }
     else if (isNextTokenKeywordWord(parser, KEYWORD_DO, 0))
     {
@@ -6531,13 +7027,11 @@ static ASTNode *parseIterationStatement(Parser *parser)
         children[childCount++] = parseExpression(parser);
         tokens[tokenCount++] = matchToken(parser, TOKEN_CLOSE_PARENTHESIS);
         tokens[tokenCount++] = matchToken(parser, TOKEN_SEMICOLON);
-        return createASTNode(AST_ITERATION_STATEMENT, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_ITERATION_STATEMENT, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected an Iteration Statement but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "an Iteration Statement");
     return NULL;
 }
 
@@ -6549,6 +7043,12 @@ static int isForControl(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_FOR_CONTROL);
+    if (!PARSER_RULE_FIRST(parser, FOR_CONTROL))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isDeclaration(parser, 0))
     {
@@ -6558,9 +7058,9 @@ static int isForControl(Parser *parser, const int resetOnSuccess)
             isExpression(parser, 0);
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_FOR_CONTROL, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_FOR_CONTROL);
         }
     }
     
@@ -6573,13 +7073,13 @@ static int isForControl(Parser *parser, const int resetOnSuccess)
             isExpression(parser, 0);
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_FOR_CONTROL, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_FOR_CONTROL);
         }
     }
     
-    parser->position = lookaheadPosition;
+    PARSER_RULE_REWIND(parser, PARSER_RULE_FOR_CONTROL, lookaheadPosition);
     return 0;
 }
 
@@ -6593,7 +7093,7 @@ static ASTNode *parseForControl(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 2;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -6601,11 +7101,10 @@ static ASTNode *parseForControl(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 3;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -6623,7 +7122,7 @@ static ASTNode *parseForControl(Parser *parser)
         {
             children[childCount++] = parseExpression(parser);
         }
-        return createASTNode(AST_FOR_CONTROL, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_FOR_CONTROL, tokens, tokenCount, children, childCount);
     }
 
     if (isExpression(parser, 1))
@@ -6642,7 +7141,7 @@ static ASTNode *parseForControl(Parser *parser)
     {
         children[childCount++] = parseExpression(parser);
     }
-    return createASTNode(AST_FOR_CONTROL, tokens, tokenCount, children, childCount);
+    return createArenaASTNode(parser->arena, AST_FOR_CONTROL, tokens, tokenCount, children, childCount);
 }
 
 static int isJumpStatement(Parser *parser, const int resetOnSuccess)
@@ -6653,6 +7152,12 @@ static int isJumpStatement(Parser *parser, const int resetOnSuccess)
         return 0;
     }
 
+    PARSER_RULE_CALL(parser, PARSER_RULE_JUMP_STATEMENT);
+    if (!PARSER_RULE_FIRST(parser, JUMP_STATEMENT))
+    {
+        return 0;
+    }
+
     int lookaheadPosition = parser->position;
     if (isNextTokenKeywordWord(parser, KEYWORD_GOTO, 1))
     {
@@ -6662,9 +7167,9 @@ static int isJumpStatement(Parser *parser, const int resetOnSuccess)
             {
                 if (resetOnSuccess)
                 {
-                    parser->position = lookaheadPosition;
+                    PARSER_RULE_REWIND(parser, PARSER_RULE_JUMP_STATEMENT, lookaheadPosition);
                 }
-                return 1;
+                return PARSER_RULE_ACCEPT(parser, PARSER_RULE_JUMP_STATEMENT);
             }
         }
     }
@@ -6674,9 +7179,9 @@ static int isJumpStatement(Parser *parser, const int resetOnSuccess)
         {
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_JUMP_STATEMENT, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_JUMP_STATEMENT);
         }
     }
     else if (isNextTokenKeywordWord(parser, KEYWORD_RETURN, 1))
@@ -6686,12 +7191,13 @@ static int isJumpStatement(Parser *parser, const int resetOnSuccess)
         {
             if (resetOnSuccess)
             {
-                parser->position = lookaheadPosition;
+                PARSER_RULE_REWIND(parser, PARSER_RULE_JUMP_STATEMENT, lookaheadPosition);
             }
-            return 1;
+            return PARSER_RULE_ACCEPT(parser, PARSER_RULE_JUMP_STATEMENT);
         }
     }
 
+    PARSER_RULE_REWIND(parser, PARSER_RULE_JUMP_STATEMENT, lookaheadPosition);
     return 0;
 }
 
@@ -6705,7 +7211,7 @@ static ASTNode *parseJumpStatement(Parser *parser)
 
     //Allocating memory
     size_t tokensSize = 3;
-    Token **tokens = malloc(tokensSize * sizeof(Token *));
+    Token **tokens = allocateFromASTArena(parser->arena, tokensSize * sizeof(Token *));
     if (tokens == NULL)
     {
         fprintf(stderr, "Memory allocation for tokens failed.\n");
@@ -6713,11 +7219,10 @@ static ASTNode *parseJumpStatement(Parser *parser)
     }
     size_t tokenCount = 0;
     size_t childrenSize = 1;
-    ASTNode **children = malloc(childrenSize * sizeof(ASTNode *));
+    ASTNode **children = allocateFromASTArena(parser->arena, childrenSize * sizeof(ASTNode *));
     if (children == NULL)
     {
         fprintf(stderr, "Memory allocation for children failed.\n");
-        free(tokens);
         return NULL;
     }
     size_t childCount = 0;
@@ -6728,13 +7233,13 @@ static ASTNode *parseJumpStatement(Parser *parser)
         tokens[tokenCount++] = matchToken(parser, TOKEN_KEYWORD);
         tokens[tokenCount++] = matchToken(parser, TOKEN_IDENTIFIER);
         tokens[tokenCount++] = matchToken(parser, TOKEN_SEMICOLON);
-        return createASTNode(AST_JUMP_STATEMENT, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_JUMP_STATEMENT, tokens, tokenCount, children, childCount);
     }
     else if (isNextTokenKeywordWord(parser, KEYWORD_CONTINUE, 0) || isNextTokenKeywordWord(parser, KEYWORD_BREAK, 0))
     {
         tokens[tokenCount++] = matchToken(parser, TOKEN_KEYWORD);
         tokens[tokenCount++] = matchToken(parser, TOKEN_SEMICOLON);
-        return createASTNode(AST_JUMP_STATEMENT, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_JUMP_STATEMENT, tokens, tokenCount, children, childCount);
     }
     else if (isNextTokenKeywordWord(parser, KEYWORD_RETURN, 0))
     {
@@ -6744,13 +7249,11 @@ static ASTNode *parseJumpStatement(Parser *parser)
             children[childCount++] = parseExpression(parser);
         }
         tokens[tokenCount++] = matchToken(parser, TOKEN_SEMICOLON);
-        return createASTNode(AST_JUMP_STATEMENT, tokens, tokenCount, children, childCount);
+        return createArenaASTNode(parser->arena, AST_JUMP_STATEMENT, tokens, tokenCount, children, childCount);
     }
 
     //Error
-    addError(parser, createError(ERROR_PARSING, "Expected a Jump Statement but found:", duplicateToken(nextToken(parser))));
-    free(tokens);
-    free(children);
+    addExpectedError(parser, "a Jump Statement");
     return NULL;
 }
 
@@ -6766,54 +7269,78 @@ Parser *createParser(Token **const tokens, const size_t tokenCount)
         return NULL;
     }
 
-    Parser *parser = malloc(sizeof(Parser));
+    Parser *parser = allocateMemory(MEMORY_PARSER_SCRATCH, sizeof(Parser));
     if (parser == NULL)
     {
         fprintf(stderr, "Memory allocation for Parser failed!\n");
         return NULL;
     }
 
-    parser->tokens = malloc(tokenCount * sizeof(Token*));
-    if (parser->tokens == NULL)
+    Token **parsedTokens = allocateMemory(MEMORY_PARSER_SCRATCH, tokenCount * sizeof(Token*));
+    if (parsedTokens == NULL)
     {
         fprintf(stderr, "Memory allocation for Parser->tokens failed!\n");
-        free(parser);
+        releaseMemory(MEMORY_PARSER_SCRATCH, parser);
         return NULL;
     }
 
     size_t newCount = 0;
     for (size_t i = 0; i < tokenCount; i++)
     {
-        if (tokens[i]->type != TOKEN_WHITESPACE && tokens[i]->type != TOKEN_BLOCK_COMMENT && tokens[i]->type != TOKEN_LINE_COMMENT)
+        if (isParsedToken(tokens[i]))
         {
-            parser->tokens[newCount++] = tokens[i];
+            parsedTokens[newCount++] = tokens[i];
         }
     }
     
-    Token **newTokens = realloc(parser->tokens, newCount * sizeof(Token*));
+    Token **newTokens = reallocateMemory(MEMORY_PARSER_SCRATCH, parsedTokens, newCount * sizeof(Token*));
     if (newTokens == NULL && newCount > 0)
     {
         fprintf(stderr, "Memory reallocation for Parser->tokens failed!\n");
-        free(parser->tokens);
-        free(parser);
+        releaseMemory(MEMORY_PARSER_SCRATCH, parsedTokens);
+        releaseMemory(MEMORY_PARSER_SCRATCH, parser);
         return NULL;
     }
-    parser->tokens = newTokens;
 
-    parser->tokenCount = newCount;
-    parser->position = 0;
-    parser->ASTroot = NULL;
+    return setupParser(parser, newTokens, newCount, newCount);
+}
+
+Parser *createStreamingParser(TokenQueue *const queue)
+{
+    if (queue == NULL)
+    {
+        fprintf(stderr, "Token queue provided to parser is NULL!\n");
+        return NULL;
+    }
+
+    Parser *parser = allocateMemory(MEMORY_PARSER_SCRATCH, sizeof(Parser));
+    if (parser == NULL)
+    {
+        fprintf(stderr, "Memory allocation for Parser failed!\n");
+        return NULL;
+    }
+
+    Token **tokens = allocateMemory(MEMORY_PARSER_SCRATCH, PARSER_STREAM_TOKEN_CAPACITY * sizeof(Token*));
+    if (tokens == NULL)
+    {
+        fprintf(stderr, "Memory allocation for Parser->tokens failed!\n");
+        releaseMemory(MEMORY_PARSER_SCRATCH, parser);
+        return NULL;
+    }
+
+    if (setupParser(parser, tokens, 0, PARSER_STREAM_TOKEN_CAPACITY) == NULL)
+    {
+        return NULL;
+    }
 
-    parser->errorsSize = 1;
-    parser->errors = malloc(parser->errorsSize * sizeof(Error *));
-    if (parser->errors == NULL)
+    //The current token has to be available before parsing starts
+    parser->tokenQueue = queue;
+    pullTokens(parser, 1);
+    if (parser->tokenCount == 0)
     {
-        fprintf(stderr, "Memory allocation for Parser->errors failed!\n");
-        free(parser->tokens);
-        free(parser);
+        deleteParser(parser);
         return NULL;
     }
-    parser->errorCount = 0;
 
     return parser;
 }
@@ -6825,20 +7352,16 @@ void deleteParser(Parser *const parser)
         return;
     }
 
-    free(parser->tokens);
-
-    if (parser->ASTroot != NULL)
-    {
-        free(parser->ASTroot);
-    }
+    releaseMemory(MEMORY_PARSER_SCRATCH, parser->tokens);
+    deleteASTArena(parser->arena);
+    deleteASTInternTable(parser->sharedNodes);
 
-    deleteErrors(parser->errors, parser->errorCount);
-    free(parser->errors);
+    deleteDiagnosticEngine(parser->diagnostics);
 
-    free(parser);
+    releaseMemory(MEMORY_PARSER_SCRATCH, parser);
 }
 
-ASTNode *getCopyAST(const Parser *const parser)
+ASTNode *releaseAST(Parser *const parser, ASTArena **const arena)
 {
     if (parser == NULL)
     {
@@ -6848,11 +7371,33 @@ ASTNode *getCopyAST(const Parser *const parser)
 
     if (parser->ASTroot == NULL)
     {
-        fprintf(stderr, "Parser's AST root is NULL, no AST to copy.\n");
+        fprintf(stderr, "Parser's AST root is NULL, no AST to release.\n");
         return NULL;
     }
 
-    return duplicateASTNode(parser->ASTroot);
+    ASTNode *root = parser->ASTroot;
+    *arena = parser->arena;
+    parser->ASTroot = NULL;
+    parser->arena = NULL;
+
+    return root;
+}
+
+int shareSpecifiers(Parser *const parser)
+{
+    if (parser == NULL)
+    {
+        fprintf(stderr, "Parser is not initialized.\n");
+        return 0;
+    }
+
+    if (parser->sharedNodes != NULL)
+    {
+        return 1;
+    }
+
+    parser->sharedNodes = createASTInternTable();
+    return parser->sharedNodes != NULL;
 }
 
 int parse(Parser *parser)
@@ -6870,15 +7415,43 @@ int parse(Parser *parser)
     }
 
     parser->ASTroot = parseProgram(parser);
-    if (parser->ASTroot == NULL)
+
+    //Leave nothing in the queue of a streaming parser
+    pullTokens(parser, SIZE_MAX);
+    if (parser->ASTroot == NULL || parser->tokenStreamFailed)
     {
-        fprintf(stderr, "Failed to parse the input tokens!\n");
         return 0;
     }
 
     return 1;
 }
 
+int recognize(Parser *parser)
+{
+    if(parser == NULL)
+    {
+        fprintf(stderr, "Parser is NULL!\n");
+        return 0;
+    }
+
+    uint64_t declarationStart = isTracing() ? getTraceTime() : 0;
+    size_t declarationPosition = parser->position;
+    while (isGlobalDeclaration(parser, 0))
+    {
+        declarationStart = traceGlobalDeclaration(parser, declarationPosition, declarationStart);
+        declarationPosition = parser->position;
+    }
+
+    if (nextToken(parser)->type != TOKEN_EOF)
+    {
+        addExpectedError(parser, "a Global Declaration");
+        pullTokens(parser, SIZE_MAX);
+        return 0;
+    }
+
+    return !parser->tokenStreamFailed;
+}
+
 void printParseTrees(const Parser *const parser)
 {
     if(parser == NULL)
@@ -6895,4 +7468,55 @@ void printParseTrees(const Parser *const parser)
 
     printf("Parser:\n");
     printASTNode(parser->ASTroot, "", 0);
-}
\ No newline at end of file
+}
+
+void printParseStats(const Parser *const parser, FILE *stream)
+{
+    if (parser == NULL)
+    {
+        fprintf(stderr, "Parser is NULL!\n");
+        return;
+    }
+
+#ifdef PARSER_STATS
+    //Sort the rules by cost
+    ParserRule order[PARSER_RULE_COUNT];
+    size_t ruleCount = 0;
+    for (size_t i = 0; i < PARSER_RULE_COUNT; i++)
+    {
+        if (parser->stats[i].calls == 0)
+        {
+            continue;
+        }
+
+        size_t j = ruleCount++;
+        while (j > 0 && isRuleMoreExpensive(&parser->stats[i], &parser->stats[order[j - 1]]))
+        {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = (ParserRule)i;
+    }
+
+    //Print the report
+    ParserRuleStats total = {0, 0, 0, 0, 0};
+    fprintf(stream, "Parser statistics:\n");
+    fprintf(stream, "%-34s %12s %12s %12s %12s %12s\n", "Rule", "Calls", "Prefiltered", "Successes", "Rewinds", "Rescanned");
+    for (size_t i = 0; i < ruleCount; i++)
+    {
+        const ParserRuleStats *stats = &parser->stats[order[i]];
+        fprintf(stream, "%-34s %12zu %12zu %12zu %12zu %12zu\n", parserRuleNames[order[i]], stats->calls, stats->prefiltered, stats->successes, stats->rewinds, stats->tokensRescanned);
+
+        total.calls += stats->calls;
+        total.prefiltered += stats->prefiltered;
+        total.successes += stats->successes;
+        total.rewinds += stats->rewinds;
+        total.tokensRescanned += stats->tokensRescanned;
+    }
+    fprintf(stream, "%-34s %12zu %12zu %12zu %12zu %12zu\n", "Total", total.calls, total.prefiltered, total.successes, total.rewinds, total.tokensRescanned);
+    fprintf(stream, "Tokens parsed: %zu\n", parser->tokenCount);
+#else
+    (void)stream;
+    fprintf(stderr, "Parser statistics are not available, rebuild with `make PARSER_STATS=1`.\n");
+#endif
+}
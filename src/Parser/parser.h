@@ -5,7 +5,113 @@
 #include <string.h>
 #include "../utils/token.h"
 #include "../utils/AST.h"
-#include "../utils/error.h"
+#include "../utils/ast_intern.h"
+#include "../utils/token_queue.h"
+#include "../utils/diagnostic.h"
+#include "../utils/trace.h"
+
+#ifdef PARSER_STATS
+/**
+ * Enumeration of the instrumented grammar rules.
+ * 
+ * The `ParserRule` enum has one entry for every `isX` predicate of the parser. It is
+ * only available when the parser is built with `PARSER_STATS` defined, and is used to
+ * index the per-rule counters stored in the `Parser`.
+ */
+typedef enum parserRule
+{
+    PARSER_RULE_GLOBAL_DECLARATION,
+    PARSER_RULE_FUNCTION_DEFINITION,
+    PARSER_RULE_DECLARATION_SPECIFIERS,
+    PARSER_RULE_STORAGE_CLASS_SPECIFIER,
+    PARSER_RULE_TYPE_SPECIFIER,
+    PARSER_RULE_STRUCT_OR_UNION_SPECIFIER,
+    PARSER_RULE_STRUCT_DECLARATION,
+    PARSER_RULE_SPECIFIER_QUALIFIER,
+    PARSER_RULE_TYPE_QUALIFIER,
+    PARSER_RULE_STRUCT_DECLARATOR_LIST,
+    PARSER_RULE_STRUCT_DECLARATOR,
+    PARSER_RULE_DECLARATOR,
+    PARSER_RULE_POINTER,
+    PARSER_RULE_DIRECT_DECLARATOR,
+    PARSER_RULE_DIRECT_DECLARATOR_PRIME,
+    PARSER_RULE_ASSIGNMENT_EXPRESSION,
+    PARSER_RULE_ASSIGNMENT_OPERATOR,
+    PARSER_RULE_CONDITIONAL_EXPRESSION,
+    PARSER_RULE_LOGICAL_OR_EXPRESSION,
+    PARSER_RULE_LOGICAL_AND_EXPRESSION,
+    PARSER_RULE_BITWISE_OR_EXPRESSION,
+    PARSER_RULE_BITWISE_XOR_EXPRESSION,
+    PARSER_RULE_BITWISE_AND_EXPRESSION,
+    PARSER_RULE_EQUALITY_EXPRESSION,
+    PARSER_RULE_EQUALITY_OPERATOR,
+    PARSER_RULE_RELATIONAL_EXPRESSION,
+    PARSER_RULE_RELATIONAL_OPERATOR,
+    PARSER_RULE_SHIFT_EXPRESSION,
+    PARSER_RULE_SHIFT_OPERATOR,
+    PARSER_RULE_ADDITIVE_EXPRESSION,
+    PARSER_RULE_ADDITIVE_OPERATOR,
+    PARSER_RULE_MULTIPLICATIVE_EXPRESSION,
+    PARSER_RULE_MULTIPLICATIVE_OPERATOR,
+    PARSER_RULE_CAST_EXPRESSION,
+    PARSER_RULE_UNARY_EXPRESSION,
+    PARSER_RULE_PREFIX_UNARY_OPERATOR,
+    PARSER_RULE_UNARY_OPERATOR,
+    PARSER_RULE_POSTFIX_EXPRESSION,
+    PARSER_RULE_POSTFIX_EXPRESSION_PRIME,
+    PARSER_RULE_PRIMARY_EXPRESSION,
+    PARSER_RULE_LITERAL,
+    PARSER_RULE_EXPRESSION,
+    PARSER_RULE_TYPE_NAME,
+    PARSER_RULE_ABSTRACT_DECLARATOR,
+    PARSER_RULE_DIRECT_ABSTRACT_DECLARATOR,
+    PARSER_RULE_DIRECT_ABSTRACT_DECLARATOR_PRIME,
+    PARSER_RULE_PARAMETER_LIST,
+    PARSER_RULE_PARAMETER_DECLARATION,
+    PARSER_RULE_INITIALIZER_LIST,
+    PARSER_RULE_DESIGNATION,
+    PARSER_RULE_DESIGNATOR,
+    PARSER_RULE_CONSTANT_EXPRESSION,
+    PARSER_RULE_INITIALIZER,
+    PARSER_RULE_IDENTIFIER_LIST,
+    PARSER_RULE_ENUM_SPECIFIER,
+    PARSER_RULE_ENUMERATOR_LIST,
+    PARSER_RULE_ENUMERATOR,
+    PARSER_RULE_DECLARATION,
+    PARSER_RULE_INIT_DECLARATOR_LIST,
+    PARSER_RULE_INIT_DECLARATOR,
+    PARSER_RULE_STATEMENT,
+    PARSER_RULE_LABELED_STATEMENT,
+    PARSER_RULE_COMPOUND_STATEMENT,
+    PARSER_RULE_EXPRESSION_STATEMENT,
+    PARSER_RULE_SELECTION_STATEMENT,
+    PARSER_RULE_ITERATION_STATEMENT,
+    PARSER_RULE_FOR_CONTROL,
+    PARSER_RULE_JUMP_STATEMENT,
+    PARSER_RULE_COUNT,
+} ParserRule;
+
+/**
+ * Represents the counters collected for a single grammar rule.
+ * 
+ * - `calls`: How many times the rule's predicate was entered.
+ * - `prefiltered`: How many of those calls were rejected by the FIRST set of the rule,
+ *                  without consuming or rewinding any token.
+ * - `successes`: How many of those calls recognized the rule.
+ * - `rewinds`: How many times the predicate moved the position back to where it started,
+ *              either because it failed or because it was asked to reset on success.
+ * - `tokensRescanned`: The number of tokens given back by those rewinds, which is the
+ *                      amount of work that has to be done again by a later rule.
+ */
+typedef struct parserRuleStats
+{
+    size_t calls;               /** Number of times the rule was tried. */
+    size_t prefiltered;         /** Number of times the FIRST set rejected the rule. */
+    size_t successes;           /** Number of times the rule matched. */
+    size_t rewinds;             /** Number of times the position was reset. */
+    size_t tokensRescanned;     /** Number of tokens given back by the resets. */
+} ParserRuleStats;
+#endif
 
 /**
  * Represents the state and context of the parser during the parsing process.
@@ -27,17 +133,30 @@
  *               indicating the current token being processed by the parser. This 
  *               index is incremented as the parser progresses through the tokens.
  * 
+ * - `tokensSize`: The allocated size of the `tokens` array.
+ * 
+ * - `tokenQueue`: The queue the tokens are still arriving on when the parser was created with
+ *                 `createStreamingParser`, or NULL once every token is in the `tokens` array.
+ *                 Tokens are pulled from it only when the position moves past the last
+ *                 pulled one, and are kept afterwards, so rewinds never need the queue.
+ * 
+ * - `tokenStreamFailed`: Set if the token queue was closed without an end of file token.
+ * 
  * - `ASTroot`: A pointer to the root `ASTNode` of the abstract syntax tree (AST) 
  *              generated by the parser. The AST represents the hierarchical structure 
  *              of the parsed source code.
  * 
- * - `errors`: A pointer to an array of `Error` pointers that capture any errors 
- *              encountered during parsing. The parser maintains and manages this array.
+ * - `arena`: The `ASTArena` every node, token array and children array of the AST is
+ *            allocated from. The parser owns it until `releaseAST` hands it to the caller.
+ * 
+ * - `sharedNodes`: The table of the specifier and pointer nodes shared between declarations,
+ *                  or NULL if `shareSpecifiers` was not called.
  * 
- * - `errorCount`: A `size_t` value indicating the number of errors recorded in the 
- *                  `errors` array.
+ * - `diagnostics`: The `DiagnosticEngine` the syntax errors encountered during parsing
+ *                  are recorded in. The parser owns it.
  * 
- * - `errorsSize`: A `size_t` value indicating the allocated size of the `errors` array. 
+ * - `stats`: Per-rule counters, indexed by `ParserRule`. This field only exists when the 
+ *            parser is built with `PARSER_STATS` defined.
  * 
  * The `Parser` struct is central to the parsing process, managing the context and state 
  * needed to navigate through the token stream and construct the corresponding AST.
@@ -52,10 +171,16 @@ typedef struct parser
     Token **tokens;         /** The array of token pointers owned by the parser. */
     size_t tokenCount;      /** The number of tokens in the array. */
     size_t position;        /** The current position in the token array. */
+    size_t tokensSize;      /** The allocated size of the token array. */
+    TokenQueue *tokenQueue; /** The queue of the tokens still to come, or NULL. */
+    int tokenStreamFailed;  /** Whether the token queue ended without an end of file. */
     ASTNode *ASTroot;       /** The root of the AST generated by the parser. */
-    Error **errors;         /** An array of error pointers encountered during parsing. */
-    size_t errorCount;      /** The number of errors recorded. */
-    size_t errorsSize;      /** The allocated size of the errors array. */
+    ASTArena *arena;        /** The arena the AST is allocated from. */
+    ASTInternTable *sharedNodes; /** Shared specifier nodes, or NULL. */
+    DiagnosticEngine *diagnostics; /** The syntax errors. */
+#ifdef PARSER_STATS
+    ParserRuleStats stats[PARSER_RULE_COUNT]; /** Per-rule instrumentation counters. */
+#endif
 } Parser;
 
 /**
@@ -85,12 +210,36 @@ typedef struct parser
  */
 Parser *createParser(Token **const tokens, const size_t count);
 
+/**
+ * Creates a new `Parser` object that reads its tokens from a queue while they are being lexed.
+ * 
+ * The tokens are popped from the queue as the parser needs them, filtering out whitespace and
+ * comments the same way as `createParser`, so the parser can run on its own thread while the
+ * lexer is still producing tokens on another. Popping blocks until the lexer pushes the next
+ * token. Every popped token is kept, so rewinding over tokens that were already consumed works
+ * the same as with `createParser`. `parse` and `recognize` pull the rest of the queue before they
+ * return, so the queue is empty once they are done.
+ * 
+ * If the queue is closed before an end of file token arrives, the parser ends the input with
+ * its own end of file token and `parse` and `recognize` fail.
+ * 
+ * @param queue The queue the lexer pushes the tokens to. The `Parser` does not own it.
+ * 
+ * @return A pointer to the newly created `Parser` object, or NULL if memory allocation fails or if
+ *         the queue is NULL.
+ * 
+ * @note The `Parser` does not own the popped `Token` objects, the lexer side stays responsible
+ *       for freeing them after the `Parser` is done.
+ */
+Parser *createStreamingParser(TokenQueue *const queue);
+
 /**
  * Deletes a `Parser` object and frees its memory.
  * 
  * Frees the memory allocated for the `Parser` structure and its associated resources.
  * The function will free the memory for the filtered token array held by the `Parser`.
- * If an Abstract Syntax Tree (AST) root node exists, it will also be freed.
+ * If the `Parser` still owns its `ASTArena`, the arena and with it the whole Abstract
+ * Syntax Tree (AST) is freed as well.
  * 
  * @param parser The `Parser` object to be deleted. If the parser is NULL, the function does nothing.
  * 
@@ -98,31 +247,49 @@ Parser *createParser(Token **const tokens, const size_t count);
  *       `Token` objects. It is the caller's responsibility to manage and free the memory 
  *       for the `Token` objects separately.
  * 
- * @note The `Parser` does not own the AST root node but it is the caller's responsibility 
- *       to manage and free the memory for the AST if needed. To avoid memory leaks, 
- *       it is advised that the caller obtains a copy of the AST using `getCopyAST` 
- *       before deleting the parser.
+ * @note To keep the AST after the `Parser` is deleted, the caller has to take it and its
+ *       arena with `releaseAST` first.
  */
 void deleteParser(Parser *const parser);
 
 /**
- * Retrieves a copy of the Abstract Syntax Tree (AST) from the `Parser`.
+ * Takes the Abstract Syntax Tree (AST) and the arena it is allocated from out of the `Parser`.
  * 
- * This function creates a duplicate of the AST root node held by the `Parser`.
- * It ensures that a new `ASTNode` structure is returned, which is a copy of the 
- * current AST root. If the `Parser` is not initialized or the AST root is NULL, 
- * the function will report an error and return NULL.
+ * After this call the `Parser` no longer refers to the AST, so deleting the `Parser` leaves
+ * the tree intact. The whole tree is freed at once by passing the returned arena to
+ * `deleteASTArena`.
  * 
- * @param parser A pointer to the `Parser` object from which to copy the AST.
+ * @param parser A pointer to the `Parser` object from which to take the AST.
  *               The `Parser` must be initialized and must contain a valid AST root.
  * 
- * @return A pointer to a newly created `ASTNode` that is a copy of the parser's 
- *         AST root, or NULL if the `Parser` is not initialized, or if the AST root is NULL.
+ * @param arena Set to the arena holding the AST. Left unchanged if the function fails.
+ * 
+ * @return A pointer to the root of the AST, or NULL if the `Parser` is not initialized,
+ *         or if the AST root is NULL.
  * 
- * @note To avoid memory leaks, ensure that the returned `ASTNode` is properly managed
- *       and freed when no longer needed.
+ * @note The caller is responsible for freeing the arena with `deleteASTArena`. The nodes
+ *       of the AST must not be passed to `deleteASTNode`.
  */
-ASTNode *getCopyAST(const Parser *const parser);
+ASTNode *releaseAST(Parser *const parser, ASTArena **const arena);
+
+/**
+ * Makes the `Parser` share structurally identical specifier and pointer subtrees.
+ * 
+ * Once enabled, every `AST_DECLARATION_SPECIFIERS`, `AST_SPECIFIER_QUALIFIER`, `AST_POINTER`
+ * and keyword or typedef name `AST_TYPE_SPECIFIER` node is hash-consed: a node with the same
+ * type, token types and texts, and children as an earlier one is not allocated again, the
+ * earlier node is used instead. Repeated specifiers such as `static const unsigned int` then
+ * take memory only once, and later stages can compare them by pointer.
+ * 
+ * @param parser A pointer to the `Parser` object. Must be called before `parse`.
+ * 
+ * @return 1 on success, 0 if the `Parser` is not initialized or memory allocation fails.
+ * 
+ * @note The AST becomes a directed acyclic graph. It prints the same as the unshared tree,
+ *       but a shared node keeps the tokens, and so the source positions, of its first
+ *       occurrence. Shared nodes live as long as the arena and must never be changed.
+ */
+int shareSpecifiers(Parser *const parser);
 
 /**
  * Parses the input tokens and generates an Abstract Syntax Tree (AST) from them.
@@ -151,6 +318,26 @@ ASTNode *getCopyAST(const Parser *const parser);
  */
 int parse(Parser *parser);
 
+/**
+ * Checks the syntax of the input tokens without building an Abstract Syntax Tree (AST).
+ * 
+ * This function runs only the recognizer predicates over the tokens held by the `Parser`,
+ * one global declaration after the other, and never creates an `ASTNode`. It is the fast
+ * path for callers that only need to know whether the input is syntactically valid and
+ * where it stops being so. The first global declaration that can not be recognized is
+ * reported as an error on the `Parser`.
+ * 
+ * @param parser A pointer to the `Parser` object containing the tokens to be checked.
+ *               The `Parser` must be initialized.
+ * 
+ * @return 1 if the tokens form a valid program; 0 if the `Parser` is NULL or a syntax
+ *         error was found.
+ * 
+ * @note The `Parser`'s `ASTroot` stays NULL, so `releaseAST` and `printParseTrees` can not
+ *       be used afterwards. The errors are recorded in the `Parser`'s `diagnostics`.
+ */
+int recognize(Parser *parser);
+
 /**
  * Prints the Abstract Syntax Tree (AST) to the standard output.
  * 
@@ -175,4 +362,24 @@ int parse(Parser *parser);
  */
 void printParseTrees(const Parser *const parser);
 
+/**
+ * Prints the per-rule parser statistics, sorted by cost.
+ * 
+ * For every grammar rule that was tried at least once, this function prints how many
+ * times it was called, how many of those calls succeeded, how many times it rewound the
+ * token position and how many tokens those rewinds gave back. The rules are ordered by
+ * the number of tokens re-scanned and then by the number of calls, so the most expensive
+ * speculation is listed first. A totals line closes the report.
+ * 
+ * @param parser A pointer to the `Parser` whose counters should be printed. The counters are
+ *               valid after `parse` has been called, whether or not parsing succeeded.
+ * 
+ * @param stream The stream the report is written to.
+ * 
+ * @note The counters are only collected when the parser is built with `PARSER_STATS` defined
+ *       (`make PARSER_STATS=1`). Otherwise the function reports that the statistics are not
+ *       available to `stderr` and does nothing else.
+ */
+void printParseStats(const Parser *const parser, FILE *stream);
+
 #endif // PARSER_H
\ No newline at end of file
@@ -7,6 +7,27 @@
 /* Inital token capacity for lexing */
 #define INITIAL_TOKEN_CAPACITY 100
 
+/* Number of times each tree walk is repeated by --bench-ast-walk */
+#define BENCH_WALK_REPEATS 200
+
+/* Block size of the arena the benchmarked round trip is decoded into */
+#define BENCH_ARENA_BLOCK_SIZE (64 * 1024)
+
+/* Number of tokens the queue between the lexer and the parser thread of --pipeline holds */
+#define PIPELINE_QUEUE_CAPACITY 4096
+
+/* Default memory limit of the per-file cache of --server, in MiB */
+#define SERVER_CACHE_DEFAULT_MIB 256
+
+/* Default size limit of the result cache of --cache-dir, in MiB */
+#define RESULT_CACHE_DEFAULT_MIB 1024
+
+/* Bytes of finished --batch results kept in memory, later results go to a spill file */
+#define BATCH_MEMORY_LIMIT (64 * 1024 * 1024)
+
+/* Part of every result cache key, bump it when the output of the compiler changes */
+#define COMPILER_VERSION "cmc 0.1"
+
 /**
  * Represents a collection of flags and options for configuring the compiler.
  * 
@@ -53,6 +74,81 @@
  * 
  * - `headerCount`: The number of header files specified in the `headerFiles` array.
  *
+ * - `parseStats`: Indicates if the per-rule parser statistics should be printed.
+ *                 - 1 if the report is requested (e.g., `--parse-stats` flag).
+ *                 - 0 otherwise.
+ *
+ * - `syntaxOnly`: Indicates whether only the syntax should be checked, without building the AST.
+ *                 - 1 if only the syntax check is requested (e.g., `-fsyntax-only` flag).
+ *                 - 0 otherwise.
+ *
+ * - `verboseAST`: Indicates whether the AST should keep its single-child wrapper chains.
+ *                 - 1 if the uncollapsed tree is requested (e.g., `--verbose-ast` flag).
+ *                 - 0 otherwise.
+ *
+ * - `compactAST`: Indicates whether the AST should be converted to a `CompactAST` after parsing.
+ *                 - 1 if the compact tree is requested (e.g., `--compact-ast` flag).
+ *                 - 0 otherwise.
+ *
+ * - `benchASTWalk`: Indicates whether the pointer and flat tree walks should be benchmarked.
+ *                 - 1 if the benchmark is requested (e.g., `--bench-ast-walk` flag).
+ *                 - 0 otherwise.
+ *
+ * - `emitASTFile`: The file the AST is serialized into, or `NULL` (e.g., `-emit-ast=file.cast` flag).
+ *
+ * - `loadASTFile`: The serialized AST file to print instead of compiling sources, or `NULL`
+ *                  (e.g., `-load-ast=file.cast` flag).
+ *
+ * - `shareSpecifiers`: Indicates whether identical specifier and pointer subtrees should be shared.
+ *                 - 1 if sharing is requested (e.g., `--share-specifiers` flag).
+ *                 - 0 otherwise.
+ *
+ * - `jobCount`: The number of files compiled in parallel (e.g., `-j 8` flag).
+ *               The number of processors by default.
+ *
+ * - `pipeline`: Indicates whether the lexer and the parser of a file run on separate threads.
+ *               - 1 if the pipelined mode is requested (e.g., `--pipeline` flag).
+ *               - 0 otherwise.
+ *
+ * - `serverSocket`: The socket a compile server listens on, or `NULL` (e.g., `--server /tmp/cmc.sock` flag).
+ *
+ * - `serverCacheSize`: The memory limit of the per-file cache of the compile server in bytes
+ *                      (e.g., `--server-cache-size=64` flag, in MiB). 256 MiB by default.
+ *
+ * - `dumpFormat`: The format the tokens and the AST are written in (e.g., `--dump-format=json` flag).
+ *                 `DUMP_FORMAT_TREE` by default.
+ *
+ * - `resultCacheDir`: The directory of the compilation result cache, or `NULL`
+ *                     (e.g., `--cache-dir=.cmc-cache` flag).
+ *
+ * - `resultCacheSize`: The size limit of the result cache in bytes (e.g., `--cache-size=512` flag,
+ *                      in MiB). 1024 MiB by default.
+ *
+ * - `cacheStats`: Indicates whether the result cache statistics should be printed.
+ *                 - 1 if the statistics are requested (e.g., `--cache-stats` flag).
+ *                 - 0 otherwise.
+ *
+ * - `timeReport`: Indicates whether the time, allocations and memory of each phase should be printed.
+ *                 - 1 if the report is requested (e.g., `-ftime-report` flag).
+ *                 - 0 otherwise.
+ *
+ * - `perfCounters`: Indicates whether the hardware events of each phase should be counted and printed.
+ *                   - 1 if the counters are requested (e.g., `--perf-counters` flag).
+ *                   - 0 otherwise.
+ *
+ * - `memReport`: Indicates whether the allocations of the front end should be counted and printed.
+ *                - 1 if the report is requested (e.g., `--mem-report` flag).
+ *                - 0 otherwise.
+ *
+ * - `batchFile`: The manifest listing the files of a batch compilation, or `NULL`
+ *                (e.g., `--batch manifest.txt` flag).
+ *
+ * - `traceFile`: The file the trace of the compilation is written to, or `NULL`
+ *                (e.g., `--trace=out.json` flag).
+ *
+ * - `errorLimit`: The number of errors the lexer and the parser of a file report before they
+ *                 stop, 0 for no limit (e.g., `-ferror-limit=50` flag).
+ *
  * The `Flags` structure is used by various functions to manage the state and configuration of the compiler based on user input.
  * 
  * @note The caller is responsible for managing the lifecycle of the `Flags` object. After use, the memory allocated for the
@@ -73,29 +169,243 @@ typedef struct flags
     int optimization;        /** Flag to enable optimization. */
     char **headerFiles;      /** Array of strings representing header file paths. */
     size_t headerCount;      /** Number of header files. */
+    int parseStats;          /** Flag to print the parser statistics. */
+    int syntaxOnly;          /** Flag to indicate syntax checking only. */
+    int verboseAST;          /** Flag to keep the single-child chains of the AST. */
+    int compactAST;          /** Flag to convert the AST to a compact tree. */
+    int benchASTWalk;        /** Flag to benchmark the AST walks. */
+    char *emitASTFile;       /** Name or path of the serialized AST output file, if specified. */
+    char *loadASTFile;       /** Name or path of the serialized AST input file, if specified. */
+    DumpFormat dumpFormat;   /** Format of the dumped tokens and AST. */
+    int shareSpecifiers;     /** Flag to share identical specifier subtrees. */
+    size_t jobCount;         /** Number of files compiled in parallel. */
+    int pipeline;            /** Flag to lex and parse on separate threads. */
+    char *serverSocket;      /** Socket of the compile server, if specified. */
+    size_t serverCacheSize;  /** Memory limit of the compile server's file cache. */
+    char *resultCacheDir;    /** Directory of the result cache, if specified. */
+    size_t resultCacheSize;  /** Size limit of the result cache. */
+    int cacheStats;          /** Flag to print the result cache statistics. */
+    int timeReport;          /** Flag to print the phase timings. */
+    int perfCounters;        /** Flag to print the phase hardware counters. */
+    int memReport;           /** Flag to print the front end allocations. */
+    char *batchFile;         /** Manifest of a batch compilation, if specified. */
+    char *traceFile;         /** Name or path of the trace output file, if specified. */
+    size_t errorLimit;       /** Number of errors reported per file, 0 for no limit. */
 } Flags;
 
-static int getFileSize(FILE *file);
+/**
+ * Represents the compilation of a single input file.
+ *
+ * Every input file is lexed and parsed by its own job, possibly on a worker thread, so a job
+ * holds everything its file needs and prints its messages to its own streams. When jobs run in
+ * parallel the streams are temporary files, which are copied to the standard streams in
+ * command-line order, so the output does not depend on the order the jobs finish in.
+ *
+ * - `flags`: The command-line flags.
+ * - `fileName`: The name of the input file.
+ * - `fileContents`: The contents of the file, owned by the job until they are lexed.
+ * - `fileStart`: The `SourceLoc` the file starts at.
+ * - `sources`: The source manager the file was added to. It is only read by the job.
+ * - `out`: The stream the errors are printed to, `stdout` or a temporary file.
+ * - `err`: The stream the status messages are printed to, `stderr` or a temporary file.
+ * - `tokens`: The tokens of the file.
+ * - `tokenCount`: The number of tokens.
+ * - `arena`: The arena holding the AST.
+ * - `root`: The root of the AST, with its single-child chains collapsed unless `verboseAST` is set.
+ * - `success`: 1 if the file was lexed and parsed without errors, 0 otherwise.
+ * - `tokenQueue`: The queue the lexer thread pushes the tokens to with `--pipeline`, or NULL.
+ * - `lexerThread`: The thread lexing the file while `tokenQueue` is set.
+ * - `lexed`: The result of `lexFile`.
+ * - `cached`: The cached state of the file on a compile server, or NULL. The job borrows its tokens.
+ * - `cachePath`: The absolute path to cache the file under once it is lexed, or NULL.
+ * - `modifiedTime`: The modification time of the file, for the cache.
+ * - `fileSize`: The size of the file, for the cache.
+ * - `resultKey`: The key of the outcome of the job in the result cache.
+ * - `storeResult`: 1 if the outcome of the job is written to the result cache once it is done.
+ *                  The streams of such a job are always temporary files.
+ * - `result`: The outcome of an earlier compilation of the same input, or NULL. A job with a
+ *             result does not run, the result is written in its place.
+ * - `timeReport`: The measurements of the phases of the job, for `-ftime-report`.
+ */
+typedef struct compileJob
+{
+    const Flags *flags;             /** The command-line flags. */
+    const char *fileName;           /** The name of the input file. */
+    char *fileContents;             /** The contents of the file. */
+    SourceLoc fileStart;            /** The location the file starts at. */
+    const SourceManager *sources;   /** The source manager of the compilation. */
+    FILE *out;                      /** The stream of the errors. */
+    FILE *err;                      /** The stream of the status messages. */
+    Token **tokens;                 /** The tokens of the file. */
+    size_t tokenCount;              /** Number of tokens. */
+    ASTArena *arena;                /** The arena holding the AST. */
+    ASTNode *root;                  /** The root of the AST. */
+    int success;                    /** Whether the job succeeded. */
+    TokenQueue *tokenQueue;         /** The queue to the parser, or NULL. */
+    pthread_t lexerThread;          /** The thread running the lexer. */
+    int lexed;                      /** Whether lexing succeeded. */
+    const FileCacheEntry *cached;   /** The cached state of the file, or NULL. */
+    char *cachePath;                /** The path to cache the file under, or NULL. */
+    int64_t modifiedTime;           /** The modification time of the file. */
+    size_t fileSize;                /** The size of the file. */
+    ResultKey resultKey;            /** The key of the outcome. */
+    int storeResult;                /** Whether to cache the outcome. */
+    CachedResult *result;           /** The cached outcome, or NULL. */
+    TimeReport timeReport;          /** The measurements of the phases. */
+} CompileJob;
 
-static char *readFromFile(char *fileName);
+/**
+ * Holds the finished results of a batch that the main thread has not written yet.
+ *
+ * The files of a batch finish largest first but are written in manifest order, so any number of
+ * them can finish before the ones above them in the manifest. Their results are kept in memory
+ * up to `limit` bytes, and the ones after that are appended to a single temporary file.
+ *
+ * - `lock`: Guards the other fields and the position of `file`.
+ * - `file`: The spilled results, or NULL until the first one is spilled.
+ * - `buffered`: The bytes of the results kept in memory.
+ * - `limit`: The bytes of results kept in memory before they are spilled.
+ */
+typedef struct batchSpill
+{
+    pthread_mutex_t lock;           /** Guards the spill. */
+    FILE *file;                     /** The spilled results. */
+    size_t buffered;                /** Bytes of results in memory. */
+    size_t limit;                   /** Bytes of results kept in memory. */
+} BatchSpill;
 
-static char **readFromFiles(char **fileNames, const size_t fileCount);
+/**
+ * Represents a file of a batch compilation, one line of its manifest.
+ *
+ * The files are compiled largest first, each on a worker with its own source manager. A worker
+ * keeps the messages and the output of its file in memory, or in the `BatchSpill` once its
+ * memory limit is reached, so only the threads and the spill hold temporary files, and the
+ * main thread writes them in manifest order.
+ *
+ * - `flags`: The flags of the file: the command-line flags and the options of its line.
+ * - `fileName`: The name of the file.
+ * - `fileSize`: The size of the file in bytes, 0 if it cannot be read.
+ * - `line`: The line of the file in the manifest.
+ * - `task`: The thread pool task of the file, or `THREAD_POOL_INVALID_TASK`.
+ * - `time`: The seconds the compilation of the file took.
+ * - `success`: 1 if the file compiled without errors, 0 otherwise.
+ * - `err`: The status messages of the file.
+ * - `errSize`: The size of the status messages.
+ * - `out`: The errors and the output of the file.
+ * - `outSize`: The size of the errors and the output.
+ * - `spill`: The spill of the batch.
+ * - `spillOffset`: The offset of the results in the spill file, -1 if they are in memory.
+ */
+typedef struct batchEntry
+{
+    Flags *flags;                   /** The flags of the file. */
+    const char *fileName;           /** The name of the file. */
+    size_t fileSize;                /** The size of the file. */
+    size_t line;                    /** The line in the manifest. */
+    size_t task;                    /** The task of the file. */
+    double time;                    /** Compilation time in seconds. */
+    int success;                    /** Whether the file compiled. */
+    char *err;                      /** The status messages. */
+    size_t errSize;                 /** Size of the status messages. */
+    char *out;                      /** The errors and the output. */
+    size_t outSize;                 /** Size of the errors and the output. */
+    BatchSpill *spill;              /** The spill of the batch. */
+    long spillOffset;               /** Offset in the spill file, or -1. */
+} BatchEntry;
+
+static int getFileSize(FILE *file, FILE *const err);
+
+static char *readFromFile(char *fileName, FILE *const err);
 
 static void freeFileContent(char *fileContent);
 
-static void freeFileContents(char **fileContents, const size_t fileCount);
-
 static Flags *parseArgs(int argc, char **argv);
 
+static int parsePositiveNumber(const char *const text, size_t *const number);
+
 static void freeFlags(Flags *flags);
 
 static void printUsage();
 
 static void printHelp();
 
-static Token **lexFile(const char *const fileContents, size_t *tokenCount);
+static int lexFile(CompileJob *const job);
+
+static int parseTokens(CompileJob *const job);
+
+static int checkSyntax(CompileJob *const job);
+
+static void *runLexerThread(void *argument);
+
+static int startPipeline(CompileJob *const job);
+
+static int finishLexing(CompileJob *const job);
+
+static Parser *createJobParser(CompileJob *const job);
+
+static void compileJobFile(CompileJob *const job);
+
+static void runCompileJob(void *const argument);
 
-static ASTNode *parseTokens(Token **tokens, size_t tokenCount);
+static int copyJobStream(FILE *const from, FILE *const to);
+
+static int bufferJobStreams(CompileJob *const job);
+
+static int writeJobOutput(CompileJob *const job, FILE *const stream);
+
+static int finishCompileJob(CompileJob *const job);
+
+static void freeCompileJob(CompileJob *const job);
+
+static size_t walkASTNode(const ASTNode *const astNode);
+
+static ASTVisitAction sumVisitedASTNode(ASTNode *const astNode, const size_t depth, void *const context);
+
+static size_t walkFlatAST(const FlatAST *const ast);
+
+static size_t walkFlatNode(const FlatAST *const ast, const size_t index);
+
+static int isSameASTNode(const ASTNode *const first, const ASTNode *const second);
+
+static void benchmarkASTWalk(const ASTNode *const root);
+
+static FILE *openOutput(const Flags *const flags, FILE *const stream);
+
+static int closeOutput(const Flags *const flags, FILE *const stream, FILE *const output, int success);
+
+static int writeOutput(const Flags *const flags, FILE *const stream, Token **tokens, size_t tokenCount, const ASTNode *const root);
+
+static const char *readJobFile(CompileJob *const job, FileCache *const cache, const SourceLoc fileStart);
+
+static int isResultCacheable(const Flags *const flags);
+
+static void seedResultHasher(ResultHasher *const hasher, const Flags *const flags, const char *const programName);
+
+static int findJobResult(CompileJob *const job, ResultCache *const cache, const ResultHasher *const seed, const char *const contents);
+
+static int runCompilation(const char *const programName, Flags *const flags, FileCache *const cache);
+
+static int handleCompileRequest(int argc, char **argv, void *const context);
+
+static char *readJobStream(FILE *const stream, size_t *const size);
+
+static size_t splitManifestLine(char *line, char **arguments);
+
+static int parseManifestLine(int argc, char **argv, char *line, const size_t lineNumber, const char *const manifest, Flags **flags);
+
+static int compareBatchEntries(const void *first, const void *second);
+
+static void runBatchEntry(void *const argument);
+
+static void keepBatchResult(BatchEntry *const entry);
+
+static int copySpilledStream(FILE *const from, size_t size, FILE *const to);
+
+static void writeBatchResult(BatchEntry *const entry);
+
+static void printBatchSummary(const BatchEntry *const entries, const size_t entryCount, const double wallTime);
+
+static int runBatch(int argc, char **argv, Flags *const flags);
 
 /*****************************************************************************************************
                                 PRIVATE MY_STRING FUNCTIONS START HERE
@@ -111,26 +421,28 @@ static ASTNode *parseTokens(Token **tokens, size_t tokenCount);
  * @param file A pointer to the `FILE` object representing the open file. 
  *             The file must be opened in binary mode and positioned at the start.
  * 
+ * @param err The stream the error messages are printed to.
+ * 
  * @return The size of the file in bytes on success. 
  *         Returns -1 if the file pointer is `NULL`, if the file was not opened 
  *         at the start, if the file is empty, or if an error occurs.
  * 
  * @note The function assumes that the file is opened in binary mode. 
  *       The file pointer will be reset to the beginning of the file after 
- *       determining the size. Error messages are printed to `stderr` if any 
+ *       determining the size. Error messages are printed to `err` if any 
  *       issues are encountered.
  */
-static int getFileSize(FILE *file)
+static int getFileSize(FILE *file, FILE *const err)
 {
     if (file == NULL)
     {
-        fprintf(stderr, "File is NULL!\n");
+        fprintf(err, "File is NULL!\n");
         return -1;
     }
 
     if (ftell(file) != 0)
     {
-        fprintf(stderr, "The file wasn't opened at the start or was already modifyed.\n");
+        fprintf(err, "The file wasn't opened at the start or was already modifyed.\n");
         return -1;
     }
     fseek(file, 0, SEEK_END);
@@ -138,7 +450,7 @@ static int getFileSize(FILE *file)
     int size = ftell(file) / sizeof(char);
     if (size == 0)
     {
-        fprintf(stderr, "The file was empty!\n");
+        fprintf(err, "The file was empty!\n");
         return -1;
     }
 
@@ -155,6 +467,8 @@ static int getFileSize(FILE *file)
  * 
  * @param fileName A string containing the name of the file to read from.
  * 
+ * @param err The stream the error messages are printed to.
+ * 
  * @return A pointer to the string containing the file contents on success. 
  *         Returns `NULL` if the file name is `NULL`, if the file cannot be opened, 
  *         if the file cannot be read, or if memory allocation fails.
@@ -162,22 +476,22 @@ static int getFileSize(FILE *file)
  * @note The function allocates memory for the string containing the file contents. 
  *       It is the caller's responsibility to free this memory when it is no longer needed by calling `freeFileContent`.
  */
-static char *readFromFile(char *fileName)
+static char *readFromFile(char *fileName, FILE *const err)
 {
     if (fileName == NULL)
     {
-        fprintf(stderr, "File name is NULL!\n");
+        fprintf(err, "File name is NULL!\n");
         return NULL;
     }
 
     FILE *file = fopen(fileName, "rb");
     if (file == NULL)
     {
-        fprintf(stderr, "Failed to open file %s!\n", fileName);
+        fprintf(err, "Failed to open file %s!\n", fileName);
         return NULL;
     }
 
-    int size = getFileSize(file);
+    int size = getFileSize(file, err);
     if (size == -1)
     {
         fclose(file);
@@ -188,7 +502,7 @@ static char *readFromFile(char *fileName)
 
     if ((int)fread(content, sizeof(char), size, file) != size)
     {
-        fprintf(stderr, "Failed reading from the file %s!\n", fileName);
+        fprintf(err, "Failed reading from the file %s!\n", fileName);
         free(content);
         fclose(file);
         return NULL;
@@ -199,41 +513,6 @@ static char *readFromFile(char *fileName)
     return content;
 }
 
-/**
- * Reads the contents of multiple files into an array of strings.
- *
- * The `readFromFiles` function takes an array of file names, reads the contents of 
- * each file, and stores them in an array of strings. Each string in the returned array 
- * corresponds to the contents of one file.
- *
- * @param fileNames An array of `char*` representing the file names to read from. 
- *                  The array should contain `fileCount` elements.
- * @param fileCount The number of files to read, i.e., the size of the `fileNames` array.
- *
- * @return An array of `char*` where each element contains the contents of a corresponding file.
- *         Returns `NULL` if the `fileNames` array is `NULL` or if memory allocation fails.
- * 
- * @note The caller is responsible for freeing the memory allocated for the file contents 
- *       using `freeFileContents`. If a file cannot be read, the corresponding 
- *       entry in the returned array may be `NULL`.
- */
-static char **readFromFiles(char **fileNames, const size_t fileCount)
-{
-    if (fileNames == NULL)
-    {
-        fprintf(stderr, "File name array is null!\n");
-        return NULL;
-    }
-
-    char **fileContents = malloc(fileCount * sizeof(char *));
-    for (size_t i = 0; i < fileCount; i++)
-    {
-        fileContents[i] = readFromFile(fileNames[i]);
-    }
-    
-    return fileContents;
-}
-
 /**
  * Frees the memory allocated for the contents of single file.
  *
@@ -257,36 +536,6 @@ static void freeFileContent(char *fileContent)
     free(fileContent);
 }
 
-/**
- * Frees the memory allocated for the contents of multiple files.
- *
- * The `freeFileContents` function deallocates the memory used to store the contents 
- * of multiple files, as well as the memory used for the array holding those contents.
- *
- * @param fileContents An array of `char*` where each element points to the contents 
- *                     of a file. The array should contain `fileCount` elements.
- * @param fileCount The number of files, i.e., the number of elements in the 
- *                  `FileContents` array.
- *
- * @note If `FileContents` is `NULL`, the function does nothing and logs an error 
- *       message to `stderr`. The caller should ensure `fileContents` is properly 
- *       allocated before passing it to this function.
- */
-void freeFileContents(char **fileContents, const size_t fileCount)
-{
-    if (fileContents == NULL)
-    {
-        fprintf(stderr, "File contents array is null!\n");
-        return;
-    }
-
-    for (size_t i = 0; i < fileCount; i++)
-    {
-        freeFileContent(fileContents[i]);
-    }
-    free(fileContents);
-}
-
 /**
  * Parses and handles command-line arguments to initialize and configure the `Flags` structure.
  * 
@@ -330,6 +579,7 @@ static Flags *parseArgs(int argc, char **argv)
         return NULL;
     }
     flags->onlyLex = 0;
+    flags->noLink = 0;
     flags->help = 0;
     flags->files = malloc(sizeof(char *));
     if (flags->files == NULL)
@@ -353,13 +603,35 @@ static Flags *parseArgs(int argc, char **argv)
         return NULL;
     }
     flags->headerCount = 0;
+    flags->parseStats = 0;
+    flags->syntaxOnly = 0;
+    flags->verboseAST = 0;
+    flags->compactAST = 0;
+    flags->benchASTWalk = 0;
+    flags->emitASTFile = NULL;
+    flags->loadASTFile = NULL;
+    flags->dumpFormat = DUMP_FORMAT_TREE;
+    flags->shareSpecifiers = 0;
+    flags->jobCount = getProcessorCount();
+    flags->pipeline = 0;
+    flags->serverSocket = NULL;
+    flags->serverCacheSize = (size_t)SERVER_CACHE_DEFAULT_MIB * 1024 * 1024;
+    flags->resultCacheDir = NULL;
+    flags->resultCacheSize = (size_t)RESULT_CACHE_DEFAULT_MIB * 1024 * 1024;
+    flags->cacheStats = 0;
+    flags->timeReport = 0;
+    flags->perfCounters = 0;
+    flags->memReport = 0;
+    flags->batchFile = NULL;
+    flags->traceFile = NULL;
+    flags->errorLimit = DEFAULT_ERROR_LIMIT;
 
     for (size_t i = 1; (int)i < argc; i++)
     {
         if (argv[i][0] != '-')
         {
             flags->files[flags->fileCount++] = argv[i];
-            char **newFiles = realloc(flags->files, flags->fileCount * sizeof(char *));
+            char **newFiles = realloc(flags->files, (flags->fileCount + 1) * sizeof(char *));
             if (newFiles == NULL)
             {
                 fprintf(stderr, "Memory reallocation for files failed!\n");
@@ -384,6 +656,12 @@ static Flags *parseArgs(int argc, char **argv)
             }
             else if (strcmp(argv[i], "-o") == 0)
             {
+                if ((int)i + 1 >= argc)
+                {
+                    fprintf(stderr, "Missing output file after -o!\n");
+                    freeFlags(flags);
+                    return NULL;
+                }
                 flags->isOutputFile = 1;
                 i++;
                 flags->outputFile = argv[i];
@@ -404,12 +682,94 @@ static Flags *parseArgs(int argc, char **argv)
             {
                 flags->optimization = 1;
             }
+            else if (strcmp(argv[i], "--parse-stats") == 0)
+            {
+                flags->parseStats = 1;
+            }
+            else if (strcmp(argv[i], "-fsyntax-only") == 0)
+            {
+                flags->syntaxOnly = 1;
+            }
+            else if (strcmp(argv[i], "--verbose-ast") == 0)
+            {
+                flags->verboseAST = 1;
+            }
+            else if (strcmp(argv[i], "--compact-ast") == 0)
+            {
+                flags->compactAST = 1;
+            }
+            else if (strcmp(argv[i], "--bench-ast-walk") == 0)
+            {
+                flags->benchASTWalk = 1;
+            }
+            else if (strcmp(argv[i], "--share-specifiers") == 0)
+            {
+                flags->shareSpecifiers = 1;
+            }
+            else if (strcmp(argv[i], "--pipeline") == 0)
+            {
+                flags->pipeline = 1;
+            }
+            else if (strcmp(argv[i], "--cache-stats") == 0)
+            {
+                flags->cacheStats = 1;
+            }
+            else if (strcmp(argv[i], "-ftime-report") == 0)
+            {
+                flags->timeReport = 1;
+            }
+            else if (strcmp(argv[i], "--perf-counters") == 0)
+            {
+                flags->perfCounters = 1;
+            }
+            else if (strcmp(argv[i], "--mem-report") == 0)
+            {
+                flags->memReport = 1;
+            }
+            else if (strcmp(argv[i], "--server") == 0)
+            {
+                if ((int)i + 1 >= argc)
+                {
+                    fprintf(stderr, "Missing socket path after --server!\n");
+                    freeFlags(flags);
+                    return NULL;
+                }
+                i++;
+                flags->serverSocket = argv[i];
+            }
+            else if (strcmp(argv[i], "--batch") == 0)
+            {
+                if ((int)i + 1 >= argc)
+                {
+                    fprintf(stderr, "Missing manifest after --batch!\n");
+                    freeFlags(flags);
+                    return NULL;
+                }
+                i++;
+                flags->batchFile = argv[i];
+            }
+            else if (strcmp(argv[i], "-j") == 0)
+            {
+                if ((int)i + 1 >= argc)
+                {
+                    fprintf(stderr, "Missing job count after -j!\n");
+                    freeFlags(flags);
+                    return NULL;
+                }
+                i++;
+                if (!parsePositiveNumber(argv[i], &flags->jobCount))
+                {
+                    fprintf(stderr, "Invalid job count %s!\n", argv[i]);
+                    freeFlags(flags);
+                    return NULL;
+                }
+            }
             else if (strlen(argv[i]) > 2)
             {
                 if (strncmp(argv[i], "-I", 2) == 0)
                 {
                     flags->headerFiles[flags->headerCount++] = substring(argv[i], 2, strlen(argv[i]));
-                    char **newHeaderFiles = realloc(flags->headerFiles, flags->headerCount * sizeof(char *));
+                    char **newHeaderFiles = realloc(flags->headerFiles, (flags->headerCount + 1) * sizeof(char *));
                     if (newHeaderFiles == NULL)
                     {
                         fprintf(stderr, "Memory reallocation for header files failed!\n");
@@ -418,6 +778,75 @@ static Flags *parseArgs(int argc, char **argv)
                     }
                     flags->headerFiles = newHeaderFiles;
                 }
+                else if (strncmp(argv[i], "-emit-ast=", 10) == 0 && strlen(argv[i]) > 10)
+                {
+                    flags->emitASTFile = argv[i] + 10;
+                }
+                else if (strncmp(argv[i], "-load-ast=", 10) == 0 && strlen(argv[i]) > 10)
+                {
+                    flags->loadASTFile = argv[i] + 10;
+                }
+                else if (strncmp(argv[i], "-j", 2) == 0)
+                {
+                    if (!parsePositiveNumber(argv[i] + 2, &flags->jobCount))
+                    {
+                        fprintf(stderr, "Invalid job count %s!\n", argv[i] + 2);
+                        freeFlags(flags);
+                        return NULL;
+                    }
+                }
+                else if (strncmp(argv[i], "--server-cache-size=", 20) == 0)
+                {
+                    size_t mebibytes;
+                    if (!parsePositiveNumber(argv[i] + 20, &mebibytes))
+                    {
+                        fprintf(stderr, "Invalid server cache size %s!\n", argv[i] + 20);
+                        freeFlags(flags);
+                        return NULL;
+                    }
+                    flags->serverCacheSize = mebibytes * 1024 * 1024;
+                }
+                else if (strncmp(argv[i], "--cache-dir=", 12) == 0 && strlen(argv[i]) > 12)
+                {
+                    flags->resultCacheDir = argv[i] + 12;
+                }
+                else if (strncmp(argv[i], "--cache-size=", 13) == 0)
+                {
+                    size_t mebibytes;
+                    if (!parsePositiveNumber(argv[i] + 13, &mebibytes))
+                    {
+                        fprintf(stderr, "Invalid cache size %s!\n", argv[i] + 13);
+                        freeFlags(flags);
+                        return NULL;
+                    }
+                    flags->resultCacheSize = mebibytes * 1024 * 1024;
+                }
+                else if (strncmp(argv[i], "--trace=", 8) == 0 && strlen(argv[i]) > 8)
+                {
+                    flags->traceFile = argv[i] + 8;
+                }
+                else if (strncmp(argv[i], "-ferror-limit=", 14) == 0)
+                {
+                    if (strcmp(argv[i] + 14, "0") == 0)
+                    {
+                        flags->errorLimit = 0;
+                    }
+                    else if (!parsePositiveNumber(argv[i] + 14, &flags->errorLimit))
+                    {
+                        fprintf(stderr, "Invalid error limit %s!\n", argv[i] + 14);
+                        freeFlags(flags);
+                        return NULL;
+                    }
+                }
+                else if (strncmp(argv[i], "--dump-format=", 14) == 0)
+                {
+                    if (!parseDumpFormat(argv[i] + 14, &flags->dumpFormat))
+                    {
+                        fprintf(stderr, "Unknown dump format %s!\n", argv[i] + 14);
+                        freeFlags(flags);
+                        return NULL;
+                    }
+                }
                 else
                 {
                     fprintf(stderr, "Invalid argument %s!\n", argv[i]);
@@ -434,54 +863,120 @@ static Flags *parseArgs(int argc, char **argv)
         }
     }
 
-    if (flags->fileCount == 0)
+    if (flags->fileCount == 0 && flags->loadASTFile == NULL && flags->serverSocket == NULL && flags->batchFile == NULL)
     {
         fprintf(stderr, "No files to compile!\n");
         freeFlags(flags);
         return NULL;
     }
 
-    return flags;
-}
-
-/**
- * Frees memory associated with a `Flags` structure and its dynamically allocated members.
- * 
- * This function deallocates all memory allocated for the `Flags` structure, including any
- * dynamically allocated arrays and strings within the structure. If the `flags` pointer is `NULL`,
- * an error message is printed and the function returns immediately.
- * 
- * The function checks each dynamically allocated member of the `Flags` structure and frees it
- * appropriately. The `flags` structure itself is also freed at the end.
- * 
- * @param flags A pointer to the `Flags` structure to be freed. It is assumed to be dynamically allocated.
- * 
- * @note This function checks if the `flags` pointer is `NULL` before attempting to free its members.
- *       It also checks for each dynamically allocated member array to ensure it is not `NULL` before freeing.
- * 
- * @note After calling this function, the pointer to the `Flags` structure should not be used unless
- *       it is re-initialized, as the memory it points to will be deallocated.
- */
-static void freeFlags(Flags *flags)
-{
-    if (flags == NULL)
+    if (flags->cacheStats && flags->resultCacheDir == NULL)
     {
-        fprintf(stderr, "Flags are NULL!\n");
-        return;
+        fprintf(stderr, "Cannot specify --cache-stats without --cache-dir!\n");
+        freeFlags(flags);
+        return NULL;
     }
 
-    if (flags->files != NULL)
+    //The files of a batch come from its manifest
+    if (flags->batchFile != NULL && flags->fileCount > 0)
     {
-        free(flags->files);
+        fprintf(stderr, "Cannot specify files with --batch!\n");
+        freeFlags(flags);
+        return NULL;
     }
 
-    if (flags->headerFiles != NULL)
+    //A serialized AST is written instead of compiling files
+    if (flags->loadASTFile != NULL && (flags->fileCount > 0 || flags->batchFile != NULL))
     {
-        for (size_t i = 0; i < flags->headerCount; i++)
-        {
-            free(flags->headerFiles[i]);
-        }
-        free(flags->headerFiles);
+        fprintf(stderr, "Cannot specify files or --batch with -load-ast!\n");
+        freeFlags(flags);
+        return NULL;
+    }
+
+    //The reports are printed by the compilation of the command line, which a batch replaces
+    if (flags->batchFile != NULL && (flags->timeReport || flags->perfCounters || flags->memReport))
+    {
+        fprintf(stderr, "Cannot specify -ftime-report, --perf-counters or --mem-report with --batch!\n");
+        freeFlags(flags);
+        return NULL;
+    }
+
+    //Every file would write the same output file
+    if ((flags->fileCount > 1 || flags->batchFile != NULL) && (flags->isOutputFile || flags->emitASTFile != NULL))
+    {
+        fprintf(stderr, "Cannot specify -o or -emit-ast with multiple files!\n");
+        freeFlags(flags);
+        return NULL;
+    }
+
+    return flags;
+}
+
+/**
+ * Parses a numeric argument, like the job count of `-j` or the size of `--cache-size`.
+ *
+ * @param text The argument, a positive decimal number.
+ *
+ * @param number Set to the parsed number on success.
+ *
+ * @return 1 on success, 0 if the argument is not a positive number.
+ */
+static int parsePositiveNumber(const char *const text, size_t *const number)
+{
+    if (text == NULL || text[0] < '0' || text[0] > '9')
+    {
+        return 0;
+    }
+
+    char *end = NULL;
+    unsigned long count = strtoul(text, &end, 10);
+    if (*end != '\0' || count == 0)
+    {
+        return 0;
+    }
+
+    *number = (size_t)count;
+    return 1;
+}
+
+/**
+ * Frees memory associated with a `Flags` structure and its dynamically allocated members.
+ * 
+ * This function deallocates all memory allocated for the `Flags` structure, including any
+ * dynamically allocated arrays and strings within the structure. If the `flags` pointer is `NULL`,
+ * an error message is printed and the function returns immediately.
+ * 
+ * The function checks each dynamically allocated member of the `Flags` structure and frees it
+ * appropriately. The `flags` structure itself is also freed at the end.
+ * 
+ * @param flags A pointer to the `Flags` structure to be freed. It is assumed to be dynamically allocated.
+ * 
+ * @note This function checks if the `flags` pointer is `NULL` before attempting to free its members.
+ *       It also checks for each dynamically allocated member array to ensure it is not `NULL` before freeing.
+ * 
+ * @note After calling this function, the pointer to the `Flags` structure should not be used unless
+ *       it is re-initialized, as the memory it points to will be deallocated.
+ */
+static void freeFlags(Flags *flags)
+{
+    if (flags == NULL)
+    {
+        fprintf(stderr, "Flags are NULL!\n");
+        return;
+    }
+
+    if (flags->files != NULL)
+    {
+        free(flags->files);
+    }
+
+    if (flags->headerFiles != NULL)
+    {
+        for (size_t i = 0; i < flags->headerCount; i++)
+        {
+            free(flags->headerFiles[i]);
+        }
+        free(flags->headerFiles);
     }
 
     free(flags);
@@ -564,6 +1059,105 @@ static void printUsage()
  *    Adds a directory to the header file search path. This is useful 
  *    when your code depends on headers located in non-standard directories.
  *
+ * - `--parse-stats`: 
+ *    Prints how often each grammar rule was tried, how often it matched and 
+ *    how many tokens its backtracking re-scanned. Requires a build with 
+ *    `make PARSER_STATS=1`.
+ *
+ * - `-fsyntax-only`: 
+ *    Only checks the syntax of the input and reports the errors, without 
+ *    building or printing the Abstract Syntax Tree.
+ *
+ * - `-ferror-limit=<count>`: 
+ *    Stops lexing and collecting errors in a file after `count` errors, 
+ *    20 by default, so broken or binary input fails quickly. 0 reports 
+ *    every error.
+ *
+ * - `--verbose-ast`: 
+ *    Keeps the wrapper nodes that only hold a single child, so the printed 
+ *    tree follows the grammar rule by rule. Useful for debugging the parser.
+ *
+ * - `--compact-ast`: 
+ *    Converts the Abstract Syntax Tree to its compact form after parsing and 
+ *    frees the parser's nodes, so later stages work on the smaller tree.
+ *
+ * - `--bench-ast-walk`: 
+ *    Times full walks over the pointer based Abstract Syntax Tree and over 
+ *    its flattened pre-order encoding and prints the results to `stderr`.
+ *
+ * - `-emit-ast=<file>`: 
+ *    Serializes the Abstract Syntax Tree and its tokens into a versioned 
+ *    binary file instead of printing it.
+ *
+ * - `-load-ast=<file>`: 
+ *    Memory-maps a file written by `-emit-ast` and prints its tree, without 
+ *    lexing or parsing any source file. No source files may be given.
+ *
+ * - `--dump-format=<format>`: 
+ *    Selects how the tokens of `-l` and the Abstract Syntax Tree are written: 
+ *    `tree` (default), `json` or `sexpr`. Together with `-o <file>` the 
+ *    output is written to the file instead of the standard output.
+ *
+ * - `--share-specifiers`: 
+ *    Shares structurally identical declaration specifier, type specifier and 
+ *    pointer subtrees instead of allocating every repetition again.
+ *
+ * - `-j <count>`, `-j<count>`: 
+ *    Lexes and parses up to `count` files in parallel, by default as many as 
+ *    there are processors. The output is written in command-line order.
+ *
+ * - `--pipeline`: 
+ *    Lexes every file on its own thread while the parser consumes the 
+ *    tokens on another, instead of lexing the whole file before parsing.
+ *
+ * - `--server <socket>`: 
+ *    Runs as a compile server on a Unix domain socket, keeping the contents 
+ *    and the tokens of the compiled files between requests.
+ *
+ * - `--server-cache-size=<MiB>`: 
+ *    Limits the memory of the files the compile server keeps (default 256).
+ *
+ * - `--client <socket>`: 
+ *    Sends the rest of the command line to a compile server, or compiles 
+ *    locally if no server is listening on the socket. Must be the first option.
+ *
+ * - `--cache-dir=<dir>`: 
+ *    Keeps the messages and the output of every compiled file in a 
+ *    directory, keyed by a hash of the file and the options, and replays 
+ *    them instead of compiling an unchanged file again.
+ *
+ * - `--cache-size=<MiB>`: 
+ *    Limits the size of the result cache (default 1024). The results used 
+ *    least recently are removed first.
+ *
+ * - `--cache-stats`: 
+ *    Prints the hits, misses and size of the result cache.
+ *
+ * - `-ftime-report`: 
+ *    Prints the wall and CPU time, the allocations and the peak memory 
+ *    of every phase of the compilation.
+ *
+ * - `--perf-counters`: 
+ *    Counts the cycles, instructions, L1D and LLC misses and branch 
+ *    misses of every phase with the Linux `perf_event_open` counters, 
+ *    and prints them with the instructions per cycle and the misses per 
+ *    thousand instructions. Where the counters are unavailable a warning 
+ *    is printed and the phase times of `-ftime-report` are printed instead.
+ *
+ * - `--mem-report`: 
+ *    Prints the allocations, the requested bytes, the peak live bytes 
+ *    and the reallocations of the tokens, the token text, the AST nodes 
+ *    and arrays, the errors and the parser scratch memory.
+ *
+ * - `--batch <manifest>`: 
+ *    Compiles the files listed in a manifest, one file and its options 
+ *    per line, largest first on `-j` workers, and prints a summary.
+ *
+ * - `--trace=<file>`: 
+ *    Writes the phases, the files and the top-level declarations of the 
+ *    compilation to a Chrome Trace Event Format JSON file, one track per 
+ *    thread, to open in Perfetto or `chrome://tracing`.
+ *
  * - `-L<path>`: 
  *    Adds a directory to the library file search path. This helps the 
  *    linker find libraries that are not in standard locations.
@@ -588,56 +1182,74 @@ static void printHelp()
     printf("  -g \t\t\tInclude debugging information\n");
     printf("  -O \t\t\tEnable optimization\n");
     printf("  -I<path> \t\tAdd a directory to the header file search path\n");
+    printf("  --parse-stats \t\tPrint per-rule parser statistics\n");
+    printf("  -fsyntax-only \t\tOnly check the syntax of the input\n");
+    printf("  -ferror-limit=<count> Stop after count errors in a file, 0 for no limit\n");
+    printf("  --verbose-ast \t\tKeep single-child wrapper nodes in the AST\n");
+    printf("  --compact-ast \t\tConvert the AST to its compact form\n");
+    printf("  --bench-ast-walk \tBenchmark walking the pointer and the flat AST\n");
+    printf("  -emit-ast=<file> \tWrite the AST to a binary file\n");
+    printf("  -load-ast=<file> \tPrint the AST of a binary file\n");
+    printf("  --dump-format=<format> Write tokens and the AST as tree, json or sexpr\n");
+    printf("  --share-specifiers 	Share identical specifier subtrees of the AST\n");
+    printf("  -j <count> \t\tCompile up to count files in parallel\n");
+    printf("  --pipeline \t\tLex and parse each file on separate threads\n");
+    printf("  --server <socket> \tServe compile requests on a Unix socket\n");
+    printf("  --server-cache-size=<MiB> Memory limit of the files the server keeps\n");
+    printf("  --client <socket> \tCompile on the server listening on the socket\n");
+    printf("  --cache-dir=<dir> \tReuse the results of earlier compilations\n");
+    printf("  --cache-size=<MiB> \tSize limit of the result cache\n");
+    printf("  --cache-stats \t\tPrint the result cache statistics\n");
+    printf("  -ftime-report \t\tPrint the time and memory of each phase\n");
+    printf("  --perf-counters \tPrint the hardware counters of each phase\n");
+    printf("  --mem-report \t\tPrint the memory allocated by the front end\n");
+    printf("  --batch <manifest> \tCompile the files listed in a manifest\n");
+    printf("  --trace=<file> \tWrite a Chrome trace of the compilation\n");
 }
 
 /**
- * Lexes the contents of a file into an array of tokens.
+ * Lexes the contents of the file of a job into an array of tokens.
  *
  * The `lexFile` function takes the contents of a file as input and processes it to produce 
  * an array of tokens. These tokens represent the lexical elements of the input file, 
  * such as keywords, operators, identifiers, literals, etc.
  *
- * The function dynamically allocates memory for the array of tokens and returns a pointer 
- * to the array. The caller is responsible for freeing the memory using a suitable 
- * function after use.
+ * The tokens are stored in the job, which frees them with `freeCompileJob`, even if lexing
+ * fails. The lexing errors are printed to the streams of the job. If the job has a token queue,
+ * every token is also pushed to it as soon as it is lexed.
  *
- * @param fileContents A constant pointer to a character array containing the contents of the file
- *                     to be lexed. This parameter must not be `NULL`.
- * 
- * @param tokenCount   A pointer to a `size_t` variable where the function will store the number 
- *                     of tokens generated from the input file. The value is set to `0` if 
- *                     lexing fails or if there are no tokens.
+ * @param job The job of the file. Its `fileContents` must not be `NULL`.
  *
- * @return A pointer to an array of `Token` pointers representing the tokens parsed from the input file.
- *         Returns `NULL` if there is an error during lexing, such as memory allocation failure,
- *         invalid input, or errors encountered while parsing.
+ * @return 1 if the file was lexed without errors, 0 if there is an error during lexing,
+ *         such as memory allocation failure, invalid input, or errors in the input.
  */
-static Token **lexFile(const char *const fileContents, size_t *tokenCount)
+static int lexFile(CompileJob *const job)
 {
-    if (fileContents == NULL)
+    if (job->fileContents == NULL)
     {
-        fprintf(stderr, "File contents is NULL!\n");
-        return NULL;
+        fprintf(job->err, "File contents is NULL!\n");
+        return 0;
     }
 
     //Create the tokens array
     size_t tokenCapacity = INITIAL_TOKEN_CAPACITY;
-    Token **tokens = malloc(tokenCapacity * sizeof(Token));
+    Token **tokens = allocateMemory(MEMORY_TOKENS, tokenCapacity * sizeof(Token *));
     if (tokens == NULL)
     {
-        fprintf(stderr, "Memory allocation for Tokens failed!\n");
-        return NULL;
+        fprintf(job->err, "Memory allocation for Tokens failed!\n");
+        return 0;
     }
-    *tokenCount = 0;
+    size_t tokenCount = 0;
 
     //Create the lexer
-    Lexer *lexer = createLexer(fileContents);
+    Lexer *lexer = createLexer(job->fileContents, job->fileStart);
     if (lexer == NULL)
     {
-        fprintf(stderr, "Failed to create Lexer.\n");
-        free(tokens);
-        return NULL;
+        fprintf(job->err, "Failed to create Lexer.\n");
+        releaseMemory(MEMORY_TOKENS, tokens);
+        return 0;
     }
+    setDiagnosticLimit(lexer->diagnostics, job->flags->errorLimit);
 
     //Lex the input
     while (1)
@@ -645,27 +1257,34 @@ static Token **lexFile(const char *const fileContents, size_t *tokenCount)
         Token *ctoken = lex(lexer);
         if (ctoken == NULL)
         {
-            fprintf(stderr, "Error lexing input or end of input.\n");
-            deleteTokens(tokens, *tokenCount);
+            fprintf(job->err, "Error lexing input or end of input.\n");
+            job->tokens = tokens;
+            job->tokenCount = tokenCount;
             deleteLexer(lexer);
-            return NULL;
+            return 0;
         }
 
-        if (*tokenCount >= tokenCapacity)
+        if (tokenCount >= tokenCapacity)
         {
             tokenCapacity *= 2;
-            Token **newTokens = realloc(tokens, tokenCapacity * sizeof(Token *));
+            Token **newTokens = reallocateMemory(MEMORY_TOKENS, tokens, tokenCapacity * sizeof(Token *));
             if (newTokens == NULL)
             {
-                fprintf(stderr, "Memory allocation for tokens array failed!\n");
-                deleteTokens(tokens, *tokenCount);
+                fprintf(job->err, "Memory allocation for tokens array failed!\n");
+                deleteToken(ctoken);
+                job->tokens = tokens;
+                job->tokenCount = tokenCount;
                 deleteLexer(lexer);
-                return NULL;
+                return 0;
             }
             tokens = newTokens;
         }
 
-        tokens[(*tokenCount)++] = ctoken;
+        tokens[tokenCount++] = ctoken;
+        if (job->tokenQueue != NULL)
+        {
+            pushTokenQueue(job->tokenQueue, ctoken);
+        }
 
         if (ctoken->type == TOKEN_EOF)
         {
@@ -674,170 +1293,1751 @@ static Token **lexFile(const char *const fileContents, size_t *tokenCount)
     }
 
     //If lexer had errors, print them and return
-    if (lexer->errorCount > 0)
+    if (lexer->diagnostics->count > 0)
     {
-        fprintf(stderr, "Lexing failed!\n");
-        for (size_t i = 0; i < lexer->errorCount; i++)
-        {
-            printError(lexer->errors[i]);
-        }
+        fprintf(job->err, "Lexing failed!\n");
+        printDiagnostics(lexer->diagnostics, job->sources, job->out);
         
-        deleteTokens(tokens, *tokenCount);
+        job->tokens = tokens;
+        job->tokenCount = tokenCount;
         deleteLexer(lexer);
-        return NULL;
+        return 0;
     }
 
     deleteLexer(lexer);
-    return tokens;
+    job->tokens = tokens;
+    job->tokenCount = tokenCount;
+    return 1;
 }
 
 /**
- * Parses an array of tokens into an Abstract Syntax Tree (AST).
+ * Runs `lexFile` on the lexer thread of a pipelined job and closes its token queue afterwards.
  *
- * The `parseTokens` function takes an array of tokens generated by a lexer and 
- * processes them to construct an Abstract Syntax Tree (AST) representing the 
- * syntactic structure of the input source code. The function dynamically 
- * allocates memory for the AST and returns a pointer to its root node.
+ * @param argument The `CompileJob` to lex. Its `lexed` field is set to the result.
  *
- * The caller is responsible for freeing the memory associated with the returned 
- * AST node and its children using a suitable function after use.
+ * @return Always NULL.
+ */
+static void *runLexerThread(void *argument)
+{
+    CompileJob *job = argument;
+    PhaseTimer timer;
+    startPhaseTimer(&timer);
+    job->lexed = lexFile(job);
+    stopPhaseTimer(&timer, &job->timeReport, PHASE_LEX);
+    closeTokenQueue(job->tokenQueue);
+
+    return NULL;
+}
+
+/**
+ * Starts lexing the file of a job on its own thread, feeding a token queue the parser reads from.
  *
- * @param tokens     A pointer to an array of `Token` pointers representing the 
- *                   lexical tokens to be parsed. This parameter must not be `NULL`.
- * 
- * @param tokenCount The number of tokens in the `tokens` array.
+ * @param job The job of the file.
  *
- * @return A pointer to the root node of the constructed AST. 
- *         Returns `NULL` if there is an error during parsing, such as memory allocation 
- *         failure, invalid input, or syntax errors in the tokens.
+ * @return 1 if the lexer thread is running, 0 if the queue or the thread could not be created.
+ *         The job is left unchanged on failure, so it can be lexed in place instead.
  */
-static ASTNode *parseTokens(Token **tokens, size_t tokenCount)
+static int startPipeline(CompileJob *const job)
 {
-    if (tokens == NULL)
+    job->tokenQueue = createTokenQueue(PIPELINE_QUEUE_CAPACITY);
+    if (job->tokenQueue == NULL)
+    {
+        return 0;
+    }
+
+    if (pthread_create(&job->lexerThread, NULL, runLexerThread, job) != 0)
+    {
+        fprintf(job->err, "Failed to start the lexer thread, lexing before parsing.\n");
+        deleteTokenQueue(job->tokenQueue);
+        job->tokenQueue = NULL;
+        return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * Waits for the lexer thread of a pipelined job, after emptying the token queue so it can finish.
+ *
+ * @param job The job of the file. If it has no token queue, the function does nothing.
+ *
+ * @return 1 if the file was lexed without errors or was lexed before parsing, 0 otherwise.
+ */
+static int finishLexing(CompileJob *const job)
+{
+    if (job->tokenQueue == NULL)
+    {
+        return 1;
+    }
+
+    while (popTokenQueue(job->tokenQueue) != NULL);
+    pthread_join(job->lexerThread, NULL);
+    deleteTokenQueue(job->tokenQueue);
+    job->tokenQueue = NULL;
+
+    return job->lexed;
+}
+
+/**
+ * Creates the parser of a job, reading the token queue of a pipelined job or the lexed tokens otherwise.
+ *
+ * @param job The job of the file.
+ *
+ * @return The parser, or NULL if it could not be created.
+ */
+static Parser *createJobParser(CompileJob *const job)
+{
+    PhaseTimer timer;
+    startPhaseTimer(&timer);
+    Parser *parser = job->tokenQueue != NULL ? createStreamingParser(job->tokenQueue) : createParser(job->tokens, job->tokenCount);
+    stopPhaseTimer(&timer, &job->timeReport, PHASE_FILTER);
+    if (parser == NULL)
     {
-        fprintf(stderr, "Tokens array is NULL!\n");
-        deleteTokens(tokens, tokenCount);
+        fprintf(job->err, "Failed to create Parser.\n");
         return NULL;
     }
+    setDiagnosticLimit(parser->diagnostics, job->flags->errorLimit);
+
+    return parser;
+}
+
+/**
+ * Parses the tokens of a job into an Abstract Syntax Tree (AST).
+ *
+ * The `parseTokens` function takes the tokens generated by the lexer and 
+ * processes them to construct an Abstract Syntax Tree (AST) representing the 
+ * syntactic structure of the input source code.
+ *
+ * The whole AST is allocated from a single `ASTArena`, which is stored in the job together
+ * with the root. Both are freed with the tokens by `freeCompileJob`.
+ *
+ * If `parseStats` is set in the flags of the job, the per-rule parser statistics are printed
+ * once parsing has finished. If `shareSpecifiers` is set, identical specifier subtrees are shared.
+ *
+ * @param job The job of the file. Its `tokens` must not be `NULL` unless its lexer thread is running.
+ *
+ * @return 1 if the AST was built, 0 if there is an error during parsing, such as memory
+ *         allocation failure, invalid input, or syntax errors in the tokens.
+ */
+static int parseTokens(CompileJob *const job)
+{
+    if (job->tokenQueue == NULL && job->tokens == NULL)
+    {
+        fprintf(job->err, "Tokens array is NULL!\n");
+        return 0;
+    }
 
     //Create the parser
-    Parser *parser = createParser(tokens, tokenCount);
+    Parser *parser = createJobParser(job);
     if (parser == NULL)
     {
-        fprintf(stderr, "Failed to create Parser.\n");
-        deleteTokens(tokens, tokenCount);
-        return NULL;
+        finishLexing(job);
+        return 0;
+    }
+
+    //Share identical specifiers if requested
+    if (job->flags->shareSpecifiers && !shareSpecifiers(parser))
+    {
+        fprintf(job->err, "Failed to enable specifier sharing.\n");
+        deleteParser(parser);
+        finishLexing(job);
+        return 0;
     }
 
-    //Parse the tokens
+    //Parse the tokens, the parse of a file that failed to lex is not reported
+    PhaseTimer timer;
+    startPhaseTimer(&timer);
     int success = parse(parser);
+    stopPhaseTimer(&timer, &job->timeReport, PHASE_PARSE);
+    if (!finishLexing(job))
+    {
+        deleteParser(parser);
+        return 0;
+    }
+
+    if (job->flags->parseStats)
+    {
+        printParseStats(parser, job->err);
+    }
+
     if (!success)
     {
-        fprintf(stderr, "Parsing failed!\n");
-        for (size_t i = 0; i < parser->errorCount; i++)
-        {
-            printError(parser->errors[i]);
-        }
+        fprintf(job->err, "Parsing failed!\n");
+        printDiagnostics(parser->diagnostics, job->sources, job->out);
 
         deleteParser(parser);
-        deleteTokens(tokens, tokenCount);
-        return NULL;
+        return 0;
     }
 
-    if (parser->errorCount > 0)
+    if (parser->diagnostics->count > 0)
     {
-        fprintf(stderr, "Parsing completed with errors!\n");
-        for (size_t i = 0; i < parser->errorCount; i++)
-        {
-            printError(parser->errors[i]);
-        }
+        fprintf(job->err, "Parsing completed with errors!\n");
+        printDiagnostics(parser->diagnostics, job->sources, job->out);
         deleteParser(parser);
-        deleteTokens(tokens, tokenCount);
-        return NULL;
+        return 0;
     }
 
-    //Get the AST root
-    ASTNode *root = getCopyAST(parser);
+    //Take the AST and its arena from the parser
+    job->root = releaseAST(parser, &job->arena);
     deleteParser(parser);
 
-    return root;
+    return job->root != NULL;
 }
 
-/*****************************************************************************************************
-                                PUBLIC MY_STRING FUNCTIONS START HERE                                
- *****************************************************************************************************/
-
-int runVM(int argc, char **argv)
+/**
+ * Checks the syntax of the tokens of a job without building an Abstract Syntax Tree (AST).
+ *
+ * The `checkSyntax` function runs the parser's recognizer over the tokens generated by
+ * the lexer and prints the syntax errors it finds. No AST node is created, which makes
+ * it considerably cheaper than `parseTokens` when only a yes/no answer is needed.
+ *
+ * If `parseStats` is set in the flags of the job, the per-rule parser statistics are printed
+ * once the check has finished.
+ *
+ * @param job The job of the file. Its `tokens` must not be `NULL` unless its lexer thread is running.
+ *
+ * @return 1 if the tokens are syntactically valid, 0 otherwise.
+ */
+static int checkSyntax(CompileJob *const job)
 {
-    //Parse arguments
-    Flags *flags = parseArgs(argc, argv);
-    if (flags == NULL)
+    if (job->tokenQueue == NULL && job->tokens == NULL)
     {
-        return -1;
+        fprintf(job->err, "Tokens array is NULL!\n");
+        return 0;
     }
 
-    //Handle arguments
-    if (flags->help)
+    //Create the parser
+    Parser *parser = createJobParser(job);
+    if (parser == NULL)
     {
-        printHelp(argv[0]);
-        freeFlags(flags);
+        finishLexing(job);
         return 0;
     }
 
-    //Read the contents of the files
-    char **fileContents = readFromFiles(flags->files, flags->fileCount);
-    //TODO:
-    //Handle multiple files, we only handle one file for now
-    const char *const input = fileContents[0];
+    //Recognize the tokens, the check of a file that failed to lex is not reported
+    PhaseTimer timer;
+    startPhaseTimer(&timer);
+    int success = recognize(parser);
+    stopPhaseTimer(&timer, &job->timeReport, PHASE_PARSE);
+    if (!finishLexing(job))
+    {
+        deleteParser(parser);
+        return 0;
+    }
 
-    //Lex the input
-    size_t tokenCount = 0;
-    Token **tokens = lexFile(input, &tokenCount);
-    if (tokens == NULL)
+    if (job->flags->parseStats)
     {
-        freeFileContents(fileContents, flags->fileCount);
-        freeFlags(flags);
-        return -1;
+        printParseStats(parser, job->err);
     }
 
-    //If only lexing is requested, print the tokens and return
-    if (flags->onlyLex)
+    if (!success)
+    {
+        fprintf(job->err, "Syntax check failed!\n");
+        printDiagnostics(parser->diagnostics, job->sources, job->out);
+    }
+
+    deleteParser(parser);
+    return success;
+}
+
+/**
+ * Lexes and parses the file of a job.
+ *
+ * Only the lexer runs if `onlyLex` is set, and only the recognizer if `syntaxOnly` is set.
+ * With `pipeline` the lexer runs on its own thread and the parser consumes its tokens as they
+ * arrive. The contents of the file are freed once they are lexed.
+ *
+ * @param job The job to run. Its `success` field is set to the result.
+ */
+static void compileJobFile(CompileJob *const job)
+{
+    //A file cached by the compile server is already lexed
+    if (job->cached != NULL)
     {
-        for (size_t i = 0; i < tokenCount; i++)
+        job->tokens = job->cached->tokens;
+        job->tokenCount = job->cached->tokenCount;
+        job->lexed = 1;
+        job->success = 1;
+        if (job->flags->onlyLex)
         {
-            if (tokens[i]->type != TOKEN_WHITESPACE && tokens[i]->type != TOKEN_LINE_COMMENT && tokens[i]->type != TOKEN_BLOCK_COMMENT)
-            {
-                printToken(tokens[i]);
-            }
+            return;
+        }
+    }
+    //Lex on a separate thread while parsing if requested, otherwise lex the whole input first
+    else if (!job->flags->pipeline || job->flags->onlyLex || !startPipeline(job))
+    {
+        PhaseTimer timer;
+        startPhaseTimer(&timer);
+        job->lexed = lexFile(job);
+        stopPhaseTimer(&timer, &job->timeReport, PHASE_LEX);
+        job->success = job->lexed;
+
+        //Free the file contents as they are extracted into tokens, unless they are cached
+        if (job->cachePath == NULL)
+        {
+            freeFileContent(job->fileContents);
+            job->fileContents = NULL;
+        }
+        if (!job->success || job->flags->onlyLex)
+        {
+            return;
         }
-
-        freeFileContents(fileContents, flags->fileCount);
-        freeFlags(flags);
-        deleteTokens(tokens, tokenCount);
-        return 0;
     }
 
-    //Free the file contents as they are extracted into tokens
-    //This needs to change if we want to support multiple files
-    freeFileContents(fileContents, flags->fileCount);
-
-    //Parse the tokens
-    ASTNode *root = parseTokens(tokens, tokenCount);
-    if (root == NULL)
+    //If only the syntax check is requested, recognize the tokens
+    if (job->flags->syntaxOnly)
     {
-        freeFlags(flags);
-        return -1;
+        job->success = checkSyntax(job);
+    }
+    else
+    {
+        //Parse the tokens and collapse the single-child chains unless the full tree is requested
+        job->success = parseTokens(job);
+        if (job->success && !job->flags->verboseAST)
+        {
+            PhaseTimer timer;
+            startPhaseTimer(&timer);
+            job->root = collapseASTChains(job->root);
+            stopPhaseTimer(&timer, &job->timeReport, PHASE_COLLAPSE);
+        }
     }
 
-    //Print the AST
-    printASTNode(root, "", 0);
+    //The lexer thread is done with the file contents
+    if (job->fileContents != NULL && job->cachePath == NULL)
+    {
+        freeFileContent(job->fileContents);
+        job->fileContents = NULL;
+    }
+}
 
-    //TODO:
-    //Do things with the AST
+/**
+ * Compiles the file of a job with `compileJobFile`, recording it as a span of the trace.
+ * Used as a `ThreadPoolFunction`.
+ *
+ * @param argument The `CompileJob` to run. Its `success` field is set to the result.
+ */
+static void runCompileJob(void *const argument)
+{
+    CompileJob *job = argument;
+    uint64_t start = getTraceTime();
+    compileJobFile(job);
+    recordTraceSpan("file", "file", start, getTraceTime(), job->fileName, (int64_t)job->tokenCount);
+}
 
-    //Free memory
-    freeFlags(flags);
-    deleteASTNode(root);
-    deleteTokens(tokens, tokenCount);
-    return 0;
-}
\ No newline at end of file
+/**
+ * Copies the messages a job buffered in a temporary file to a standard stream.
+ *
+ * @param from The stream of the job. If it is a standard stream, nothing is copied.
+ *
+ * @param to The standard stream to copy to.
+ *
+ * @return 1 on success, 0 if reading the temporary file fails.
+ */
+static int copyJobStream(FILE *const from, FILE *const to)
+{
+    if (from == NULL || from == stdout || from == stderr)
+    {
+        return 1;
+    }
+
+    rewind(from);
+    char buffer[4096];
+    size_t size;
+    while ((size = fread(buffer, 1, sizeof(buffer), from)) > 0)
+    {
+        fwrite(buffer, 1, size, to);
+    }
+
+    return !ferror(from);
+}
+
+/**
+ * Redirects the streams of a job to temporary files, unless they already are.
+ *
+ * @param job The job.
+ *
+ * @return 1 if the streams of the job are temporary files, 0 if they cannot be created.
+ */
+static int bufferJobStreams(CompileJob *const job)
+{
+    if (job->out != stdout)
+    {
+        return 1;
+    }
+
+    FILE *out = tmpfile();
+    FILE *err = tmpfile();
+    if (out == NULL || err == NULL)
+    {
+        if (out != NULL)
+        {
+            fclose(out);
+        }
+        if (err != NULL)
+        {
+            fclose(err);
+        }
+        return 0;
+    }
+    job->out = out;
+    job->err = err;
+
+    return 1;
+}
+
+/**
+ * Writes the output of a finished job.
+ *
+ * The tokens are written if only lexing is requested, or the AST is benchmarked, serialized,
+ * converted or written as the flags request.
+ *
+ * @param job The finished job.
+ *
+ * @param stream The stream the tokens or the AST are written to when there is no `-o` file.
+ *
+ * @return 1 if the job and its output succeeded, 0 otherwise.
+ */
+static int writeJobOutput(CompileJob *const job, FILE *const stream)
+{
+    if (!job->success)
+    {
+        return 0;
+    }
+
+    //If only lexing is requested, write the tokens
+    const Flags *flags = job->flags;
+    if (flags->onlyLex)
+    {
+        return writeOutput(flags, stream, job->tokens, job->tokenCount, NULL);
+    }
+
+    if (flags->syntaxOnly)
+    {
+        return 1;
+    }
+
+    //Benchmark the tree walks if requested
+    if (flags->benchASTWalk)
+    {
+        benchmarkASTWalk(job->root);
+    }
+
+    //Serialize the AST instead of printing it if requested
+    if (flags->emitASTFile != NULL)
+    {
+        FlatAST *flatAST = createFlatAST(job->root);
+        int success = flatAST != NULL && writeCastFile(flags->emitASTFile, flatAST);
+        deleteFlatAST(flatAST);
+        return success;
+    }
+
+    //Convert the AST to its compact form and free the parser's nodes
+    if (flags->compactAST)
+    {
+        CompactAST *compactAST = createCompactAST(job->root);
+        deleteASTArena(job->arena);
+        job->arena = NULL;
+        job->root = NULL;
+        if (compactAST == NULL)
+        {
+            return 0;
+        }
+
+        //Write the AST
+        FILE *output = openOutput(flags, stream);
+        int success = output != NULL && dumpCompactAST(compactAST, flags->dumpFormat, output);
+        deleteCompactAST(compactAST);
+        return output != NULL && closeOutput(flags, stream, output, success);
+    }
+
+    //Print the AST
+    //TODO:
+    //Do things with the AST
+    return writeOutput(flags, stream, job->tokens, job->tokenCount, job->root);
+}
+
+/**
+ * Writes the results of a finished job.
+ *
+ * The buffered messages of the job are copied to the standard streams, followed by its output.
+ * The output of a job whose outcome is cached is written behind the errors in its buffered
+ * stream first, so the whole outcome can be stored. This runs on the main thread in
+ * command-line order.
+ *
+ * @param job The finished job.
+ *
+ * @return 1 if the job and its output succeeded, 0 otherwise.
+ */
+static int finishCompileJob(CompileJob *const job)
+{
+    int success = job->storeResult ? writeJobOutput(job, job->out) : 0;
+
+    if (!copyJobStream(job->err, stderr) || !copyJobStream(job->out, stdout))
+    {
+        fprintf(stderr, "Failed to read the messages of %s!\n", job->fileName);
+    }
+
+    return job->storeResult ? success : writeJobOutput(job, stdout);
+}
+
+/**
+ * Frees everything a job holds: its file contents, tokens, AST and temporary streams.
+ * The tokens a job borrowed from the file cache are left to the cache.
+ *
+ * @param job The job to free. The `CompileJob` itself is owned by the caller.
+ */
+static void freeCompileJob(CompileJob *const job)
+{
+    if (job->fileContents != NULL)
+    {
+        freeFileContent(job->fileContents);
+    }
+    deleteASTArena(job->arena);
+    if (job->tokens != NULL && job->cached == NULL)
+    {
+        deleteTokens(job->tokens, job->tokenCount);
+    }
+    free(job->cachePath);
+    deleteCachedResult(job->result);
+
+    if (job->out != NULL && job->out != stdout)
+    {
+        fclose(job->out);
+    }
+    if (job->err != NULL && job->err != stderr)
+    {
+        fclose(job->err);
+    }
+
+    memset(job, 0, sizeof(CompileJob));
+}
+
+/**
+ * Visits every node of a pointer based Abstract Syntax Tree (AST) recursively.
+ *
+ * @param astNode The root of the tree to walk.
+ *
+ * @return A checksum of the node types and token counts, so the walk cannot be optimized away.
+ */
+static size_t walkASTNode(const ASTNode *const astNode)
+{
+    if (astNode == NULL)
+    {
+        return 0;
+    }
+
+    size_t sum = astNode->type + astNode->tokenCount;
+    for (size_t i = 0; i < astNode->childCount; i++)
+    {
+        sum += walkASTNode(astNode->children[i]);
+    }
+
+    return sum;
+}
+
+/**
+ * Adds a visited node to the checksum of `walkASTNode`, for the `walkAST` based walk.
+ *
+ * @param astNode The visited node.
+ *
+ * @param depth Unused.
+ *
+ * @param context A pointer to the `size_t` checksum.
+ *
+ * @return Always `AST_VISIT_CONTINUE`.
+ */
+static ASTVisitAction sumVisitedASTNode(ASTNode *const astNode, const size_t depth, void *const context)
+{
+    (void)depth;
+    *(size_t *)context += astNode->type + astNode->tokenCount;
+    return AST_VISIT_CONTINUE;
+}
+
+/**
+ * Visits every node of a `FlatAST` with a single forward scan.
+ *
+ * @param ast The tree to walk.
+ *
+ * @return The same checksum as `walkASTNode` on the tree the `FlatAST` was created from.
+ */
+static size_t walkFlatAST(const FlatAST *const ast)
+{
+    size_t sum = 0;
+    for (size_t i = 0; i < ast->nodeCount; i++)
+    {
+        const FlatNode *node = &ast->nodes[i];
+        if (!(node->flags & FLAT_NODE_MISSING))
+        {
+            sum += node->type + node->tokenCount;
+        }
+    }
+
+    return sum;
+}
+
+/**
+ * Visits every node of a `FlatAST` recursively, moving between siblings by skipping subtrees.
+ *
+ * @param ast The tree to walk.
+ *
+ * @param index The index of the node to start from.
+ *
+ * @return The same checksum as `walkASTNode` on the tree the `FlatAST` was created from.
+ */
+static size_t walkFlatNode(const FlatAST *const ast, const size_t index)
+{
+    const FlatNode *node = &ast->nodes[index];
+    if (node->flags & FLAT_NODE_MISSING)
+    {
+        return 0;
+    }
+
+    size_t sum = node->type + node->tokenCount;
+    size_t child = FLAT_FIRST_CHILD(index);
+    for (size_t i = 0; i < node->childCount; i++)
+    {
+        sum += walkFlatNode(ast, child);
+        child = FLAT_NEXT_SIBLING(ast, child);
+    }
+
+    return sum;
+}
+
+/**
+ * Checks whether two Abstract Syntax Trees (ASTs) have the same shape, types and tokens.
+ *
+ * @param first The root of the first tree.
+ *
+ * @param second The root of the second tree.
+ *
+ * @return 1 if the trees are the same, 0 otherwise.
+ */
+static int isSameASTNode(const ASTNode *const first, const ASTNode *const second)
+{
+    if (first == NULL || second == NULL)
+    {
+        return first == second;
+    }
+
+    if (first->type != second->type || first->tokenCount != second->tokenCount || first->childCount != second->childCount)
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < first->tokenCount; i++)
+    {
+        if (first->tokens[i] != second->tokens[i])
+        {
+            return 0;
+        }
+    }
+
+    for (size_t i = 0; i < first->childCount; i++)
+    {
+        if (!isSameASTNode(first->children[i], second->children[i]))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * Benchmarks walking an Abstract Syntax Tree (AST) in its pointer based and in its flat form.
+ *
+ * The function encodes the tree into a `FlatAST`, checks that decoding it gives back the same
+ * tree, then times `BENCH_WALK_REPEATS` full walks of each form and prints the results to `stderr`.
+ *
+ * @param root The root of the tree to benchmark.
+ */
+static void benchmarkASTWalk(const ASTNode *const root)
+{
+    clock_t start = clock();
+    FlatAST *flatAST = createFlatAST(root);
+    clock_t end = clock();
+    if (flatAST == NULL)
+    {
+        fprintf(stderr, "Failed to create Flat AST.\n");
+        return;
+    }
+    fprintf(stderr, "AST walk benchmark: %zu nodes, %d walks each\n", flatAST->nodeCount, BENCH_WALK_REPEATS);
+    fprintf(stderr, "  flatten:           %10.3f ms\n", 1000.0 * (end - start) / CLOCKS_PER_SEC);
+
+    //Check the round trip
+    ASTArena *arena = createASTArena(BENCH_ARENA_BLOCK_SIZE);
+    ASTNode *expanded = arena == NULL ? NULL : expandFlatAST(flatAST, arena);
+    fprintf(stderr, "  round trip:        %s\n", isSameASTNode(root, expanded) ? "identical" : "DIFFERENT");
+    deleteASTArena(arena);
+
+    size_t pointerSum = 0;
+    start = clock();
+    for (int i = 0; i < BENCH_WALK_REPEATS; i++)
+    {
+        pointerSum += walkASTNode(root);
+    }
+    end = clock();
+    fprintf(stderr, "  pointer walk:      %10.3f ms\n", 1000.0 * (end - start) / CLOCKS_PER_SEC);
+
+    ASTVisitor visitor = {0};
+    visitor.enterAny = sumVisitedASTNode;
+    visitor.prefetch = 1;
+    size_t visitorSum = 0;
+    start = clock();
+    for (int i = 0; i < BENCH_WALK_REPEATS; i++)
+    {
+        walkAST((ASTNode *)root, &visitor, &visitorSum);
+    }
+    end = clock();
+    fprintf(stderr, "  visitor walk:      %10.3f ms\n", 1000.0 * (end - start) / CLOCKS_PER_SEC);
+
+    size_t scanSum = 0;
+    start = clock();
+    for (int i = 0; i < BENCH_WALK_REPEATS; i++)
+    {
+        scanSum += walkFlatAST(flatAST);
+    }
+    end = clock();
+    fprintf(stderr, "  flat scan:         %10.3f ms\n", 1000.0 * (end - start) / CLOCKS_PER_SEC);
+
+    size_t flatSum = 0;
+    start = clock();
+    for (int i = 0; i < BENCH_WALK_REPEATS; i++)
+    {
+        flatSum += walkFlatNode(flatAST, 0);
+    }
+    end = clock();
+    fprintf(stderr, "  flat sibling walk: %10.3f ms\n", 1000.0 * (end - start) / CLOCKS_PER_SEC);
+
+    if (pointerSum != visitorSum || pointerSum != scanSum || pointerSum != flatSum)
+    {
+        fprintf(stderr, "  checksums differ: %zu %zu %zu %zu\n", pointerSum, visitorSum, scanSum, flatSum);
+    }
+
+    deleteFlatAST(flatAST);
+}
+
+/**
+ * Opens the output of a compilation: the file given with `-o`, or `stream` if there is none.
+ *
+ * @param flags  The command-line flags, which select the output file.
+ *
+ * @param stream The stream to write to without an output file.
+ *
+ * @return The stream to write to, or NULL if the output file cannot be opened.
+ */
+static FILE *openOutput(const Flags *const flags, FILE *const stream)
+{
+    if (!flags->isOutputFile)
+    {
+        return stream;
+    }
+
+    FILE *output = fopen(flags->outputFile, "w");
+    if (output == NULL)
+    {
+        fprintf(stderr, "Error opening output file %s!\n", flags->outputFile);
+    }
+    return output;
+}
+
+/**
+ * Closes the output opened with `openOutput`.
+ *
+ * @param flags   The command-line flags, which select the output file.
+ *
+ * @param stream  The stream given to `openOutput`, which is left open.
+ *
+ * @param output  The stream returned by `openOutput`.
+ *
+ * @param success Whether writing the output succeeded.
+ *
+ * @return `success`, or 0 if the output file cannot be written.
+ */
+static int closeOutput(const Flags *const flags, FILE *const stream, FILE *const output, int success)
+{
+    if (output != stream && fclose(output) != 0)
+    {
+        fprintf(stderr, "Error writing output file %s!\n", flags->outputFile);
+        success = 0;
+    }
+    return success;
+}
+
+/**
+ * Writes the tokens or the Abstract Syntax Tree (AST) in the requested dump format.
+ *
+ * The output goes to the file given with `-o`, or to `stream` if there is none.
+ *
+ * @param flags      The command-line flags, which select the format and the output file.
+ *
+ * @param stream     The stream to write to without an output file.
+ *
+ * @param tokens     The tokens to write if `root` is NULL.
+ *
+ * @param tokenCount The number of tokens.
+ *
+ * @param root       The root of the AST to write, or NULL to write the tokens instead.
+ *
+ * @return 1 on success, 0 if the output file cannot be opened or writing fails.
+ */
+static int writeOutput(const Flags *const flags, FILE *const stream, Token **tokens, size_t tokenCount, const ASTNode *const root)
+{
+    FILE *output = openOutput(flags, stream);
+    if (output == NULL)
+    {
+        return 0;
+    }
+
+    int success = root == NULL ? dumpTokens(tokens, tokenCount, flags->dumpFormat, output) : dumpAST(root, flags->dumpFormat, output);
+    return closeOutput(flags, stream, output, success);
+}
+
+/**
+ * Reads the file of a job, or takes its contents from the file cache of a compile server.
+ *
+ * With a cache, the file is looked up by its absolute path, modification time, size and start
+ * location. On a hit the job borrows the cached tokens and skips lexing. On a miss the file is
+ * read and the job remembers the keys, so the lexed file can be cached once the job is done.
+ *
+ * @param job The job of the file. Its `fileName` must be set.
+ *
+ * @param cache The file cache, or NULL.
+ *
+ * @param fileStart The location the file will start at.
+ *
+ * @return The contents of the file, owned by the job or the cache, or NULL if it cannot be read.
+ */
+static const char *readJobFile(CompileJob *const job, FileCache *const cache, const SourceLoc fileStart)
+{
+    struct stat fileStat;
+    if (cache != NULL && stat(job->fileName, &fileStat) == 0)
+    {
+        job->cachePath = realpath(job->fileName, NULL);
+        job->modifiedTime = (int64_t)fileStat.st_mtime;
+        job->fileSize = (size_t)fileStat.st_size;
+        job->cached = findFileCacheEntry(cache, job->cachePath, job->modifiedTime, job->fileSize, fileStart);
+        if (job->cached != NULL)
+        {
+            free(job->cachePath);
+            job->cachePath = NULL;
+            return job->cached->contents;
+        }
+    }
+
+    job->fileContents = readFromFile((char *)job->fileName, stderr);
+    return job->fileContents;
+}
+
+/**
+ * Checks whether the outcome of a compilation can be cached: everything it writes must go to the
+ * streams of its job. Output files and benchmarks are not cached, and neither is the compact
+ * tree, which is requested to measure the conversion.
+ *
+ * @param flags The command-line flags.
+ *
+ * @return 1 if the outcome can be cached, 0 otherwise.
+ */
+static int isResultCacheable(const Flags *const flags)
+{
+    return !flags->isOutputFile && flags->emitASTFile == NULL && !flags->benchASTWalk && !flags->compactAST;
+}
+
+/**
+ * Starts the result cache keys of a compilation with everything but the input file: the version
+ * and the build of the compiler, and every flag the outcome of a file depends on.
+ *
+ * @param hasher The hasher to seed.
+ *
+ * @param flags The command-line flags.
+ *
+ * @param programName The name the compiler was started with, to find its executable.
+ */
+static void seedResultHasher(ResultHasher *const hasher, const Flags *const flags, const char *const programName)
+{
+    initResultHasher(hasher);
+    updateResultHasherString(hasher, COMPILER_VERSION);
+
+    //Any rebuild of the compiler changes the size or the modification time of its executable
+    struct stat executable;
+    if (stat("/proc/self/exe", &executable) == 0 || stat(programName, &executable) == 0)
+    {
+        int64_t modifiedTime = (int64_t)executable.st_mtime;
+        int64_t size = (int64_t)executable.st_size;
+        updateResultHasher(hasher, &modifiedTime, sizeof(modifiedTime));
+        updateResultHasher(hasher, &size, sizeof(size));
+    }
+
+    int options[] = {
+        flags->onlyLex, flags->noLink, flags->warnAll, flags->warnErrors, flags->debugInfo,
+        flags->optimization, flags->parseStats, flags->syntaxOnly, flags->verboseAST,
+        flags->shareSpecifiers, (int)flags->dumpFormat,
+    };
+    updateResultHasher(hasher, options, sizeof(options));
+
+    uint64_t errorLimit = flags->errorLimit;
+    updateResultHasher(hasher, &errorLimit, sizeof(errorLimit));
+
+    uint64_t headerCount = flags->headerCount;
+    updateResultHasher(hasher, &headerCount, sizeof(headerCount));
+    for (size_t i = 0; i < flags->headerCount; i++)
+    {
+        updateResultHasherString(hasher, flags->headerFiles[i]);
+    }
+}
+
+/**
+ * Looks up the outcome of a job in the result cache.
+ *
+ * The key adds the name of the file, which appears in the errors, and its contents to the seed.
+ * On a miss the streams of the job are buffered so its outcome can be stored once it is done.
+ *
+ * @param job The job.
+ *
+ * @param cache The result cache.
+ *
+ * @param seed The hasher seeded with `seedResultHasher`.
+ *
+ * @param contents The contents of the file of the job.
+ *
+ * @return 1 if the outcome was found and stored in the job, 0 otherwise.
+ */
+static int findJobResult(CompileJob *const job, ResultCache *const cache, const ResultHasher *const seed, const char *const contents)
+{
+    ResultHasher hasher = *seed;
+    updateResultHasherString(&hasher, job->fileName);
+    updateResultHasherString(&hasher, contents);
+    job->resultKey = finishResultHasher(&hasher);
+
+    job->result = findCachedResult(cache, &job->resultKey);
+    if (job->result != NULL)
+    {
+        return 1;
+    }
+
+    job->storeResult = bufferJobStreams(job);
+    return 0;
+}
+
+/**
+ * Compiles the files of the parsed command-line flags.
+ *
+ * Prints the help or a serialized AST if requested. Otherwise every file is lexed and parsed as
+ * its own `CompileJob`, on a thread pool when there are several files, and the results are
+ * written in command-line order. With `--cache-dir`, files whose outcome is in the result cache
+ * are not compiled, their cached messages and output are written instead.
+ *
+ * @param programName The name the compiler was started with, for the result cache keys.
+ *
+ * @param flags The parsed flags. They are freed by the function.
+ *
+ * @param cache The file cache of a compile server, or NULL.
+ *
+ * @return 0 on success, -1 if any file failed.
+ */
+static int runCompilation(const char *const programName, Flags *const flags, FileCache *const cache)
+{
+    //Handle arguments
+    if (flags->help)
+    {
+        printHelp();
+        freeFlags(flags);
+        return 0;
+    }
+
+    //If a serialized AST is given, write it without lexing or parsing
+    if (flags->loadASTFile != NULL)
+    {
+        CastFile *castFile = openCastFile(flags->loadASTFile);
+        FILE *output = castFile != NULL ? openOutput(flags, stdout) : NULL;
+        int success = output != NULL && dumpCastFile(castFile, flags->dumpFormat, output);
+        success = output != NULL && closeOutput(flags, stdout, output, success);
+        closeCastFile(castFile);
+        freeFlags(flags);
+        return success ? 0 : -1;
+    }
+
+    SourceManager *sources = createSourceManager();
+    CompileJob *jobs = calloc(flags->fileCount, sizeof(CompileJob));
+    if (sources == NULL || jobs == NULL)
+    {
+        fprintf(stderr, "Failed to set up the compilation.\n");
+        deleteSourceManager(sources);
+        free(jobs);
+        freeFlags(flags);
+        return -1;
+    }
+
+    TimeReport timeReport = {0};
+    double startTime = getMonotonicTime();
+    //The trace starts first, so the span of the whole compilation starts at its origin
+    if (flags->traceFile != NULL)
+    {
+        startTrace();
+    }
+    uint64_t traceStart = getTraceTime();
+    int perfCounters = flags->perfCounters && enablePerfCounters(stderr);
+    if (flags->memReport)
+    {
+        startMemoryProfile();
+    }
+
+    //Reuse the outcomes of earlier compilations if requested
+    ResultCache *resultCache = flags->resultCacheDir != NULL ? createResultCache(flags->resultCacheDir, flags->resultCacheSize) : NULL;
+    ResultHasher resultSeed;
+    int cacheResults = resultCache != NULL && isResultCacheable(flags);
+    if (cacheResults)
+    {
+        seedResultHasher(&resultSeed, flags, programName);
+    }
+
+    //Read the files, give every file its own range of source locations and its own job
+    size_t runnableCount = 0;
+    for (size_t i = 0; i < flags->fileCount; i++)
+    {
+        jobs[i].flags = flags;
+        jobs[i].fileName = flags->files[i];
+        jobs[i].sources = sources;
+        jobs[i].out = stdout;
+        jobs[i].err = stderr;
+
+        PhaseTimer timer;
+        startPhaseTimer(&timer);
+        const char *contents = readJobFile(&jobs[i], cache, sources->nextStart);
+        stopPhaseTimer(&timer, &jobs[i].timeReport, PHASE_READ);
+        if (contents == NULL || (cacheResults && findJobResult(&jobs[i], resultCache, &resultSeed, contents)))
+        {
+            jobs[i].fileStart = SOURCE_LOC_INVALID;
+            continue;
+        }
+
+        jobs[i].fileStart = addSourceFile(sources, flags->files[i], contents);
+        if (jobs[i].fileStart == SOURCE_LOC_INVALID)
+        {
+            fprintf(stderr, "Failed to register the source file %s.\n", flags->files[i]);
+            continue;
+        }
+        runnableCount++;
+    }
+
+    //Lex and parse the files on the workers, their messages are buffered until their turn
+    size_t threadCount = flags->jobCount < runnableCount ? flags->jobCount : runnableCount;
+    ThreadPool *pool = threadCount > 1 ? createThreadPool(threadCount) : NULL;
+    size_t *tasks = malloc(flags->fileCount * sizeof(size_t));
+    for (size_t i = 0; tasks != NULL && i < flags->fileCount; i++)
+    {
+        tasks[i] = THREAD_POOL_INVALID_TASK;
+        if (pool == NULL || jobs[i].fileStart == SOURCE_LOC_INVALID)
+        {
+            continue;
+        }
+
+        //A job that cannot be queued runs in place, its messages stay buffered
+        if (bufferJobStreams(&jobs[i]))
+        {
+            tasks[i] = submitThreadPoolTask(pool, runCompileJob, &jobs[i]);
+        }
+    }
+
+    //Write the results in command-line order, running the jobs that were not queued in place
+    int success = 1;
+    for (size_t i = 0; i < flags->fileCount; i++)
+    {
+        //Replay a cached outcome instead of compiling the file
+        if (jobs[i].result != NULL)
+        {
+            fwrite(jobs[i].result->err, 1, jobs[i].result->errSize, stderr);
+            fwrite(jobs[i].result->out, 1, jobs[i].result->outSize, stdout);
+            if (!jobs[i].result->success)
+            {
+                success = 0;
+            }
+            mergeTimeReport(&timeReport, &jobs[i].timeReport);
+            freeCompileJob(&jobs[i]);
+            continue;
+        }
+
+        if (tasks != NULL && tasks[i] != THREAD_POOL_INVALID_TASK)
+        {
+            waitThreadPoolTask(pool, tasks[i]);
+        }
+        else if (jobs[i].fileStart != SOURCE_LOC_INVALID)
+        {
+            runCompileJob(&jobs[i]);
+        }
+
+        PhaseTimer timer;
+        startPhaseTimer(&timer);
+        int jobSuccess = finishCompileJob(&jobs[i]);
+        stopPhaseTimer(&timer, &jobs[i].timeReport, PHASE_OUTPUT);
+        if (!jobSuccess)
+        {
+            success = 0;
+        }
+
+        if (jobs[i].storeResult)
+        {
+            storeCachedResult(resultCache, &jobs[i].resultKey, jobSuccess, jobs[i].err, jobs[i].out);
+        }
+
+        //Keep the lexed file for the next compilation on a compile server
+        if (jobs[i].cachePath != NULL && jobs[i].lexed && addFileCacheEntry(cache, jobs[i].cachePath, jobs[i].modifiedTime, jobs[i].fileSize, jobs[i].fileStart, jobs[i].fileContents, jobs[i].tokens, jobs[i].tokenCount))
+        {
+            jobs[i].fileContents = NULL;
+            jobs[i].tokens = NULL;
+        }
+        mergeTimeReport(&timeReport, &jobs[i].timeReport);
+        freeCompileJob(&jobs[i]);
+    }
+    unpinFileCache(cache);
+
+    //Keep the result cache within its size limit
+    if (resultCache != NULL && (resultCache->stores > 0 || flags->cacheStats))
+    {
+        trimResultCache(resultCache);
+    }
+    if (resultCache != NULL && flags->cacheStats)
+    {
+        printResultCacheStats(resultCache, stderr);
+    }
+    deleteResultCache(resultCache);
+
+    //Without hardware counters the phase times are reported in their place
+    if (flags->timeReport || (flags->perfCounters && !perfCounters))
+    {
+        printTimeReport(&timeReport, flags->fileCount, getMonotonicTime() - startTime, stderr);
+    }
+    if (perfCounters)
+    {
+        printPerfCounterReport(&timeReport, stderr);
+    }
+
+    //Free memory, the workers are stopped before the trace is written
+    deleteThreadPool(pool);
+    disablePerfCounters();
+    if (flags->memReport)
+    {
+        MemoryReport memoryReport;
+        stopMemoryProfile(&memoryReport);
+        printMemoryReport(&memoryReport, stderr);
+    }
+    if (flags->traceFile != NULL)
+    {
+        recordTraceSpan("compilation", "compilation", traceStart, getTraceTime(), NULL, (int64_t)flags->fileCount);
+        writeTrace(flags->traceFile);
+    }
+    free(tasks);
+    free(jobs);
+    deleteSourceManager(sources);
+    freeFlags(flags);
+    return success ? 0 : -1;
+}
+
+/**
+ * Compiles a request of a compile server client, or the arguments of a client that found no server.
+ * Used as a `CompileRequestHandler`.
+ *
+ * @param argc The number of arguments.
+ *
+ * @param argv The arguments, `argv[0]` is the name of the program.
+ *
+ * @param context The `FileCache` of the server, or NULL.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+static int handleCompileRequest(int argc, char **argv, void *const context)
+{
+    Flags *flags = parseArgs(argc, argv);
+    if (flags == NULL)
+    {
+        return -1;
+    }
+
+    if (flags->serverSocket != NULL)
+    {
+        fprintf(stderr, "A compile request cannot start a compile server!\n");
+        freeFlags(flags);
+        return -1;
+    }
+
+    if (flags->batchFile != NULL)
+    {
+        return runBatch(argc, argv, flags);
+    }
+
+    return runCompilation(argv[0], flags, context);
+}
+
+/**
+ * Reads the messages a job buffered in a temporary file into memory.
+ *
+ * @param stream The temporary file of the job.
+ *
+ * @param size Set to the number of bytes read.
+ *
+ * @return The messages, or NULL if there are none or reading fails. The caller frees them.
+ */
+static char *readJobStream(FILE *const stream, size_t *const size)
+{
+    *size = 0;
+    if (stream == NULL || stream == stdout || stream == stderr || fseek(stream, 0, SEEK_END) != 0)
+    {
+        return NULL;
+    }
+
+    long length = ftell(stream);
+    if (length <= 0)
+    {
+        return NULL;
+    }
+
+    char *data = malloc((size_t)length);
+    rewind(stream);
+    if (data == NULL || fread(data, 1, (size_t)length, stream) != (size_t)length)
+    {
+        free(data);
+        return NULL;
+    }
+
+    *size = (size_t)length;
+    return data;
+}
+
+/**
+ * Splits a line of a batch manifest into its arguments in place.
+ *
+ * Arguments are separated by whitespace, an argument in double quotes may contain whitespace,
+ * and everything after a `#` that starts an argument is a comment.
+ *
+ * @param line The line. Its separators are overwritten with zeros.
+ *
+ * @param arguments Filled with the arguments, at least `strlen(line) / 2 + 1` long.
+ *
+ * @return The number of arguments.
+ */
+static size_t splitManifestLine(char *line, char **arguments)
+{
+    size_t count = 0;
+    char *c = line;
+    while (*c != '\0')
+    {
+        while (*c == ' ' || *c == '\t' || *c == '\r')
+        {
+            c++;
+        }
+        if (*c == '\0' || *c == '#')
+        {
+            break;
+        }
+
+        char end = ' ';
+        if (*c == '"')
+        {
+            end = '"';
+            c++;
+        }
+        arguments[count++] = c;
+        while (*c != '\0' && (end == '"' ? *c != '"' : (*c != ' ' && *c != '\t' && *c != '\r')))
+        {
+            c++;
+        }
+        if (*c != '\0')
+        {
+            *c++ = '\0';
+        }
+    }
+
+    return count;
+}
+
+/**
+ * Parses the flags of a line of a batch manifest: the command-line flags followed by the options
+ * of the line, without the `--batch` option.
+ *
+ * @param argc The number of command-line arguments.
+ *
+ * @param argv The command-line arguments.
+ *
+ * @param line The line, split in place. The flags point into it, so it must outlive them.
+ *
+ * @param lineNumber The number of the line, for the error messages.
+ *
+ * @param manifest The name of the manifest, for the error messages.
+ *
+ * @param flags Set to the flags of the line, or NULL for an empty line or a comment.
+ *
+ * @return 1 on success, 0 with an error message if the options are invalid or do not name
+ *         exactly one file.
+ */
+static int parseManifestLine(int argc, char **argv, char *line, const size_t lineNumber, const char *const manifest, Flags **flags)
+{
+    *flags = NULL;
+    char **arguments = malloc((argc + strlen(line) / 2 + 2) * sizeof(char *));
+    if (arguments == NULL)
+    {
+        fprintf(stderr, "Memory allocation for the arguments of line %zu of %s failed!\n", lineNumber, manifest);
+        return 0;
+    }
+
+    //The command-line arguments without --batch come first, so the line can add to them
+    size_t count = 0;
+    for (int i = 0; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--batch") == 0)
+        {
+            i++;
+            continue;
+        }
+        arguments[count++] = argv[i];
+    }
+    size_t lineCount = splitManifestLine(line, arguments + count);
+    if (lineCount == 0)
+    {
+        free(arguments);
+        return 1;
+    }
+    count += lineCount;
+    arguments[count] = NULL;
+
+    Flags *lineFlags = parseArgs((int)count, arguments);
+    free(arguments);
+    if (lineFlags == NULL)
+    {
+        fprintf(stderr, "Invalid options on line %zu of %s!\n", lineNumber, manifest);
+        return 0;
+    }
+
+    //The results of a batch are buffered per file, so nothing may print directly
+    if (lineFlags->fileCount != 1 || lineFlags->help || lineFlags->loadASTFile != NULL || lineFlags->serverSocket != NULL
+        || lineFlags->batchFile != NULL || lineFlags->compactAST || lineFlags->benchASTWalk
+        || lineFlags->timeReport || lineFlags->perfCounters || lineFlags->memReport)
+    {
+        fprintf(stderr, "Line %zu of %s must name one file and no -h, -load-ast, --server, --batch, --compact-ast, --bench-ast-walk, -ftime-report, --perf-counters or --mem-report!\n", lineNumber, manifest);
+        freeFlags(lineFlags);
+        return 0;
+    }
+
+    *flags = lineFlags;
+    return 1;
+}
+
+/**
+ * Orders the files of a batch from the largest to the smallest. Used with `qsort`.
+ *
+ * @param first A pointer to the first `BatchEntry` pointer.
+ *
+ * @param second A pointer to the second `BatchEntry` pointer.
+ *
+ * @return A negative number if the first file is larger, a positive one if it is smaller,
+ *         and the order of their lines for files of the same size.
+ */
+static int compareBatchEntries(const void *first, const void *second)
+{
+    const BatchEntry *a = *(BatchEntry *const *)first;
+    const BatchEntry *b = *(BatchEntry *const *)second;
+    if (a->fileSize != b->fileSize)
+    {
+        return a->fileSize > b->fileSize ? -1 : 1;
+    }
+
+    return a->line < b->line ? -1 : (a->line > b->line);
+}
+
+/**
+ * Compiles a file of a batch. Used as a `ThreadPoolFunction`.
+ *
+ * The file gets its own source manager and its own job, whose messages and output are buffered
+ * and kept by `keepBatchResult`. Everything else the job holds is freed before the function returns.
+ *
+ * @param argument The `BatchEntry` to compile. Its results are set.
+ */
+static void runBatchEntry(void *const argument)
+{
+    BatchEntry *entry = argument;
+    double start = getMonotonicTime();
+
+    CompileJob job;
+    memset(&job, 0, sizeof(CompileJob));
+    job.flags = entry->flags;
+    job.fileName = entry->fileName;
+    job.out = stdout;
+    job.err = stderr;
+
+    SourceManager *sources = createSourceManager();
+    if (sources == NULL || !bufferJobStreams(&job))
+    {
+        fprintf(stderr, "Failed to set up the compilation of %s.\n", entry->fileName);
+        deleteSourceManager(sources);
+        entry->success = 0;
+        entry->time = getMonotonicTime() - start;
+        return;
+    }
+    job.sources = sources;
+
+    job.fileContents = readFromFile((char *)entry->fileName, job.err);
+    job.fileStart = job.fileContents != NULL ? addSourceFile(sources, entry->fileName, job.fileContents) : SOURCE_LOC_INVALID;
+    if (job.fileContents != NULL && job.fileStart == SOURCE_LOC_INVALID)
+    {
+        fprintf(job.err, "Failed to register the source file %s.\n", entry->fileName);
+    }
+
+    if (job.fileStart == SOURCE_LOC_INVALID)
+    {
+        entry->success = 0;
+    }
+    else
+    {
+        runCompileJob(&job);
+        entry->success = writeJobOutput(&job, job.out);
+    }
+
+    entry->err = readJobStream(job.err, &entry->errSize);
+    entry->out = readJobStream(job.out, &entry->outSize);
+    freeCompileJob(&job);
+    deleteSourceManager(sources);
+    keepBatchResult(entry);
+
+    entry->time = getMonotonicTime() - start;
+}
+
+/**
+ * Keeps the messages and the output of a finished file of a batch until the main thread writes
+ * them. They stay in memory while the unwritten results of the batch fit in the memory limit of
+ * its spill, and are moved to the spill file otherwise. If the spill file cannot be written,
+ * they stay in memory.
+ *
+ * @param entry The finished file.
+ */
+static void keepBatchResult(BatchEntry *const entry)
+{
+    BatchSpill *spill = entry->spill;
+    size_t size = entry->errSize + entry->outSize;
+    pthread_mutex_lock(&spill->lock);
+    if (spill->buffered + size > spill->limit)
+    {
+        if (spill->file == NULL)
+        {
+            spill->file = tmpfile();
+        }
+
+        long offset = spill->file != NULL && fseek(spill->file, 0, SEEK_END) == 0 ? ftell(spill->file) : -1;
+        if (offset >= 0
+            && (entry->errSize == 0 || fwrite(entry->err, 1, entry->errSize, spill->file) == entry->errSize)
+            && (entry->outSize == 0 || fwrite(entry->out, 1, entry->outSize, spill->file) == entry->outSize))
+        {
+            free(entry->err);
+            free(entry->out);
+            entry->err = NULL;
+            entry->out = NULL;
+            entry->spillOffset = offset;
+        }
+    }
+    if (entry->spillOffset < 0)
+    {
+        spill->buffered += size;
+    }
+    pthread_mutex_unlock(&spill->lock);
+}
+
+/**
+ * Copies part of the spill file of a batch to a standard stream, from its current position.
+ *
+ * @param from The spill file.
+ *
+ * @param size The number of bytes to copy.
+ *
+ * @param to The standard stream to copy to.
+ *
+ * @return 1 on success, 0 if reading the spill file fails.
+ */
+static int copySpilledStream(FILE *const from, size_t size, FILE *const to)
+{
+    char buffer[4096];
+    while (size > 0)
+    {
+        size_t chunk = size < sizeof(buffer) ? size : sizeof(buffer);
+        if (fread(buffer, 1, chunk, from) != chunk)
+        {
+            return 0;
+        }
+        fwrite(buffer, 1, chunk, to);
+        size -= chunk;
+    }
+
+    return 1;
+}
+
+/**
+ * Writes the messages and the output of a finished file of a batch to the standard streams,
+ * from memory or from the spill file, and releases them.
+ *
+ * @param entry The finished file. Its success is cleared if its spilled results cannot be read.
+ */
+static void writeBatchResult(BatchEntry *const entry)
+{
+    BatchSpill *spill = entry->spill;
+    pthread_mutex_lock(&spill->lock);
+    if (entry->spillOffset >= 0)
+    {
+        //Workers append to the spill file, so its position is only moved under the lock
+        if (fseek(spill->file, entry->spillOffset, SEEK_SET) != 0
+            || !copySpilledStream(spill->file, entry->errSize, stderr)
+            || !copySpilledStream(spill->file, entry->outSize, stdout))
+        {
+            fprintf(stderr, "Failed to read the results of %s back!\n", entry->fileName);
+            entry->success = 0;
+        }
+    }
+    else
+    {
+        if (entry->err != NULL)
+        {
+            fwrite(entry->err, 1, entry->errSize, stderr);
+        }
+        if (entry->out != NULL)
+        {
+            fwrite(entry->out, 1, entry->outSize, stdout);
+        }
+        spill->buffered -= entry->errSize + entry->outSize;
+    }
+    pthread_mutex_unlock(&spill->lock);
+
+    free(entry->err);
+    free(entry->out);
+    entry->err = NULL;
+    entry->out = NULL;
+}
+
+/**
+ * Prints the result and the compilation time of every file of a batch in manifest order,
+ * followed by the totals and the throughput of the batch.
+ *
+ * @param entries The files of the batch.
+ *
+ * @param entryCount The number of files.
+ *
+ * @param wallTime The elapsed time of the whole batch in seconds.
+ */
+static void printBatchSummary(const BatchEntry *const entries, const size_t entryCount, const double wallTime)
+{
+    size_t failed = 0;
+    size_t totalSize = 0;
+    fprintf(stderr, "Batch summary:\n");
+    fprintf(stderr, "%-8s %12s %12s  %s\n", "Status", "Time ms", "Bytes", "File");
+    for (size_t i = 0; i < entryCount; i++)
+    {
+        fprintf(stderr, "%-8s %12.3f %12zu  %s\n", entries[i].success ? "ok" : "FAILED", 1000.0 * entries[i].time, entries[i].fileSize, entries[i].fileName);
+        failed += !entries[i].success;
+        totalSize += entries[i].fileSize;
+    }
+
+    double megabytes = totalSize / (1024.0 * 1024.0);
+    fprintf(stderr, "Files: %zu, %zu succeeded, %zu failed\n", entryCount, entryCount - failed, failed);
+    fprintf(stderr, "Total: %.3f MB in %.3f ms, %.3f MB/s, %.1f files/s\n", megabytes, 1000.0 * wallTime,
+            wallTime > 0 ? megabytes / wallTime : 0.0, wallTime > 0 ? entryCount / wallTime : 0.0);
+}
+
+/**
+ * Compiles the files listed in the manifest of `--batch`.
+ *
+ * Every non-empty line of the manifest names a file and the options it is compiled with in
+ * addition to the command-line options. The files are queued on a thread pool of up to `-j`
+ * workers from the largest to the smallest, so a large file does not start last and hold up
+ * the end of the batch, and any idle worker takes the next file. The messages and the output
+ * of every file are written in manifest order, followed by a summary on `stderr`. The results
+ * that finish before the ones above them in the manifest are held in memory up to
+ * `BATCH_MEMORY_LIMIT` bytes, and in a spill file after that.
+ *
+ * @param argc The number of command-line arguments.
+ *
+ * @param argv The command-line arguments.
+ *
+ * @param flags The parsed command-line flags. They are freed by the function.
+ *
+ * @return 0 if every file compiled, -1 otherwise.
+ */
+static int runBatch(int argc, char **argv, Flags *const flags)
+{
+    double start = getMonotonicTime();
+    //The trace starts first, so the span of the whole compilation starts at its origin
+    if (flags->traceFile != NULL)
+    {
+        startTrace();
+    }
+    uint64_t traceStart = getTraceTime();
+    char *manifest = readFromFile(flags->batchFile, stderr);
+    if (manifest == NULL)
+    {
+        freeFlags(flags);
+        return -1;
+    }
+
+    //Parse every line, the flags point into the manifest
+    size_t lineCount = 1;
+    for (const char *c = manifest; *c != '\0'; c++)
+    {
+        lineCount += *c == '\n';
+    }
+    BatchEntry *entries = calloc(lineCount, sizeof(BatchEntry));
+    BatchEntry **order = malloc(lineCount * sizeof(BatchEntry *));
+    if (entries == NULL || order == NULL)
+    {
+        fprintf(stderr, "Memory allocation for the batch failed!\n");
+        free(entries);
+        free(order);
+        free(manifest);
+        freeFlags(flags);
+        return -1;
+    }
+
+    BatchSpill spill;
+    pthread_mutex_init(&spill.lock, NULL);
+    spill.file = NULL;
+    spill.buffered = 0;
+    spill.limit = BATCH_MEMORY_LIMIT;
+
+    size_t entryCount = 0;
+    int valid = 1;
+    char *line = manifest;
+    for (size_t lineNumber = 1; line != NULL; lineNumber++)
+    {
+        char *next = strchr(line, '\n');
+        if (next != NULL)
+        {
+            *next++ = '\0';
+        }
+
+        Flags *lineFlags;
+        if (!parseManifestLine(argc, argv, line, lineNumber, flags->batchFile, &lineFlags))
+        {
+            valid = 0;
+        }
+        else if (lineFlags != NULL)
+        {
+            BatchEntry *entry = &entries[entryCount++];
+            entry->flags = lineFlags;
+            entry->fileName = lineFlags->files[0];
+            entry->line = lineNumber;
+            entry->task = THREAD_POOL_INVALID_TASK;
+            entry->spill = &spill;
+            entry->spillOffset = -1;
+
+            struct stat fileStat;
+            entry->fileSize = stat(entry->fileName, &fileStat) == 0 ? (size_t)fileStat.st_size : 0;
+        }
+        line = next;
+    }
+
+    //Queue the largest files first
+    size_t threadCount = flags->jobCount < entryCount ? flags->jobCount : entryCount;
+    ThreadPool *pool = valid && threadCount > 1 ? createThreadPool(threadCount) : NULL;
+    for (size_t i = 0; i < entryCount; i++)
+    {
+        order[i] = &entries[i];
+    }
+    qsort(order, entryCount, sizeof(BatchEntry *), compareBatchEntries);
+    for (size_t i = 0; pool != NULL && i < entryCount; i++)
+    {
+        order[i]->task = submitThreadPoolTask(pool, runBatchEntry, order[i]);
+    }
+
+    //Write the results in manifest order, compiling the files that were not queued in place
+    int success = valid;
+    for (size_t i = 0; valid && i < entryCount; i++)
+    {
+        if (entries[i].task != THREAD_POOL_INVALID_TASK)
+        {
+            waitThreadPoolTask(pool, entries[i].task);
+        }
+        else
+        {
+            runBatchEntry(&entries[i]);
+        }
+
+        writeBatchResult(&entries[i]);
+        if (!entries[i].success)
+        {
+            success = 0;
+        }
+    }
+    deleteThreadPool(pool);
+    fflush(stdout);
+
+    if (valid)
+    {
+        printBatchSummary(entries, entryCount, getMonotonicTime() - start);
+    }
+
+    //The workers are stopped, so every span is recorded
+    if (flags->traceFile != NULL)
+    {
+        recordTraceSpan("batch", "compilation", traceStart, getTraceTime(), flags->batchFile, (int64_t)entryCount);
+        writeTrace(flags->traceFile);
+    }
+
+    //Free memory
+    for (size_t i = 0; i < entryCount; i++)
+    {
+        freeFlags(entries[i].flags);
+    }
+    if (spill.file != NULL)
+    {
+        fclose(spill.file);
+    }
+    pthread_mutex_destroy(&spill.lock);
+    free(entries);
+    free(order);
+    free(manifest);
+    freeFlags(flags);
+    return success ? 0 : -1;
+}
+
+/*****************************************************************************************************
+                                PUBLIC MY_STRING FUNCTIONS START HERE                                
+ *****************************************************************************************************/
+
+int runVM(int argc, char **argv)
+{
+    //Forward the compilation to a compile server if requested, or compile here if none is running
+    if (argc >= 3 && strcmp(argv[1], "--client") == 0)
+    {
+        const char *socketPath = argv[2];
+        argv[2] = argv[0];
+
+        int exitCode;
+        if (runCompileClient(socketPath, argc - 2, argv + 2, &exitCode))
+        {
+            return exitCode;
+        }
+        return handleCompileRequest(argc - 2, argv + 2, NULL);
+    }
+
+    //Parse arguments
+    Flags *flags = parseArgs(argc, argv);
+    if (flags == NULL)
+    {
+        return -1;
+    }
+
+    //Serve compile requests with a warm file cache if requested
+    if (flags->serverSocket != NULL)
+    {
+        FileCache *cache = createFileCache(flags->serverCacheSize);
+        int result = cache != NULL ? runCompileServer(flags->serverSocket, handleCompileRequest, cache) : -1;
+        if (cache != NULL)
+        {
+            printFileCacheStats(cache, stderr);
+        }
+
+        deleteFileCache(cache);
+        freeFlags(flags);
+        return result;
+    }
+
+    if (flags->batchFile != NULL)
+    {
+        return runBatch(argc, argv, flags);
+    }
+
+    return runCompilation(argv[0], flags, NULL);
+}
@@ -4,11 +4,27 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <sys/stat.h>
 #include "../utils/my_string.h"
 #include "../utils/token.h"
 #include "../Lexer/lexer.h"
 #include "../Parser/parser.h"
 #include "../utils/AST.h"
+#include "../utils/compact_ast.h"
+#include "../utils/flat_ast.h"
+#include "../utils/ast_file.h"
+#include "../utils/dump.h"
+#include "../utils/thread_pool.h"
+#include "../utils/file_cache.h"
+#include "../utils/compile_server.h"
+#include "../utils/result_cache.h"
+#include "../utils/time_report.h"
+#include "../utils/trace.h"
+
+#ifdef _WIN32
+#define realpath(path, resolved) _fullpath((resolved), (path), 0)
+#endif
 
 /**
  * Executes the virtual machine (VM) process for compiling a source file.
@@ -19,13 +35,16 @@
  * 
  * The function follows these steps:
  * 1. Parses the command-line arguments to set the compilation flags.
- * 2. Reads the content of the specified source files.
- * 3. Creates a lexer to analyze the input content and generate tokens.
+ * 2. Reads the content of the specified source files and registers them with a source manager.
+ * 3. Lexes and parses every file as its own job, on a thread pool of up to `-j` workers.
  * 4. If requested, only lexes the input and prints the tokens.
  * 5. If further processing is required, creates a parser, parses the tokens, and generates the AST.
- * 6. Prints errors if any are encountered during lexing or parsing.
+ * 6. Prints the errors and the output of the files in command-line order.
  * 7. Manages memory cleanup for all dynamically allocated resources.
  * 
+ * With `--server <socket>` the process instead serves compile requests until it is stopped, and
+ * with `--client <socket>` it sends its command line to such a server.
+ * 
  * @param argc The number of command-line arguments.
  * @param argv The array of command-line argument strings.
  * 
@@ -34,7 +53,7 @@
  * @note The function handles multiple steps and has multiple exit points to manage errors appropriately.
  *       All dynamically allocated memory is freed before returning from any point in the function to prevent memory leaks.
  * 
- * @note The function currently supports handling only a single input file and does not process multiple files concurrently.
+ * @note `-o` and `-emit-ast` can only be used with a single input file.
  * 
  * @note The caller is responsible for providing valid command-line arguments and input files to ensure proper execution.
  */
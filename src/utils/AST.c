@@ -4,6 +4,42 @@
                             PRIVATE AST FUNCTIONS DECLARATIONS START HERE
  *****************************************************************************************************/
 
+/* Alignment of every allocation handed out by an ASTArena */
+#define AST_ARENA_ALIGNMENT sizeof(void *)
+
+/* Initial capacity of the explicit stack used by walkAST */
+#define INITIAL_WALK_STACK_CAPACITY 64
+
+/* Hints the CPU to load memory that is about to be read, where the compiler supports it */
+#if defined(__GNUC__)
+#define AST_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define AST_PREFETCH(address) ((void)(address))
+#endif
+
+/**
+ * Represents a node on the explicit stack of `walkAST`.
+ */
+typedef struct walkFrame
+{
+    ASTNode *node;                  /** The node being visited. */
+    size_t nextChild;               /** Index of the next child to visit. */
+} WalkFrame;
+
+static size_t alignArenaSize(const size_t size);
+
+static ASTArenaBlock *addArenaBlock(ASTArena *const arena, const size_t size);
+
+static void *takeArenaMemory(ASTArena *const arena, const size_t size, const MemoryTag tag, const int grown);
+
+static SourceLoc findASTNodeLoc(Token **const tokens, const size_t tokenCount, ASTNode **const children, const size_t childCount);
+
+static int isChainType(const ASTType type);
+
+static ASTVisitAction visitASTNode(const ASTVisitFunction *const callbacks, const ASTVisitFunction fallback, ASTNode *const astNode, const size_t depth, void *const context);
+
+static ASTVisitAction deleteVisitedASTNode(ASTNode *const astNode, const size_t depth, void *const context);
+
 /*****************************************************************************************************
                                 PRIVATE AST FUNCTIONS START HERE
  *****************************************************************************************************/
@@ -86,14 +122,363 @@ static const char *const ASTTypes[] = {
     [AST_JUMP_STATEMENT] = "JUMP_STATEMENT",
 };
 
+_Static_assert(sizeof(ASTTypes) / sizeof(ASTTypes[0]) == AST_TYPE_COUNT, "Every ASTType needs a name in ASTTypes");
+
+/**
+ * Rounds a size up to the alignment of the arena allocations.
+ * 
+ * @param size The requested number of bytes.
+ * 
+ * @return The smallest multiple of `AST_ARENA_ALIGNMENT` that is at least `size`.
+ */
+static size_t alignArenaSize(const size_t size)
+{
+    return (size + AST_ARENA_ALIGNMENT - 1) & ~(AST_ARENA_ALIGNMENT - 1);
+}
+
+/**
+ * Allocates a new block for an arena and makes it the current block.
+ * 
+ * @param arena The arena that gets the block.
+ * 
+ * @param size The smallest number of usable bytes the block needs. The block is at least
+ *             `blockSize` bytes large.
+ * 
+ * @return A pointer to the new block, or NULL if memory allocation fails.
+ */
+static ASTArenaBlock *addArenaBlock(ASTArena *const arena, const size_t size)
+{
+    size_t blockSize = size > arena->blockSize ? size : arena->blockSize;
+    ASTArenaBlock *block = malloc(sizeof(ASTArenaBlock) + blockSize);
+    if (block == NULL)
+    {
+        fprintf(stderr, "Memory allocation for AST Arena block failed!\n");
+        return NULL;
+    }
+
+    block->next = arena->blocks;
+    block->size = blockSize;
+    block->used = 0;
+    arena->blocks = block;
+    arena->blockCount++;
+
+    return block;
+}
+
+/**
+ * Hands out memory from the current block of an arena, adding a block if it is full.
+ * 
+ * @param arena The arena to allocate from.
+ * 
+ * @param size The number of bytes to allocate.
+ * 
+ * @param tag The tag the installed `Allocator` is told the memory is for.
+ * 
+ * @param grown 1 if the memory replaces a smaller piece, for the `Allocator`.
+ * 
+ * @return A pointer to the memory, or NULL if memory allocation fails.
+ */
+static void *takeArenaMemory(ASTArena *const arena, const size_t size, const MemoryTag tag, const int grown)
+{
+    size_t alignedSize = alignArenaSize(size);
+    ASTArenaBlock *block = arena->blocks;
+    if (block == NULL || block->size - block->used < alignedSize)
+    {
+        block = addArenaBlock(arena, alignedSize);
+        if (block == NULL)
+        {
+            return NULL;
+        }
+    }
+
+    void *memory = block->data + block->used;
+    block->used += alignedSize;
+    arena->bytesUsed += alignedSize;
+    if (tag == MEMORY_AST_NODES)
+    {
+        arena->nodeBytes += alignedSize;
+    }
+    useArenaMemory(tag, alignedSize, grown);
+
+    return memory;
+}
+
+/**
+ * Finds the location of a node from its tokens and children.
+ * 
+ * Locations grow with the position in the source, so the earliest of the first token and the
+ * first child is where the node starts.
+ * 
+ * @param tokens The tokens of the node, may contain NULL entries.
+ * 
+ * @param tokenCount The number of tokens.
+ * 
+ * @param children The children of the node, may contain NULL entries.
+ * 
+ * @param childCount The number of children.
+ * 
+ * @return The location of the node, or `SOURCE_LOC_INVALID` if neither a token nor a child has one.
+ */
+static SourceLoc findASTNodeLoc(Token **const tokens, const size_t tokenCount, ASTNode **const children, const size_t childCount)
+{
+    SourceLoc loc = SOURCE_LOC_INVALID;
+    for (size_t i = 0; i < tokenCount; i++)
+    {
+        if (tokens[i] != NULL)
+        {
+            loc = tokens[i]->loc;
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < childCount; i++)
+    {
+        if (children[i] != NULL)
+        {
+            if (children[i]->loc < loc)
+            {
+                loc = children[i]->loc;
+            }
+            break;
+        }
+    }
+
+    return loc;
+}
+
+/**
+ * Checks whether nodes of a type only wrap another node when they have a single child.
+ * 
+ * These are the expression precedence levels, where an operand without an operator is
+ * just the operand of the next level, and the rules whose only alternative besides the
+ * wrapped rule adds tokens or further children.
+ * 
+ * @param type The type of the node.
+ * 
+ * @return 1 if a tokenless node of this type with a single child can be replaced by the child, 0 otherwise.
+ */
+static int isChainType(const ASTType type)
+{
+    switch (type)
+    {
+    case AST_EXPRESSION:
+    case AST_CONSTANT_EXPRESSION:
+    case AST_ASSIGNMENT_EXPRESSION:
+    case AST_CONDITIONAL_EXPRESSION:
+    case AST_LOGICAL_OR_EXPRESSION:
+    case AST_LOGICAL_AND_EXPRESSION:
+    case AST_BITWISE_OR_EXPRESSION:
+    case AST_BITWISE_XOR_EXPRESSION:
+    case AST_BITWISE_AND_EXPRESSION:
+    case AST_EQUALITY_EXPRESSION:
+    case AST_RELATIONAL_EXPRESSION:
+    case AST_SHIFT_EXPRESSION:
+    case AST_ADDITIVE_EXPRESSION:
+    case AST_MULTIPLICATIVE_EXPRESSION:
+    case AST_CAST_EXPRESSION:
+    case AST_UNARY_EXPRESSION:
+    case AST_POSTFIX_EXPRESSION:
+    case AST_PRIMARY_EXPRESSION:
+    case AST_SPECIFIER_QUALIFIER:
+    case AST_DECLARATOR:
+    case AST_ABSTRACT_DECLARATOR:
+    case AST_STATEMENT:
+    case AST_GLOBAL_DECLARATION:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * Calls the callback a visitor has for a node.
+ * 
+ * @param callbacks The `enter` or `leave` callbacks of the visitor.
+ * 
+ * @param fallback The callback to call if the type of the node has none in `callbacks`.
+ * 
+ * @param astNode The node to visit.
+ * 
+ * @param depth The depth of the node.
+ * 
+ * @param context The context pointer of the walk.
+ * 
+ * @return The action returned by the callback, or `AST_VISIT_CONTINUE` if there is no callback.
+ */
+static ASTVisitAction visitASTNode(const ASTVisitFunction *const callbacks, const ASTVisitFunction fallback, ASTNode *const astNode, const size_t depth, void *const context)
+{
+    ASTVisitFunction callback = astNode->type < AST_TYPE_COUNT ? callbacks[astNode->type] : NULL;
+    if (callback == NULL)
+    {
+        callback = fallback;
+    }
+
+    return callback == NULL ? AST_VISIT_CONTINUE : callback(astNode, depth, context);
+}
+
+/**
+ * Frees a node left by the walk of `deleteASTNode`. Its children are already freed.
+ * 
+ * @param astNode The node to free.
+ * 
+ * @param depth Unused.
+ * 
+ * @param context Unused.
+ * 
+ * @return Always `AST_VISIT_CONTINUE`.
+ */
+static ASTVisitAction deleteVisitedASTNode(ASTNode *const astNode, const size_t depth, void *const context)
+{
+    (void)depth;
+    (void)context;
+
+    releaseMemory(MEMORY_AST_ARRAYS, astNode->children);
+    releaseMemory(MEMORY_AST_ARRAYS, astNode->tokens);
+    releaseMemory(MEMORY_AST_NODES, astNode);
+
+    return AST_VISIT_CONTINUE;
+}
 
 /*****************************************************************************************************
                                 PUBLIC AST FUNCTIONS START HERE                                
  *****************************************************************************************************/
 
+ASTArena *createASTArena(const size_t blockSize)
+{
+    if (blockSize == 0)
+    {
+        fprintf(stderr, "AST Arena block size is 0!\n");
+        return NULL;
+    }
+
+    ASTArena *arena = malloc(sizeof(ASTArena));
+    if (arena == NULL)
+    {
+        fprintf(stderr, "Memory allocation for AST Arena failed!\n");
+        return NULL;
+    }
+
+    arena->blocks = NULL;
+    arena->blockSize = blockSize;
+    arena->blockCount = 0;
+    arena->bytesUsed = 0;
+    arena->nodeBytes = 0;
+
+    return arena;
+}
+
+void *allocateFromASTArena(ASTArena *const arena, const size_t size)
+{
+    if (arena == NULL)
+    {
+        fprintf(stderr, "AST Arena is NULL!\n");
+        return NULL;
+    }
+
+    return takeArenaMemory(arena, size, MEMORY_AST_ARRAYS, 0);
+}
+
+void *growFromASTArena(ASTArena *const arena, void *const memory, const size_t oldSize, const size_t newSize)
+{
+    if (arena == NULL)
+    {
+        fprintf(stderr, "AST Arena is NULL!\n");
+        return NULL;
+    }
+
+    if (memory == NULL)
+    {
+        return allocateFromASTArena(arena, newSize);
+    }
+
+    //Extend the last allocation of the current block in place if it fits
+    ASTArenaBlock *block = arena->blocks;
+    size_t alignedOldSize = alignArenaSize(oldSize);
+    size_t alignedNewSize = alignArenaSize(newSize);
+    if (block != NULL && (unsigned char *)memory + alignedOldSize == block->data + block->used
+        && block->size - block->used >= alignedNewSize - alignedOldSize)
+    {
+        block->used += alignedNewSize - alignedOldSize;
+        arena->bytesUsed += alignedNewSize - alignedOldSize;
+        useArenaMemory(MEMORY_AST_ARRAYS, alignedNewSize - alignedOldSize, 1);
+        return memory;
+    }
+
+    void *newMemory = takeArenaMemory(arena, newSize, MEMORY_AST_ARRAYS, 1);
+    if (newMemory == NULL)
+    {
+        return NULL;
+    }
+
+    memcpy(newMemory, memory, oldSize < newSize ? oldSize : newSize);
+    return newMemory;
+}
+
+ASTArenaMark markASTArena(const ASTArena *const arena)
+{
+    ASTArenaMark mark = {0};
+    if (arena != NULL)
+    {
+        mark.block = arena->blocks;
+        mark.used = arena->blocks != NULL ? arena->blocks->used : 0;
+        mark.blockCount = arena->blockCount;
+        mark.bytesUsed = arena->bytesUsed;
+        mark.nodeBytes = arena->nodeBytes;
+    }
+
+    return mark;
+}
+
+void rewindASTArena(ASTArena *const arena, const ASTArenaMark mark)
+{
+    if (arena == NULL)
+    {
+        return;
+    }
+
+    //Free the blocks added after the mark
+    while (arena->blocks != mark.block)
+    {
+        ASTArenaBlock *next = arena->blocks->next;
+        free(arena->blocks);
+        arena->blocks = next;
+    }
+
+    if (arena->blocks != NULL)
+    {
+        arena->blocks->used = mark.used;
+    }
+    releaseArenaMemory(MEMORY_AST_NODES, arena->nodeBytes - mark.nodeBytes);
+    releaseArenaMemory(MEMORY_AST_ARRAYS, (arena->bytesUsed - arena->nodeBytes) - (mark.bytesUsed - mark.nodeBytes));
+    arena->blockCount = mark.blockCount;
+    arena->bytesUsed = mark.bytesUsed;
+    arena->nodeBytes = mark.nodeBytes;
+}
+
+void deleteASTArena(ASTArena *const arena)
+{
+    if (arena == NULL)
+    {
+        return;
+    }
+
+    releaseArenaMemory(MEMORY_AST_NODES, arena->nodeBytes);
+    releaseArenaMemory(MEMORY_AST_ARRAYS, arena->bytesUsed - arena->nodeBytes);
+
+    ASTArenaBlock *block = arena->blocks;
+    while (block != NULL)
+    {
+        ASTArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+
+    free(arena);
+}
+
 ASTNode *createASTNode(const ASTType type, Token **const tokens, const size_t tokenCount, ASTNode **const children, const size_t childCount)
 {
-    ASTNode *astNode = (ASTNode *)malloc(sizeof(ASTNode)); 
+    ASTNode *astNode = (ASTNode *)allocateMemory(MEMORY_AST_NODES, sizeof(ASTNode));
     if (astNode == NULL)
     {
         fprintf(stderr, "Memory allocation for AST Node failed!\n");
@@ -101,6 +486,7 @@ ASTNode *createASTNode(const ASTType type, Token **const tokens, const size_t to
     }
 
     astNode->type = type;
+    astNode->loc = findASTNodeLoc(tokens, tokenCount, children, childCount);
     astNode->tokens = tokens;
     astNode->tokenCount = tokenCount;
     astNode->children = children;
@@ -109,21 +495,41 @@ ASTNode *createASTNode(const ASTType type, Token **const tokens, const size_t to
     return astNode;
 }
 
-void deleteASTNode(ASTNode *const astNode)
+ASTNode *createArenaASTNode(ASTArena *const arena, const ASTType type, Token **const tokens, const size_t tokenCount, ASTNode **const children, const size_t childCount)
 {
+    if (arena == NULL)
+    {
+        fprintf(stderr, "AST Arena is NULL!\n");
+        return NULL;
+    }
+
+    ASTNode *astNode = takeArenaMemory(arena, sizeof(ASTNode), MEMORY_AST_NODES, 0);
     if (astNode == NULL)
     {
-        return;
+        fprintf(stderr, "Memory allocation for AST Node failed!\n");
+        return NULL;
     }
 
-    for (size_t i = 0; i < astNode->childCount; ++i) 
+    astNode->type = type;
+    astNode->loc = findASTNodeLoc(tokens, tokenCount, children, childCount);
+    astNode->tokens = tokens;
+    astNode->tokenCount = tokenCount;
+    astNode->children = children;
+    astNode->childCount = childCount;
+
+    return astNode;
+}
+
+void deleteASTNode(ASTNode *const astNode)
+{
+    if (astNode == NULL)
     {
-        deleteASTNode(astNode->children[i]);
+        return;
     }
 
-    free(astNode->children);
-    free(astNode->tokens);
-    free(astNode);
+    ASTVisitor visitor = {0};
+    visitor.leaveAny = deleteVisitedASTNode;
+    walkAST(astNode, &visitor, NULL);
 }
 
 ASTNode *duplicateASTNode(ASTNode *const astNode)
@@ -144,6 +550,32 @@ ASTNode *duplicateASTNode(ASTNode *const astNode)
     return newNode;
 }
 
+ASTNode *collapseASTChains(ASTNode *const astNode)
+{
+    if (astNode == NULL)
+    {
+        return NULL;
+    }
+
+    ASTNode *node = astNode;
+    while (isChainType(node->type) && node->tokenCount == 0 && node->childCount == 1 && node->children[0] != NULL)
+    {
+        node = node->children[0];
+    }
+
+    for (size_t i = 0; i < node->childCount; i++)
+    {
+        node->children[i] = collapseASTChains(node->children[i]);
+    }
+
+    return node;
+}
+
+const char *getASTTypeName(const ASTType type)
+{
+    return ASTTypes[type];
+}
+
 void printASTNode(const ASTNode *const astNode, char *indent, int isLast)
 {
     if (astNode == NULL)
@@ -195,4 +627,93 @@ void printASTNode(const ASTNode *const astNode, char *indent, int isLast)
     {
         printASTNode(astNode->children[i], newIndent, i == astNode->childCount - 1);
     }
-}
\ No newline at end of file
+}
+
+int walkAST(ASTNode *const root, const ASTVisitor *const visitor, void *const context)
+{
+    if (root == NULL)
+    {
+        return 1;
+    }
+
+    if (visitor == NULL)
+    {
+        fprintf(stderr, "AST Visitor is NULL!\n");
+        return 0;
+    }
+
+    size_t stackCapacity = INITIAL_WALK_STACK_CAPACITY;
+    WalkFrame *stack = malloc(stackCapacity * sizeof(WalkFrame));
+    if (stack == NULL)
+    {
+        fprintf(stderr, "Memory allocation for the AST walk stack failed!\n");
+        return 0;
+    }
+
+    ASTVisitAction action = visitASTNode(visitor->enter, visitor->enterAny, root, 0, context);
+    if (action == AST_VISIT_STOP)
+    {
+        free(stack);
+        return 0;
+    }
+    stack[0].node = root;
+    stack[0].nextChild = action == AST_VISIT_SKIP_CHILDREN ? root->childCount : 0;
+    size_t stackSize = 1;
+
+    while (stackSize > 0)
+    {
+        WalkFrame *frame = &stack[stackSize - 1];
+        ASTNode *node = frame->node;
+
+        //Leave the node once all of its children are done
+        if (frame->nextChild >= node->childCount)
+        {
+            stackSize--;
+            if (visitASTNode(visitor->leave, visitor->leaveAny, node, stackSize, context) == AST_VISIT_STOP)
+            {
+                free(stack);
+                return 0;
+            }
+            continue;
+        }
+
+        ASTNode *child = node->children[frame->nextChild++];
+        if (child == NULL)
+        {
+            continue;
+        }
+
+        if (visitor->prefetch && frame->nextChild < node->childCount)
+        {
+            AST_PREFETCH(node->children[frame->nextChild]);
+        }
+
+        //Enter the child and push it
+        action = visitASTNode(visitor->enter, visitor->enterAny, child, stackSize, context);
+        if (action == AST_VISIT_STOP)
+        {
+            free(stack);
+            return 0;
+        }
+
+        if (stackSize >= stackCapacity)
+        {
+            WalkFrame *newStack = realloc(stack, 2 * stackCapacity * sizeof(WalkFrame));
+            if (newStack == NULL)
+            {
+                fprintf(stderr, "Memory reallocation for the AST walk stack failed!\n");
+                free(stack);
+                return 0;
+            }
+            stack = newStack;
+            stackCapacity *= 2;
+        }
+
+        stack[stackSize].node = child;
+        stack[stackSize].nextChild = action == AST_VISIT_SKIP_CHILDREN ? child->childCount : 0;
+        stackSize++;
+    }
+
+    free(stack);
+    return 1;
+}
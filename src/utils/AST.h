@@ -7,6 +7,7 @@
  * Enumeration of AST node types.
  * 
  * The `ASTType` enum defines various types of nodes in the Abstract Syntax Tree (AST).
+ * `AST_TYPE_COUNT` is not a node type, it is the number of node types.
  */
 typedef enum astType
 {
@@ -82,6 +83,7 @@ typedef enum astType
     AST_ITERATION_STATEMENT,
     AST_FOR_CONTROL,
     AST_JUMP_STATEMENT,
+    AST_TYPE_COUNT // Keep this last
 } ASTType;
 
 /**
@@ -91,6 +93,8 @@ typedef enum astType
  * associated tokens, and child nodes.
  * 
  * - `type`: The type of the AST node.
+ * - `loc`: The `SourceLoc` of the first token of the node or of its subtree, `SOURCE_LOC_INVALID` if
+ *          it has none. It fits in the padding after `type`, so it does not grow the node.
  * - `tokens`: An array of tokens associated with this node. This array is managed by the caller.
  * - `tokenCount`: The number of tokens in the `tokens` array.
  * - `children`: An array of child AST nodes.
@@ -99,12 +103,152 @@ typedef enum astType
 typedef struct astNode
 {
     ASTType type;               /** The type of the AST node. */
+    SourceLoc loc;              /** The location of the first token of the subtree. */
     Token **tokens;             /** Array of tokens associated with the node. */
     size_t tokenCount;          /** Number of tokens in the `tokens` array. */
     struct astNode **children;  /** Array of child nodes. */
     size_t childCount;          /** Number of child nodes in the `children` array. */
 } ASTNode;
 
+/**
+ * Represents a block of memory handed out by an `ASTArena`.
+ * 
+ * - `next`: The block that was filled before this one, or NULL.
+ * - `size`: The number of bytes available in `data`.
+ * - `used`: The number of bytes of `data` already handed out.
+ * - `data`: The memory itself, allocated together with the block header.
+ */
+typedef struct astArenaBlock
+{
+    struct astArenaBlock *next; /** The previously filled block. */
+    size_t size;                /** Number of bytes in `data`. */
+    size_t used;                /** Number of bytes handed out from `data`. */
+    unsigned char data[];       /** The memory handed out by the arena. */
+} ASTArenaBlock;
+
+/**
+ * Represents a bump allocator for the nodes and arrays of an Abstract Syntax Tree (AST).
+ * 
+ * The `ASTArena` hands out memory from large blocks by moving a pointer forward, so building
+ * a tree costs one `malloc` per block instead of one per node and array. The memory can not be
+ * freed piece by piece; deleting the arena releases every block and with them the whole tree.
+ * 
+ * - `blocks`: The block currently handed out from, linked to the earlier blocks.
+ * - `blockSize`: The size of a new block. Larger requests get a block of their own size.
+ * - `blockCount`: The number of blocks allocated so far.
+ * - `bytesUsed`: The number of bytes handed out so far.
+ * - `nodeBytes`: The number of those bytes handed out for nodes, the rest went to arrays. The
+ *                installed `Allocator` is told about both with the `MEMORY_AST_NODES` and the
+ *                `MEMORY_AST_ARRAYS` tags.
+ */
+typedef struct astArena
+{
+    ASTArenaBlock *blocks;      /** The current block, linked to the earlier ones. */
+    size_t blockSize;           /** The default size of a new block. */
+    size_t blockCount;          /** The number of allocated blocks. */
+    size_t bytesUsed;           /** The number of bytes handed out. */
+    size_t nodeBytes;           /** The number of bytes handed out for nodes. */
+} ASTArena;
+
+/**
+ * Represents a position in an `ASTArena` that the arena can be rewound to.
+ * 
+ * - `block`: The current block when the mark was taken, or NULL if the arena had no block.
+ * - `used`: The number of bytes handed out from `block` when the mark was taken.
+ * - `blockCount`: The number of blocks the arena had when the mark was taken.
+ * - `bytesUsed`: The number of bytes the arena had handed out when the mark was taken.
+ * - `nodeBytes`: The number of bytes the arena had handed out for nodes when the mark was taken.
+ */
+typedef struct astArenaMark
+{
+    ASTArenaBlock *block;       /** The current block at the mark. */
+    size_t used;                /** Bytes handed out from the block at the mark. */
+    size_t blockCount;          /** Number of blocks at the mark. */
+    size_t bytesUsed;           /** Bytes handed out by the arena at the mark. */
+    size_t nodeBytes;           /** Bytes handed out for nodes at the mark. */
+} ASTArenaMark;
+
+/**
+ * Creates a new, empty `ASTArena`.
+ * 
+ * No block is allocated until the first request, so an arena that is never used costs a
+ * single small allocation.
+ * 
+ * @param blockSize The size of the blocks the arena allocates.
+ * 
+ * @return A pointer to the newly created `ASTArena`, or NULL if memory allocation fails or the block size is 0.
+ * 
+ * @note The caller is responsible for freeing the arena with `deleteASTArena`.
+ */
+ASTArena *createASTArena(const size_t blockSize);
+
+/**
+ * Allocates memory from an `ASTArena`.
+ * 
+ * The memory is aligned for pointers and `size_t` values, which is all an `ASTNode` and its
+ * arrays contain. If the current block can not hold the request a new block is allocated.
+ * 
+ * @param arena The arena to allocate from.
+ * 
+ * @param size The number of bytes to allocate.
+ * 
+ * @return A pointer to the memory, or NULL if the arena is NULL or memory allocation fails.
+ * 
+ * @note The memory must not be passed to `free`, it is released by `deleteASTArena`. It is
+ *       counted as `MEMORY_AST_ARRAYS`.
+ */
+void *allocateFromASTArena(ASTArena *const arena, const size_t size);
+
+/**
+ * Grows memory previously allocated from an `ASTArena`.
+ * 
+ * If `memory` is the last allocation of the current block and the block has room, the
+ * allocation is extended in place. Otherwise new memory is allocated and the old contents
+ * are copied; the old memory stays in the arena until the arena is deleted.
+ * 
+ * @param arena The arena the memory was allocated from.
+ * 
+ * @param memory The memory to grow, or NULL to allocate new memory.
+ * 
+ * @param oldSize The number of bytes `memory` was allocated with.
+ * 
+ * @param newSize The number of bytes needed.
+ * 
+ * @return A pointer to the grown memory, or NULL if memory allocation fails.
+ */
+void *growFromASTArena(ASTArena *const arena, void *const memory, const size_t oldSize, const size_t newSize);
+
+/**
+ * Marks the current position of an `ASTArena`.
+ * 
+ * @param arena The arena to mark.
+ * 
+ * @return The mark, to be passed to `rewindASTArena`.
+ */
+ASTArenaMark markASTArena(const ASTArena *const arena);
+
+/**
+ * Rewinds an `ASTArena` to a mark, handing the memory allocated since the mark out again.
+ * 
+ * Blocks allocated after the mark are freed.
+ * 
+ * @param arena The arena to rewind. If NULL, the function does nothing.
+ * 
+ * @param mark A mark taken from the same arena with `markASTArena`.
+ * 
+ * @note Every allocation made after the mark becomes invalid, and so does every later mark.
+ */
+void rewindASTArena(ASTArena *const arena, const ASTArenaMark mark);
+
+/**
+ * Deletes an `ASTArena` and every block it allocated.
+ * 
+ * @param arena The arena to delete. If NULL, the function does nothing.
+ * 
+ * @note Every `ASTNode` and array allocated from the arena becomes invalid.
+ */
+void deleteASTArena(ASTArena *const arena);
+
 /**
  * Creates a new `ASTNode` with the specified type, tokens, and children.
  * 
@@ -114,11 +258,13 @@ typedef struct astNode
  * 
  * @param type The type of the AST node.
  * 
- * @param tokens An array of tokens associated with the node (must be dynamically allocated).
+ * @param tokens An array of tokens associated with the node (must be allocated with
+ *               `allocateMemory` and the `MEMORY_AST_ARRAYS` tag).
  * 
  * @param tokenCount The number of tokens in the `tokens` array.
  * 
- * @param children An array of child nodes (must be dynamically allocated).
+ * @param children An array of child nodes (must be allocated with `allocateMemory` and the
+ *                 `MEMORY_AST_ARRAYS` tag).
  * 
  * @param childCount The number of child nodes in the `children` array.
  * 
@@ -131,6 +277,31 @@ typedef struct astNode
  */
 ASTNode *createASTNode(const ASTType type, Token **const tokens, const size_t tokenCount, ASTNode **const children, const size_t childCount);
 
+/**
+ * Creates a new `ASTNode` in an `ASTArena`.
+ * 
+ * Works like `createASTNode`, but the node is allocated from the arena. The `tokens` and
+ * `children` arrays are expected to be allocated from the same arena, so the whole tree is
+ * released at once by `deleteASTArena`.
+ * 
+ * @param arena The arena to allocate the node from.
+ * 
+ * @param type The type of the AST node.
+ * 
+ * @param tokens An array of tokens associated with the node, allocated from `arena`.
+ * 
+ * @param tokenCount The number of tokens in the `tokens` array.
+ * 
+ * @param children An array of child nodes, allocated from `arena`.
+ * 
+ * @param childCount The number of child nodes in the `children` array.
+ * 
+ * @return A pointer to the newly created `ASTNode`, or NULL if memory allocation fails.
+ * 
+ * @note A node created by this function must not be passed to `deleteASTNode`.
+ */
+ASTNode *createArenaASTNode(ASTArena *const arena, const ASTType type, Token **const tokens, const size_t tokenCount, ASTNode **const children, const size_t childCount);
+
 /**
  * Deletes an `ASTNode` and frees its memory.
  * 
@@ -140,7 +311,8 @@ ASTNode *createASTNode(const ASTType type, Token **const tokens, const size_t to
  * @param astNode The `ASTNode` to be deleted.
  * 
  * @note The function assumes that the `tokens` array and `children` array are dynamically allocated.
- *       It is the caller's responsibility to manage the memory of individual tokens.
+ *       It is the caller's responsibility to manage the memory of individual tokens. Trees built
+ *       with `createArenaASTNode` are freed with `deleteASTArena` instead.
  */
 void deleteASTNode(ASTNode *const astNode);
 
@@ -162,6 +334,36 @@ void deleteASTNode(ASTNode *const astNode);
  */
 ASTNode *duplicateASTNode(ASTNode *const astNode);
 
+/**
+ * Collapses the single-child chains of an Abstract Syntax Tree (AST).
+ * 
+ * Some rules of the grammar only wrap another rule, e.g. an `EXPRESSION` without a comma
+ * wraps a single `ASSIGNMENT_EXPRESSION`, and a `DECLARATOR` without a pointer wraps a single
+ * `DIRECT_DECLARATOR`. A node of such a wrapper type that holds no tokens and exactly one child
+ * carries no information of its own, so this function replaces it with its child, in place,
+ * for the whole tree. Nodes of every other type, such as lists and declarations, are kept even
+ * with a single child.
+ * 
+ * @param astNode The root of the tree to collapse. If NULL, the function returns NULL.
+ * 
+ * @return The node that takes the place of `astNode`, which is `astNode` itself unless it was
+ *         a wrapper.
+ * 
+ * @note The collapsed wrapper nodes are unlinked but not freed, which suits trees allocated
+ *       from an `ASTArena`. For trees built with `createASTNode` the caller has to keep the
+ *       original root to free them with `deleteASTNode`.
+ */
+ASTNode *collapseASTChains(ASTNode *const astNode);
+
+/**
+ * Returns the printable name of an `ASTType`.
+ * 
+ * @param type The `ASTType` to name.
+ * 
+ * @return The name of the type, as used by `printASTNode`.
+ */
+const char *getASTTypeName(const ASTType type);
+
 /**
  * Recursively prints an Abstract Syntax Tree (AST) node with indentation.
  * 
@@ -176,4 +378,71 @@ ASTNode *duplicateASTNode(ASTNode *const astNode);
  */
 void printASTNode(const ASTNode *const astNode, char *indent, int isLast);
 
+/**
+ * Enumeration of the actions a visitor callback can request from `walkAST`.
+ * 
+ * - `AST_VISIT_CONTINUE`: Continue the walk normally.
+ * - `AST_VISIT_SKIP_CHILDREN`: Do not visit the children of the node. Only meaningful when
+ *                              returned before the children are visited, the node is still left.
+ * - `AST_VISIT_STOP`: End the walk immediately, no further callback is called.
+ */
+typedef enum astVisitAction
+{
+    AST_VISIT_CONTINUE,
+    AST_VISIT_SKIP_CHILDREN,
+    AST_VISIT_STOP,
+} ASTVisitAction;
+
+/**
+ * A visitor callback.
+ * 
+ * @param astNode The node being visited. Never NULL.
+ * 
+ * @param depth The depth of the node, 0 for the root of the walk.
+ * 
+ * @param context The context pointer given to `walkAST`.
+ * 
+ * @return The `ASTVisitAction` the walk should take.
+ */
+typedef ASTVisitAction (*ASTVisitFunction)(ASTNode *const astNode, const size_t depth, void *const context);
+
+/**
+ * Represents a set of visitor callbacks for `walkAST`.
+ * 
+ * - `enter`: Callbacks called in pre-order, before the children of a node, indexed by `ASTType`.
+ * - `leave`: Callbacks called in post-order, after the children of a node, indexed by `ASTType`.
+ * - `enterAny`: Called before the children of nodes whose type has no `enter` callback.
+ * - `leaveAny`: Called after the children of nodes whose type has no `leave` callback.
+ * - `prefetch`: If set, the next sibling of every visited node is prefetched into the cache.
+ * 
+ * Any callback can be NULL, nodes without a callback are walked through silently. A zero
+ * initialized `ASTVisitor` visits nothing.
+ */
+typedef struct astVisitor
+{
+    ASTVisitFunction enter[AST_TYPE_COUNT];     /** Pre-order callbacks by node type. */
+    ASTVisitFunction leave[AST_TYPE_COUNT];     /** Post-order callbacks by node type. */
+    ASTVisitFunction enterAny;                  /** Fallback pre-order callback. */
+    ASTVisitFunction leaveAny;                  /** Fallback post-order callback. */
+    int prefetch;                               /** Flag to prefetch the next sibling. */
+} ASTVisitor;
+
+/**
+ * Walks an Abstract Syntax Tree (AST) depth-first, calling the callbacks of a visitor.
+ * 
+ * The walk runs on an explicit stack instead of recursion, so the depth of the tree is only
+ * limited by memory. NULL children are skipped. Children are visited in order, and every node
+ * is left after all of its children, so the tree can be freed from the `leave` callbacks.
+ * 
+ * @param root The root of the tree to walk. If NULL, nothing is visited.
+ * 
+ * @param visitor The callbacks to call.
+ * 
+ * @param context A pointer passed to every callback unchanged.
+ * 
+ * @return 1 if the whole tree was walked, 0 if a callback returned `AST_VISIT_STOP` or memory
+ *         allocation for the stack failed.
+ */
+int walkAST(ASTNode *const root, const ASTVisitor *const visitor, void *const context);
+
 #endif // AST_H
\ No newline at end of file
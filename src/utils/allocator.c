@@ -0,0 +1,319 @@
+#include "allocator.h"
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+/*****************************************************************************************************
+                            PRIVATE ALLOCATOR FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+/* The allocator the front end allocates through, NULL for the C library */
+static const Allocator *activeAllocator = NULL;
+
+/* The allocator replaced by the profiling allocator */
+static const Allocator *profiledAllocator = NULL;
+
+/* Allocations of the calling thread through the functions below, for -ftime-report */
+static __thread size_t threadAllocations = 0;
+static __thread size_t threadAllocatedBytes = 0;
+
+/* The counts of the profiling allocator, updated atomically by every thread */
+static MemoryTagStats profileStats[MEMORY_TAG_COUNT];
+static int64_t profileLiveBytes = 0;
+static int64_t profilePeakLiveBytes = 0;
+
+static const char *const tagNames[MEMORY_TAG_COUNT] = {
+    "tokens",
+    "token text",
+    "AST nodes",
+    "AST arrays",
+    "errors",
+    "parser scratch",
+};
+
+static size_t getAllocationSize(void *const memory);
+
+static void raisePeak(int64_t *const peak, const int64_t value);
+
+static void addLiveBytes(const MemoryTag tag, const int64_t delta);
+
+static void *profileAllocate(const MemoryTag tag, const size_t size);
+
+static void *profileReallocate(const MemoryTag tag, void *const memory, const size_t size);
+
+static void profileRelease(const MemoryTag tag, void *const memory);
+
+static void profileUseArena(const MemoryTag tag, const size_t size, const int grown);
+
+static void profileReleaseArena(const MemoryTag tag, const size_t size);
+
+static const Allocator profilingAllocator = {
+    profileAllocate,
+    profileReallocate,
+    profileRelease,
+    profileUseArena,
+    profileReleaseArena,
+};
+
+/*****************************************************************************************************
+                                PRIVATE ALLOCATOR FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Finds the size of an allocation of the C library.
+ *
+ * @param memory The allocation, or NULL.
+ *
+ * @return The usable size of the allocation, or 0 if the C library does not report it.
+ */
+static size_t getAllocationSize(void *const memory)
+{
+#ifdef __GLIBC__
+    return memory != NULL ? malloc_usable_size(memory) : 0;
+#else
+    (void)memory;
+    return 0;
+#endif
+}
+
+/**
+ * Raises a peak atomically if a value exceeds it.
+ *
+ * @param peak The peak.
+ *
+ * @param value The value.
+ */
+static void raisePeak(int64_t *const peak, const int64_t value)
+{
+    int64_t current = __atomic_load_n(peak, __ATOMIC_RELAXED);
+    while (value > current && !__atomic_compare_exchange_n(peak, &current, value, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+/**
+ * Adds to the live bytes of a tag and of the whole profile, raising their peaks.
+ *
+ * @param tag The tag.
+ *
+ * @param delta The bytes allocated, negative for released bytes.
+ */
+static void addLiveBytes(const MemoryTag tag, const int64_t delta)
+{
+    MemoryTagStats *stats = &profileStats[tag];
+    raisePeak(&stats->peakLiveBytes, __atomic_add_fetch(&stats->liveBytes, delta, __ATOMIC_RELAXED));
+    raisePeak(&profilePeakLiveBytes, __atomic_add_fetch(&profileLiveBytes, delta, __ATOMIC_RELAXED));
+}
+
+/**
+ * Allocates memory with `malloc` and counts it. Used as the `allocate` of the profiling allocator.
+ *
+ * @param tag The subsystem the memory is for.
+ *
+ * @param size The number of bytes.
+ *
+ * @return The memory, or NULL if the allocation fails.
+ */
+static void *profileAllocate(const MemoryTag tag, const size_t size)
+{
+    void *memory = malloc(size);
+    if (memory != NULL)
+    {
+        __atomic_add_fetch(&profileStats[tag].allocations, 1, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&profileStats[tag].bytes, size, __ATOMIC_RELAXED);
+        addLiveBytes(tag, (int64_t)getAllocationSize(memory));
+    }
+    return memory;
+}
+
+/**
+ * Resizes memory with `realloc` and counts it. Used as the `reallocate` of the profiling allocator.
+ *
+ * @param tag The tag the memory was allocated with.
+ *
+ * @param memory The memory, or NULL to allocate.
+ *
+ * @param size The new number of bytes.
+ *
+ * @return The resized memory, or NULL if the reallocation fails.
+ */
+static void *profileReallocate(const MemoryTag tag, void *const memory, const size_t size)
+{
+    size_t oldSize = getAllocationSize(memory);
+    void *newMemory = realloc(memory, size);
+    if (newMemory != NULL)
+    {
+        __atomic_add_fetch(memory != NULL ? &profileStats[tag].reallocations : &profileStats[tag].allocations, 1, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&profileStats[tag].bytes, size, __ATOMIC_RELAXED);
+        addLiveBytes(tag, (int64_t)getAllocationSize(newMemory) - (int64_t)oldSize);
+    }
+    return newMemory;
+}
+
+/**
+ * Frees memory with `free` and counts it. Used as the `release` of the profiling allocator.
+ *
+ * @param tag The tag the memory was allocated with.
+ *
+ * @param memory The memory, or NULL.
+ */
+static void profileRelease(const MemoryTag tag, void *const memory)
+{
+    if (memory != NULL)
+    {
+        addLiveBytes(tag, -(int64_t)getAllocationSize(memory));
+    }
+    free(memory);
+}
+
+/**
+ * Counts memory an arena handed out. Used as the `useArena` of the profiling allocator.
+ *
+ * @param tag The subsystem the memory is for.
+ *
+ * @param size The number of bytes.
+ *
+ * @param grown 1 if an earlier piece was grown, 0 otherwise.
+ */
+static void profileUseArena(const MemoryTag tag, const size_t size, const int grown)
+{
+    __atomic_add_fetch(grown ? &profileStats[tag].reallocations : &profileStats[tag].allocations, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&profileStats[tag].bytes, size, __ATOMIC_RELAXED);
+    addLiveBytes(tag, (int64_t)size);
+}
+
+/**
+ * Counts memory an arena took back. Used as the `releaseArena` of the profiling allocator.
+ *
+ * @param tag The tag the memory was handed out with.
+ *
+ * @param size The number of bytes.
+ */
+static void profileReleaseArena(const MemoryTag tag, const size_t size)
+{
+    addLiveBytes(tag, -(int64_t)size);
+}
+
+/*****************************************************************************************************
+                                PUBLIC ALLOCATOR FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+void setAllocator(const Allocator *const allocator)
+{
+    activeAllocator = allocator;
+}
+
+void *allocateMemory(const MemoryTag tag, const size_t size)
+{
+    threadAllocations++;
+    threadAllocatedBytes += size;
+    if (activeAllocator == NULL)
+    {
+        return malloc(size);
+    }
+    return activeAllocator->allocate(tag, size);
+}
+
+void *reallocateMemory(const MemoryTag tag, void *const memory, const size_t size)
+{
+    threadAllocations++;
+    threadAllocatedBytes += size;
+    if (activeAllocator == NULL)
+    {
+        return realloc(memory, size);
+    }
+    return activeAllocator->reallocate(tag, memory, size);
+}
+
+void releaseMemory(const MemoryTag tag, void *const memory)
+{
+    if (activeAllocator == NULL)
+    {
+        free(memory);
+        return;
+    }
+    activeAllocator->release(tag, memory);
+}
+
+void useArenaMemory(const MemoryTag tag, const size_t size, const int grown)
+{
+    threadAllocations++;
+    threadAllocatedBytes += size;
+    if (activeAllocator != NULL && activeAllocator->useArena != NULL)
+    {
+        activeAllocator->useArena(tag, size, grown);
+    }
+}
+
+void releaseArenaMemory(const MemoryTag tag, const size_t size)
+{
+    if (activeAllocator != NULL && activeAllocator->releaseArena != NULL && size > 0)
+    {
+        activeAllocator->releaseArena(tag, size);
+    }
+}
+
+void getThreadAllocations(size_t *const allocations, size_t *const bytes)
+{
+    *allocations = threadAllocations;
+    *bytes = threadAllocatedBytes;
+}
+
+void startMemoryProfile(void)
+{
+    memset(profileStats, 0, sizeof(profileStats));
+    profileLiveBytes = 0;
+    profilePeakLiveBytes = 0;
+
+    profiledAllocator = activeAllocator;
+    setAllocator(&profilingAllocator);
+}
+
+void stopMemoryProfile(MemoryReport *const report)
+{
+    setAllocator(profiledAllocator);
+    profiledAllocator = NULL;
+
+    memcpy(report->tags, profileStats, sizeof(profileStats));
+    report->peakLiveBytes = profilePeakLiveBytes;
+#ifdef __GLIBC__
+    report->liveTracked = 1;
+#else
+    report->liveTracked = 0;
+#endif
+}
+
+void printMemoryReport(const MemoryReport *const report, FILE *const stream)
+{
+    if (report == NULL)
+    {
+        fprintf(stderr, "Memory Report is NULL!\n");
+        return;
+    }
+
+    MemoryTagStats total = {0};
+    fprintf(stream, "Memory report:\n");
+    fprintf(stream, "%-15s %12s %14s %14s %12s\n", "Tag", "Allocations", "Bytes", "Peak live", "Reallocs");
+    for (size_t i = 0; i <= MEMORY_TAG_COUNT; i++)
+    {
+        //The last row is the sum of the tags, with the peak of all of them together
+        const MemoryTagStats *stats = i < MEMORY_TAG_COUNT ? &report->tags[i] : &total;
+        int64_t peak = i < MEMORY_TAG_COUNT ? stats->peakLiveBytes : report->peakLiveBytes;
+        if (i < MEMORY_TAG_COUNT)
+        {
+            total.allocations += stats->allocations;
+            total.bytes += stats->bytes;
+            total.reallocations += stats->reallocations;
+        }
+
+        fprintf(stream, "%-15s %12zu %14zu", i < MEMORY_TAG_COUNT ? tagNames[i] : "total", stats->allocations, stats->bytes);
+        if (report->liveTracked)
+        {
+            fprintf(stream, " %14lld", (long long)peak);
+        }
+        else
+        {
+            fprintf(stream, " %14s", "n/a");
+        }
+        fprintf(stream, " %12zu\n", stats->reallocations);
+    }
+}
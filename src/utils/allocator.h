@@ -0,0 +1,187 @@
+#ifndef ALLOCATOR_H
+#define ALLOCATOR_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * The subsystems the front end allocates memory for.
+ *
+ * - `MEMORY_TOKENS`: The `Token` objects and the token arrays of the lexer.
+ * - `MEMORY_TOKEN_TEXT`: The text of the tokens and the values of the string literals.
+ * - `MEMORY_AST_NODES`: The `ASTNode` objects.
+ * - `MEMORY_AST_ARRAYS`: The token and child arrays of the AST nodes.
+ * - `MEMORY_ERRORS`: The diagnostic engines of the lexer and the parser and their buffers.
+ * - `MEMORY_PARSER_SCRATCH`: The `Parser` and the filtered token array it parses from.
+ */
+typedef enum memoryTag
+{
+    MEMORY_TOKENS,
+    MEMORY_TOKEN_TEXT,
+    MEMORY_AST_NODES,
+    MEMORY_AST_ARRAYS,
+    MEMORY_ERRORS,
+    MEMORY_PARSER_SCRATCH,
+    MEMORY_TAG_COUNT,
+} MemoryTag;
+
+/**
+ * Represents an allocator the front end allocates through, in place of the C library.
+ *
+ * The memory is released with the same tag it was allocated with. The arena functions are only
+ * told about the memory an `ASTArena` hands out from its blocks, they do not allocate.
+ *
+ * - `allocate`: Allocates memory, like `malloc`.
+ * - `reallocate`: Resizes memory, like `realloc`.
+ * - `release`: Frees memory, like `free`.
+ * - `useArena`: Called when an arena hands out memory, or NULL. `grown` is 1 if an earlier
+ *               piece was grown into it.
+ * - `releaseArena`: Called when an arena takes memory back, or NULL.
+ */
+typedef struct allocator
+{
+    void *(*allocate)(const MemoryTag tag, const size_t size);
+    void *(*reallocate)(const MemoryTag tag, void *const memory, const size_t size);
+    void (*release)(const MemoryTag tag, void *const memory);
+    void (*useArena)(const MemoryTag tag, const size_t size, const int grown);
+    void (*releaseArena)(const MemoryTag tag, const size_t size);
+} Allocator;
+
+/**
+ * The allocations of one tag, counted by the profiling allocator.
+ *
+ * - `allocations`: The number of allocations.
+ * - `reallocations`: The number of reallocations.
+ * - `bytes`: The number of bytes the allocations and reallocations requested.
+ * - `liveBytes`: The number of bytes allocated and not yet released.
+ * - `peakLiveBytes`: The largest `liveBytes` reached.
+ */
+typedef struct memoryTagStats
+{
+    size_t allocations;         /** Number of allocations. */
+    size_t reallocations;       /** Number of reallocations. */
+    size_t bytes;               /** Requested bytes. */
+    int64_t liveBytes;          /** Bytes not yet released. */
+    int64_t peakLiveBytes;      /** Largest number of live bytes. */
+} MemoryTagStats;
+
+/**
+ * Represents the allocations of every tag between `startMemoryProfile` and `stopMemoryProfile`.
+ *
+ * - `tags`: The allocations, indexed by `MemoryTag`.
+ * - `peakLiveBytes`: The largest number of live bytes of every tag together.
+ * - `liveTracked`: 1 if the C library reports the size of an allocation, so the live bytes
+ *                  could be counted, 0 otherwise.
+ */
+typedef struct memoryReport
+{
+    MemoryTagStats tags[MEMORY_TAG_COUNT];  /** The allocations of the tags. */
+    int64_t peakLiveBytes;                  /** Largest number of live bytes. */
+    int liveTracked;                        /** Whether live bytes were counted. */
+} MemoryReport;
+
+/**
+ * Installs the allocator the front end allocates through.
+ *
+ * Must not be called while other threads allocate through it, and the allocator must stay
+ * valid until it is replaced.
+ *
+ * @param allocator The allocator, or NULL to allocate straight from the C library.
+ */
+void setAllocator(const Allocator *const allocator);
+
+/**
+ * Allocates memory through the installed allocator.
+ *
+ * @param tag The subsystem the memory is for.
+ *
+ * @param size The number of bytes.
+ *
+ * @return The memory, or NULL if the allocation fails.
+ */
+void *allocateMemory(const MemoryTag tag, const size_t size);
+
+/**
+ * Resizes memory through the installed allocator.
+ *
+ * @param tag The tag the memory was allocated with.
+ *
+ * @param memory The memory, or NULL to allocate.
+ *
+ * @param size The new number of bytes.
+ *
+ * @return The resized memory, or NULL if the reallocation fails. The old memory stays valid then.
+ */
+void *reallocateMemory(const MemoryTag tag, void *const memory, const size_t size);
+
+/**
+ * Frees memory through the installed allocator.
+ *
+ * @param tag The tag the memory was allocated with.
+ *
+ * @param memory The memory, or NULL.
+ */
+void releaseMemory(const MemoryTag tag, void *const memory);
+
+/**
+ * Tells the installed allocator that an `ASTArena` handed out memory from one of its blocks.
+ *
+ * @param tag The subsystem the memory is for.
+ *
+ * @param size The number of bytes.
+ *
+ * @param grown 1 if an earlier piece was grown by `size` bytes or into the new piece, 0 otherwise.
+ */
+void useArenaMemory(const MemoryTag tag, const size_t size, const int grown);
+
+/**
+ * Tells the installed allocator that an `ASTArena` took back memory it handed out.
+ *
+ * @param tag The tag the memory was handed out with.
+ *
+ * @param size The number of bytes.
+ */
+void releaseArenaMemory(const MemoryTag tag, const size_t size);
+
+/**
+ * Reads how many allocations, reallocations and arena pieces the calling thread requested
+ * through `allocateMemory`, `reallocateMemory` and `useArenaMemory` so far, whichever
+ * allocator is installed. Used by `-ftime-report` to count the allocations of every phase.
+ *
+ * @param allocations Set to the number of requests.
+ *
+ * @param bytes Set to the number of bytes they requested.
+ */
+void getThreadAllocations(size_t *const allocations, size_t *const bytes);
+
+/**
+ * Installs an allocator that counts the allocations of every tag, for `--mem-report`. The
+ * counts start from zero, so the profile should span whole compilations: memory allocated
+ * before it and released during it lowers the live bytes.
+ *
+ * Must be called before the threads that allocate are started.
+ */
+void startMemoryProfile(void);
+
+/**
+ * Removes the profiling allocator and returns what it counted.
+ *
+ * Must be called once the threads that allocate have stopped.
+ *
+ * @param report Set to the counts.
+ */
+void stopMemoryProfile(MemoryReport *const report);
+
+/**
+ * Prints a table of the allocations, the requested bytes, the peak live bytes and the
+ * reallocations of every tag of a report.
+ *
+ * @param report The report to print.
+ *
+ * @param stream The stream to print to.
+ */
+void printMemoryReport(const MemoryReport *const report, FILE *const stream);
+
+#endif // ALLOCATOR_H
@@ -0,0 +1,475 @@
+#include "ast_file.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/*****************************************************************************************************
+                            PRIVATE AST FILE FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+_Static_assert(sizeof(CastHeader) == 32, "CastHeader must not contain padding");
+_Static_assert(sizeof(FlatNode) == 16, "FlatNode must not contain padding");
+_Static_assert(sizeof(CastToken) == 24, "CastToken must not contain padding");
+
+/* Initial capacity of the string pool while writing */
+#define INITIAL_STRING_POOL_CAPACITY 1024
+
+/**
+ * Represents the string pool of a serialized AST file while it is being written.
+ */
+typedef struct stringPool
+{
+    char *data;                     /** The contents of the pool. */
+    size_t size;                    /** Number of bytes used. */
+    size_t capacity;                /** Number of bytes allocated. */
+} StringPool;
+
+static int addToStringPool(StringPool *const pool, const char *const string, uint32_t *offset, uint32_t *length);
+
+static void *readCastData(const char *const fileName, size_t *size, int *mapped);
+
+static void freeCastData(void *data, const size_t size, const int mapped);
+
+static int isValidCastFile(const CastFile *const file);
+
+/*****************************************************************************************************
+                                PRIVATE AST FILE FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Appends a zero terminated copy of a string to the string pool.
+ *
+ * @param pool The string pool to append to.
+ *
+ * @param string The string to append. NULL is stored as an empty string.
+ *
+ * @param offset Set to the offset of the copy in the pool.
+ *
+ * @param length Set to the length of the string, if not NULL.
+ *
+ * @return 1 on success, 0 if memory allocation fails or the pool grows beyond 32 bit offsets.
+ */
+static int addToStringPool(StringPool *const pool, const char *const string, uint32_t *offset, uint32_t *length)
+{
+    size_t stringLength = string == NULL ? 0 : strlen(string);
+    if (pool->size + stringLength + 1 > UINT32_MAX)
+    {
+        fprintf(stderr, "String pool is too large for an AST file!\n");
+        return 0;
+    }
+
+    while (pool->size + stringLength + 1 > pool->capacity)
+    {
+        char *newData = realloc(pool->data, pool->capacity * 2);
+        if (newData == NULL)
+        {
+            fprintf(stderr, "Memory reallocation for the string pool failed!\n");
+            return 0;
+        }
+        pool->data = newData;
+        pool->capacity *= 2;
+    }
+
+    if (stringLength > 0)
+    {
+        memcpy(pool->data + pool->size, string, stringLength);
+    }
+    pool->data[pool->size + stringLength] = '\0';
+
+    *offset = (uint32_t)pool->size;
+    if (length != NULL)
+    {
+        *length = (uint32_t)stringLength;
+    }
+    pool->size += stringLength + 1;
+
+    return 1;
+}
+
+/**
+ * Makes the contents of a file available in memory.
+ *
+ * The file is memory-mapped read-only where the platform supports it. On Windows it is read
+ * into a heap buffer instead.
+ *
+ * @param fileName The path of the file.
+ *
+ * @param size Set to the size of the file.
+ *
+ * @param mapped Set to 1 if the contents are memory-mapped, 0 if they were read.
+ *
+ * @return The contents of the file, or NULL if the file cannot be opened, is empty or cannot be read.
+ */
+static void *readCastData(const char *const fileName, size_t *size, int *mapped)
+{
+#ifndef _WIN32
+    int descriptor = open(fileName, O_RDONLY);
+    if (descriptor < 0)
+    {
+        fprintf(stderr, "Error opening AST file %s!\n", fileName);
+        return NULL;
+    }
+
+    struct stat fileStat;
+    if (fstat(descriptor, &fileStat) != 0 || fileStat.st_size <= 0)
+    {
+        fprintf(stderr, "AST file %s is empty or cannot be read!\n", fileName);
+        close(descriptor);
+        return NULL;
+    }
+
+    void *data = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);
+    if (data == MAP_FAILED)
+    {
+        fprintf(stderr, "Memory-mapping AST file %s failed!\n", fileName);
+        return NULL;
+    }
+
+    *size = (size_t)fileStat.st_size;
+    *mapped = 1;
+    return data;
+#else
+    FILE *file = fopen(fileName, "rb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Error opening AST file %s!\n", fileName);
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long fileSize = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (fileSize <= 0)
+    {
+        fprintf(stderr, "AST file %s is empty or cannot be read!\n", fileName);
+        fclose(file);
+        return NULL;
+    }
+
+    void *data = malloc((size_t)fileSize);
+    if (data == NULL)
+    {
+        fprintf(stderr, "Memory allocation for AST file %s failed!\n", fileName);
+        fclose(file);
+        return NULL;
+    }
+
+    if (fread(data, 1, (size_t)fileSize, file) != (size_t)fileSize)
+    {
+        fprintf(stderr, "Error reading AST file %s!\n", fileName);
+        free(data);
+        fclose(file);
+        return NULL;
+    }
+    fclose(file);
+
+    *size = (size_t)fileSize;
+    *mapped = 0;
+    return data;
+#endif
+}
+
+/**
+ * Releases the contents of a file returned by `readCastData`.
+ *
+ * @param data The contents of the file.
+ *
+ * @param size The size of the file.
+ *
+ * @param mapped Whether the contents are memory-mapped.
+ */
+static void freeCastData(void *data, const size_t size, const int mapped)
+{
+#ifndef _WIN32
+    if (mapped)
+    {
+        munmap(data, size);
+        return;
+    }
+#else
+    (void)mapped;
+#endif
+    (void)size;
+    free(data);
+}
+
+/**
+ * Checks that every offset and index of an opened file stays inside the file.
+ *
+ * @param file The file to check. Its sections must already be located from the header.
+ *
+ * @return 1 if the file can be used safely, 0 otherwise.
+ */
+static int isValidCastFile(const CastFile *const file)
+{
+    const CastHeader *header = file->data;
+    if (header->stringSize == 0 || file->strings[header->stringSize - 1] != '\0')
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < file->tokenCount; i++)
+    {
+        const CastToken *token = &file->tokens[i];
+        if (token->type >= TOKEN_TYPE_COUNT || token->text >= header->stringSize || token->textLength >= header->stringSize - token->text)
+        {
+            return 0;
+        }
+        if (token->type == TOKEN_STRING && token->value.string >= header->stringSize)
+        {
+            return 0;
+        }
+        if (token->type == TOKEN_KEYWORD && (token->value.number < 0 || token->value.number > KEYWORD_RETURN))
+        {
+            return 0;
+        }
+    }
+
+    for (size_t i = 0; i < file->nodeCount; i++)
+    {
+        const FlatNode *node = &file->nodes[i];
+        if (node->subtreeSize == 0 || node->subtreeSize > file->nodeCount - i)
+        {
+            return 0;
+        }
+        if (node->flags & FLAT_NODE_MISSING)
+        {
+            if (node->subtreeSize != 1 || node->childCount != 0)
+            {
+                return 0;
+            }
+            continue;
+        }
+        if (node->type >= AST_TYPE_COUNT || node->firstToken > file->tokenCount || node->tokenCount > file->tokenCount - node->firstToken)
+        {
+            return 0;
+        }
+
+        //The subtrees of the children have to fill the subtree of the node exactly
+        size_t child = FLAT_FIRST_CHILD(i);
+        for (size_t j = 0; j < node->childCount; j++)
+        {
+            if (child >= i + node->subtreeSize)
+            {
+                return 0;
+            }
+            child = FLAT_NEXT_SIBLING(file, child);
+        }
+        if (child != i + node->subtreeSize)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*****************************************************************************************************
+                                PUBLIC AST FILE FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+int writeCastFile(const char *const fileName, const FlatAST *const ast)
+{
+    if (ast == NULL || ast->nodeCount == 0)
+    {
+        fprintf(stderr, "Flat AST is empty!\n");
+        return 0;
+    }
+
+    CastHeader header;
+    memcpy(header.magic, CAST_MAGIC, sizeof(header.magic));
+    header.version = CAST_VERSION;
+    header.byteOrder = CAST_BYTE_ORDER;
+    header.nodeCount = (uint32_t)ast->nodeCount;
+    header.tokenCount = (uint32_t)ast->tokenCount;
+    header.nodesOffset = sizeof(CastHeader);
+    if ((uint64_t)header.nodesOffset + (uint64_t)ast->nodeCount * sizeof(FlatNode) + (uint64_t)ast->tokenCount * sizeof(CastToken) > UINT32_MAX)
+    {
+        fprintf(stderr, "AST is too large for an AST file!\n");
+        return 0;
+    }
+    header.tokensOffset = header.nodesOffset + (uint32_t)(ast->nodeCount * sizeof(FlatNode));
+    header.stringsOffset = header.tokensOffset + (uint32_t)(ast->tokenCount * sizeof(CastToken));
+
+    //Convert the tokens and collect their strings
+    CastToken *tokens = calloc(ast->tokenCount > 0 ? ast->tokenCount : 1, sizeof(CastToken));
+    StringPool pool = {malloc(INITIAL_STRING_POOL_CAPACITY), 0, INITIAL_STRING_POOL_CAPACITY};
+    if (tokens == NULL || pool.data == NULL)
+    {
+        fprintf(stderr, "Memory allocation for the AST file failed!\n");
+        free(tokens);
+        free(pool.data);
+        return 0;
+    }
+
+    for (size_t i = 0; i < ast->tokenCount; i++)
+    {
+        const Token *token = ast->tokens[i];
+        tokens[i].type = (uint32_t)token->type;
+        tokens[i].loc = token->loc;
+        if (!addToStringPool(&pool, token->text, &tokens[i].text, &tokens[i].textLength))
+        {
+            free(tokens);
+            free(pool.data);
+            return 0;
+        }
+
+        switch (token->type)
+        {
+        case TOKEN_FLOATINGPOINT:
+            tokens[i].value.floatingPoint = token->value.floatingPoint;
+            break;
+        case TOKEN_STRING:
+            if (!addToStringPool(&pool, token->value.string, &tokens[i].value.string, NULL))
+            {
+                free(tokens);
+                free(pool.data);
+                return 0;
+            }
+            break;
+        case TOKEN_CHARACTER:
+            tokens[i].value.number = token->value.character;
+            break;
+        case TOKEN_KEYWORD:
+            tokens[i].value.number = token->value.keyword;
+            break;
+        default:
+            tokens[i].value.number = token->value.number;
+            break;
+        }
+    }
+    header.stringSize = (uint32_t)pool.size;
+
+    FILE *file = fopen(fileName, "wb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Error opening AST file %s for writing!\n", fileName);
+        free(tokens);
+        free(pool.data);
+        return 0;
+    }
+
+    int success = fwrite(&header, sizeof(CastHeader), 1, file) == 1
+        && fwrite(ast->nodes, sizeof(FlatNode), ast->nodeCount, file) == ast->nodeCount
+        && fwrite(tokens, sizeof(CastToken), ast->tokenCount, file) == ast->tokenCount
+        && fwrite(pool.data, 1, pool.size, file) == pool.size;
+    if (fclose(file) != 0)
+    {
+        success = 0;
+    }
+    if (!success)
+    {
+        fprintf(stderr, "Error writing AST file %s!\n", fileName);
+    }
+
+    free(tokens);
+    free(pool.data);
+    return success;
+}
+
+CastFile *openCastFile(const char *const fileName)
+{
+    if (fileName == NULL)
+    {
+        fprintf(stderr, "AST file name is NULL!\n");
+        return NULL;
+    }
+
+    CastFile *file = malloc(sizeof(CastFile));
+    if (file == NULL)
+    {
+        fprintf(stderr, "Memory allocation for AST file failed!\n");
+        return NULL;
+    }
+
+    file->data = readCastData(fileName, &file->size, &file->mapped);
+    if (file->data == NULL)
+    {
+        free(file);
+        return NULL;
+    }
+
+    //Check the header before trusting any of its offsets
+    const CastHeader *header = file->data;
+    if (file->size < sizeof(CastHeader) || memcmp(header->magic, CAST_MAGIC, sizeof(header->magic)) != 0)
+    {
+        fprintf(stderr, "%s is not an AST file!\n", fileName);
+        closeCastFile(file);
+        return NULL;
+    }
+    if (header->version != CAST_VERSION || header->byteOrder != CAST_BYTE_ORDER)
+    {
+        fprintf(stderr, "AST file %s was written by an incompatible version or platform!\n", fileName);
+        closeCastFile(file);
+        return NULL;
+    }
+    if (header->nodeCount == 0
+        || header->nodesOffset % sizeof(uint64_t) != 0 || header->tokensOffset % sizeof(uint64_t) != 0
+        || (uint64_t)header->nodesOffset + (uint64_t)header->nodeCount * sizeof(FlatNode) > file->size
+        || (uint64_t)header->tokensOffset + (uint64_t)header->tokenCount * sizeof(CastToken) > file->size
+        || (uint64_t)header->stringsOffset + header->stringSize > file->size)
+    {
+        fprintf(stderr, "AST file %s is truncated or corrupted!\n", fileName);
+        closeCastFile(file);
+        return NULL;
+    }
+
+    const char *base = file->data;
+    file->nodes = (const FlatNode *)(base + header->nodesOffset);
+    file->nodeCount = header->nodeCount;
+    file->tokens = (const CastToken *)(base + header->tokensOffset);
+    file->tokenCount = header->tokenCount;
+    file->strings = base + header->stringsOffset;
+
+    if (!isValidCastFile(file))
+    {
+        fprintf(stderr, "AST file %s is truncated or corrupted!\n", fileName);
+        closeCastFile(file);
+        return NULL;
+    }
+
+    return file;
+}
+
+void closeCastFile(CastFile *const file)
+{
+    if (file == NULL)
+    {
+        return;
+    }
+
+    freeCastData(file->data, file->size, file->mapped);
+    free(file);
+}
+
+void getCastToken(const CastFile *const file, const size_t index, Token *const token)
+{
+    const CastToken *castToken = &file->tokens[index];
+    token->text = file->strings + castToken->text;
+    token->loc = castToken->loc;
+    token->type = (TokenType)castToken->type;
+
+    switch (token->type)
+    {
+    case TOKEN_FLOATINGPOINT:
+        token->value.floatingPoint = castToken->value.floatingPoint;
+        break;
+    case TOKEN_STRING:
+        token->value.string = file->strings + castToken->value.string;
+        break;
+    case TOKEN_CHARACTER:
+        token->value.character = (char)castToken->value.number;
+        break;
+    case TOKEN_KEYWORD:
+        token->value.keyword = (Keywords)castToken->value.number;
+        break;
+    default:
+        token->value.number = (int)castToken->value.number;
+        break;
+    }
+}
@@ -0,0 +1,157 @@
+#ifndef AST_FILE_H
+#define AST_FILE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "token.h"
+#include "flat_ast.h"
+
+/**
+ * The magic bytes every serialized AST file starts with.
+ */
+#define CAST_MAGIC "CAST"
+
+/**
+ * The version of the serialized AST format. Bump it on every incompatible change.
+ */
+#define CAST_VERSION 2
+
+/**
+ * Written as a native `uint16_t`, used to reject files written with another byte order.
+ */
+#define CAST_BYTE_ORDER 0x0102
+
+/**
+ * The header of a serialized AST file.
+ *
+ * A file consists of the header, the node records, the token records and the string pool.
+ * Every reference inside the file is an index or an offset, never a pointer, so a file
+ * can be mapped at any address and used in place.
+ *
+ * - `magic`: `CAST_MAGIC`, without a terminating zero.
+ * - `version`: `CAST_VERSION`.
+ * - `byteOrder`: `CAST_BYTE_ORDER` in the byte order of the writer.
+ * - `nodeCount`: The number of `FlatNode` records.
+ * - `tokenCount`: The number of `CastToken` records.
+ * - `stringSize`: The size of the string pool in bytes.
+ * - `nodesOffset`: The offset of the node records from the start of the file.
+ * - `tokensOffset`: The offset of the token records from the start of the file.
+ * - `stringsOffset`: The offset of the string pool from the start of the file.
+ */
+typedef struct castHeader
+{
+    char magic[4];                  /** `CAST_MAGIC`. */
+    uint16_t version;               /** `CAST_VERSION`. */
+    uint16_t byteOrder;             /** `CAST_BYTE_ORDER`. */
+    uint32_t nodeCount;             /** Number of node records. */
+    uint32_t tokenCount;            /** Number of token records. */
+    uint32_t stringSize;            /** Size of the string pool. */
+    uint32_t nodesOffset;           /** Offset of the node records. */
+    uint32_t tokensOffset;          /** Offset of the token records. */
+    uint32_t stringsOffset;         /** Offset of the string pool. */
+} CastHeader;
+
+/**
+ * Represents a serialized `Token`.
+ *
+ * The texts are zero terminated strings in the string pool, referenced by their offset.
+ *
+ * - `type`: The `TokenType` of the token.
+ * - `loc`: The `SourceLoc` of the token.
+ * - `text`: The offset of the text of the token in the string pool.
+ * - `textLength`: The length of the text, without the terminating zero.
+ * - `value`: The value of the token. Integers, characters and keywords are stored in `number`,
+ *            string literals as the offset of their value in the string pool.
+ */
+typedef struct castToken
+{
+    uint32_t type;                  /** The `TokenType` of the token. */
+    uint32_t loc;                   /** The `SourceLoc` of the token. */
+    uint32_t text;                  /** Offset of the text in the string pool. */
+    uint32_t textLength;            /** Length of the text. */
+    union
+    {
+        int64_t number;             /** Integer, character and keyword values. */
+        double floatingPoint;       /** Floating-point values. */
+        uint32_t string;            /** Offset of a string literal value in the string pool. */
+    } value;
+} CastToken;
+
+/**
+ * Represents a serialized AST file opened for reading.
+ *
+ * The file is memory-mapped where the platform allows it, and read into memory otherwise.
+ * The node records are the same `FlatNode`s a `FlatAST` uses, so the tree can be walked with
+ * `FLAT_FIRST_CHILD` and `FLAT_NEXT_SIBLING` directly on the mapped data.
+ *
+ * - `data`: The contents of the file.
+ * - `size`: The size of the file in bytes.
+ * - `mapped`: 1 if `data` is memory-mapped, 0 if it was read into memory.
+ * - `nodes`: The node records, in pre-order.
+ * - `nodeCount`: The number of node records.
+ * - `tokens`: The token records, the tokens of every node in pre-order.
+ * - `tokenCount`: The number of token records.
+ * - `strings`: The string pool.
+ */
+typedef struct castFile
+{
+    void *data;                     /** The contents of the file. */
+    size_t size;                    /** Size of the file. */
+    int mapped;                     /** Whether the contents are memory-mapped. */
+    const FlatNode *nodes;          /** The node records. */
+    size_t nodeCount;               /** Number of node records. */
+    const CastToken *tokens;        /** The token records. */
+    size_t tokenCount;              /** Number of token records. */
+    const char *strings;            /** The string pool. */
+} CastFile;
+
+/**
+ * Serializes a `FlatAST` and its tokens into a file.
+ *
+ * @param fileName The path of the file to write. An existing file is overwritten.
+ *
+ * @param ast The tree to serialize.
+ *
+ * @return 1 on success, 0 if the file cannot be written or the tree is too large for the format.
+ */
+int writeCastFile(const char *const fileName, const FlatAST *const ast);
+
+/**
+ * Opens a serialized AST file for reading without deserializing it.
+ *
+ * The header and every offset and index in the file are validated, so a truncated or
+ * corrupted file is rejected instead of being read out of bounds.
+ *
+ * @param fileName The path of the file to open.
+ *
+ * @return A pointer to the opened `CastFile`, or NULL if the file cannot be read or is not a valid
+ *         serialized AST of this version.
+ *
+ * @note The caller is responsible for closing the returned `CastFile` with `closeCastFile`.
+ */
+CastFile *openCastFile(const char *const fileName);
+
+/**
+ * Closes a serialized AST file and frees its memory.
+ *
+ * @param file The `CastFile` to close. If NULL, the function does nothing.
+ */
+void closeCastFile(CastFile *const file);
+
+/**
+ * Fills a `Token` with a view of a token record.
+ *
+ * The strings of the filled `Token` point into the file, so it must not be freed with
+ * `deleteToken` and must not be used after the file is closed.
+ *
+ * @param file The file the token belongs to.
+ *
+ * @param index The index of the token record.
+ *
+ * @param token The `Token` to fill.
+ */
+void getCastToken(const CastFile *const file, const size_t index, Token *const token);
+
+#endif // AST_FILE_H
@@ -0,0 +1,282 @@
+#include "ast_intern.h"
+
+/*****************************************************************************************************
+                            PRIVATE AST INTERN FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+/* Number of slots of a new table, a power of two */
+#define INITIAL_INTERN_CAPACITY 256
+
+/* FNV-1a parameters */
+#define FNV_OFFSET_BASIS 14695981039346656037ULL
+#define FNV_PRIME 1099511628211ULL
+
+static uint64_t hashBytes(uint64_t hash, const void *const data, const size_t size);
+
+static size_t hashASTNode(const ASTType type, Token **const tokens, const size_t tokenCount, ASTNode **const children, const size_t childCount);
+
+static int isSameToken(const Token *const first, const Token *const second);
+
+static int isInternedASTNode(const ASTNode *const astNode, const ASTType type, Token **const tokens, const size_t tokenCount, ASTNode **const children, const size_t childCount);
+
+static int growASTInternTable(ASTInternTable *const table);
+
+/*****************************************************************************************************
+                                PRIVATE AST INTERN FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Mixes bytes into an FNV-1a hash.
+ *
+ * @param hash The hash so far.
+ *
+ * @param data The bytes to mix in.
+ *
+ * @param size The number of bytes.
+ *
+ * @return The updated hash.
+ */
+static uint64_t hashBytes(uint64_t hash, const void *const data, const size_t size)
+{
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/**
+ * Hashes the parts of a node that decide whether two nodes are structurally identical.
+ *
+ * @param type The type of the node.
+ *
+ * @param tokens The tokens of the node, hashed by type and text.
+ *
+ * @param tokenCount The number of tokens.
+ *
+ * @param children The children of the node, hashed by pointer.
+ *
+ * @param childCount The number of children.
+ *
+ * @return The hash of the node.
+ */
+static size_t hashASTNode(const ASTType type, Token **const tokens, const size_t tokenCount, ASTNode **const children, const size_t childCount)
+{
+    uint64_t hash = FNV_OFFSET_BASIS;
+    hash = hashBytes(hash, &type, sizeof(type));
+    hash = hashBytes(hash, &tokenCount, sizeof(tokenCount));
+    for (size_t i = 0; i < tokenCount; i++)
+    {
+        if (tokens[i] == NULL)
+        {
+            continue;
+        }
+
+        hash = hashBytes(hash, &tokens[i]->type, sizeof(tokens[i]->type));
+        if (tokens[i]->text != NULL)
+        {
+            hash = hashBytes(hash, tokens[i]->text, strlen(tokens[i]->text));
+        }
+    }
+
+    hash = hashBytes(hash, &childCount, sizeof(childCount));
+    hash = hashBytes(hash, children, childCount * sizeof(ASTNode *));
+
+    return (size_t)hash;
+}
+
+/**
+ * Checks whether two tokens have the same type and text.
+ *
+ * @param first The first token, may be NULL.
+ *
+ * @param second The second token, may be NULL.
+ *
+ * @return 1 if the tokens are the same, 0 otherwise.
+ */
+static int isSameToken(const Token *const first, const Token *const second)
+{
+    if (first == NULL || second == NULL)
+    {
+        return first == second;
+    }
+
+    if (first->text == NULL || second->text == NULL)
+    {
+        return first->type == second->type && first->text == second->text;
+    }
+
+    return first->type == second->type && strcmp(first->text, second->text) == 0;
+}
+
+/**
+ * Checks whether an interned node is structurally identical to the described one.
+ *
+ * @param astNode The interned node.
+ *
+ * @param type The type of the described node.
+ *
+ * @param tokens The tokens of the described node.
+ *
+ * @param tokenCount The number of tokens.
+ *
+ * @param children The children of the described node.
+ *
+ * @param childCount The number of children.
+ *
+ * @return 1 if the nodes are identical, 0 otherwise.
+ */
+static int isInternedASTNode(const ASTNode *const astNode, const ASTType type, Token **const tokens, const size_t tokenCount, ASTNode **const children, const size_t childCount)
+{
+    if (astNode->type != type || astNode->tokenCount != tokenCount || astNode->childCount != childCount)
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < tokenCount; i++)
+    {
+        if (!isSameToken(astNode->tokens[i], tokens[i]))
+        {
+            return 0;
+        }
+    }
+
+    for (size_t i = 0; i < childCount; i++)
+    {
+        if (astNode->children[i] != children[i])
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * Doubles the number of slots of a table and moves the interned nodes over.
+ *
+ * @param table The table to grow.
+ *
+ * @return 1 on success, 0 if memory allocation fails.
+ */
+static int growASTInternTable(ASTInternTable *const table)
+{
+    size_t capacity = table->capacity * 2;
+    ASTInternEntry *entries = calloc(capacity, sizeof(ASTInternEntry));
+    if (entries == NULL)
+    {
+        fprintf(stderr, "Memory allocation for AST Intern Table entries failed!\n");
+        return 0;
+    }
+
+    for (size_t i = 0; i < table->capacity; i++)
+    {
+        if (table->entries[i].node == NULL)
+        {
+            continue;
+        }
+
+        size_t slot = table->entries[i].hash & (capacity - 1);
+        while (entries[slot].node != NULL)
+        {
+            slot = (slot + 1) & (capacity - 1);
+        }
+        entries[slot] = table->entries[i];
+    }
+
+    free(table->entries);
+    table->entries = entries;
+    table->capacity = capacity;
+
+    return 1;
+}
+
+/*****************************************************************************************************
+                                PUBLIC AST INTERN FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+ASTInternTable *createASTInternTable(void)
+{
+    ASTInternTable *table = malloc(sizeof(ASTInternTable));
+    if (table == NULL)
+    {
+        fprintf(stderr, "Memory allocation for AST Intern Table failed!\n");
+        return NULL;
+    }
+
+    table->entries = calloc(INITIAL_INTERN_CAPACITY, sizeof(ASTInternEntry));
+    if (table->entries == NULL)
+    {
+        fprintf(stderr, "Memory allocation for AST Intern Table entries failed!\n");
+        free(table);
+        return NULL;
+    }
+    table->capacity = INITIAL_INTERN_CAPACITY;
+    table->nodeCount = 0;
+    table->hitCount = 0;
+
+    return table;
+}
+
+ASTNode *findInternedASTNode(ASTInternTable *const table, const ASTType type, Token **const tokens, const size_t tokenCount, ASTNode **const children, const size_t childCount)
+{
+    if (table == NULL)
+    {
+        return NULL;
+    }
+
+    size_t hash = hashASTNode(type, tokens, tokenCount, children, childCount);
+    size_t slot = hash & (table->capacity - 1);
+    while (table->entries[slot].node != NULL)
+    {
+        if (table->entries[slot].hash == hash && isInternedASTNode(table->entries[slot].node, type, tokens, tokenCount, children, childCount))
+        {
+            table->hitCount++;
+            return table->entries[slot].node;
+        }
+        slot = (slot + 1) & (table->capacity - 1);
+    }
+
+    return NULL;
+}
+
+int addInternedASTNode(ASTInternTable *const table, ASTNode *const astNode)
+{
+    if (table == NULL || astNode == NULL)
+    {
+        fprintf(stderr, "AST Intern Table or AST Node is NULL!\n");
+        return 0;
+    }
+
+    //Keep the table at most half full so probe sequences stay short
+    if (2 * (table->nodeCount + 1) > table->capacity && !growASTInternTable(table))
+    {
+        return 0;
+    }
+
+    size_t hash = hashASTNode(astNode->type, astNode->tokens, astNode->tokenCount, astNode->children, astNode->childCount);
+    size_t slot = hash & (table->capacity - 1);
+    while (table->entries[slot].node != NULL)
+    {
+        slot = (slot + 1) & (table->capacity - 1);
+    }
+    table->entries[slot].node = astNode;
+    table->entries[slot].hash = hash;
+    table->nodeCount++;
+
+    return 1;
+}
+
+void deleteASTInternTable(ASTInternTable *const table)
+{
+    if (table == NULL)
+    {
+        return;
+    }
+
+    free(table->entries);
+    free(table);
+}
@@ -0,0 +1,93 @@
+#ifndef AST_INTERN_H
+#define AST_INTERN_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "token.h"
+#include "AST.h"
+
+/**
+ * Represents a slot of an `ASTInternTable`.
+ *
+ * - `node`: The interned node, or NULL if the slot is empty.
+ * - `hash`: The hash of the node, kept so growing the table does not hash the nodes again.
+ */
+typedef struct astInternEntry
+{
+    ASTNode *node;                  /** The interned node. */
+    size_t hash;                    /** The hash of the node. */
+} ASTInternEntry;
+
+/**
+ * Represents a hash-consing table of `ASTNode`s.
+ *
+ * Two nodes are structurally identical if they have the same type, their tokens have the same
+ * types and texts, and their children are the same nodes. Children are compared by pointer,
+ * so once the children of a node are interned, whole subtrees are shared bottom-up and equal
+ * subtrees can be compared by pointer as well.
+ *
+ * The table does not own the nodes. Interned nodes are expected to live in an `ASTArena` that
+ * outlives the table, and to never be changed after they were interned.
+ *
+ * - `entries`: The open-addressing slots, linearly probed.
+ * - `capacity`: The number of slots, always a power of two.
+ * - `nodeCount`: The number of interned nodes.
+ * - `hitCount`: The number of lookups that found an interned node.
+ */
+typedef struct astInternTable
+{
+    ASTInternEntry *entries;        /** The slots of the table. */
+    size_t capacity;                /** Number of slots. */
+    size_t nodeCount;               /** Number of interned nodes. */
+    size_t hitCount;                /** Number of successful lookups. */
+} ASTInternTable;
+
+/**
+ * Creates a new, empty `ASTInternTable`.
+ *
+ * @return A pointer to the newly created `ASTInternTable`, or NULL if memory allocation fails.
+ *
+ * @note The caller is responsible for freeing the table with `deleteASTInternTable`.
+ */
+ASTInternTable *createASTInternTable(void);
+
+/**
+ * Looks up a node that is structurally identical to the described one.
+ *
+ * @param table The table to search.
+ *
+ * @param type The type of the node.
+ *
+ * @param tokens The tokens of the node.
+ *
+ * @param tokenCount The number of tokens.
+ *
+ * @param children The children of the node, compared by pointer.
+ *
+ * @param childCount The number of children.
+ *
+ * @return The interned node, or NULL if the table holds no identical node.
+ */
+ASTNode *findInternedASTNode(ASTInternTable *const table, const ASTType type, Token **const tokens, const size_t tokenCount, ASTNode **const children, const size_t childCount);
+
+/**
+ * Adds a node to an `ASTInternTable`.
+ *
+ * @param table The table to add the node to.
+ *
+ * @param astNode The node to add. It must not be identical to a node already in the table.
+ *
+ * @return 1 on success, 0 if memory allocation fails. The table is left unchanged on failure.
+ */
+int addInternedASTNode(ASTInternTable *const table, ASTNode *const astNode);
+
+/**
+ * Deletes an `ASTInternTable`. The interned nodes are left intact.
+ *
+ * @param table The table to delete. If NULL, the function does nothing.
+ */
+void deleteASTInternTable(ASTInternTable *const table);
+
+#endif // AST_INTERN_H
@@ -0,0 +1,244 @@
+#include "compact_ast.h"
+
+/*****************************************************************************************************
+                            PRIVATE COMPACT AST FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+_Static_assert(AST_TYPE_COUNT <= UINT8_MAX + 1, "ASTType no longer fits in the 8 bit type of a CompactNode");
+
+static int measureASTNode(const ASTNode *const astNode, size_t *nodeCount, size_t *tokenCount, size_t *childListCount);
+
+static CompactKind getCompactKind(const ASTNode *const astNode);
+
+static CompactIndex addCompactNode(CompactAST *const ast, const ASTNode *const astNode);
+
+/*****************************************************************************************************
+                                PRIVATE COMPACT AST FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Counts the nodes, tokens and child list slots a tree needs in a `CompactAST`.
+ *
+ * @param astNode The root of the tree to measure.
+ *
+ * @param nodeCount Incremented by the number of nodes.
+ *
+ * @param tokenCount Incremented by the number of tokens.
+ *
+ * @param childListCount Incremented by the number of child list slots of the list nodes.
+ *
+ * @return 1 on success, 0 if a node has more tokens than a `CompactNode` can hold.
+ */
+static int measureASTNode(const ASTNode *const astNode, size_t *nodeCount, size_t *tokenCount, size_t *childListCount)
+{
+    if (astNode->tokenCount > UINT16_MAX)
+    {
+        fprintf(stderr, "AST Node has too many tokens for a Compact AST!\n");
+        return 0;
+    }
+
+    (*nodeCount)++;
+    *tokenCount += astNode->tokenCount;
+    if (getCompactKind(astNode) == COMPACT_LIST)
+    {
+        *childListCount += astNode->childCount;
+    }
+
+    for (size_t i = 0; i < astNode->childCount; i++)
+    {
+        if (astNode->children[i] != NULL && !measureASTNode(astNode->children[i], nodeCount, tokenCount, childListCount))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * Picks the layout of a node by its number of tokens and children.
+ *
+ * @param astNode The node to convert.
+ *
+ * @return The `CompactKind` that holds the node without losing anything.
+ */
+static CompactKind getCompactKind(const ASTNode *const astNode)
+{
+    if (astNode->tokenCount == 1 && astNode->childCount == 0)
+    {
+        return COMPACT_LEAF;
+    }
+    if (astNode->tokenCount == 1 && astNode->childCount == 1)
+    {
+        return COMPACT_UNARY;
+    }
+    if (astNode->tokenCount == 1 && astNode->childCount == 2)
+    {
+        return COMPACT_BINARY;
+    }
+    if (astNode->tokenCount == 2 && astNode->childCount <= 1)
+    {
+        return COMPACT_BRACKETED;
+    }
+
+    return COMPACT_LIST;
+}
+
+/**
+ * Appends a node and its subtree to a `CompactAST` in pre-order.
+ *
+ * The node, its tokens and, for list nodes, its child list slots are reserved before the
+ * children are added, so the tokens and the child list of every node stay consecutive.
+ *
+ * @param ast The tree being built. Its counts are used as the fill positions of the arrays.
+ *
+ * @param astNode The node to add.
+ *
+ * @return The index of the added node, or `COMPACT_NONE` if `astNode` is NULL.
+ */
+static CompactIndex addCompactNode(CompactAST *const ast, const ASTNode *const astNode)
+{
+    if (astNode == NULL)
+    {
+        return COMPACT_NONE;
+    }
+
+    CompactIndex index = (CompactIndex)ast->nodeCount++;
+    CompactNode *node = &ast->nodes[index];
+    node->kind = (uint8_t)getCompactKind(astNode);
+    node->type = (uint8_t)astNode->type;
+    node->tokenCount = (uint16_t)astNode->tokenCount;
+    node->firstToken = (CompactIndex)ast->tokenCount;
+    for (size_t i = 0; i < astNode->tokenCount; i++)
+    {
+        ast->tokens[ast->tokenCount++] = astNode->tokens[i];
+    }
+
+    if (node->kind == COMPACT_LIST)
+    {
+        CompactIndex first = (CompactIndex)ast->childListCount;
+        node->as.list.first = first;
+        node->as.list.count = (uint32_t)astNode->childCount;
+        ast->childListCount += astNode->childCount;
+
+        for (size_t i = 0; i < astNode->childCount; i++)
+        {
+            CompactIndex child = addCompactNode(ast, astNode->children[i]);
+            ast->childList[first + i] = child;
+        }
+        return index;
+    }
+
+    node->as.children[0] = COMPACT_NONE;
+    node->as.children[1] = COMPACT_NONE;
+    for (size_t i = 0; i < astNode->childCount; i++)
+    {
+        CompactIndex child = addCompactNode(ast, astNode->children[i]);
+        ast->nodes[index].as.children[i] = child;
+    }
+
+    return index;
+}
+
+/*****************************************************************************************************
+                                PUBLIC COMPACT AST FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+CompactAST *createCompactAST(const ASTNode *const root)
+{
+    if (root == NULL)
+    {
+        fprintf(stderr, "AST root is NULL!\n");
+        return NULL;
+    }
+
+    size_t nodeCount = 0;
+    size_t tokenCount = 0;
+    size_t childListCount = 0;
+    if (!measureASTNode(root, &nodeCount, &tokenCount, &childListCount))
+    {
+        return NULL;
+    }
+
+    if (nodeCount >= COMPACT_NONE || tokenCount >= COMPACT_NONE || childListCount >= COMPACT_NONE)
+    {
+        fprintf(stderr, "AST is too large for a Compact AST!\n");
+        return NULL;
+    }
+
+    CompactAST *ast = malloc(sizeof(CompactAST));
+    if (ast == NULL)
+    {
+        fprintf(stderr, "Memory allocation for Compact AST failed!\n");
+        return NULL;
+    }
+
+    ast->nodes = malloc(nodeCount * sizeof(CompactNode));
+    ast->tokens = malloc((tokenCount > 0 ? tokenCount : 1) * sizeof(Token *));
+    ast->childList = malloc((childListCount > 0 ? childListCount : 1) * sizeof(CompactIndex));
+    if (ast->nodes == NULL || ast->tokens == NULL || ast->childList == NULL)
+    {
+        fprintf(stderr, "Memory allocation for Compact AST arrays failed!\n");
+        deleteCompactAST(ast);
+        return NULL;
+    }
+    ast->nodeCount = 0;
+    ast->tokenCount = 0;
+    ast->childListCount = 0;
+
+    addCompactNode(ast, root);
+
+    return ast;
+}
+
+void deleteCompactAST(CompactAST *const ast)
+{
+    if (ast == NULL)
+    {
+        return;
+    }
+
+    free(ast->nodes);
+    free(ast->tokens);
+    free(ast->childList);
+    free(ast);
+}
+
+size_t getCompactChildCount(const CompactAST *const ast, const CompactIndex node)
+{
+    const CompactNode *compactNode = &ast->nodes[node];
+    switch (compactNode->kind)
+    {
+    case COMPACT_LEAF:
+        return 0;
+    case COMPACT_UNARY:
+        return 1;
+    case COMPACT_BINARY:
+        return 2;
+    case COMPACT_BRACKETED:
+        return compactNode->as.children[0] == COMPACT_NONE ? 0 : 1;
+    default:
+        return compactNode->as.list.count;
+    }
+}
+
+CompactIndex getCompactChild(const CompactAST *const ast, const CompactIndex node, const size_t child)
+{
+    const CompactNode *compactNode = &ast->nodes[node];
+    if (compactNode->kind == COMPACT_LIST)
+    {
+        return ast->childList[compactNode->as.list.first + child];
+    }
+
+    return compactNode->as.children[child];
+}
+
+size_t getCompactASTSize(const CompactAST *const ast)
+{
+    if (ast == NULL)
+    {
+        return 0;
+    }
+
+    return sizeof(CompactAST) + ast->nodeCount * sizeof(CompactNode) + ast->tokenCount * sizeof(Token *) + ast->childListCount * sizeof(CompactIndex);
+}
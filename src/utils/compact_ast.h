@@ -0,0 +1,151 @@
+#ifndef COMPACT_AST_H
+#define COMPACT_AST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "token.h"
+#include "AST.h"
+
+/**
+ * Index of a node, token or child slot inside a `CompactAST`.
+ */
+typedef uint32_t CompactIndex;
+
+/**
+ * Marks a missing child of a fixed-arity node.
+ */
+#define COMPACT_NONE UINT32_MAX
+
+/**
+ * Enumeration of the node layouts of a `CompactAST`.
+ *
+ * The layout is picked by the shape of the `ASTNode` it was converted from, so converting
+ * is lossless for every node:
+ *
+ * - `COMPACT_LEAF`: One token and no children, e.g. literals and identifiers.
+ * - `COMPACT_UNARY`: One token and one child, e.g. unary operators and declarations without declarators.
+ * - `COMPACT_BINARY`: One token and two children, e.g. binary operators, assignments and declarations.
+ * - `COMPACT_BRACKETED`: Two tokens and at most one child, e.g. calls, subscripts and parentheses.
+ * - `COMPACT_LIST`: Any other number of tokens and children, stored in the shared child list.
+ */
+typedef enum compactKind
+{
+    COMPACT_LEAF,
+    COMPACT_UNARY,
+    COMPACT_BINARY,
+    COMPACT_BRACKETED,
+    COMPACT_LIST,
+} CompactKind;
+
+/**
+ * Represents a node of a `CompactAST`.
+ *
+ * Every node takes 16 bytes. The tokens of a node are always consecutive in the token table,
+ * so a node only stores the index of its first token. Fixed-arity nodes store the indices of
+ * their children inline, list nodes store a range of the shared child list.
+ *
+ * - `kind`: The layout of the node, a `CompactKind`.
+ * - `type`: The `ASTType` of the node.
+ * - `tokenCount`: The number of tokens of the node.
+ * - `firstToken`: The index of the first token in the token table.
+ * - `as.children`: The children of fixed-arity nodes, `COMPACT_NONE` where a child is missing.
+ * - `as.list`: The first slot and the number of slots in the child list of list nodes.
+ */
+typedef struct compactNode
+{
+    uint8_t kind;                   /** The `CompactKind` of the node. */
+    uint8_t type;                   /** The `ASTType` of the node. */
+    uint16_t tokenCount;            /** Number of tokens of the node. */
+    CompactIndex firstToken;        /** Index of the first token in the token table. */
+    union
+    {
+        CompactIndex children[2];   /** Inline children of fixed-arity nodes. */
+        struct
+        {
+            CompactIndex first;     /** First slot in the child list. */
+            uint32_t count;         /** Number of children. */
+        } list;                     /** Children of list nodes. */
+    } as;
+} CompactNode;
+
+/**
+ * Represents an Abstract Syntax Tree (AST) stored in three contiguous arrays.
+ *
+ * - `nodes`: The nodes, in pre-order. The root is node 0.
+ * - `nodeCount`: The number of nodes.
+ * - `tokens`: The token table, the tokens of every node in pre-order.
+ * - `tokenCount`: The number of tokens in the token table.
+ * - `childList`: The child indices of the list nodes.
+ * - `childListCount`: The number of slots in the child list.
+ *
+ * @note The `CompactAST` does not own the `Token` objects, only the table pointing to them.
+ */
+typedef struct compactAST
+{
+    CompactNode *nodes;             /** The nodes in pre-order. */
+    size_t nodeCount;               /** Number of nodes. */
+    Token **tokens;                 /** The token table. */
+    size_t tokenCount;              /** Number of tokens in the token table. */
+    CompactIndex *childList;        /** The children of the list nodes. */
+    size_t childListCount;          /** Number of slots in the child list. */
+} CompactAST;
+
+/**
+ * Converts a tree of `ASTNode`s to a `CompactAST`.
+ *
+ * The tree is measured first, so each of the three arrays is allocated once with its exact size.
+ * The `ASTNode` tree is not modified and can be freed afterwards.
+ *
+ * @param root The root of the tree to convert.
+ *
+ * @return A pointer to the new `CompactAST`, or NULL if the root is NULL, memory allocation fails,
+ *         or the tree is too large for 32 bit indices.
+ *
+ * @note The caller is responsible for freeing the returned `CompactAST` with `deleteCompactAST`.
+ */
+CompactAST *createCompactAST(const ASTNode *const root);
+
+/**
+ * Deletes a `CompactAST` and frees its memory.
+ *
+ * @param ast The `CompactAST` to delete. If NULL, the function does nothing.
+ *
+ * @note The `Token` objects referenced by the tree are not freed.
+ */
+void deleteCompactAST(CompactAST *const ast);
+
+/**
+ * Returns the number of children of a node.
+ *
+ * @param ast The tree the node belongs to.
+ *
+ * @param node The index of the node.
+ *
+ * @return The number of children, missing children of fixed-arity nodes are not counted.
+ */
+size_t getCompactChildCount(const CompactAST *const ast, const CompactIndex node);
+
+/**
+ * Returns a child of a node.
+ *
+ * @param ast The tree the node belongs to.
+ *
+ * @param node The index of the node.
+ *
+ * @param child The position of the child, less than `getCompactChildCount`.
+ *
+ * @return The index of the child node.
+ */
+CompactIndex getCompactChild(const CompactAST *const ast, const CompactIndex node, const size_t child);
+
+/**
+ * Returns the number of bytes used by a `CompactAST`, including its arrays.
+ *
+ * @param ast The tree to measure.
+ *
+ * @return The size in bytes, or 0 if the tree is NULL.
+ */
+size_t getCompactASTSize(const CompactAST *const ast);
+
+#endif // COMPACT_AST_H
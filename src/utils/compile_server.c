@@ -0,0 +1,559 @@
+#include "compile_server.h"
+
+#ifndef _WIN32
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+#ifndef _WIN32
+/*****************************************************************************************************
+                            PRIVATE COMPILE SERVER FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+/* Size of the chunks the captured output is sent in */
+#define COMPILE_SERVER_CHUNK_SIZE (64 * 1024)
+
+/* Longest argument or working directory a request may carry */
+#define COMPILE_SERVER_MAX_STRING (1024 * 1024)
+
+/* Most arguments a request may carry */
+#define COMPILE_SERVER_MAX_ARGS 65536
+
+/* Set by the signal handler to stop the server */
+static volatile sig_atomic_t stopRequested = 0;
+
+static void requestStop(int signal);
+
+static int setSocketAddress(struct sockaddr_un *const address, const char *const socketPath);
+
+static int writeAll(const int fd, const void *const data, const size_t size);
+
+static int readAll(const int fd, void *const data, const size_t size);
+
+static int writeString(const int fd, const char *const string);
+
+static char *readString(const int fd);
+
+static int writeFrame(const int fd, const CompileServerFrame tag, const void *const data, const uint32_t size);
+
+static int sendCapturedStream(const int fd, const CompileServerFrame tag, FILE *const stream);
+
+static void freeRequest(char *cwd, char **argv, const int argc);
+
+static int readRequest(const int fd, char **const cwd, char ***const argv, int *const argc);
+
+static int serveRequest(const int fd, const CompileRequestHandler handler, void *const context);
+
+/*****************************************************************************************************
+                                PRIVATE COMPILE SERVER FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Asks the server loop to stop. Installed for SIGINT and SIGTERM.
+ *
+ * @param signal The received signal.
+ */
+static void requestStop(int signal)
+{
+    (void)signal;
+    stopRequested = 1;
+}
+
+/**
+ * Fills in the address of a Unix domain socket.
+ *
+ * @param address The address to fill in.
+ *
+ * @param socketPath The path of the socket.
+ *
+ * @return 1 on success, 0 if the path is too long.
+ */
+static int setSocketAddress(struct sockaddr_un *const address, const char *const socketPath)
+{
+    memset(address, 0, sizeof(struct sockaddr_un));
+    address->sun_family = AF_UNIX;
+    if (strlen(socketPath) >= sizeof(address->sun_path))
+    {
+        fprintf(stderr, "Socket path %s is too long!\n", socketPath);
+        return 0;
+    }
+    strcpy(address->sun_path, socketPath);
+
+    return 1;
+}
+
+/**
+ * Writes a whole buffer to a socket, retrying short and interrupted writes.
+ *
+ * @param fd The socket.
+ *
+ * @param data The bytes to write.
+ *
+ * @param size The number of bytes.
+ *
+ * @return 1 on success, 0 if the connection is broken.
+ */
+static int writeAll(const int fd, const void *const data, const size_t size)
+{
+    const char *bytes = data;
+    size_t written = 0;
+    while (written < size)
+    {
+        ssize_t result = write(fd, bytes + written, size - written);
+        if (result < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (result <= 0)
+        {
+            return 0;
+        }
+        written += (size_t)result;
+    }
+
+    return 1;
+}
+
+/**
+ * Reads a whole buffer from a socket, retrying short and interrupted reads.
+ *
+ * @param fd The socket.
+ *
+ * @param data The buffer to fill.
+ *
+ * @param size The number of bytes to read.
+ *
+ * @return 1 on success, 0 if the connection is closed or broken first.
+ */
+static int readAll(const int fd, void *const data, const size_t size)
+{
+    char *bytes = data;
+    size_t received = 0;
+    while (received < size)
+    {
+        ssize_t result = recv(fd, bytes + received, size - received, 0);
+        if (result < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (result <= 0)
+        {
+            return 0;
+        }
+        received += (size_t)result;
+    }
+
+    return 1;
+}
+
+/**
+ * Writes a string as a 32-bit length followed by its characters.
+ *
+ * @param fd The socket.
+ *
+ * @param string The string to write.
+ *
+ * @return 1 on success, 0 if the connection is broken.
+ */
+static int writeString(const int fd, const char *const string)
+{
+    uint32_t length = (uint32_t)strlen(string);
+    return writeAll(fd, &length, sizeof(length)) && writeAll(fd, string, length);
+}
+
+/**
+ * Reads a string written by `writeString`.
+ *
+ * @param fd The socket.
+ *
+ * @return The string, or NULL if the connection breaks, the string is too long or memory
+ *         allocation fails. The caller frees it.
+ */
+static char *readString(const int fd)
+{
+    uint32_t length;
+    if (!readAll(fd, &length, sizeof(length)) || length > COMPILE_SERVER_MAX_STRING)
+    {
+        return NULL;
+    }
+
+    char *string = malloc((size_t)length + 1);
+    if (string == NULL)
+    {
+        fprintf(stderr, "Memory allocation for request string failed!\n");
+        return NULL;
+    }
+
+    if (!readAll(fd, string, length))
+    {
+        free(string);
+        return NULL;
+    }
+    string[length] = '\0';
+
+    return string;
+}
+
+/**
+ * Writes one frame of the answer to a request.
+ *
+ * @param fd The socket.
+ *
+ * @param tag The kind of the frame.
+ *
+ * @param data The payload.
+ *
+ * @param size The size of the payload.
+ *
+ * @return 1 on success, 0 if the connection is broken.
+ */
+static int writeFrame(const int fd, const CompileServerFrame tag, const void *const data, const uint32_t size)
+{
+    unsigned char tagByte = (unsigned char)tag;
+    return writeAll(fd, &tagByte, 1) && writeAll(fd, &size, sizeof(size)) && writeAll(fd, data, size);
+}
+
+/**
+ * Sends what the handler printed to a captured stream, in chunks.
+ *
+ * @param fd The socket.
+ *
+ * @param tag The frame tag of the stream.
+ *
+ * @param stream The temporary file the stream was redirected to.
+ *
+ * @return 1 on success, 0 if the connection is broken.
+ */
+static int sendCapturedStream(const int fd, const CompileServerFrame tag, FILE *const stream)
+{
+    static char buffer[COMPILE_SERVER_CHUNK_SIZE];
+
+    rewind(stream);
+    size_t size;
+    while ((size = fread(buffer, 1, sizeof(buffer), stream)) > 0)
+    {
+        if (!writeFrame(fd, tag, buffer, (uint32_t)size))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * Frees a request read by `readRequest`.
+ *
+ * @param cwd The working directory.
+ *
+ * @param argv The arguments.
+ *
+ * @param argc The number of arguments read so far.
+ */
+static void freeRequest(char *cwd, char **argv, const int argc)
+{
+    for (int i = 0; argv != NULL && i < argc; i++)
+    {
+        free(argv[i]);
+    }
+    free(argv);
+    free(cwd);
+}
+
+/**
+ * Reads a compile request: the magic, the version, the working directory and the arguments.
+ *
+ * @param fd The socket.
+ *
+ * @param cwd Set to the working directory of the client.
+ *
+ * @param argv Set to the NULL terminated arguments of the client.
+ *
+ * @param argc Set to the number of arguments.
+ *
+ * @return 1 on success, 0 if the request is malformed or the connection breaks.
+ */
+static int readRequest(const int fd, char **const cwd, char ***const argv, int *const argc)
+{
+    uint32_t header[3];
+    if (!readAll(fd, header, sizeof(header)))
+    {
+        return 0;
+    }
+
+    if (header[0] != COMPILE_SERVER_MAGIC || header[1] != COMPILE_SERVER_VERSION)
+    {
+        fprintf(stderr, "Unknown compile request format!\n");
+        return 0;
+    }
+
+    if (header[2] == 0 || header[2] > COMPILE_SERVER_MAX_ARGS)
+    {
+        fprintf(stderr, "Invalid compile request argument count %u!\n", header[2]);
+        return 0;
+    }
+
+    *cwd = readString(fd);
+    *argv = calloc((size_t)header[2] + 1, sizeof(char *));
+    if (*cwd == NULL || *argv == NULL)
+    {
+        freeRequest(*cwd, *argv, 0);
+        return 0;
+    }
+
+    for (*argc = 0; *argc < (int)header[2]; (*argc)++)
+    {
+        (*argv)[*argc] = readString(fd);
+        if ((*argv)[*argc] == NULL)
+        {
+            freeRequest(*cwd, *argv, *argc);
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * Reads a request from a connection, runs the handler with the output captured, and answers.
+ *
+ * @param fd The connection.
+ *
+ * @param handler The function compiling the request.
+ *
+ * @param context Passed to the handler.
+ *
+ * @return 1 if the request was answered, 0 otherwise.
+ */
+static int serveRequest(const int fd, const CompileRequestHandler handler, void *const context)
+{
+    char *cwd = NULL;
+    char **argv = NULL;
+    int argc = 0;
+    if (!readRequest(fd, &cwd, &argv, &argc))
+    {
+        return 0;
+    }
+
+    char *serverCwd = getcwd(NULL, 0);
+    FILE *out = tmpfile();
+    FILE *err = tmpfile();
+    if (serverCwd == NULL || out == NULL || err == NULL)
+    {
+        fprintf(stderr, "Failed to set up the compile request!\n");
+        free(serverCwd);
+        if (out != NULL)
+        {
+            fclose(out);
+        }
+        if (err != NULL)
+        {
+            fclose(err);
+        }
+        freeRequest(cwd, argv, argc);
+        return 0;
+    }
+
+    //Run the handler in the directory of the client with its output captured
+    fflush(stdout);
+    fflush(stderr);
+    int savedOut = dup(STDOUT_FILENO);
+    int savedErr = dup(STDERR_FILENO);
+    dup2(fileno(out), STDOUT_FILENO);
+    dup2(fileno(err), STDERR_FILENO);
+
+    int32_t exitCode = -1;
+    if (chdir(cwd) != 0)
+    {
+        fprintf(stderr, "Cannot change to the directory %s!\n", cwd);
+    }
+    else
+    {
+        exitCode = handler(argc, argv, context);
+    }
+
+    fflush(stdout);
+    fflush(stderr);
+    dup2(savedOut, STDOUT_FILENO);
+    dup2(savedErr, STDERR_FILENO);
+    close(savedOut);
+    close(savedErr);
+    if (chdir(serverCwd) != 0)
+    {
+        fprintf(stderr, "Cannot change back to the directory %s!\n", serverCwd);
+    }
+
+    int success = sendCapturedStream(fd, COMPILE_SERVER_STDERR, err)
+               && sendCapturedStream(fd, COMPILE_SERVER_STDOUT, out)
+               && writeFrame(fd, COMPILE_SERVER_EXIT, &exitCode, sizeof(exitCode));
+
+    fclose(out);
+    fclose(err);
+    free(serverCwd);
+    freeRequest(cwd, argv, argc);
+
+    return success;
+}
+#endif
+
+/*****************************************************************************************************
+                                PUBLIC COMPILE SERVER FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+int runCompileServer(const char *const socketPath, const CompileRequestHandler handler, void *const context)
+{
+#ifdef _WIN32
+    (void)socketPath;
+    (void)handler;
+    (void)context;
+    fprintf(stderr, "The compile server is not supported on Windows!\n");
+    return -1;
+#else
+    struct sockaddr_un address;
+    if (socketPath == NULL || handler == NULL || !setSocketAddress(&address, socketPath))
+    {
+        return -1;
+    }
+
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0)
+    {
+        fprintf(stderr, "Failed to create the server socket!\n");
+        return -1;
+    }
+
+    //Replace the socket of a server that is no longer running
+    if (bind(listener, (struct sockaddr *)&address, sizeof(address)) != 0 && errno == EADDRINUSE)
+    {
+        int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+        int live = probe >= 0 && connect(probe, (struct sockaddr *)&address, sizeof(address)) == 0;
+        if (probe >= 0)
+        {
+            close(probe);
+        }
+
+        if (live || unlink(socketPath) != 0 || bind(listener, (struct sockaddr *)&address, sizeof(address)) != 0)
+        {
+            fprintf(stderr, "Socket %s is in use!\n", socketPath);
+            close(listener);
+            return -1;
+        }
+    }
+
+    if (listen(listener, SOMAXCONN) != 0)
+    {
+        fprintf(stderr, "Failed to listen on %s!\n", socketPath);
+        close(listener);
+        unlink(socketPath);
+        return -1;
+    }
+
+    //Stop on SIGINT and SIGTERM, interrupting accept, and survive clients that hang up
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = requestStop;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    fprintf(stderr, "Compile server listening on %s\n", socketPath);
+    while (!stopRequested)
+    {
+        int connection = accept(listener, NULL, NULL);
+        if (connection < 0)
+        {
+            continue;
+        }
+
+        serveRequest(connection, handler, context);
+        close(connection);
+    }
+
+    close(listener);
+    unlink(socketPath);
+    return 0;
+#endif
+}
+
+int runCompileClient(const char *const socketPath, int argc, char **argv, int *const exitCode)
+{
+#ifdef _WIN32
+    (void)socketPath;
+    (void)argc;
+    (void)argv;
+    (void)exitCode;
+    return 0;
+#else
+    struct sockaddr_un address;
+    if (socketPath == NULL || argv == NULL || !setSocketAddress(&address, socketPath))
+    {
+        return 0;
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+    {
+        return 0;
+    }
+
+    if (connect(fd, (struct sockaddr *)&address, sizeof(address)) != 0)
+    {
+        close(fd);
+        return 0;
+    }
+    signal(SIGPIPE, SIG_IGN);
+
+    //Send the arguments and the working directory
+    char *cwd = getcwd(NULL, 0);
+    uint32_t header[3] = {COMPILE_SERVER_MAGIC, COMPILE_SERVER_VERSION, (uint32_t)argc};
+    int sent = cwd != NULL && writeAll(fd, header, sizeof(header)) && writeString(fd, cwd);
+    for (int i = 0; sent && i < argc; i++)
+    {
+        sent = writeString(fd, argv[i]);
+    }
+    free(cwd);
+
+    if (!sent)
+    {
+        close(fd);
+        return 0;
+    }
+
+    //Copy the frames to the standard streams until the exit code arrives
+    char *buffer = malloc(COMPILE_SERVER_CHUNK_SIZE);
+    int answered = 0;
+    int received = 0;
+    unsigned char tag;
+    uint32_t size;
+    while (buffer != NULL && readAll(fd, &tag, 1) && readAll(fd, &size, sizeof(size)) && size <= COMPILE_SERVER_CHUNK_SIZE && readAll(fd, buffer, size))
+    {
+        if (tag == COMPILE_SERVER_EXIT && size == sizeof(int32_t))
+        {
+            int32_t code;
+            memcpy(&code, buffer, sizeof(code));
+            *exitCode = code;
+            answered = 1;
+            break;
+        }
+
+        fwrite(buffer, 1, size, tag == COMPILE_SERVER_STDERR ? stderr : stdout);
+        received = 1;
+    }
+
+    //Part of the answer is already printed, so compiling locally would repeat it
+    if (!answered && received)
+    {
+        fprintf(stderr, "The compile server closed the connection!\n");
+        *exitCode = -1;
+        answered = 1;
+    }
+
+    free(buffer);
+    close(fd);
+    return answered;
+#endif
+}
@@ -0,0 +1,79 @@
+#ifndef COMPILE_SERVER_H
+#define COMPILE_SERVER_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * The first bytes of every request, followed by the protocol version.
+ */
+#define COMPILE_SERVER_MAGIC 0x434d4353u
+#define COMPILE_SERVER_VERSION 1
+
+/**
+ * The tags of the frames the server answers a request with.
+ *
+ * Every frame is a one byte tag and a 32-bit length followed by that many bytes. The output and
+ * the errors of the compilation come first, the exit frame with a 32-bit exit code comes last.
+ */
+typedef enum compileServerFrame
+{
+    COMPILE_SERVER_STDOUT = 1,
+    COMPILE_SERVER_STDERR = 2,
+    COMPILE_SERVER_EXIT = 3,
+} CompileServerFrame;
+
+/**
+ * Compiles one request on the server.
+ *
+ * The handler runs with the working directory of the client, and with the standard output and
+ * the standard error redirected, so whatever it prints is sent back to the client.
+ *
+ * @param argc The number of arguments of the client.
+ *
+ * @param argv The arguments of the client, `argv[0]` is the name of the program.
+ *
+ * @param context The context given to `runCompileServer`.
+ *
+ * @return The exit code for the client.
+ */
+typedef int (*CompileRequestHandler)(int argc, char **argv, void *const context);
+
+/**
+ * Serves compile requests on a Unix domain socket until the process receives SIGINT or SIGTERM.
+ *
+ * The requests are handled one at a time, so the handler can keep state between them without
+ * locking. The socket file is removed when the server stops.
+ *
+ * @param socketPath The path of the socket. A stale socket left by a server that is no longer
+ *                   running is replaced, a live one is an error.
+ *
+ * @param handler The function compiling a request.
+ *
+ * @param context Passed to the handler.
+ *
+ * @return 0 once the server stopped, -1 if the socket could not be set up.
+ */
+int runCompileServer(const char *const socketPath, const CompileRequestHandler handler, void *const context);
+
+/**
+ * Sends a compile request to a server and copies its answer to the standard streams.
+ *
+ * The request holds the arguments and the working directory of the client.
+ *
+ * @param socketPath The path of the socket of the server.
+ *
+ * @param argc The number of arguments.
+ *
+ * @param argv The arguments, `argv[0]` is the name of the program.
+ *
+ * @param exitCode Set to the exit code the server answered with.
+ *
+ * @return 1 if the server answered, 0 if it could not be reached or the connection broke before
+ *         it sent anything, in which case the caller can compile locally instead.
+ */
+int runCompileClient(const char *const socketPath, int argc, char **argv, int *const exitCode);
+
+#endif // COMPILE_SERVER_H
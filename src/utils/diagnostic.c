@@ -0,0 +1,495 @@
+#include "diagnostic.h"
+
+/*****************************************************************************************************
+                            PRIVATE DIAGNOSTIC FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Number of bytes the buffer of an engine starts with
+ */
+#define INITIAL_DIAGNOSTIC_BUFFER_SIZE 256
+
+/**
+ * Number of characters of the text of a token, and of the value of a string token, copied into a diagnostic
+ */
+#define DIAGNOSTIC_TEXT_LIMIT 64
+
+/**
+ * The message templates, indexed by `DiagnosticId`
+ */
+static const char *const diagnosticMessages[DIAG_COUNT] = {
+    "Unknown character found while lexing!",
+    "The multi-line comment was not closed!",
+    "The string wasn't closed!",
+    "The character wasn't closed!",
+    "Invalid escape string format.",
+    "Invalid digit in an octal number",
+    "Invalid character in a hexadecimal number",
+    "Expected %0 but found:",
+    "Expected token of type %0 but found %1:",
+};
+
+/**
+ * The start of every diagnostic in the buffer, followed by its arguments. Each argument is its
+ * kind as one byte, followed by a pointer for a name, an `int32_t` for a token type, and a
+ * `DiagnosticToken` with the copied characters for a token.
+ */
+typedef struct diagnosticHeader
+{
+    uint16_t id;                    /** The `DiagnosticId`. */
+    uint8_t argCount;               /** The number of arguments. */
+    uint8_t reserved;               /** Unused. */
+    SourceLoc loc;                  /** The location. */
+    uint32_t length;                /** The characters covered from the location. */
+} DiagnosticHeader;
+
+/**
+ * A token argument in the buffer, followed by `textLength` characters of its text and
+ * `valueLength` characters of the value of a string token.
+ */
+typedef struct diagnosticToken
+{
+    int32_t type;                   /** The `TokenType`. */
+    SourceLoc loc;                  /** The location of the token. */
+    TokenValue value;               /** The value, without the string of a string token. */
+    uint8_t textLength;             /** The copied characters of the text. */
+    uint8_t valueLength;            /** The copied characters of the string value. */
+    uint8_t truncated;              /** 1 if the text or the value was cut. */
+} DiagnosticToken;
+
+/**
+ * Represents a token argument read back from the buffer.
+ */
+typedef struct decodedToken
+{
+    Token token;                    /** The token, its text and value point into the buffers below. */
+    char text[DIAGNOSTIC_TEXT_LIMIT + 4];   /** The text, with `...` if it was cut. */
+    char value[DIAGNOSTIC_TEXT_LIMIT + 4];  /** The string value, with `...` if it was cut. */
+} DecodedToken;
+
+/**
+ * Represents an argument read back from the buffer.
+ */
+typedef struct decodedArg
+{
+    DiagnosticArgKind kind;         /** The kind of the argument. */
+    const char *name;               /** The name, for a name argument. */
+    TokenType tokenType;            /** The type, for a token type or token argument. */
+    size_t tokenOffset;             /** The offset of the `DiagnosticToken`, for a token argument. */
+} DecodedArg;
+
+static int reserveDiagnosticBytes(DiagnosticEngine *const engine, const size_t size);
+
+static void appendDiagnosticBytes(DiagnosticEngine *const engine, const void *const data, const size_t size);
+
+static size_t getTokenArgSize(const Token *const token);
+
+static void appendTokenArg(DiagnosticEngine *const engine, const Token *const token);
+
+static size_t decodeArgs(const DiagnosticEngine *const engine, size_t offset, const size_t argCount, DecodedArg *const args);
+
+static void decodeToken(const DiagnosticEngine *const engine, const size_t offset, DecodedToken *const decoded);
+
+static void printMessage(const char *message, const DecodedArg *const args, const size_t argCount, FILE *const stream);
+
+/*****************************************************************************************************
+                                PRIVATE DIAGNOSTIC FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Makes room for more bytes at the end of the buffer of an engine.
+ *
+ * @param engine The engine.
+ *
+ * @param size The number of bytes.
+ *
+ * @return 1 on success, 0 if memory allocation fails.
+ */
+static int reserveDiagnosticBytes(DiagnosticEngine *const engine, const size_t size)
+{
+    if (engine->size + size <= engine->capacity)
+    {
+        return 1;
+    }
+
+    size_t capacity = engine->capacity > 0 ? engine->capacity : INITIAL_DIAGNOSTIC_BUFFER_SIZE;
+    while (capacity < engine->size + size)
+    {
+        capacity *= 2;
+    }
+
+    uint8_t *buffer = reallocateMemory(MEMORY_ERRORS, engine->buffer, capacity);
+    if (buffer == NULL)
+    {
+        fprintf(stderr, "Memory reallocation for Diagnostics failed!\n");
+        return 0;
+    }
+    engine->buffer = buffer;
+    engine->capacity = capacity;
+    return 1;
+}
+
+/**
+ * Copies bytes to the end of the buffer of an engine, which must have room for them.
+ *
+ * @param engine The engine.
+ *
+ * @param data The bytes, may be NULL if `size` is 0.
+ *
+ * @param size The number of bytes.
+ */
+static void appendDiagnosticBytes(DiagnosticEngine *const engine, const void *const data, const size_t size)
+{
+    if (size > 0)
+    {
+        memcpy(engine->buffer + engine->size, data, size);
+        engine->size += size;
+    }
+}
+
+/**
+ * Returns the number of bytes a token argument takes in the buffer, without its kind.
+ *
+ * @param token The token.
+ *
+ * @return The number of bytes.
+ */
+static size_t getTokenArgSize(const Token *const token)
+{
+    size_t textLength = token->text != NULL ? strnlen(token->text, DIAGNOSTIC_TEXT_LIMIT) : 0;
+    size_t valueLength = token->type == TOKEN_STRING && token->value.string != NULL ? strnlen(token->value.string, DIAGNOSTIC_TEXT_LIMIT) : 0;
+    return sizeof(DiagnosticToken) + textLength + valueLength;
+}
+
+/**
+ * Copies a token argument to the end of the buffer of an engine, which must have room for it.
+ *
+ * @param engine The engine.
+ *
+ * @param token The token.
+ */
+static void appendTokenArg(DiagnosticEngine *const engine, const Token *const token)
+{
+    DiagnosticToken record;
+    memset(&record, 0, sizeof(record));
+    record.type = (int32_t)token->type;
+    record.loc = token->loc;
+    record.value = token->value;
+
+    size_t textLength = token->text != NULL ? strnlen(token->text, DIAGNOSTIC_TEXT_LIMIT + 1) : 0;
+    const char *string = token->type == TOKEN_STRING ? token->value.string : NULL;
+    size_t valueLength = string != NULL ? strnlen(string, DIAGNOSTIC_TEXT_LIMIT + 1) : 0;
+    if (string != NULL)
+    {
+        memset(&record.value, 0, sizeof(record.value));
+    }
+    record.truncated = textLength > DIAGNOSTIC_TEXT_LIMIT || valueLength > DIAGNOSTIC_TEXT_LIMIT;
+    record.textLength = (uint8_t)(textLength > DIAGNOSTIC_TEXT_LIMIT ? DIAGNOSTIC_TEXT_LIMIT : textLength);
+    record.valueLength = (uint8_t)(valueLength > DIAGNOSTIC_TEXT_LIMIT ? DIAGNOSTIC_TEXT_LIMIT : valueLength);
+
+    appendDiagnosticBytes(engine, &record, sizeof(record));
+    appendDiagnosticBytes(engine, token->text, record.textLength);
+    appendDiagnosticBytes(engine, string, record.valueLength);
+}
+
+/**
+ * Reads the arguments of a diagnostic back from the buffer.
+ *
+ * @param engine The engine.
+ *
+ * @param offset The offset of the first argument.
+ *
+ * @param argCount The number of arguments.
+ *
+ * @param args Set to the arguments.
+ *
+ * @return The offset after the last argument, the start of the next diagnostic.
+ */
+static size_t decodeArgs(const DiagnosticEngine *const engine, size_t offset, const size_t argCount, DecodedArg *const args)
+{
+    for (size_t i = 0; i < argCount; i++)
+    {
+        DecodedArg *arg = &args[i];
+        arg->kind = (DiagnosticArgKind)engine->buffer[offset++];
+        switch (arg->kind)
+        {
+        case DIAG_ARG_NAME:
+            memcpy(&arg->name, engine->buffer + offset, sizeof(arg->name));
+            offset += sizeof(arg->name);
+            break;
+        case DIAG_ARG_TOKEN_TYPE:
+        {
+            int32_t type;
+            memcpy(&type, engine->buffer + offset, sizeof(type));
+            arg->tokenType = (TokenType)type;
+            offset += sizeof(type);
+            break;
+        }
+        case DIAG_ARG_TOKEN:
+        {
+            DiagnosticToken record;
+            memcpy(&record, engine->buffer + offset, sizeof(record));
+            arg->tokenType = (TokenType)record.type;
+            arg->tokenOffset = offset;
+            offset += sizeof(record) + record.textLength + record.valueLength;
+            break;
+        }
+        }
+    }
+    return offset;
+}
+
+/**
+ * Rebuilds a token argument from the buffer.
+ *
+ * @param engine The engine.
+ *
+ * @param offset The offset of the `DiagnosticToken`.
+ *
+ * @param decoded Set to the token.
+ */
+static void decodeToken(const DiagnosticEngine *const engine, const size_t offset, DecodedToken *const decoded)
+{
+    DiagnosticToken record;
+    memcpy(&record, engine->buffer + offset, sizeof(record));
+    const uint8_t *characters = engine->buffer + offset + sizeof(record);
+    const char *ellipsis = record.truncated ? "..." : "";
+
+    snprintf(decoded->text, sizeof(decoded->text), "%.*s%s", (int)record.textLength, (const char *)characters, ellipsis);
+    snprintf(decoded->value, sizeof(decoded->value), "%.*s%s", (int)record.valueLength, (const char *)characters + record.textLength, ellipsis);
+
+    decoded->token.text = decoded->text;
+    decoded->token.loc = record.loc;
+    decoded->token.type = (TokenType)record.type;
+    decoded->token.value = record.value;
+    if (decoded->token.type == TOKEN_STRING)
+    {
+        decoded->token.value.string = decoded->value;
+    }
+}
+
+/**
+ * Prints a message template with its `%0` to `%9` placeholders replaced by the arguments.
+ *
+ * @param message The template.
+ *
+ * @param args The arguments.
+ *
+ * @param argCount The number of arguments.
+ *
+ * @param stream The stream to print to.
+ */
+static void printMessage(const char *message, const DecodedArg *const args, const size_t argCount, FILE *const stream)
+{
+    for (; *message != '\0'; message++)
+    {
+        if (message[0] != '%' || message[1] < '0' || message[1] > '9')
+        {
+            fputc(*message, stream);
+            continue;
+        }
+
+        size_t index = (size_t)(message[1] - '0');
+        message++;
+        if (index >= argCount)
+        {
+            continue;
+        }
+
+        const DecodedArg *arg = &args[index];
+        fputs(arg->kind == DIAG_ARG_NAME ? arg->name : getType(arg->tokenType), stream);
+    }
+}
+
+/*****************************************************************************************************
+                                PUBLIC DIAGNOSTIC FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+DiagnosticEngine *createDiagnosticEngine(void)
+{
+    DiagnosticEngine *engine = allocateMemory(MEMORY_ERRORS, sizeof(DiagnosticEngine));
+    if (engine == NULL)
+    {
+        fprintf(stderr, "Memory allocation for DiagnosticEngine failed!\n");
+        return NULL;
+    }
+
+    engine->buffer = NULL;
+    engine->size = 0;
+    engine->capacity = 0;
+    engine->count = 0;
+    engine->limit = DEFAULT_ERROR_LIMIT;
+    engine->dropped = 0;
+
+    return engine;
+}
+
+void deleteDiagnosticEngine(DiagnosticEngine *const engine)
+{
+    if (engine == NULL)
+    {
+        return;
+    }
+
+    releaseMemory(MEMORY_ERRORS, engine->buffer);
+    releaseMemory(MEMORY_ERRORS, engine);
+}
+
+void setDiagnosticLimit(DiagnosticEngine *const engine, const size_t limit)
+{
+    if (engine == NULL)
+    {
+        fprintf(stderr, "DiagnosticEngine is NULL!\n");
+        return;
+    }
+
+    engine->limit = limit;
+}
+
+int isDiagnosticLimitReached(const DiagnosticEngine *const engine)
+{
+    return engine != NULL && engine->limit > 0 && engine->count >= engine->limit;
+}
+
+int reportDiagnostic(DiagnosticEngine *const engine, const DiagnosticId id, const SourceLoc loc, const size_t length,
+                     const DiagnosticArg *const args, const size_t argCount)
+{
+    if (engine == NULL)
+    {
+        fprintf(stderr, "DiagnosticEngine is NULL!\n");
+        return 0;
+    }
+
+    if (id >= DIAG_COUNT || argCount > UINT8_MAX || (argCount > 0 && args == NULL))
+    {
+        fprintf(stderr, "Invalid diagnostic!\n");
+        return 0;
+    }
+
+    if (isDiagnosticLimitReached(engine))
+    {
+        engine->dropped++;
+        return 0;
+    }
+
+    //Size the whole diagnostic first, so a failed allocation leaves no half-written one behind
+    size_t size = sizeof(DiagnosticHeader);
+    for (size_t i = 0; i < argCount; i++)
+    {
+        size += 1;
+        switch (args[i].kind)
+        {
+        case DIAG_ARG_NAME:
+            size += sizeof(const char *);
+            break;
+        case DIAG_ARG_TOKEN_TYPE:
+            size += sizeof(int32_t);
+            break;
+        case DIAG_ARG_TOKEN:
+            if (args[i].value.token == NULL)
+            {
+                fprintf(stderr, "Invalid diagnostic!\n");
+                return 0;
+            }
+            size += getTokenArgSize(args[i].value.token);
+            break;
+        default:
+            fprintf(stderr, "Invalid diagnostic!\n");
+            return 0;
+        }
+    }
+    if (!reserveDiagnosticBytes(engine, size))
+    {
+        return 0;
+    }
+
+    DiagnosticHeader header;
+    header.id = (uint16_t)id;
+    header.argCount = (uint8_t)argCount;
+    header.reserved = 0;
+    header.loc = loc;
+    header.length = length > UINT32_MAX ? UINT32_MAX : (uint32_t)length;
+    appendDiagnosticBytes(engine, &header, sizeof(header));
+
+    for (size_t i = 0; i < argCount; i++)
+    {
+        uint8_t kind = (uint8_t)args[i].kind;
+        appendDiagnosticBytes(engine, &kind, 1);
+        switch (args[i].kind)
+        {
+        case DIAG_ARG_NAME:
+            appendDiagnosticBytes(engine, &args[i].value.name, sizeof(const char *));
+            break;
+        case DIAG_ARG_TOKEN_TYPE:
+        {
+            int32_t type = (int32_t)args[i].value.tokenType;
+            appendDiagnosticBytes(engine, &type, sizeof(type));
+            break;
+        }
+        case DIAG_ARG_TOKEN:
+            appendTokenArg(engine, args[i].value.token);
+            break;
+        }
+    }
+
+    engine->count++;
+    return 1;
+}
+
+void printDiagnostics(const DiagnosticEngine *const engine, const SourceManager *const sources, FILE *const stream)
+{
+    if (engine == NULL)
+    {
+        fprintf(stderr, "DiagnosticEngine is NULL!\n");
+        return;
+    }
+
+    size_t offset = 0;
+    for (size_t i = 0; i < engine->count; i++)
+    {
+        DiagnosticHeader header;
+        memcpy(&header, engine->buffer + offset, sizeof(header));
+        DecodedArg args[UINT8_MAX];
+        offset = decodeArgs(engine, offset + sizeof(header), header.argCount, args);
+
+        fprintf(stream, "Error: ");
+        printMessage(diagnosticMessages[header.id], args, header.argCount, stream);
+        fprintf(stream, "\n");
+
+        //The found tokens print below the message, and the location below them
+        const char *indent = "\t";
+        for (size_t j = 0; j < header.argCount; j++)
+        {
+            if (args[j].kind != DIAG_ARG_TOKEN)
+            {
+                continue;
+            }
+
+            DecodedToken decoded;
+            decodeToken(engine, args[j].tokenOffset, &decoded);
+            fprintf(stream, "\t");
+            writeToken(&decoded.token, stream);
+            indent = "\t\t";
+        }
+
+        if (header.loc == SOURCE_LOC_INVALID)
+        {
+            continue;
+        }
+
+        SourcePosition position;
+        if (getSourcePosition(sources, header.loc, &position))
+        {
+            fprintf(stream, "%sat: %s:%zu:%zu\n", indent, position.fileName, position.line, position.column);
+        }
+        else
+        {
+            fprintf(stream, "%sfrom: %u to %u\n", indent, (unsigned int)header.loc, (unsigned int)(header.loc + header.length));
+        }
+    }
+
+    if (isDiagnosticLimitReached(engine))
+    {
+        fprintf(stream, "Error: Too many errors, stopped after %zu! Use -ferror-limit=0 to report all of them.\n", engine->limit);
+    }
+}
@@ -0,0 +1,172 @@
+#ifndef DIAGNOSTIC_H
+#define DIAGNOSTIC_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "token.h"
+#include "source_manager.h"
+
+/**
+ * Identifies a diagnostic. Every ID has a message template in the diagnostic table, where `%0`,
+ * `%1`, ... are replaced by the arguments of the diagnostic when it is printed.
+ *
+ * - `DIAG_UNKNOWN_CHARACTER`: The lexer found a character no token starts with.
+ * - `DIAG_UNCLOSED_COMMENT`: A multi-line comment reaches the end of the input.
+ * - `DIAG_UNCLOSED_STRING`: A string literal reaches the end of the line or the input.
+ * - `DIAG_UNCLOSED_CHARACTER`: A character literal is not closed.
+ * - `DIAG_INVALID_ESCAPE`: A character literal has an unknown escape sequence.
+ * - `DIAG_INVALID_OCTAL_DIGIT`: An octal number has a digit above 7.
+ * - `DIAG_INVALID_HEX_DIGIT`: A hexadecimal number has a character that is not a hexadecimal digit.
+ * - `DIAG_EXPECTED_RULE`: The parser expected a grammar rule, named by the first argument.
+ * - `DIAG_EXPECTED_TOKEN`: The parser expected a token type, the first argument, and found
+ *                          another, the second argument.
+ */
+typedef enum diagnosticId
+{
+    DIAG_UNKNOWN_CHARACTER,
+    DIAG_UNCLOSED_COMMENT,
+    DIAG_UNCLOSED_STRING,
+    DIAG_UNCLOSED_CHARACTER,
+    DIAG_INVALID_ESCAPE,
+    DIAG_INVALID_OCTAL_DIGIT,
+    DIAG_INVALID_HEX_DIGIT,
+    DIAG_EXPECTED_RULE,
+    DIAG_EXPECTED_TOKEN,
+    DIAG_COUNT,
+} DiagnosticId;
+
+/**
+ * The kinds of the arguments of a diagnostic.
+ *
+ * - `DIAG_ARG_NAME`: A string with static storage, like the name of a grammar rule. Only the
+ *                    pointer is recorded.
+ * - `DIAG_ARG_TOKEN_TYPE`: A `TokenType`, printed by its name.
+ * - `DIAG_ARG_TOKEN`: A token, printed on its own line below the message. Its type, location,
+ *                     value and the start of its text are copied into the diagnostic, so the
+ *                     token may be freed before the diagnostic is printed.
+ */
+typedef enum diagnosticArgKind
+{
+    DIAG_ARG_NAME,
+    DIAG_ARG_TOKEN_TYPE,
+    DIAG_ARG_TOKEN,
+} DiagnosticArgKind;
+
+/**
+ * Represents an argument of a diagnostic while it is reported.
+ */
+typedef struct diagnosticArg
+{
+    DiagnosticArgKind kind;         /** The kind of the argument. */
+    union
+    {
+        const char *name;           /** A string with static storage. */
+        TokenType tokenType;        /** A token type. */
+        const Token *token;         /** A token. */
+    } value;                        /** The argument. */
+} DiagnosticArg;
+
+/**
+ * Records the diagnostics of a lexer or a parser.
+ *
+ * Nothing is formatted when a diagnostic is reported. Its ID, location and arguments are
+ * packed into one growing buffer, and the text is only built by `printDiagnostics`. Once
+ * `limit` diagnostics are recorded the engine only counts the ones reported after them, so
+ * the memory of the diagnostics stays bounded however broken the input is.
+ *
+ * - `buffer`: The packed diagnostics.
+ * - `size`: The number of bytes used in `buffer`.
+ * - `capacity`: The allocated size of `buffer`.
+ * - `count`: The number of recorded diagnostics.
+ * - `limit`: The number of diagnostics to record, 0 for no limit.
+ * - `dropped`: The number of diagnostics reported after the limit was reached.
+ */
+typedef struct diagnosticEngine
+{
+    uint8_t *buffer;                /** The packed diagnostics. */
+    size_t size;                    /** Used bytes of the buffer. */
+    size_t capacity;                /** Allocated bytes of the buffer. */
+    size_t count;                   /** Number of recorded diagnostics. */
+    size_t limit;                   /** Number of diagnostics to record, 0 for no limit. */
+    size_t dropped;                 /** Number of diagnostics past the limit. */
+} DiagnosticEngine;
+
+/**
+ * The number of diagnostics recorded when no limit is set with `setDiagnosticLimit`.
+ */
+#define DEFAULT_ERROR_LIMIT 20
+
+/**
+ * Creates a new, empty `DiagnosticEngine` with the default limit.
+ *
+ * @return A pointer to the newly created `DiagnosticEngine`, or NULL if memory allocation fails.
+ *
+ * @note It is the caller's responsibility to free the returned engine by calling `deleteDiagnosticEngine`.
+ */
+DiagnosticEngine *createDiagnosticEngine(void);
+
+/**
+ * Deletes a `DiagnosticEngine` and the diagnostics it recorded.
+ *
+ * @param engine The engine to delete. If it is NULL, the function does nothing.
+ */
+void deleteDiagnosticEngine(DiagnosticEngine *const engine);
+
+/**
+ * Sets the number of diagnostics an engine records.
+ *
+ * @param engine The engine.
+ *
+ * @param limit The number of diagnostics to record, 0 for no limit.
+ */
+void setDiagnosticLimit(DiagnosticEngine *const engine, const size_t limit);
+
+/**
+ * Checks whether an engine has recorded as many diagnostics as its limit allows.
+ *
+ * @param engine The engine.
+ *
+ * @return 1 if the limit is reached, 0 otherwise or if the engine is NULL.
+ */
+int isDiagnosticLimitReached(const DiagnosticEngine *const engine);
+
+/**
+ * Records a diagnostic without formatting it.
+ *
+ * @param engine The engine.
+ *
+ * @param id The ID of the diagnostic.
+ *
+ * @param loc The location the diagnostic points at, or `SOURCE_LOC_INVALID`.
+ *
+ * @param length The number of characters the diagnostic covers from `loc`.
+ *
+ * @param args The arguments of the diagnostic, or NULL if it has none.
+ *
+ * @param argCount The number of arguments, at most 255.
+ *
+ * @return 1 if the diagnostic was recorded, 0 if the limit was reached, the arguments are
+ *         invalid or memory allocation fails.
+ */
+int reportDiagnostic(DiagnosticEngine *const engine, const DiagnosticId id, const SourceLoc loc, const size_t length,
+                     const DiagnosticArg *const args, const size_t argCount);
+
+/**
+ * Formats and prints the diagnostics of an engine, in the order they were reported, followed
+ * by a note if the limit was reached.
+ *
+ * Every diagnostic prints as `Error: <message>`. A token argument prints below it, and the
+ * location prints as `file:line:column` when the source manager knows the file, and as
+ * offsets otherwise.
+ *
+ * @param engine The engine.
+ *
+ * @param sources The source manager the files of the compilation were added to, or NULL.
+ *
+ * @param stream The stream to print to.
+ */
+void printDiagnostics(const DiagnosticEngine *const engine, const SourceManager *const sources, FILE *const stream);
+
+#endif // DIAGNOSTIC_H
@@ -0,0 +1,990 @@
+#include "dump.h"
+
+/*****************************************************************************************************
+                            PRIVATE DUMP FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+/* Size of the output buffer of the dumpers */
+#define DUMP_BUFFER_SIZE (64 * 1024)
+
+/* Initial number of tree levels the dump context has room for */
+#define INITIAL_DUMP_DEPTH 64
+
+/* Initial length of the indentation of the tree format */
+#define INITIAL_DUMP_INDENT 256
+
+/**
+ * Represents the output buffer of a dump.
+ */
+typedef struct dumpBuffer
+{
+    FILE *stream;                   /** The stream the buffer is flushed to. */
+    char *data;                     /** The buffered output. */
+    size_t size;                    /** Number of buffered bytes. */
+    int failed;                     /** Set once an allocation or a write failed. */
+} DumpBuffer;
+
+/* Returned by `DumpTree.getChild` for a missing child */
+#define DUMP_NO_NODE SIZE_MAX
+
+/**
+ * Represents the fields of a node the dumpers write.
+ */
+typedef struct dumpNode
+{
+    ASTType type;                   /** The type of the node. */
+    size_t tokenCount;              /** Number of tokens of the node. */
+    size_t childCount;              /** Number of children of the node, including missing ones. */
+} DumpNode;
+
+/**
+ * Represents a tree in one of the layouts the dumpers write: `ASTNode`s, a `CompactAST`
+ * or a `CastFile`. Nodes are identified by a `size_t`, a pointer or an index.
+ */
+typedef struct dumpTree
+{
+    const void *tree;               /** The tree being dumped. */
+    size_t root;                    /** The root node. */
+    void (*getNode)(const void *tree, const size_t node, DumpNode *const dumpNode);
+    const Token *(*getToken)(const void *tree, const size_t node, const size_t index, Token *const view);
+    size_t (*getChild)(const void *tree, const size_t node, const size_t child, size_t *const cursor);
+} DumpTree;
+
+/**
+ * Represents a level of the tree being dumped.
+ */
+typedef struct dumpFrame
+{
+    size_t node;                    /** The node at this level. */
+    DumpNode fields;                /** The fields of the node. */
+    size_t nextChild;               /** Index of the next child of the node to be dumped. */
+    size_t cursor;                  /** The last child found, for layouts that find a child from the previous one. */
+    size_t indentLength;            /** Length of the indentation of the children of the node. */
+    int wroteChild;                 /** Whether a child of the node was written already. */
+} DumpFrame;
+
+/**
+ * Represents the state of a tree dump.
+ */
+typedef struct dumpContext
+{
+    DumpBuffer buffer;              /** The output buffer. */
+    const DumpTree *tree;           /** The tree being dumped. */
+    DumpFrame *frames;              /** The levels of the tree above the current node. */
+    size_t frameCapacity;           /** Number of levels allocated. */
+    char *indent;                   /** The indentation of the tree format. */
+    size_t indentCapacity;          /** Number of bytes allocated for the indentation. */
+} DumpContext;
+
+static int createDumpBuffer(DumpBuffer *const buffer, FILE *const stream);
+
+static int flushDumpBuffer(DumpBuffer *const buffer);
+
+static void writeDump(DumpBuffer *const buffer, const char *const data, const size_t length);
+
+static void writeDumpString(DumpBuffer *const buffer, const char *const string);
+
+static void writeDumpSpaces(DumpBuffer *const buffer, size_t count);
+
+static void writeDumpQuoted(DumpBuffer *const buffer, const char *const string, const int json);
+
+static void writeDumpTokenLine(DumpBuffer *const buffer, const Token *const token);
+
+static void writeDumpJSONToken(DumpBuffer *const buffer, const Token *const token);
+
+static void writeDumpSExprToken(DumpBuffer *const buffer, const Token *const token);
+
+static int reserveDumpFrames(DumpContext *const dump, const size_t depth);
+
+static int reserveDumpIndent(DumpContext *const dump, const size_t length);
+
+static void writeTreeNode(DumpContext *const dump, const size_t depth, const int isLast);
+
+static void writeJSONNode(DumpContext *const dump, const size_t depth);
+
+static void writeSExprNode(DumpContext *const dump, const size_t depth);
+
+static int writeDumpTree(const DumpTree *const tree, const DumpFormat format, FILE *const stream);
+
+static void getASTDumpNode(const void *tree, const size_t node, DumpNode *const dumpNode);
+
+static const Token *getASTDumpToken(const void *tree, const size_t node, const size_t index, Token *const view);
+
+static size_t getASTDumpChild(const void *tree, const size_t node, const size_t child, size_t *const cursor);
+
+static void getCompactDumpNode(const void *tree, const size_t node, DumpNode *const dumpNode);
+
+static const Token *getCompactDumpToken(const void *tree, const size_t node, const size_t index, Token *const view);
+
+static size_t getCompactDumpChild(const void *tree, const size_t node, const size_t child, size_t *const cursor);
+
+static void getCastDumpNode(const void *tree, const size_t node, DumpNode *const dumpNode);
+
+static const Token *getCastDumpToken(const void *tree, const size_t node, const size_t index, Token *const view);
+
+static size_t getCastDumpChild(const void *tree, const size_t node, const size_t child, size_t *const cursor);
+
+static int isDumpedToken(const Token *const token);
+
+/*****************************************************************************************************
+                                PRIVATE DUMP FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Allocates the output buffer of a dump.
+ *
+ * @param buffer The buffer to initialize.
+ *
+ * @param stream The stream the buffer is flushed to.
+ *
+ * @return 1 on success, 0 if memory allocation fails.
+ */
+static int createDumpBuffer(DumpBuffer *const buffer, FILE *const stream)
+{
+    buffer->stream = stream;
+    buffer->size = 0;
+    buffer->failed = 0;
+    buffer->data = malloc(DUMP_BUFFER_SIZE);
+    if (buffer->data == NULL)
+    {
+        fprintf(stderr, "Memory allocation for the dump buffer failed!\n");
+        return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * Writes the buffered output to the stream and empties the buffer.
+ *
+ * @param buffer The buffer to flush.
+ *
+ * @return 1 on success, 0 if writing failed now or before.
+ */
+static int flushDumpBuffer(DumpBuffer *const buffer)
+{
+    if (buffer->size > 0 && fwrite(buffer->data, 1, buffer->size, buffer->stream) != buffer->size)
+    {
+        buffer->failed = 1;
+    }
+    buffer->size = 0;
+
+    return !buffer->failed;
+}
+
+/**
+ * Appends bytes to the output buffer, flushing it when it is full.
+ *
+ * @param buffer The buffer to append to.
+ *
+ * @param data The bytes to append.
+ *
+ * @param length The number of bytes.
+ */
+static void writeDump(DumpBuffer *const buffer, const char *const data, const size_t length)
+{
+    if (length > DUMP_BUFFER_SIZE - buffer->size)
+    {
+        flushDumpBuffer(buffer);
+        if (length > DUMP_BUFFER_SIZE)
+        {
+            if (fwrite(data, 1, length, buffer->stream) != length)
+            {
+                buffer->failed = 1;
+            }
+            return;
+        }
+    }
+
+    memcpy(buffer->data + buffer->size, data, length);
+    buffer->size += length;
+}
+
+/**
+ * Appends a zero terminated string to the output buffer.
+ *
+ * @param buffer The buffer to append to.
+ *
+ * @param string The string to append.
+ */
+static void writeDumpString(DumpBuffer *const buffer, const char *const string)
+{
+    writeDump(buffer, string, strlen(string));
+}
+
+/**
+ * Appends spaces to the output buffer.
+ *
+ * @param buffer The buffer to append to.
+ *
+ * @param count The number of spaces.
+ */
+static void writeDumpSpaces(DumpBuffer *const buffer, size_t count)
+{
+    static const char spaces[] = "                                ";
+    while (count > 0)
+    {
+        size_t length = count < sizeof(spaces) - 1 ? count : sizeof(spaces) - 1;
+        writeDump(buffer, spaces, length);
+        count -= length;
+    }
+}
+
+/**
+ * Appends a string in double quotes, escaping the characters the format requires.
+ *
+ * @param buffer The buffer to append to.
+ *
+ * @param string The string to append. NULL is written as an empty string.
+ *
+ * @param json If set, control characters are escaped as JSON requires, otherwise only the
+ *             quote and the backslash are escaped.
+ */
+static void writeDumpQuoted(DumpBuffer *const buffer, const char *const string, const int json)
+{
+    writeDump(buffer, "\"", 1);
+    if (string == NULL)
+    {
+        writeDump(buffer, "\"", 1);
+        return;
+    }
+
+    //Copy the runs without special characters in one piece
+    const char *run = string;
+    for (const char *c = string; *c != '\0'; c++)
+    {
+        unsigned char character = (unsigned char)*c;
+        if (character != '"' && character != '\\' && (!json || character >= 0x20))
+        {
+            continue;
+        }
+
+        writeDump(buffer, run, (size_t)(c - run));
+        run = c + 1;
+        if (character == '"' || character == '\\')
+        {
+            char escape[2] = {'\\', (char)character};
+            writeDump(buffer, escape, 2);
+        }
+        else
+        {
+            char escape[8];
+            int length = snprintf(escape, sizeof(escape), "\\u%04x", character);
+            writeDump(buffer, escape, (size_t)length);
+        }
+    }
+    writeDump(buffer, run, strlen(run));
+    writeDump(buffer, "\"", 1);
+}
+
+/**
+ * Appends the line `printToken` prints for a token, formatting it directly into the buffer.
+ *
+ * @param buffer The buffer to append to.
+ *
+ * @param token The token to append.
+ */
+static void writeDumpTokenLine(DumpBuffer *const buffer, const Token *const token)
+{
+    int length = formatToken(buffer->data + buffer->size, DUMP_BUFFER_SIZE - buffer->size, token);
+    if (length < 0)
+    {
+        return;
+    }
+    if ((size_t)length < DUMP_BUFFER_SIZE - buffer->size)
+    {
+        buffer->size += (size_t)length;
+        return;
+    }
+
+    //The line did not fit the rest of the buffer, retry in an empty one
+    flushDumpBuffer(buffer);
+    if ((size_t)length < DUMP_BUFFER_SIZE)
+    {
+        buffer->size = (size_t)formatToken(buffer->data, DUMP_BUFFER_SIZE, token);
+        return;
+    }
+
+    char *line = malloc((size_t)length + 1);
+    if (line == NULL)
+    {
+        fprintf(stderr, "Memory allocation for dumping Token failed!\n");
+        buffer->failed = 1;
+        return;
+    }
+    formatToken(line, (size_t)length + 1, token);
+    writeDump(buffer, line, (size_t)length);
+    free(line);
+}
+
+/**
+ * Appends a token as a JSON object with its type, text, start position and value.
+ *
+ * @param buffer The buffer to append to.
+ *
+ * @param token The token to append.
+ */
+static void writeDumpJSONToken(DumpBuffer *const buffer, const Token *const token)
+{
+    if (token == NULL)
+    {
+        writeDumpString(buffer, "null");
+        return;
+    }
+
+    char number[64];
+    writeDumpString(buffer, "{\"type\":");
+    writeDumpQuoted(buffer, getType(token->type), 1);
+    writeDumpString(buffer, ",\"text\":");
+    writeDumpQuoted(buffer, token->text, 1);
+    snprintf(number, sizeof(number), ",\"start\":%u", (unsigned int)token->loc);
+    writeDumpString(buffer, number);
+
+    switch (token->type)
+    {
+    case TOKEN_INTEGER:
+    case TOKEN_HEXADECIMAL:
+    case TOKEN_OCTAL:
+        snprintf(number, sizeof(number), ",\"value\":%d", token->value.number);
+        writeDumpString(buffer, number);
+        break;
+    case TOKEN_FLOATINGPOINT:
+        snprintf(number, sizeof(number), ",\"value\":%.17g", token->value.floatingPoint);
+        writeDumpString(buffer, number);
+        break;
+    case TOKEN_CHARACTER:
+    {
+        char character[2] = {token->value.character, '\0'};
+        writeDumpString(buffer, ",\"value\":");
+        writeDumpQuoted(buffer, character, 1);
+        break;
+    }
+    case TOKEN_STRING:
+        writeDumpString(buffer, ",\"value\":");
+        writeDumpQuoted(buffer, token->value.string, 1);
+        break;
+    case TOKEN_KEYWORD:
+        writeDumpString(buffer, ",\"value\":");
+        writeDumpQuoted(buffer, getKeywordName(token->value.keyword), 1);
+        break;
+    default:
+        break;
+    }
+
+    writeDump(buffer, "}", 1);
+}
+
+/**
+ * Appends a token as an S-expression of its type and text.
+ *
+ * @param buffer The buffer to append to.
+ *
+ * @param token The token to append.
+ */
+static void writeDumpSExprToken(DumpBuffer *const buffer, const Token *const token)
+{
+    if (token == NULL)
+    {
+        writeDumpString(buffer, "()");
+        return;
+    }
+
+    writeDump(buffer, "(", 1);
+    writeDumpString(buffer, getType(token->type));
+    writeDump(buffer, " ", 1);
+    writeDumpQuoted(buffer, token->text, 0);
+    writeDump(buffer, ")", 1);
+}
+
+/**
+ * Makes sure the dump context has a frame for a tree level.
+ *
+ * @param dump The dump context.
+ *
+ * @param depth The level that needs a frame.
+ *
+ * @return 1 on success, 0 if memory allocation fails.
+ */
+static int reserveDumpFrames(DumpContext *const dump, const size_t depth)
+{
+    if (depth < dump->frameCapacity)
+    {
+        return 1;
+    }
+
+    size_t newCapacity = dump->frameCapacity * 2;
+    while (newCapacity <= depth)
+    {
+        newCapacity *= 2;
+    }
+
+    DumpFrame *newFrames = realloc(dump->frames, newCapacity * sizeof(DumpFrame));
+    if (newFrames == NULL)
+    {
+        fprintf(stderr, "Memory reallocation for the dump frames failed!\n");
+        dump->buffer.failed = 1;
+        return 0;
+    }
+    dump->frames = newFrames;
+    dump->frameCapacity = newCapacity;
+
+    return 1;
+}
+
+/**
+ * Makes sure the indentation of the tree format has room for a given length.
+ *
+ * @param dump The dump context.
+ *
+ * @param length The length the indentation needs.
+ *
+ * @return 1 on success, 0 if memory allocation fails.
+ */
+static int reserveDumpIndent(DumpContext *const dump, const size_t length)
+{
+    if (length <= dump->indentCapacity)
+    {
+        return 1;
+    }
+
+    size_t newCapacity = dump->indentCapacity * 2;
+    while (newCapacity < length)
+    {
+        newCapacity *= 2;
+    }
+
+    char *newIndent = realloc(dump->indent, newCapacity);
+    if (newIndent == NULL)
+    {
+        fprintf(stderr, "Memory reallocation for the dump indentation failed!\n");
+        dump->buffer.failed = 1;
+        return 0;
+    }
+    dump->indent = newIndent;
+    dump->indentCapacity = newCapacity;
+
+    return 1;
+}
+
+/**
+ * Writes a node and its tokens in the tree format of `printASTNode`.
+ *
+ * @param dump The dump context. The frame of the node at `depth` is filled in already.
+ *
+ * @param depth The depth of the node.
+ *
+ * @param isLast Indicates whether the node is the last child of its parent.
+ */
+static void writeTreeNode(DumpContext *const dump, const size_t depth, const int isLast)
+{
+    size_t prefixLength = depth > 0 ? dump->frames[depth - 1].indentLength : 0;
+    DumpFrame *frame = &dump->frames[depth];
+
+    DumpBuffer *buffer = &dump->buffer;
+    writeDump(buffer, dump->indent, prefixLength);
+    writeDumpString(buffer, isLast ? "└── " : "├── ");
+    writeDumpString(buffer, getASTTypeName(frame->fields.type));
+    writeDump(buffer, "\n", 1);
+
+    //The children are indented one step further than the node
+    const char *step = isLast ? "    " : "│   ";
+    size_t indentLength = prefixLength + strlen(step);
+    if (!reserveDumpIndent(dump, indentLength))
+    {
+        return;
+    }
+    memcpy(dump->indent + prefixLength, step, strlen(step));
+    frame->indentLength = indentLength;
+
+    //Write tokens
+    size_t tokenCount = frame->fields.tokenCount;
+    int hasChildren = frame->fields.childCount > 0;
+    writeDump(buffer, dump->indent, indentLength);
+    writeDumpString(buffer, hasChildren ? "├── Tokens:\n" : "└── Tokens:\n");
+    for (size_t i = 0; i < tokenCount; i++)
+    {
+        Token view;
+        writeDump(buffer, dump->indent, indentLength);
+        writeDumpString(buffer, hasChildren ? "│   " : "    ");
+        writeDumpString(buffer, i + 1 >= tokenCount ? "└── " : "├── ");
+        writeDumpTokenLine(buffer, dump->tree->getToken(dump->tree->tree, frame->node, i, &view));
+    }
+}
+
+/**
+ * Opens the JSON object of a node and writes its type and tokens.
+ *
+ * @param dump The dump context. The frame of the node at `depth` is filled in already.
+ *
+ * @param depth The depth of the node.
+ */
+static void writeJSONNode(DumpContext *const dump, const size_t depth)
+{
+    DumpBuffer *buffer = &dump->buffer;
+    if (depth > 0)
+    {
+        if (dump->frames[depth - 1].wroteChild)
+        {
+            writeDump(buffer, ",", 1);
+        }
+        dump->frames[depth - 1].wroteChild = 1;
+    }
+
+    DumpFrame *frame = &dump->frames[depth];
+    writeDumpString(buffer, "{\"type\":");
+    writeDumpQuoted(buffer, getASTTypeName(frame->fields.type), 1);
+    writeDumpString(buffer, ",\"tokens\":[");
+    for (size_t i = 0; i < frame->fields.tokenCount; i++)
+    {
+        Token view;
+        if (i > 0)
+        {
+            writeDump(buffer, ",", 1);
+        }
+        writeDumpJSONToken(buffer, dump->tree->getToken(dump->tree->tree, frame->node, i, &view));
+    }
+    writeDumpString(buffer, "],\"children\":[");
+}
+
+/**
+ * Opens the S-expression of a node on a new line and writes its type and token texts.
+ *
+ * @param dump The dump context. The frame of the node at `depth` is filled in already.
+ *
+ * @param depth The depth of the node, which sets the indentation.
+ */
+static void writeSExprNode(DumpContext *const dump, const size_t depth)
+{
+    DumpBuffer *buffer = &dump->buffer;
+    if (depth > 0)
+    {
+        writeDump(buffer, "\n", 1);
+        writeDumpSpaces(buffer, 2 * depth);
+    }
+
+    DumpFrame *frame = &dump->frames[depth];
+    writeDump(buffer, "(", 1);
+    writeDumpString(buffer, getASTTypeName(frame->fields.type));
+    for (size_t i = 0; i < frame->fields.tokenCount; i++)
+    {
+        Token view;
+        const Token *token = dump->tree->getToken(dump->tree->tree, frame->node, i, &view);
+        writeDump(buffer, " ", 1);
+        writeDumpQuoted(buffer, token == NULL ? NULL : token->text, 0);
+    }
+}
+
+/**
+ * Writes a tree to a stream in pre-order.
+ *
+ * The tree is walked with an explicit stack of frames, so its depth is not limited by the call
+ * stack. Missing children are skipped, but still count for the position of the last child.
+ *
+ * @param tree The tree to write.
+ *
+ * @param format The output format.
+ *
+ * @param stream The stream to write to.
+ *
+ * @return 1 on success, 0 if memory allocation or writing to the stream fails.
+ */
+static int writeDumpTree(const DumpTree *const tree, const DumpFormat format, FILE *const stream)
+{
+    DumpContext dump;
+    if (!createDumpBuffer(&dump.buffer, stream))
+    {
+        return 0;
+    }
+    dump.tree = tree;
+    dump.frameCapacity = INITIAL_DUMP_DEPTH;
+    dump.frames = malloc(dump.frameCapacity * sizeof(DumpFrame));
+    dump.indentCapacity = INITIAL_DUMP_INDENT;
+    dump.indent = malloc(dump.indentCapacity);
+    if (dump.frames == NULL || dump.indent == NULL)
+    {
+        fprintf(stderr, "Memory allocation for the dump context failed!\n");
+        free(dump.frames);
+        free(dump.indent);
+        free(dump.buffer.data);
+        return 0;
+    }
+
+    size_t depth = 0;
+    size_t node = tree->root;
+    int isLast = 0;
+    while (!dump.buffer.failed)
+    {
+        //Enter the node at `depth`
+        if (node != DUMP_NO_NODE)
+        {
+            if (!reserveDumpFrames(&dump, depth))
+            {
+                break;
+            }
+            DumpFrame *frame = &dump.frames[depth];
+            frame->node = node;
+            tree->getNode(tree->tree, node, &frame->fields);
+            frame->nextChild = 0;
+            frame->cursor = DUMP_NO_NODE;
+            frame->indentLength = 0;
+            frame->wroteChild = 0;
+            switch (format)
+            {
+            case DUMP_FORMAT_JSON:
+                writeJSONNode(&dump, depth);
+                break;
+            case DUMP_FORMAT_SEXPR:
+                writeSExprNode(&dump, depth);
+                break;
+            default:
+                writeTreeNode(&dump, depth, isLast);
+                break;
+            }
+            node = DUMP_NO_NODE;
+        }
+
+        //Go down to the next child, or leave the node once its children are written
+        DumpFrame *frame = &dump.frames[depth];
+        if (frame->nextChild < frame->fields.childCount)
+        {
+            size_t child = frame->nextChild++;
+            node = tree->getChild(tree->tree, frame->node, child, &frame->cursor);
+            if (node != DUMP_NO_NODE)
+            {
+                isLast = child == frame->fields.childCount - 1;
+                depth++;
+            }
+            continue;
+        }
+
+        if (format == DUMP_FORMAT_JSON)
+        {
+            writeDumpString(&dump.buffer, depth == 0 ? "]}\n" : "]}");
+        }
+        else if (format == DUMP_FORMAT_SEXPR)
+        {
+            writeDumpString(&dump.buffer, depth == 0 ? ")\n" : ")");
+        }
+        if (depth == 0)
+        {
+            break;
+        }
+        depth--;
+    }
+
+    int success = flushDumpBuffer(&dump.buffer);
+    if (!success)
+    {
+        fprintf(stderr, "Dumping the AST failed!\n");
+    }
+
+    free(dump.frames);
+    free(dump.indent);
+    free(dump.buffer.data);
+    return success;
+}
+
+/**
+ * Reads the fields of an `ASTNode` for the dumpers.
+ *
+ * @param tree Unused, the node is identified by its address.
+ *
+ * @param node The address of the node.
+ *
+ * @param dumpNode Set to the fields of the node.
+ */
+static void getASTDumpNode(const void *tree, const size_t node, DumpNode *const dumpNode)
+{
+    (void)tree;
+    const ASTNode *astNode = (const ASTNode *)(uintptr_t)node;
+    dumpNode->type = astNode->type;
+    dumpNode->tokenCount = astNode->tokenCount;
+    dumpNode->childCount = astNode->childCount;
+}
+
+/**
+ * Returns a token of an `ASTNode` for the dumpers.
+ *
+ * @param tree Unused, the node is identified by its address.
+ *
+ * @param node The address of the node.
+ *
+ * @param index The position of the token.
+ *
+ * @param view Unused, the tokens of the node are returned directly.
+ *
+ * @return The token.
+ */
+static const Token *getASTDumpToken(const void *tree, const size_t node, const size_t index, Token *const view)
+{
+    (void)tree;
+    (void)view;
+    return ((const ASTNode *)(uintptr_t)node)->tokens[index];
+}
+
+/**
+ * Returns a child of an `ASTNode` for the dumpers.
+ *
+ * @param tree Unused, the node is identified by its address.
+ *
+ * @param node The address of the node.
+ *
+ * @param child The position of the child.
+ *
+ * @param cursor Unused.
+ *
+ * @return The address of the child, or `DUMP_NO_NODE` if it is missing.
+ */
+static size_t getASTDumpChild(const void *tree, const size_t node, const size_t child, size_t *const cursor)
+{
+    (void)tree;
+    (void)cursor;
+    const ASTNode *astNode = ((const ASTNode *)(uintptr_t)node)->children[child];
+    return astNode == NULL ? DUMP_NO_NODE : (size_t)(uintptr_t)astNode;
+}
+
+/**
+ * Reads the fields of a node of a `CompactAST` for the dumpers.
+ *
+ * @param tree The `CompactAST`.
+ *
+ * @param node The index of the node.
+ *
+ * @param dumpNode Set to the fields of the node.
+ */
+static void getCompactDumpNode(const void *tree, const size_t node, DumpNode *const dumpNode)
+{
+    const CompactAST *ast = tree;
+    dumpNode->type = (ASTType)ast->nodes[node].type;
+    dumpNode->tokenCount = ast->nodes[node].tokenCount;
+    dumpNode->childCount = getCompactChildCount(ast, (CompactIndex)node);
+}
+
+/**
+ * Returns a token of a node of a `CompactAST` for the dumpers.
+ *
+ * @param tree The `CompactAST`.
+ *
+ * @param node The index of the node.
+ *
+ * @param index The position of the token.
+ *
+ * @param view Unused, the token table points to the tokens directly.
+ *
+ * @return The token.
+ */
+static const Token *getCompactDumpToken(const void *tree, const size_t node, const size_t index, Token *const view)
+{
+    (void)view;
+    const CompactAST *ast = tree;
+    return ast->tokens[ast->nodes[node].firstToken + index];
+}
+
+/**
+ * Returns a child of a node of a `CompactAST` for the dumpers.
+ *
+ * @param tree The `CompactAST`.
+ *
+ * @param node The index of the node.
+ *
+ * @param child The position of the child.
+ *
+ * @param cursor Unused.
+ *
+ * @return The index of the child, or `DUMP_NO_NODE` if it is missing.
+ */
+static size_t getCompactDumpChild(const void *tree, const size_t node, const size_t child, size_t *const cursor)
+{
+    (void)cursor;
+    CompactIndex index = getCompactChild(tree, (CompactIndex)node, child);
+    return index == COMPACT_NONE ? DUMP_NO_NODE : index;
+}
+
+/**
+ * Reads the fields of a node record of a `CastFile` for the dumpers.
+ *
+ * @param tree The `CastFile`.
+ *
+ * @param node The index of the node record.
+ *
+ * @param dumpNode Set to the fields of the node.
+ */
+static void getCastDumpNode(const void *tree, const size_t node, DumpNode *const dumpNode)
+{
+    const CastFile *file = tree;
+    dumpNode->type = (ASTType)file->nodes[node].type;
+    dumpNode->tokenCount = file->nodes[node].tokenCount;
+    dumpNode->childCount = file->nodes[node].childCount;
+}
+
+/**
+ * Returns a token of a node record of a `CastFile` for the dumpers.
+ *
+ * @param tree The `CastFile`.
+ *
+ * @param node The index of the node record.
+ *
+ * @param index The position of the token.
+ *
+ * @param view Filled with a view of the token record.
+ *
+ * @return `view`.
+ */
+static const Token *getCastDumpToken(const void *tree, const size_t node, const size_t index, Token *const view)
+{
+    const CastFile *file = tree;
+    getCastToken(file, file->nodes[node].firstToken + index, view);
+    return view;
+}
+
+/**
+ * Returns a child of a node record of a `CastFile` for the dumpers.
+ *
+ * The children are asked for in order, so each one is found from the previous one in
+ * constant time.
+ *
+ * @param tree The `CastFile`.
+ *
+ * @param node The index of the node record.
+ *
+ * @param child The position of the child.
+ *
+ * @param cursor The record of the previous child, set to the record of this one.
+ *
+ * @return The index of the child record, or `DUMP_NO_NODE` if it is missing.
+ */
+static size_t getCastDumpChild(const void *tree, const size_t node, const size_t child, size_t *const cursor)
+{
+    const CastFile *file = tree;
+    *cursor = child == 0 ? FLAT_FIRST_CHILD(node) : FLAT_NEXT_SIBLING(file, *cursor);
+    return (file->nodes[*cursor].flags & FLAT_NODE_MISSING) ? DUMP_NO_NODE : *cursor;
+}
+
+/**
+ * Checks whether a token is written by `dumpTokens`.
+ *
+ * @param token The token to check.
+ *
+ * @return 0 for whitespace and comments, 1 otherwise.
+ */
+static int isDumpedToken(const Token *const token)
+{
+    return token->type != TOKEN_WHITESPACE && token->type != TOKEN_LINE_COMMENT && token->type != TOKEN_BLOCK_COMMENT;
+}
+
+/*****************************************************************************************************
+                                PUBLIC DUMP FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+int parseDumpFormat(const char *const name, DumpFormat *const format)
+{
+    if (strcmp(name, "tree") == 0)
+    {
+        *format = DUMP_FORMAT_TREE;
+        return 1;
+    }
+    if (strcmp(name, "json") == 0)
+    {
+        *format = DUMP_FORMAT_JSON;
+        return 1;
+    }
+    if (strcmp(name, "sexpr") == 0)
+    {
+        *format = DUMP_FORMAT_SEXPR;
+        return 1;
+    }
+
+    return 0;
+}
+
+int dumpAST(const ASTNode *const root, const DumpFormat format, FILE *const stream)
+{
+    if (root == NULL)
+    {
+        return 1;
+    }
+
+    DumpTree tree = {NULL, (size_t)(uintptr_t)root, getASTDumpNode, getASTDumpToken, getASTDumpChild};
+    return writeDumpTree(&tree, format, stream);
+}
+
+int dumpCompactAST(const CompactAST *const ast, const DumpFormat format, FILE *const stream)
+{
+    if (ast == NULL || ast->nodeCount == 0)
+    {
+        return 1;
+    }
+
+    DumpTree tree = {ast, 0, getCompactDumpNode, getCompactDumpToken, getCompactDumpChild};
+    return writeDumpTree(&tree, format, stream);
+}
+
+int dumpCastFile(const CastFile *const file, const DumpFormat format, FILE *const stream)
+{
+    if (file == NULL || file->nodeCount == 0 || (file->nodes[0].flags & FLAT_NODE_MISSING))
+    {
+        return 1;
+    }
+
+    DumpTree tree = {file, 0, getCastDumpNode, getCastDumpToken, getCastDumpChild};
+    return writeDumpTree(&tree, format, stream);
+}
+
+int dumpTokens(Token **const tokens, const size_t tokenCount, const DumpFormat format, FILE *const stream)
+{
+    if (tokens == NULL)
+    {
+        fprintf(stderr, "Tokens is NULL!\n");
+        return 0;
+    }
+
+    DumpBuffer buffer;
+    if (!createDumpBuffer(&buffer, stream))
+    {
+        return 0;
+    }
+
+    if (format == DUMP_FORMAT_JSON)
+    {
+        writeDump(&buffer, "[", 1);
+    }
+
+    int first = 1;
+    for (size_t i = 0; i < tokenCount && !buffer.failed; i++)
+    {
+        if (!isDumpedToken(tokens[i]))
+        {
+            continue;
+        }
+
+        switch (format)
+        {
+        case DUMP_FORMAT_JSON:
+            writeDumpString(&buffer, first ? "\n" : ",\n");
+            writeDumpJSONToken(&buffer, tokens[i]);
+            break;
+        case DUMP_FORMAT_SEXPR:
+            writeDumpSExprToken(&buffer, tokens[i]);
+            writeDump(&buffer, "\n", 1);
+            break;
+        default:
+            writeDumpTokenLine(&buffer, tokens[i]);
+            break;
+        }
+        first = 0;
+    }
+
+    if (format == DUMP_FORMAT_JSON)
+    {
+        writeDumpString(&buffer, "\n]\n");
+    }
+
+    int success = flushDumpBuffer(&buffer);
+    if (!success)
+    {
+        fprintf(stderr, "Dumping the tokens failed!\n");
+    }
+
+    free(buffer.data);
+    return success;
+}
@@ -0,0 +1,101 @@
+#ifndef DUMP_H
+#define DUMP_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "token.h"
+#include "AST.h"
+#include "compact_ast.h"
+#include "ast_file.h"
+
+/**
+ * Enumeration of the output formats of the dumpers.
+ *
+ * - `DUMP_FORMAT_TREE`: The ASCII tree of `printASTNode` and the token lines of `printToken`.
+ * - `DUMP_FORMAT_JSON`: One JSON value, a node object with `type`, `tokens` and `children`,
+ *                       or an array of token objects.
+ * - `DUMP_FORMAT_SEXPR`: S-expressions, one node or token per line.
+ */
+typedef enum dumpFormat
+{
+    DUMP_FORMAT_TREE,
+    DUMP_FORMAT_JSON,
+    DUMP_FORMAT_SEXPR,
+} DumpFormat;
+
+/**
+ * Looks up a `DumpFormat` by its name.
+ *
+ * @param name The name of the format: `tree`, `json` or `sexpr`.
+ *
+ * @param format Set to the format if the name is known.
+ *
+ * @return 1 if the name is known, 0 otherwise.
+ */
+int parseDumpFormat(const char *const name, DumpFormat *const format);
+
+/**
+ * Writes an Abstract Syntax Tree (AST) to a stream.
+ *
+ * The tree is walked with an explicit stack, so its depth is not limited by the call stack, and the
+ * output is collected in a large buffer that is written to the stream in few large writes.
+ * Unlike `printASTNode`, the indentation of the tree format is not limited in length.
+ *
+ * @param root The root of the tree to write. If NULL, nothing is written.
+ *
+ * @param format The output format.
+ *
+ * @param stream The stream to write to.
+ *
+ * @return 1 on success, 0 if memory allocation or writing to the stream fails.
+ */
+int dumpAST(const ASTNode *const root, const DumpFormat format, FILE *const stream);
+
+/**
+ * Writes a `CompactAST` to a stream, in the same output as `dumpAST` on the tree it was
+ * converted from.
+ *
+ * @param ast The tree to write. If NULL or empty, nothing is written.
+ *
+ * @param format The output format.
+ *
+ * @param stream The stream to write to.
+ *
+ * @return 1 on success, 0 if memory allocation or writing to the stream fails.
+ */
+int dumpCompactAST(const CompactAST *const ast, const DumpFormat format, FILE *const stream);
+
+/**
+ * Writes the tree of a serialized AST file to a stream, in the same output as `dumpAST` on the
+ * tree it was written from. The tree is read from the file in place.
+ *
+ * @param file The file to write. If NULL or empty, nothing is written.
+ *
+ * @param format The output format.
+ *
+ * @param stream The stream to write to.
+ *
+ * @return 1 on success, 0 if memory allocation or writing to the stream fails.
+ */
+int dumpCastFile(const CastFile *const file, const DumpFormat format, FILE *const stream);
+
+/**
+ * Writes the tokens of a file to a stream, skipping whitespace and comments.
+ *
+ * The tokens are collected in a large buffer that is written to the stream in few large writes.
+ * The tree format writes the same lines as `printToken`.
+ *
+ * @param tokens The tokens to write.
+ *
+ * @param tokenCount The number of tokens.
+ *
+ * @param format The output format.
+ *
+ * @param stream The stream to write to.
+ *
+ * @return 1 on success, 0 if memory allocation or writing to the stream fails.
+ */
+int dumpTokens(Token **const tokens, const size_t tokenCount, const DumpFormat format, FILE *const stream);
+
+#endif // DUMP_H
@@ -0,0 +1,339 @@
+#include "file_cache.h"
+
+/*****************************************************************************************************
+                            PRIVATE FILE CACHE FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+/* Number of buckets of a new cache, a power of two */
+#define FILE_CACHE_BUCKET_COUNT 1024
+
+/* FNV-1a parameters */
+#define FNV_OFFSET_BASIS 14695981039346656037ULL
+#define FNV_PRIME 1099511628211ULL
+
+static size_t hashPath(const char *const path);
+
+static size_t measureTokens(Token **const tokens, const size_t tokenCount);
+
+static void unlinkFileCacheEntry(FileCache *const cache, FileCacheEntry *const entry);
+
+static void linkFileCacheEntry(FileCache *const cache, FileCacheEntry *const entry);
+
+static void removeFileCacheEntry(FileCache *const cache, FileCacheEntry *const entry);
+
+/*****************************************************************************************************
+                                PRIVATE FILE CACHE FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Hashes a path with FNV-1a.
+ *
+ * @param path The path to hash.
+ *
+ * @return The hash of the path.
+ */
+static size_t hashPath(const char *const path)
+{
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (const char *c = path; *c != '\0'; c++)
+    {
+        hash ^= (unsigned char)*c;
+        hash *= FNV_PRIME;
+    }
+
+    return (size_t)hash;
+}
+
+/**
+ * Estimates the memory used by an array of tokens, including their texts and string values.
+ *
+ * @param tokens The tokens.
+ *
+ * @param tokenCount The number of tokens.
+ *
+ * @return The number of bytes.
+ */
+static size_t measureTokens(Token **const tokens, const size_t tokenCount)
+{
+    size_t bytes = tokenCount * sizeof(Token *);
+    for (size_t i = 0; i < tokenCount; i++)
+    {
+        bytes += sizeof(Token);
+        if (tokens[i]->text != NULL)
+        {
+            bytes += strlen(tokens[i]->text) + 1;
+        }
+        if (tokens[i]->type == TOKEN_STRING && tokens[i]->value.string != NULL)
+        {
+            bytes += strlen(tokens[i]->value.string) + 1;
+        }
+    }
+
+    return bytes;
+}
+
+/**
+ * Takes an entry out of the recently used list.
+ *
+ * @param cache The cache of the entry.
+ *
+ * @param entry The entry to unlink.
+ */
+static void unlinkFileCacheEntry(FileCache *const cache, FileCacheEntry *const entry)
+{
+    if (entry->newer != NULL)
+    {
+        entry->newer->older = entry->older;
+    }
+    else
+    {
+        cache->newest = entry->older;
+    }
+
+    if (entry->older != NULL)
+    {
+        entry->older->newer = entry->newer;
+    }
+    else
+    {
+        cache->oldest = entry->newer;
+    }
+
+    entry->newer = NULL;
+    entry->older = NULL;
+}
+
+/**
+ * Puts an entry at the most recently used end of the list.
+ *
+ * @param cache The cache of the entry.
+ *
+ * @param entry The entry to link.
+ */
+static void linkFileCacheEntry(FileCache *const cache, FileCacheEntry *const entry)
+{
+    entry->newer = NULL;
+    entry->older = cache->newest;
+    if (cache->newest != NULL)
+    {
+        cache->newest->newer = entry;
+    }
+    cache->newest = entry;
+
+    if (cache->oldest == NULL)
+    {
+        cache->oldest = entry;
+    }
+}
+
+/**
+ * Removes an entry from the cache and frees it with the contents and tokens it owns.
+ *
+ * @param cache The cache of the entry.
+ *
+ * @param entry The entry to remove.
+ */
+static void removeFileCacheEntry(FileCache *const cache, FileCacheEntry *const entry)
+{
+    FileCacheEntry **link = &cache->buckets[hashPath(entry->path) & (cache->bucketCount - 1)];
+    while (*link != entry)
+    {
+        link = &(*link)->nextInBucket;
+    }
+    *link = entry->nextInBucket;
+
+    unlinkFileCacheEntry(cache, entry);
+    cache->entryCount--;
+    cache->bytes -= entry->bytes;
+
+    deleteTokens(entry->tokens, entry->tokenCount);
+    free(entry->contents);
+    free(entry->path);
+    free(entry);
+}
+
+/*****************************************************************************************************
+                                PUBLIC FILE CACHE FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+FileCache *createFileCache(const size_t capacity)
+{
+    FileCache *cache = malloc(sizeof(FileCache));
+    if (cache == NULL)
+    {
+        fprintf(stderr, "Memory allocation for File Cache failed!\n");
+        return NULL;
+    }
+
+    cache->bucketCount = FILE_CACHE_BUCKET_COUNT;
+    cache->buckets = calloc(cache->bucketCount, sizeof(FileCacheEntry *));
+    if (cache->buckets == NULL)
+    {
+        fprintf(stderr, "Memory allocation for File Cache buckets failed!\n");
+        free(cache);
+        return NULL;
+    }
+    cache->newest = NULL;
+    cache->oldest = NULL;
+    cache->entryCount = 0;
+    cache->bytes = 0;
+    cache->capacity = capacity;
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->evictions = 0;
+
+    return cache;
+}
+
+const FileCacheEntry *findFileCacheEntry(FileCache *const cache, const char *const path, const int64_t modifiedTime, const size_t fileSize, const SourceLoc fileStart)
+{
+    if (cache == NULL || path == NULL)
+    {
+        return NULL;
+    }
+
+    FileCacheEntry *entry = cache->buckets[hashPath(path) & (cache->bucketCount - 1)];
+    while (entry != NULL && strcmp(entry->path, path) != 0)
+    {
+        entry = entry->nextInBucket;
+    }
+
+    if (entry == NULL)
+    {
+        cache->misses++;
+        return NULL;
+    }
+
+    //The file changed since it was cached, or is placed differently in this compilation
+    if (entry->modifiedTime != modifiedTime || entry->fileSize != fileSize || entry->fileStart != fileStart)
+    {
+        if (!entry->pinned)
+        {
+            removeFileCacheEntry(cache, entry);
+        }
+        cache->misses++;
+        return NULL;
+    }
+
+    unlinkFileCacheEntry(cache, entry);
+    linkFileCacheEntry(cache, entry);
+    entry->pinned = 1;
+    cache->hits++;
+
+    return entry;
+}
+
+int addFileCacheEntry(FileCache *const cache, const char *const path, const int64_t modifiedTime, const size_t fileSize, const SourceLoc fileStart, char *const contents, Token **const tokens, const size_t tokenCount)
+{
+    if (cache == NULL || path == NULL || contents == NULL || tokens == NULL)
+    {
+        fprintf(stderr, "File Cache or cached file is NULL!\n");
+        return 0;
+    }
+
+    size_t bytes = sizeof(FileCacheEntry) + strlen(path) + 1 + fileSize + 1 + measureTokens(tokens, tokenCount);
+    if (bytes > cache->capacity)
+    {
+        return 0;
+    }
+
+    //A pinned entry of the same path is still in use, so the new state is not kept
+    size_t bucket = hashPath(path) & (cache->bucketCount - 1);
+    for (FileCacheEntry *entry = cache->buckets[bucket]; entry != NULL; entry = entry->nextInBucket)
+    {
+        if (strcmp(entry->path, path) == 0)
+        {
+            if (entry->pinned)
+            {
+                return 0;
+            }
+            removeFileCacheEntry(cache, entry);
+            break;
+        }
+    }
+
+    //Evict the least recently used entries that are not in use until the new one fits
+    FileCacheEntry *victim = cache->oldest;
+    while (cache->bytes + bytes > cache->capacity && victim != NULL)
+    {
+        FileCacheEntry *newer = victim->newer;
+        if (!victim->pinned)
+        {
+            removeFileCacheEntry(cache, victim);
+            cache->evictions++;
+        }
+        victim = newer;
+    }
+
+    if (cache->bytes + bytes > cache->capacity)
+    {
+        return 0;
+    }
+
+    FileCacheEntry *entry = malloc(sizeof(FileCacheEntry));
+    char *pathCopy = strdup(path);
+    if (entry == NULL || pathCopy == NULL)
+    {
+        fprintf(stderr, "Memory allocation for File Cache entry failed!\n");
+        free(entry);
+        free(pathCopy);
+        return 0;
+    }
+    entry->path = pathCopy;
+    entry->modifiedTime = modifiedTime;
+    entry->fileSize = fileSize;
+    entry->fileStart = fileStart;
+    entry->contents = contents;
+    entry->tokens = tokens;
+    entry->tokenCount = tokenCount;
+    entry->bytes = bytes;
+    entry->pinned = 1;
+
+    entry->nextInBucket = cache->buckets[bucket];
+    cache->buckets[bucket] = entry;
+    linkFileCacheEntry(cache, entry);
+    cache->entryCount++;
+    cache->bytes += bytes;
+
+    return 1;
+}
+
+void unpinFileCache(FileCache *const cache)
+{
+    if (cache == NULL)
+    {
+        return;
+    }
+
+    for (FileCacheEntry *entry = cache->newest; entry != NULL; entry = entry->older)
+    {
+        entry->pinned = 0;
+    }
+}
+
+void printFileCacheStats(const FileCache *const cache, FILE *const stream)
+{
+    if (cache == NULL)
+    {
+        fprintf(stderr, "File Cache is NULL!\n");
+        return;
+    }
+
+    fprintf(stream, "File cache: %zu files, %zu of %zu bytes, %zu hits, %zu misses, %zu evictions\n",
+            cache->entryCount, cache->bytes, cache->capacity, cache->hits, cache->misses, cache->evictions);
+}
+
+void deleteFileCache(FileCache *const cache)
+{
+    if (cache == NULL)
+    {
+        return;
+    }
+
+    while (cache->oldest != NULL)
+    {
+        removeFileCacheEntry(cache, cache->oldest);
+    }
+    free(cache->buckets);
+    free(cache);
+}
@@ -0,0 +1,152 @@
+#ifndef FILE_CACHE_H
+#define FILE_CACHE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "token.h"
+
+/**
+ * Represents the cached state of one source file.
+ *
+ * An entry is only valid for the exact file it was made from: the same path, modification time
+ * and size, and the same `SourceLoc` start, because the locations of the tokens depend on it.
+ *
+ * - `path`: The absolute path of the file. Owned by the entry.
+ * - `modifiedTime`: The modification time of the file when it was read.
+ * - `fileSize`: The size of the file when it was read.
+ * - `fileStart`: The `SourceLoc` the file started at when it was lexed.
+ * - `contents`: The contents of the file. Owned by the entry.
+ * - `tokens`: The tokens of the file. Owned by the entry.
+ * - `tokenCount`: The number of tokens.
+ * - `bytes`: The memory the entry accounts for in the cache.
+ * - `pinned`: Set while a compilation uses the entry, a pinned entry is never evicted.
+ * - `newer`, `older`: The neighbours of the entry in the recently used list.
+ * - `nextInBucket`: The next entry of the same hash bucket.
+ */
+typedef struct fileCacheEntry
+{
+    char *path;                             /** The absolute path of the file. */
+    int64_t modifiedTime;                   /** The modification time of the file. */
+    size_t fileSize;                        /** The size of the file. */
+    SourceLoc fileStart;                    /** The location the file was lexed at. */
+    char *contents;                         /** The contents of the file. */
+    Token **tokens;                         /** The tokens of the file. */
+    size_t tokenCount;                      /** Number of tokens. */
+    size_t bytes;                           /** The accounted memory of the entry. */
+    int pinned;                             /** Whether a compilation uses the entry. */
+    struct fileCacheEntry *newer;           /** The more recently used neighbour. */
+    struct fileCacheEntry *older;           /** The less recently used neighbour. */
+    struct fileCacheEntry *nextInBucket;    /** The next entry in the bucket. */
+} FileCacheEntry;
+
+/**
+ * Represents the per-file state a long running compiler keeps between compilations.
+ *
+ * The entries are found by path in a hash table and kept in a list ordered by their last use.
+ * When adding an entry would take the cache over its byte limit, the least recently used
+ * entries that are not pinned are evicted first.
+ *
+ * - `buckets`: The hash table of the entries, chained through `nextInBucket`.
+ * - `bucketCount`: The number of buckets, a power of two.
+ * - `newest`, `oldest`: The ends of the recently used list.
+ * - `entryCount`: The number of entries.
+ * - `bytes`: The memory used by the entries.
+ * - `capacity`: The most memory the entries may use.
+ * - `hits`, `misses`, `evictions`: Counters for the statistics.
+ */
+typedef struct fileCache
+{
+    FileCacheEntry **buckets;   /** The hash table of the entries. */
+    size_t bucketCount;         /** Number of buckets. */
+    FileCacheEntry *newest;     /** The most recently used entry. */
+    FileCacheEntry *oldest;     /** The least recently used entry. */
+    size_t entryCount;          /** Number of entries. */
+    size_t bytes;               /** Memory used by the entries. */
+    size_t capacity;            /** Memory limit of the entries. */
+    size_t hits;                /** Number of successful lookups. */
+    size_t misses;              /** Number of failed lookups. */
+    size_t evictions;           /** Number of evicted entries. */
+} FileCache;
+
+/**
+ * Creates a new, empty `FileCache`.
+ *
+ * @param capacity The most memory in bytes the cached files may use.
+ *
+ * @return A pointer to the newly created `FileCache`, or NULL if memory allocation fails.
+ *
+ * @note The caller is responsible for freeing the cache with `deleteFileCache`.
+ */
+FileCache *createFileCache(const size_t capacity);
+
+/**
+ * Looks up the cached state of a file and pins it until `unpinFileCache` is called.
+ *
+ * An entry of the same path that does not match the other keys is stale and is removed.
+ *
+ * @param cache The cache to search.
+ *
+ * @param path The absolute path of the file.
+ *
+ * @param modifiedTime The current modification time of the file.
+ *
+ * @param fileSize The current size of the file.
+ *
+ * @param fileStart The location the file starts at in this compilation.
+ *
+ * @return The entry, or NULL if the file is not cached.
+ */
+const FileCacheEntry *findFileCacheEntry(FileCache *const cache, const char *const path, const int64_t modifiedTime, const size_t fileSize, const SourceLoc fileStart);
+
+/**
+ * Adds the state of a file to the cache and pins it until `unpinFileCache` is called.
+ *
+ * On success the cache takes ownership of the contents and the tokens.
+ *
+ * @param cache The cache to add to.
+ *
+ * @param path The absolute path of the file. It is copied.
+ *
+ * @param modifiedTime The modification time of the file.
+ *
+ * @param fileSize The size of the file.
+ *
+ * @param fileStart The location the file was lexed at.
+ *
+ * @param contents The contents of the file.
+ *
+ * @param tokens The tokens of the file.
+ *
+ * @param tokenCount The number of tokens.
+ *
+ * @return 1 if the entry was added, 0 if it does not fit next to the pinned entries or memory
+ *         allocation fails. On failure the caller keeps ownership of the contents and the tokens.
+ */
+int addFileCacheEntry(FileCache *const cache, const char *const path, const int64_t modifiedTime, const size_t fileSize, const SourceLoc fileStart, char *const contents, Token **const tokens, const size_t tokenCount);
+
+/**
+ * Unpins every entry, called once a compilation no longer uses them.
+ *
+ * @param cache The cache to unpin.
+ */
+void unpinFileCache(FileCache *const cache);
+
+/**
+ * Prints the hit, miss and eviction counters and the memory use of the cache.
+ *
+ * @param cache The cache to print.
+ *
+ * @param stream The stream to print to.
+ */
+void printFileCacheStats(const FileCache *const cache, FILE *const stream);
+
+/**
+ * Deletes a `FileCache` and every cached file.
+ *
+ * @param cache The cache to delete. If NULL, the function does nothing.
+ */
+void deleteFileCache(FileCache *const cache);
+
+#endif // FILE_CACHE_H
@@ -0,0 +1,242 @@
+#include "flat_ast.h"
+
+/*****************************************************************************************************
+                            PRIVATE FLAT AST FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+static int measureFlatNode(const ASTNode *const astNode, size_t *nodeCount, size_t *tokenCount);
+
+static size_t addFlatNode(FlatAST *const ast, const ASTNode *const astNode);
+
+static ASTNode *expandFlatNode(const FlatAST *const ast, const size_t index, ASTArena *const arena, int *failed);
+
+/*****************************************************************************************************
+                                PRIVATE FLAT AST FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Counts the records and tokens a tree needs in a `FlatAST`.
+ *
+ * @param astNode The root of the tree to measure, NULL for a missing child.
+ *
+ * @param nodeCount Incremented by the number of records.
+ *
+ * @param tokenCount Incremented by the number of tokens.
+ *
+ * @return 1 on success, 0 if a node has more tokens than a `FlatNode` can hold.
+ */
+static int measureFlatNode(const ASTNode *const astNode, size_t *nodeCount, size_t *tokenCount)
+{
+    (*nodeCount)++;
+    if (astNode == NULL)
+    {
+        return 1;
+    }
+
+    if (astNode->tokenCount > UINT16_MAX)
+    {
+        fprintf(stderr, "AST Node has too many tokens for a Flat AST!\n");
+        return 0;
+    }
+
+    *tokenCount += astNode->tokenCount;
+    for (size_t i = 0; i < astNode->childCount; i++)
+    {
+        if (!measureFlatNode(astNode->children[i], nodeCount, tokenCount))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * Appends the records of a subtree to a `FlatAST` in pre-order.
+ *
+ * @param ast The tree being built. Its counts are used as the fill positions of the arrays.
+ *
+ * @param astNode The node to add, NULL for a missing child.
+ *
+ * @return The number of records added, which is the `subtreeSize` of the node.
+ */
+static size_t addFlatNode(FlatAST *const ast, const ASTNode *const astNode)
+{
+    size_t index = ast->nodeCount++;
+    FlatNode *node = &ast->nodes[index];
+    node->firstToken = (uint32_t)ast->tokenCount;
+    node->subtreeSize = 1;
+    if (astNode == NULL)
+    {
+        node->type = 0;
+        node->flags = FLAT_NODE_MISSING;
+        node->tokenCount = 0;
+        node->childCount = 0;
+        return 1;
+    }
+
+    node->type = (uint8_t)astNode->type;
+    node->flags = 0;
+    node->tokenCount = (uint16_t)astNode->tokenCount;
+    node->childCount = (uint32_t)astNode->childCount;
+    for (size_t i = 0; i < astNode->tokenCount; i++)
+    {
+        ast->tokens[ast->tokenCount++] = astNode->tokens[i];
+    }
+
+    size_t subtreeSize = 1;
+    for (size_t i = 0; i < astNode->childCount; i++)
+    {
+        subtreeSize += addFlatNode(ast, astNode->children[i]);
+    }
+    ast->nodes[index].subtreeSize = (uint32_t)subtreeSize;
+
+    return subtreeSize;
+}
+
+/**
+ * Rebuilds the `ASTNode` of a record and its subtree.
+ *
+ * @param ast The `FlatAST` being decoded.
+ *
+ * @param index The index of the record to decode.
+ *
+ * @param arena The `ASTArena` to allocate the nodes from.
+ *
+ * @param failed Set to 1 if an allocation fails.
+ *
+ * @return The decoded node, or NULL for a missing child or on failure.
+ */
+static ASTNode *expandFlatNode(const FlatAST *const ast, const size_t index, ASTArena *const arena, int *failed)
+{
+    const FlatNode *node = &ast->nodes[index];
+    if (node->flags & FLAT_NODE_MISSING)
+    {
+        return NULL;
+    }
+
+    Token **tokens = NULL;
+    if (node->tokenCount > 0)
+    {
+        tokens = allocateFromASTArena(arena, node->tokenCount * sizeof(Token *));
+        if (tokens == NULL)
+        {
+            *failed = 1;
+            return NULL;
+        }
+
+        for (size_t i = 0; i < node->tokenCount; i++)
+        {
+            tokens[i] = ast->tokens[node->firstToken + i];
+        }
+    }
+
+    ASTNode **children = NULL;
+    if (node->childCount > 0)
+    {
+        children = allocateFromASTArena(arena, node->childCount * sizeof(ASTNode *));
+        if (children == NULL)
+        {
+            *failed = 1;
+            return NULL;
+        }
+
+        size_t child = FLAT_FIRST_CHILD(index);
+        for (size_t i = 0; i < node->childCount; i++)
+        {
+            children[i] = expandFlatNode(ast, child, arena, failed);
+            if (*failed)
+            {
+                return NULL;
+            }
+            child = FLAT_NEXT_SIBLING(ast, child);
+        }
+    }
+
+    ASTNode *astNode = createArenaASTNode(arena, (ASTType)node->type, tokens, node->tokenCount, children, node->childCount);
+    if (astNode == NULL)
+    {
+        *failed = 1;
+    }
+
+    return astNode;
+}
+
+/*****************************************************************************************************
+                                PUBLIC FLAT AST FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+FlatAST *createFlatAST(const ASTNode *const root)
+{
+    if (root == NULL)
+    {
+        fprintf(stderr, "AST root is NULL!\n");
+        return NULL;
+    }
+
+    size_t nodeCount = 0;
+    size_t tokenCount = 0;
+    if (!measureFlatNode(root, &nodeCount, &tokenCount))
+    {
+        return NULL;
+    }
+
+    if (nodeCount > UINT32_MAX || tokenCount > UINT32_MAX)
+    {
+        fprintf(stderr, "AST is too large for a Flat AST!\n");
+        return NULL;
+    }
+
+    FlatAST *ast = malloc(sizeof(FlatAST));
+    if (ast == NULL)
+    {
+        fprintf(stderr, "Memory allocation for Flat AST failed!\n");
+        return NULL;
+    }
+
+    ast->nodes = malloc(nodeCount * sizeof(FlatNode));
+    ast->tokens = malloc((tokenCount > 0 ? tokenCount : 1) * sizeof(Token *));
+    if (ast->nodes == NULL || ast->tokens == NULL)
+    {
+        fprintf(stderr, "Memory allocation for Flat AST arrays failed!\n");
+        deleteFlatAST(ast);
+        return NULL;
+    }
+    ast->nodeCount = 0;
+    ast->tokenCount = 0;
+
+    addFlatNode(ast, root);
+
+    return ast;
+}
+
+ASTNode *expandFlatAST(const FlatAST *const ast, ASTArena *const arena)
+{
+    if (ast == NULL || ast->nodeCount == 0)
+    {
+        fprintf(stderr, "Flat AST is empty!\n");
+        return NULL;
+    }
+
+    int failed = 0;
+    ASTNode *root = expandFlatNode(ast, 0, arena, &failed);
+    if (failed)
+    {
+        fprintf(stderr, "Memory allocation for expanding the Flat AST failed!\n");
+        return NULL;
+    }
+
+    return root;
+}
+
+void deleteFlatAST(FlatAST *const ast)
+{
+    if (ast == NULL)
+    {
+        return;
+    }
+
+    free(ast->nodes);
+    free(ast->tokens);
+    free(ast);
+}
@@ -0,0 +1,113 @@
+#ifndef FLAT_AST_H
+#define FLAT_AST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "token.h"
+#include "AST.h"
+
+/**
+ * Marks a record that stands for a missing (NULL) child of an `ASTNode`.
+ */
+#define FLAT_NODE_MISSING 0x01
+
+/**
+ * Returns the index of the first child of the node at `index`.
+ * Only valid if the node has children.
+ */
+#define FLAT_FIRST_CHILD(index) ((index) + 1)
+
+/**
+ * Returns the index of the node following the subtree of the node at `index`,
+ * which is its next sibling if it has one.
+ */
+#define FLAT_NEXT_SIBLING(ast, index) ((index) + (ast)->nodes[(index)].subtreeSize)
+
+/**
+ * Represents a record of a `FlatAST`.
+ *
+ * Every record takes 16 bytes and holds no pointers. The children of a node are the
+ * records following it, and its subtree is the next `subtreeSize` records, so a whole
+ * subtree can be skipped in constant time.
+ *
+ * - `type`: The `ASTType` of the node.
+ * - `flags`: `FLAT_NODE_MISSING` if the record stands for a NULL child, 0 otherwise.
+ * - `tokenCount`: The number of tokens of the node.
+ * - `firstToken`: The index of the first token of the node in the token table.
+ * - `childCount`: The number of children of the node, including missing ones.
+ * - `subtreeSize`: The number of records in the subtree of the node, including itself.
+ */
+typedef struct flatNode
+{
+    uint8_t type;                   /** The `ASTType` of the node. */
+    uint8_t flags;                  /** `FLAT_NODE_MISSING` for NULL children. */
+    uint16_t tokenCount;            /** Number of tokens of the node. */
+    uint32_t firstToken;            /** Index of the first token in the token table. */
+    uint32_t childCount;            /** Number of children. */
+    uint32_t subtreeSize;           /** Number of records in the subtree. */
+} FlatNode;
+
+/**
+ * Represents an Abstract Syntax Tree (AST) encoded in pre-order in one contiguous array.
+ *
+ * - `nodes`: The records in pre-order. The root is record 0.
+ * - `nodeCount`: The number of records.
+ * - `tokens`: The token table, the tokens of every node in pre-order.
+ * - `tokenCount`: The number of tokens in the token table.
+ *
+ * A full traversal is a forward scan over `nodes`. Structured walks move to the first child
+ * with `FLAT_FIRST_CHILD` and to the next sibling with `FLAT_NEXT_SIBLING`.
+ *
+ * @note The `FlatAST` does not own the `Token` objects, only the table pointing to them.
+ */
+typedef struct flatAST
+{
+    FlatNode *nodes;                /** The records in pre-order. */
+    size_t nodeCount;               /** Number of records. */
+    Token **tokens;                 /** The token table. */
+    size_t tokenCount;              /** Number of tokens in the token table. */
+} FlatAST;
+
+/**
+ * Encodes a tree of `ASTNode`s into a `FlatAST`.
+ *
+ * The tree is measured first, so both arrays are allocated once with their exact size.
+ * NULL children are kept as records marked with `FLAT_NODE_MISSING`, so `expandFlatAST`
+ * gives back the same tree. The `ASTNode` tree is not modified and can be freed afterwards.
+ *
+ * @param root The root of the tree to encode.
+ *
+ * @return A pointer to the new `FlatAST`, or NULL if the root is NULL, memory allocation fails,
+ *         or the tree is too large for 32 bit indices.
+ *
+ * @note The caller is responsible for freeing the returned `FlatAST` with `deleteFlatAST`.
+ */
+FlatAST *createFlatAST(const ASTNode *const root);
+
+/**
+ * Decodes a `FlatAST` back into a tree of `ASTNode`s.
+ *
+ * The nodes and their token and child arrays are allocated from `arena`. The tokens
+ * are shared with the `FlatAST`, not duplicated.
+ *
+ * @param ast The `FlatAST` to decode.
+ *
+ * @param arena The `ASTArena` to allocate the tree from.
+ *
+ * @return The root of the decoded tree, or NULL if `ast` is empty or memory allocation fails.
+ *
+ * @note The tree is freed with the arena, through `deleteASTArena`.
+ */
+ASTNode *expandFlatAST(const FlatAST *const ast, ASTArena *const arena);
+
+/**
+ * Deletes a `FlatAST` and frees its memory.
+ *
+ * @param ast The `FlatAST` to delete. If NULL, the function does nothing.
+ *
+ * @note The `Token` objects referenced by the tree are not freed.
+ */
+void deleteFlatAST(FlatAST *const ast);
+
+#endif // FLAT_AST_H
@@ -0,0 +1,287 @@
+#include "perf_counters.h"
+
+#include <errno.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+/*****************************************************************************************************
+                            PRIVATE PERF COUNTERS FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+/* Set while the counters are read */
+static int countersEnabled = 0;
+
+/* Whether each counter could be opened by the thread that enabled the counters */
+static int availableCounters[PERF_COUNTER_COUNT] = {0};
+
+/* Closes the counters of a thread when it exits */
+static pthread_key_t groupKey;
+static pthread_once_t groupKeyOnce = PTHREAD_ONCE_INIT;
+
+/* The counters of the calling thread, NULL until it first reads them */
+static __thread PerfCounterGroup *threadGroup = NULL;
+
+static const char *const counterNames[PERF_COUNTER_COUNT] = {
+    "cycles",
+    "instructions",
+    "L1D misses",
+    "LLC misses",
+    "branch misses",
+};
+
+static void createGroupKey(void);
+
+static void closePerfCounterGroup(void *const argument);
+
+static PerfCounterGroup *openPerfCounterGroup(int *const error);
+
+static PerfCounterGroup *getThreadGroup(int *const error);
+
+/*****************************************************************************************************
+                                PRIVATE PERF COUNTERS FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Creates the key that closes the counters of a thread when it exits. Used with `pthread_once`.
+ */
+static void createGroupKey(void)
+{
+    if (pthread_key_create(&groupKey, closePerfCounterGroup) != 0)
+    {
+        fprintf(stderr, "Failed to create the performance counter key.\n");
+    }
+}
+
+/**
+ * Closes and frees the counters of a thread.
+ *
+ * @param argument The `PerfCounterGroup` to close.
+ */
+static void closePerfCounterGroup(void *const argument)
+{
+    PerfCounterGroup *group = argument;
+    if (group == NULL)
+    {
+        return;
+    }
+
+#ifdef __linux__
+    //Close the members before the leader
+    for (size_t i = PERF_COUNTER_COUNT; i-- > 0;)
+    {
+        if (group->fds[i] >= 0)
+        {
+            close(group->fds[i]);
+        }
+    }
+#endif
+    free(group);
+}
+
+/**
+ * Opens the counters of the calling thread as a group led by the cycle counter. The counters
+ * count the thread in user space only, so they work with a `perf_event_paranoid` of 2.
+ *
+ * @param error Set to the `errno` of opening the cycle counter if it fails, 0 otherwise.
+ *
+ * @return The group, with no counters if the cycle counter cannot be opened, or NULL if memory
+ *         allocation fails. The caller closes it with `closePerfCounterGroup`.
+ */
+static PerfCounterGroup *openPerfCounterGroup(int *const error)
+{
+    PerfCounterGroup *group = malloc(sizeof(PerfCounterGroup));
+    if (group == NULL)
+    {
+        fprintf(stderr, "Memory allocation for the performance counters failed!\n");
+        return NULL;
+    }
+    group->slotCount = 0;
+    *error = 0;
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; i++)
+    {
+        group->fds[i] = -1;
+        group->slots[i] = -1;
+    }
+
+#ifdef __linux__
+    static const uint32_t types[PERF_COUNTER_COUNT] = {
+        PERF_TYPE_HARDWARE,
+        PERF_TYPE_HARDWARE,
+        PERF_TYPE_HW_CACHE,
+        PERF_TYPE_HARDWARE,
+        PERF_TYPE_HARDWARE,
+    };
+    static const uint64_t configs[PERF_COUNTER_COUNT] = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES,
+    };
+
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; i++)
+    {
+        struct perf_event_attr attributes;
+        memset(&attributes, 0, sizeof(attributes));
+        attributes.size = sizeof(attributes);
+        attributes.type = types[i];
+        attributes.config = configs[i];
+        attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+
+        int leader = group->fds[PERF_COUNTER_CYCLES];
+        int fd = (int)syscall(SYS_perf_event_open, &attributes, 0, -1, leader, 0);
+        if (fd < 0)
+        {
+            //Without the leader there is no group to add the others to
+            if (i == PERF_COUNTER_CYCLES)
+            {
+                *error = errno;
+                return group;
+            }
+            continue;
+        }
+
+        group->fds[i] = fd;
+        group->slots[i] = (int)group->slotCount++;
+    }
+#else
+    *error = ENOSYS;
+#endif
+
+    return group;
+}
+
+/**
+ * Returns the counters of the calling thread, opening them the first time. A thread keeps its
+ * counters until it exits, so a compile server opens them only once.
+ *
+ * @param error Set to the `errno` of opening the cycle counter if this call fails to, 0 otherwise.
+ *
+ * @return The group, or NULL if memory allocation fails.
+ */
+static PerfCounterGroup *getThreadGroup(int *const error)
+{
+    *error = 0;
+    if (threadGroup != NULL)
+    {
+        return threadGroup;
+    }
+
+    pthread_once(&groupKeyOnce, createGroupKey);
+    threadGroup = openPerfCounterGroup(error);
+    if (threadGroup != NULL)
+    {
+        pthread_setspecific(groupKey, threadGroup);
+    }
+    return threadGroup;
+}
+
+/*****************************************************************************************************
+                                PUBLIC PERF COUNTERS FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+int enablePerfCounters(FILE *const err)
+{
+    int error;
+    PerfCounterGroup *group = getThreadGroup(&error);
+    if (group == NULL)
+    {
+        return 0;
+    }
+
+    if (group->slotCount == 0)
+    {
+        static int warned = 0;
+        if (!warned)
+        {
+            fprintf(err, "Hardware performance counters are unavailable (%s), only the time is reported.\n",
+                    error != 0 ? strerror(error) : "no cycle counter");
+            warned = 1;
+        }
+        return 0;
+    }
+
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; i++)
+    {
+        availableCounters[i] = group->slots[i] >= 0;
+    }
+    countersEnabled = 1;
+    return 1;
+}
+
+void disablePerfCounters(void)
+{
+    countersEnabled = 0;
+}
+
+int isPerfCounterAvailable(const PerfCounter counter)
+{
+    return countersEnabled && counter < PERF_COUNTER_COUNT && availableCounters[counter];
+}
+
+const char *getPerfCounterName(const PerfCounter counter)
+{
+    return counter < PERF_COUNTER_COUNT ? counterNames[counter] : "unknown";
+}
+
+void readPerfCounters(PerfSample *const sample)
+{
+    sample->valid = 0;
+    if (!countersEnabled)
+    {
+        return;
+    }
+
+#ifdef __linux__
+    int error;
+    PerfCounterGroup *group = getThreadGroup(&error);
+    if (group == NULL || group->slotCount == 0)
+    {
+        return;
+    }
+
+    //A group read is the number of counters, the enabled and running times, then the counts
+    uint64_t data[3 + PERF_COUNTER_COUNT];
+    ssize_t size = read(group->fds[PERF_COUNTER_CYCLES], data, sizeof(data));
+    if (size < (ssize_t)(3 * sizeof(uint64_t)) || data[0] != group->slotCount || size < (ssize_t)((3 + data[0]) * sizeof(uint64_t)))
+    {
+        return;
+    }
+
+    sample->timeEnabled = data[1];
+    sample->timeRunning = data[2];
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; i++)
+    {
+        sample->values[i] = group->slots[i] >= 0 ? data[3 + group->slots[i]] : 0;
+    }
+    sample->valid = 1;
+#endif
+}
+
+int getPerfCounterDelta(const PerfSample *const start, const PerfSample *const end, uint64_t delta[PERF_COUNTER_COUNT])
+{
+    if (!start->valid || !end->valid)
+    {
+        return 0;
+    }
+
+    uint64_t enabled = end->timeEnabled - start->timeEnabled;
+    uint64_t running = end->timeRunning - start->timeRunning;
+    if (running == 0 && enabled != 0)
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; i++)
+    {
+        uint64_t counted = end->values[i] - start->values[i];
+        delta[i] = running == enabled ? counted : (uint64_t)((unsigned __int128)counted * enabled / running);
+    }
+    return 1;
+}
@@ -0,0 +1,125 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+
+/**
+ * The hardware events `--perf-counters` counts.
+ *
+ * - `PERF_COUNTER_CYCLES`: CPU cycles.
+ * - `PERF_COUNTER_INSTRUCTIONS`: Retired instructions.
+ * - `PERF_COUNTER_L1D_MISSES`: Level 1 data cache read misses.
+ * - `PERF_COUNTER_LLC_MISSES`: Last level cache misses.
+ * - `PERF_COUNTER_BRANCH_MISSES`: Mispredicted branches.
+ */
+typedef enum perfCounter
+{
+    PERF_COUNTER_CYCLES,
+    PERF_COUNTER_INSTRUCTIONS,
+    PERF_COUNTER_L1D_MISSES,
+    PERF_COUNTER_LLC_MISSES,
+    PERF_COUNTER_BRANCH_MISSES,
+    PERF_COUNTER_COUNT,
+} PerfCounter;
+
+/**
+ * Represents a reading of the counters of the calling thread.
+ *
+ * The kernel multiplexes the counters when there are more events than hardware counters, so
+ * a reading also holds how long the counters were enabled and how long they actually ran,
+ * which `getPerfCounterDelta` uses to scale the counts.
+ *
+ * - `valid`: 1 if the counters were read, 0 if they are disabled or unavailable.
+ * - `values`: The counts, indexed by `PerfCounter`. Unavailable counters are 0.
+ * - `timeEnabled`: The nanoseconds the counters were enabled.
+ * - `timeRunning`: The nanoseconds the counters were counting.
+ */
+typedef struct perfSample
+{
+    int valid;                              /** Whether the counters were read. */
+    uint64_t values[PERF_COUNTER_COUNT];    /** The counts. */
+    uint64_t timeEnabled;                   /** Nanoseconds enabled. */
+    uint64_t timeRunning;                   /** Nanoseconds counting. */
+} PerfSample;
+
+/**
+ * Represents the counters of one thread, opened as a single `perf_event_open` group so every
+ * counter is read at the same moment with one system call.
+ *
+ * - `fds`: The file descriptor of each counter, or -1 if it could not be opened.
+ * - `slots`: The position of each counter in a read of the group, or -1.
+ * - `slotCount`: The number of counters in the group.
+ */
+typedef struct perfCounterGroup
+{
+    int fds[PERF_COUNTER_COUNT];            /** The counter file descriptors. */
+    int slots[PERF_COUNTER_COUNT];          /** The positions in a read. */
+    size_t slotCount;                       /** Number of counters in the group. */
+} PerfCounterGroup;
+
+/**
+ * Starts counting on every thread that reads the counters. The calling thread opens its
+ * counters right away, and if they are unavailable, like in most containers and virtual
+ * machines or with a restrictive `perf_event_paranoid`, a warning is printed once and the
+ * counters stay disabled.
+ *
+ * Must be called before the threads that read the counters are started.
+ *
+ * @param err The stream the warning is printed to.
+ *
+ * @return 1 if at least the cycle counter is available, 0 otherwise.
+ */
+int enablePerfCounters(FILE *const err);
+
+/**
+ * Stops counting. The counters of a thread are closed when the thread exits.
+ *
+ * Must be called once the threads that read the counters have stopped.
+ */
+void disablePerfCounters(void);
+
+/**
+ * Checks whether a counter is counted.
+ *
+ * @param counter The counter to check.
+ *
+ * @return 1 if the counters are enabled and the counter could be opened, 0 otherwise.
+ */
+int isPerfCounterAvailable(const PerfCounter counter);
+
+/**
+ * Returns the name of a counter, for reports.
+ *
+ * @param counter The counter.
+ *
+ * @return The name, a string literal.
+ */
+const char *getPerfCounterName(const PerfCounter counter);
+
+/**
+ * Reads the counters of the calling thread, opening them the first time the thread reads them.
+ *
+ * @param sample The reading to fill. Its `valid` field is 0 if the counters are disabled or
+ *               the thread could not open them.
+ */
+void readPerfCounters(PerfSample *const sample);
+
+/**
+ * Computes the events counted between two readings of the same thread, scaled up for the time
+ * the kernel had the counters switched out.
+ *
+ * @param start The earlier reading.
+ *
+ * @param end The later reading.
+ *
+ * @param delta Set to the counts, indexed by `PerfCounter`.
+ *
+ * @return 1 on success, 0 if either reading is invalid or the counters never ran in between.
+ */
+int getPerfCounterDelta(const PerfSample *const start, const PerfSample *const end, uint64_t delta[PERF_COUNTER_COUNT]);
+
+#endif // PERF_COUNTERS_H
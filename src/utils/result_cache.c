@@ -0,0 +1,547 @@
+#include "result_cache.h"
+
+#include <errno.h>
+#include <time.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <utime.h>
+#include <unistd.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#define mkdir(path, mode) _mkdir(path)
+#endif
+
+/*****************************************************************************************************
+                            PRIVATE RESULT CACHE FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+/* 128-bit FNV-1a parameters */
+#define FNV128_OFFSET_BASIS (((unsigned __int128)0x6c62272e07bb0142ULL << 64) | 0x62b821756295c58dULL)
+#define FNV128_PRIME (((unsigned __int128)0x0000000001000000ULL << 64) | 0x000000000000013bULL)
+
+/* Extension of the result files */
+#define RESULT_FILE_EXTENSION ".cmcr"
+
+/* Prefix of the temporary files results are written to before they are renamed */
+#define RESULT_TEMP_PREFIX ".tmp."
+
+/* Age in seconds after which a temporary file is considered abandoned */
+#define RESULT_TEMP_MAX_AGE 3600
+
+/**
+ * Represents a result file found while trimming the cache.
+ *
+ * - `name`: The name of the file in the directory.
+ * - `modifiedTime`: The last time the result was written or used.
+ * - `size`: The size of the file.
+ */
+typedef struct resultFile
+{
+    char *name;                 /** The name of the file. */
+    time_t modifiedTime;        /** The last use of the result. */
+    size_t size;                /** The size of the file. */
+} ResultFile;
+
+static char *getResultPath(const ResultCache *const cache, const char *const name);
+
+static void formatResultName(const ResultKey *const key, char *const name);
+
+static int isResultName(const char *const name);
+
+static int readResultData(FILE *const file, char **data, const size_t size);
+
+static int copyResultStream(FILE *const from, FILE *const to, const size_t size);
+
+static int compareResultFiles(const void *first, const void *second);
+
+/*****************************************************************************************************
+                                PRIVATE RESULT CACHE FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Builds the path of a file in the directory of the cache.
+ *
+ * @param cache The cache.
+ *
+ * @param name The name of the file.
+ *
+ * @return The path, or NULL if memory allocation fails. The caller frees it.
+ */
+static char *getResultPath(const ResultCache *const cache, const char *const name)
+{
+    size_t directoryLength = strlen(cache->directory);
+    size_t nameLength = strlen(name);
+    char *path = malloc(directoryLength + 1 + nameLength + 1);
+    if (path == NULL)
+    {
+        return NULL;
+    }
+
+    memcpy(path, cache->directory, directoryLength);
+    path[directoryLength] = '/';
+    memcpy(path + directoryLength + 1, name, nameLength + 1);
+    return path;
+}
+
+/**
+ * Formats the name of the result file of a key: its hex digits and the extension.
+ *
+ * @param key The key.
+ *
+ * @param name The buffer of the name, at least `2 * RESULT_KEY_SIZE + sizeof(RESULT_FILE_EXTENSION)` bytes.
+ */
+static void formatResultName(const ResultKey *const key, char *const name)
+{
+    static const char digits[] = "0123456789abcdef";
+    for (size_t i = 0; i < RESULT_KEY_SIZE; i++)
+    {
+        name[2 * i] = digits[key->bytes[i] >> 4];
+        name[2 * i + 1] = digits[key->bytes[i] & 0xf];
+    }
+    memcpy(name + 2 * RESULT_KEY_SIZE, RESULT_FILE_EXTENSION, sizeof(RESULT_FILE_EXTENSION));
+}
+
+/**
+ * Checks whether a file name is the name of a result file.
+ *
+ * @param name The name of the file.
+ *
+ * @return 1 if it is, 0 otherwise.
+ */
+static int isResultName(const char *const name)
+{
+    if (strlen(name) != 2 * RESULT_KEY_SIZE + strlen(RESULT_FILE_EXTENSION))
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < 2 * RESULT_KEY_SIZE; i++)
+    {
+        if (!((name[i] >= '0' && name[i] <= '9') || (name[i] >= 'a' && name[i] <= 'f')))
+        {
+            return 0;
+        }
+    }
+
+    return strcmp(name + 2 * RESULT_KEY_SIZE, RESULT_FILE_EXTENSION) == 0;
+}
+
+/**
+ * Reads a part of a result file into a new zero terminated buffer.
+ *
+ * @param file The result file, positioned at the part.
+ *
+ * @param data Set to the buffer on success.
+ *
+ * @param size The size of the part.
+ *
+ * @return 1 on success, 0 if memory allocation or reading fails.
+ */
+static int readResultData(FILE *const file, char **data, const size_t size)
+{
+    *data = malloc(size + 1);
+    if (*data == NULL)
+    {
+        return 0;
+    }
+
+    if (fread(*data, 1, size, file) != size)
+    {
+        free(*data);
+        *data = NULL;
+        return 0;
+    }
+    (*data)[size] = '\0';
+
+    return 1;
+}
+
+/**
+ * Copies a temporary file of a compilation into a result file.
+ *
+ * @param from The temporary file, read from its start.
+ *
+ * @param to The result file.
+ *
+ * @param size The number of bytes to copy, the size of the temporary file.
+ *
+ * @return 1 on success, 0 if reading or writing fails.
+ */
+static int copyResultStream(FILE *const from, FILE *const to, const size_t size)
+{
+    rewind(from);
+    char buffer[4096];
+    size_t left = size;
+    while (left > 0)
+    {
+        size_t chunk = left < sizeof(buffer) ? left : sizeof(buffer);
+        if (fread(buffer, 1, chunk, from) != chunk || fwrite(buffer, 1, chunk, to) != chunk)
+        {
+            return 0;
+        }
+        left -= chunk;
+    }
+
+    return 1;
+}
+
+/**
+ * Orders result files from the least to the most recently used. Used with `qsort`.
+ *
+ * @param first The first `ResultFile`.
+ *
+ * @param second The second `ResultFile`.
+ *
+ * @return A negative number, zero or a positive number as the first file is older, as old as
+ *         or newer than the second one.
+ */
+static int compareResultFiles(const void *first, const void *second)
+{
+    const ResultFile *a = first;
+    const ResultFile *b = second;
+    if (a->modifiedTime != b->modifiedTime)
+    {
+        return a->modifiedTime < b->modifiedTime ? -1 : 1;
+    }
+
+    return strcmp(a->name, b->name);
+}
+
+/*****************************************************************************************************
+                                PUBLIC RESULT CACHE FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+void initResultHasher(ResultHasher *const hasher)
+{
+    hasher->state = FNV128_OFFSET_BASIS;
+}
+
+void updateResultHasher(ResultHasher *const hasher, const void *const data, const size_t size)
+{
+    const unsigned char *bytes = data;
+    unsigned __int128 state = hasher->state;
+    for (size_t i = 0; i < size; i++)
+    {
+        state ^= bytes[i];
+        state *= FNV128_PRIME;
+    }
+    hasher->state = state;
+}
+
+void updateResultHasherString(ResultHasher *const hasher, const char *const string)
+{
+    uint64_t length = string != NULL ? strlen(string) : 0;
+    updateResultHasher(hasher, &length, sizeof(length));
+    updateResultHasher(hasher, string, length);
+}
+
+ResultKey finishResultHasher(const ResultHasher *const hasher)
+{
+    ResultKey key;
+    unsigned __int128 state = hasher->state;
+    for (int i = RESULT_KEY_SIZE - 1; i >= 0; i--)
+    {
+        key.bytes[i] = (unsigned char)state;
+        state >>= 8;
+    }
+
+    return key;
+}
+
+ResultCache *createResultCache(const char *const directory, const size_t capacity)
+{
+    if (directory == NULL)
+    {
+        fprintf(stderr, "Result cache directory is NULL!\n");
+        return NULL;
+    }
+
+    if (mkdir(directory, 0777) != 0 && errno != EEXIST)
+    {
+        fprintf(stderr, "Failed to create the result cache directory %s!\n", directory);
+        return NULL;
+    }
+
+    ResultCache *cache = malloc(sizeof(ResultCache));
+    if (cache == NULL)
+    {
+        fprintf(stderr, "Memory allocation for Result Cache failed!\n");
+        return NULL;
+    }
+
+    cache->directory = strdup(directory);
+    if (cache->directory == NULL)
+    {
+        fprintf(stderr, "Memory allocation for Result Cache directory failed!\n");
+        free(cache);
+        return NULL;
+    }
+    cache->capacity = capacity;
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->stores = 0;
+    cache->evictions = 0;
+    cache->entryCount = 0;
+    cache->bytes = 0;
+
+    return cache;
+}
+
+CachedResult *findCachedResult(ResultCache *const cache, const ResultKey *const key)
+{
+    if (cache == NULL || key == NULL)
+    {
+        return NULL;
+    }
+
+    char name[2 * RESULT_KEY_SIZE + sizeof(RESULT_FILE_EXTENSION)];
+    formatResultName(key, name);
+    char *path = getResultPath(cache, name);
+    FILE *file = path != NULL ? fopen(path, "rb") : NULL;
+    if (file == NULL)
+    {
+        free(path);
+        cache->misses++;
+        return NULL;
+    }
+
+    //A file of another format, byte order or key, or a truncated one, is a miss
+    ResultCacheHeader header;
+    struct stat fileStat;
+    CachedResult *result = NULL;
+    if (fread(&header, sizeof(ResultCacheHeader), 1, file) == 1
+        && memcmp(header.magic, RESULT_CACHE_MAGIC, sizeof(header.magic)) == 0
+        && header.version == RESULT_CACHE_VERSION
+        && header.byteOrder == RESULT_CACHE_BYTE_ORDER
+        && memcmp(&header.key, key, sizeof(ResultKey)) == 0
+        && fstat(fileno(file), &fileStat) == 0
+        && (uint64_t)fileStat.st_size == sizeof(ResultCacheHeader) + header.errSize + header.outSize)
+    {
+        result = malloc(sizeof(CachedResult));
+    }
+
+    if (result != NULL)
+    {
+        result->success = header.success != 0;
+        result->errSize = header.errSize;
+        result->outSize = header.outSize;
+        result->out = NULL;
+        if (!readResultData(file, &result->err, result->errSize) || !readResultData(file, &result->out, result->outSize))
+        {
+            deleteCachedResult(result);
+            result = NULL;
+        }
+    }
+    fclose(file);
+
+    if (result == NULL)
+    {
+        free(path);
+        cache->misses++;
+        return NULL;
+    }
+
+    //Mark the result as recently used for the eviction
+    utime(path, NULL);
+    free(path);
+    cache->hits++;
+
+    return result;
+}
+
+int storeCachedResult(ResultCache *const cache, const ResultKey *const key, const int success, FILE *const err, FILE *const out)
+{
+    if (cache == NULL || key == NULL || err == NULL || out == NULL || fflush(err) != 0 || fflush(out) != 0)
+    {
+        return 0;
+    }
+
+    ResultCacheHeader header;
+    memset(&header, 0, sizeof(ResultCacheHeader));
+    memcpy(header.magic, RESULT_CACHE_MAGIC, sizeof(header.magic));
+    header.version = RESULT_CACHE_VERSION;
+    header.byteOrder = RESULT_CACHE_BYTE_ORDER;
+    header.key = *key;
+    header.success = success != 0;
+
+    struct stat errStat;
+    struct stat outStat;
+    if (fstat(fileno(err), &errStat) != 0 || fstat(fileno(out), &outStat) != 0)
+    {
+        return 0;
+    }
+    header.errSize = (uint64_t)errStat.st_size;
+    header.outSize = (uint64_t)outStat.st_size;
+
+    //Write to a temporary file, the rename publishes the complete result at once
+    static unsigned long counter = 0;
+    char tempName[64];
+    snprintf(tempName, sizeof(tempName), RESULT_TEMP_PREFIX "%ld.%lu", (long)getpid(), counter++);
+    char name[2 * RESULT_KEY_SIZE + sizeof(RESULT_FILE_EXTENSION)];
+    formatResultName(key, name);
+
+    char *tempPath = getResultPath(cache, tempName);
+    char *path = getResultPath(cache, name);
+    FILE *file = tempPath != NULL && path != NULL ? fopen(tempPath, "wb") : NULL;
+    if (file == NULL)
+    {
+        free(tempPath);
+        free(path);
+        return 0;
+    }
+
+    int written = fwrite(&header, sizeof(ResultCacheHeader), 1, file) == 1
+        && copyResultStream(err, file, header.errSize)
+        && copyResultStream(out, file, header.outSize);
+    if (fclose(file) != 0 || !written || rename(tempPath, path) != 0)
+    {
+        remove(tempPath);
+        free(tempPath);
+        free(path);
+        return 0;
+    }
+
+    free(tempPath);
+    free(path);
+    cache->stores++;
+    return 1;
+}
+
+void trimResultCache(ResultCache *const cache)
+{
+    if (cache == NULL)
+    {
+        return;
+    }
+
+    DIR *directory = opendir(cache->directory);
+    if (directory == NULL)
+    {
+        return;
+    }
+
+    size_t fileCount = 0;
+    size_t fileCapacity = 64;
+    ResultFile *files = malloc(fileCapacity * sizeof(ResultFile));
+    size_t bytes = 0;
+    time_t now = time(NULL);
+
+    struct dirent *directoryEntry;
+    while (files != NULL && (directoryEntry = readdir(directory)) != NULL)
+    {
+        const char *name = directoryEntry->d_name;
+        int isTemp = strncmp(name, RESULT_TEMP_PREFIX, strlen(RESULT_TEMP_PREFIX)) == 0;
+        if (!isTemp && !isResultName(name))
+        {
+            continue;
+        }
+
+        char *path = getResultPath(cache, name);
+        struct stat fileStat;
+        if (path == NULL || stat(path, &fileStat) != 0)
+        {
+            free(path);
+            continue;
+        }
+
+        //A compiler that crashed while writing its result leaves the temporary file behind
+        if (isTemp)
+        {
+            if (now - fileStat.st_mtime > RESULT_TEMP_MAX_AGE)
+            {
+                remove(path);
+            }
+            free(path);
+            continue;
+        }
+        free(path);
+
+        if (fileCount == fileCapacity)
+        {
+            ResultFile *newFiles = realloc(files, 2 * fileCapacity * sizeof(ResultFile));
+            if (newFiles == NULL)
+            {
+                break;
+            }
+            files = newFiles;
+            fileCapacity *= 2;
+        }
+
+        files[fileCount].name = strdup(name);
+        if (files[fileCount].name == NULL)
+        {
+            break;
+        }
+        files[fileCount].modifiedTime = fileStat.st_mtime;
+        files[fileCount].size = (size_t)fileStat.st_size;
+        bytes += files[fileCount].size;
+        fileCount++;
+    }
+    closedir(directory);
+
+    if (files == NULL)
+    {
+        return;
+    }
+
+    //Evict the least recently used results first, another compiler may have removed them already
+    qsort(files, fileCount, sizeof(ResultFile), compareResultFiles);
+    size_t entryCount = fileCount;
+    for (size_t i = 0; i < fileCount && bytes > cache->capacity; i++)
+    {
+        char *path = getResultPath(cache, files[i].name);
+        if (path != NULL && (remove(path) == 0 || errno == ENOENT))
+        {
+            bytes -= files[i].size;
+            entryCount--;
+            cache->evictions++;
+        }
+        free(path);
+    }
+
+    for (size_t i = 0; i < fileCount; i++)
+    {
+        free(files[i].name);
+    }
+    free(files);
+
+    cache->entryCount = entryCount;
+    cache->bytes = bytes;
+}
+
+void printResultCacheStats(const ResultCache *const cache, FILE *const stream)
+{
+    if (cache == NULL)
+    {
+        fprintf(stderr, "Result Cache is NULL!\n");
+        return;
+    }
+
+    fprintf(stream, "Result cache: %zu hits, %zu misses, %zu stores, %zu evictions, %zu results, %zu of %zu bytes\n",
+            cache->hits, cache->misses, cache->stores, cache->evictions, cache->entryCount, cache->bytes, cache->capacity);
+}
+
+void deleteCachedResult(CachedResult *const result)
+{
+    if (result == NULL)
+    {
+        return;
+    }
+
+    free(result->err);
+    free(result->out);
+    free(result);
+}
+
+void deleteResultCache(ResultCache *const cache)
+{
+    if (cache == NULL)
+    {
+        return;
+    }
+
+    free(cache->directory);
+    free(cache);
+}
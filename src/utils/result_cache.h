@@ -0,0 +1,231 @@
+#ifndef RESULT_CACHE_H
+#define RESULT_CACHE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * The magic bytes every cached result file starts with.
+ */
+#define RESULT_CACHE_MAGIC "CMCR"
+
+/**
+ * The version of the cached result format. Bump it on every incompatible change.
+ */
+#define RESULT_CACHE_VERSION 1
+
+/**
+ * Written as a native `uint16_t`, used to reject files written with another byte order.
+ */
+#define RESULT_CACHE_BYTE_ORDER 0x0102
+
+/**
+ * The size of a `ResultKey` in bytes.
+ */
+#define RESULT_KEY_SIZE 16
+
+/**
+ * Identifies the outcome of one compilation: the hash of everything the outcome depends on.
+ *
+ * - `bytes`: The 128-bit hash, most significant byte first.
+ */
+typedef struct resultKey
+{
+    unsigned char bytes[RESULT_KEY_SIZE];   /** The hash. */
+} ResultKey;
+
+/**
+ * Computes a `ResultKey` incrementally with the 128-bit FNV-1a hash.
+ *
+ * - `state`: The hash of the bytes added so far.
+ */
+typedef struct resultHasher
+{
+    unsigned __int128 state;                /** The running hash. */
+} ResultHasher;
+
+/**
+ * The header of a cached result file.
+ *
+ * A file consists of the header, the status messages and the output of the compilation.
+ *
+ * - `magic`: `RESULT_CACHE_MAGIC`, without a terminating zero.
+ * - `version`: `RESULT_CACHE_VERSION`.
+ * - `byteOrder`: `RESULT_CACHE_BYTE_ORDER` in the byte order of the writer.
+ * - `key`: The key of the result, checked against the name of the file.
+ * - `success`: 1 if the compilation succeeded, 0 otherwise.
+ * - `errSize`: The size of the status messages in bytes.
+ * - `outSize`: The size of the output in bytes.
+ */
+typedef struct resultCacheHeader
+{
+    char magic[4];                          /** `RESULT_CACHE_MAGIC`. */
+    uint16_t version;                       /** `RESULT_CACHE_VERSION`. */
+    uint16_t byteOrder;                     /** `RESULT_CACHE_BYTE_ORDER`. */
+    ResultKey key;                          /** The key of the result. */
+    uint32_t success;                       /** Whether the compilation succeeded. */
+    uint32_t reserved;                      /** Zero. */
+    uint64_t errSize;                       /** Size of the status messages. */
+    uint64_t outSize;                       /** Size of the output. */
+} ResultCacheHeader;
+
+/**
+ * Represents the outcome of a compilation read back from the cache.
+ *
+ * - `success`: 1 if the compilation succeeded, 0 otherwise.
+ * - `err`: What the compilation printed to the standard error.
+ * - `errSize`: The size of `err` in bytes.
+ * - `out`: What the compilation printed to the standard output: its errors and its output.
+ * - `outSize`: The size of `out` in bytes.
+ */
+typedef struct cachedResult
+{
+    int success;                            /** Whether the compilation succeeded. */
+    char *err;                              /** The status messages. */
+    size_t errSize;                         /** Size of the status messages. */
+    char *out;                              /** The errors and the output. */
+    size_t outSize;                         /** Size of the errors and the output. */
+} CachedResult;
+
+/**
+ * Represents a directory of compilation results shared by every run of the compiler.
+ *
+ * Every result is a file named after the hex digits of its key. Files are written to a
+ * temporary name and renamed into place, so concurrent compilers never see a partial result.
+ * A hit updates the modification time of the file, and when the directory grows over its
+ * limit the files that were used least recently are removed first.
+ *
+ * - `directory`: The directory of the results. Owned by the cache.
+ * - `capacity`: The most bytes the result files may use.
+ * - `hits`, `misses`, `stores`, `evictions`: Counters of this run, for the statistics.
+ * - `entryCount`: The number of results in the directory when it was last scanned.
+ * - `bytes`: The size of the results when the directory was last scanned.
+ */
+typedef struct resultCache
+{
+    char *directory;                        /** The directory of the results. */
+    size_t capacity;                        /** Size limit of the results. */
+    size_t hits;                            /** Number of results found. */
+    size_t misses;                          /** Number of results not found. */
+    size_t stores;                          /** Number of results written. */
+    size_t evictions;                       /** Number of results removed. */
+    size_t entryCount;                      /** Number of results in the directory. */
+    size_t bytes;                           /** Size of the results in the directory. */
+} ResultCache;
+
+/**
+ * Starts computing a `ResultKey`.
+ *
+ * @param hasher The hasher to initialize.
+ */
+void initResultHasher(ResultHasher *const hasher);
+
+/**
+ * Adds bytes to a `ResultKey` being computed.
+ *
+ * @param hasher The hasher.
+ *
+ * @param data The bytes to add.
+ *
+ * @param size The number of bytes.
+ */
+void updateResultHasher(ResultHasher *const hasher, const void *const data, const size_t size);
+
+/**
+ * Adds a string to a `ResultKey` being computed, together with its length, so that
+ * consecutive strings cannot be confused with each other. NULL is added as an empty string.
+ *
+ * @param hasher The hasher.
+ *
+ * @param string The string to add.
+ */
+void updateResultHasherString(ResultHasher *const hasher, const char *const string);
+
+/**
+ * Finishes computing a `ResultKey`.
+ *
+ * @param hasher The hasher.
+ *
+ * @return The key of the bytes added to the hasher.
+ */
+ResultKey finishResultHasher(const ResultHasher *const hasher);
+
+/**
+ * Creates a `ResultCache` on a directory, creating the directory if it does not exist.
+ *
+ * @param directory The directory of the results. It is copied.
+ *
+ * @param capacity The most bytes the result files may use.
+ *
+ * @return A pointer to the newly created `ResultCache`, or NULL if the directory cannot be
+ *         created or memory allocation fails.
+ *
+ * @note The caller is responsible for freeing the cache with `deleteResultCache`.
+ */
+ResultCache *createResultCache(const char *const directory, const size_t capacity);
+
+/**
+ * Reads the result of a key from the cache and marks it as recently used.
+ *
+ * @param cache The cache to search.
+ *
+ * @param key The key of the result.
+ *
+ * @return The result, or NULL if there is no valid result for the key.
+ *
+ * @note The caller is responsible for freeing the result with `deleteCachedResult`.
+ */
+CachedResult *findCachedResult(ResultCache *const cache, const ResultKey *const key);
+
+/**
+ * Writes the result of a compilation to the cache.
+ *
+ * @param cache The cache to write to.
+ *
+ * @param key The key of the result.
+ *
+ * @param success 1 if the compilation succeeded, 0 otherwise.
+ *
+ * @param err A temporary file holding the status messages of the compilation.
+ *
+ * @param out A temporary file holding the errors and the output of the compilation.
+ *
+ * @return 1 if the result was written, 0 otherwise. A result that cannot be written is only
+ *         a missed opportunity, so nothing is printed.
+ */
+int storeCachedResult(ResultCache *const cache, const ResultKey *const key, const int success, FILE *const err, FILE *const out);
+
+/**
+ * Removes the least recently used results until the cache fits its capacity, together with
+ * temporary files abandoned by compilers that did not finish writing them.
+ *
+ * @param cache The cache to trim. Its `entryCount` and `bytes` are updated.
+ */
+void trimResultCache(ResultCache *const cache);
+
+/**
+ * Prints the counters of this run and the size of the cache.
+ *
+ * @param cache The cache to print.
+ *
+ * @param stream The stream to print to.
+ */
+void printResultCacheStats(const ResultCache *const cache, FILE *const stream);
+
+/**
+ * Deletes a `CachedResult`.
+ *
+ * @param result The result to delete. If NULL, the function does nothing.
+ */
+void deleteCachedResult(CachedResult *const result);
+
+/**
+ * Deletes a `ResultCache`. The results stay in the directory.
+ *
+ * @param cache The cache to delete. If NULL, the function does nothing.
+ */
+void deleteResultCache(ResultCache *const cache);
+
+#endif // RESULT_CACHE_H
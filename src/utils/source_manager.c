@@ -0,0 +1,205 @@
+#include "source_manager.h"
+
+/*****************************************************************************************************
+                            PRIVATE SOURCE MANAGER FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+static size_t *findLineStarts(const char *const contents, const size_t size, size_t *lineCount);
+
+/*****************************************************************************************************
+                                PRIVATE SOURCE MANAGER FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Collects the offsets where the lines of a file start.
+ *
+ * @param contents The contents of the file.
+ *
+ * @param size The number of characters in the file.
+ *
+ * @param lineCount Set to the number of lines.
+ *
+ * @return The offsets, or NULL if memory allocation fails.
+ */
+static size_t *findLineStarts(const char *const contents, const size_t size, size_t *lineCount)
+{
+    size_t count = 1;
+    for (size_t i = 0; i < size; i++)
+    {
+        if (contents[i] == '\n')
+        {
+            count++;
+        }
+    }
+
+    size_t *lineStarts = malloc(count * sizeof(size_t));
+    if (lineStarts == NULL)
+    {
+        fprintf(stderr, "Memory allocation for line starts failed!\n");
+        return NULL;
+    }
+
+    size_t line = 0;
+    lineStarts[line++] = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        if (contents[i] == '\n')
+        {
+            lineStarts[line++] = i + 1;
+        }
+    }
+
+    *lineCount = count;
+    return lineStarts;
+}
+
+/*****************************************************************************************************
+                                PUBLIC SOURCE MANAGER FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+SourceManager *createSourceManager(void)
+{
+    SourceManager *manager = malloc(sizeof(SourceManager));
+    if (manager == NULL)
+    {
+        fprintf(stderr, "Memory allocation for Source Manager failed!\n");
+        return NULL;
+    }
+
+    manager->filesSize = 1;
+    manager->files = malloc(manager->filesSize * sizeof(SourceFile));
+    if (manager->files == NULL)
+    {
+        fprintf(stderr, "Memory allocation for Source Manager files failed!\n");
+        free(manager);
+        return NULL;
+    }
+    manager->fileCount = 0;
+    manager->nextStart = 0;
+
+    return manager;
+}
+
+SourceLoc addSourceFile(SourceManager *const manager, const char *const name, const char *const contents)
+{
+    if (manager == NULL || contents == NULL)
+    {
+        fprintf(stderr, "Source Manager or file contents are NULL!\n");
+        return SOURCE_LOC_INVALID;
+    }
+
+    //The end of the file needs a location too, and the next file starts after it
+    size_t size = strlen(contents);
+    if (size >= (size_t)(SOURCE_LOC_INVALID - manager->nextStart))
+    {
+        fprintf(stderr, "Source file %s does not fit in the source location space!\n", name);
+        return SOURCE_LOC_INVALID;
+    }
+
+    if (manager->fileCount >= manager->filesSize)
+    {
+        SourceFile *newFiles = realloc(manager->files, 2 * manager->filesSize * sizeof(SourceFile));
+        if (newFiles == NULL)
+        {
+            fprintf(stderr, "Memory reallocation for Source Manager files failed!\n");
+            return SOURCE_LOC_INVALID;
+        }
+        manager->files = newFiles;
+        manager->filesSize *= 2;
+    }
+
+    SourceFile *file = &manager->files[manager->fileCount];
+    file->lineStarts = findLineStarts(contents, size, &file->lineCount);
+    if (file->lineStarts == NULL)
+    {
+        return SOURCE_LOC_INVALID;
+    }
+    file->name = name;
+    file->start = manager->nextStart;
+    file->size = size;
+
+    manager->fileCount++;
+    manager->nextStart += (SourceLoc)size + 1;
+
+    return file->start;
+}
+
+const SourceFile *getSourceFile(const SourceManager *const manager, const SourceLoc loc)
+{
+    if (manager == NULL || loc == SOURCE_LOC_INVALID || manager->fileCount == 0)
+    {
+        return NULL;
+    }
+
+    //Find the last file that starts at or before the location
+    size_t low = 0;
+    size_t high = manager->fileCount;
+    while (high - low > 1)
+    {
+        size_t middle = low + (high - low) / 2;
+        if (manager->files[middle].start <= loc)
+        {
+            low = middle;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    const SourceFile *file = &manager->files[low];
+    if (loc < file->start || loc - file->start > file->size)
+    {
+        return NULL;
+    }
+
+    return file;
+}
+
+int getSourcePosition(const SourceManager *const manager, const SourceLoc loc, SourcePosition *const position)
+{
+    const SourceFile *file = getSourceFile(manager, loc);
+    if (file == NULL)
+    {
+        return 0;
+    }
+
+    //Find the last line that starts at or before the offset
+    size_t offset = loc - file->start;
+    size_t low = 0;
+    size_t high = file->lineCount;
+    while (high - low > 1)
+    {
+        size_t middle = low + (high - low) / 2;
+        if (file->lineStarts[middle] <= offset)
+        {
+            low = middle;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    position->fileName = file->name;
+    position->offset = offset;
+    position->line = low + 1;
+    position->column = offset - file->lineStarts[low] + 1;
+
+    return 1;
+}
+
+void deleteSourceManager(SourceManager *const manager)
+{
+    if (manager == NULL)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < manager->fileCount; i++)
+    {
+        free(manager->files[i].lineStarts);
+    }
+    free(manager->files);
+    free(manager);
+}
@@ -0,0 +1,131 @@
+#ifndef SOURCE_MANAGER_H
+#define SOURCE_MANAGER_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * A location in the source code of a compilation.
+ *
+ * Every file of a compilation gets its own range of one offset space, so a single 32-bit
+ * value identifies both the file and the offset inside it. The first file starts at 0, so in a
+ * single-file compilation a `SourceLoc` is the plain offset into the file.
+ */
+typedef uint32_t SourceLoc;
+
+/**
+ * Marks a missing or unknown location.
+ */
+#define SOURCE_LOC_INVALID UINT32_MAX
+
+/**
+ * Represents a file registered with a `SourceManager`.
+ *
+ * - `name`: The name of the file, as given on the command line. Not owned by the file.
+ * - `start`: The location of the first character of the file.
+ * - `size`: The number of characters in the file. The location `start + size` is its end.
+ * - `lineStarts`: The offsets inside the file where each line starts.
+ * - `lineCount`: The number of lines.
+ */
+typedef struct sourceFile
+{
+    const char *name;               /** The name of the file. */
+    SourceLoc start;                /** The location of the first character. */
+    size_t size;                    /** The number of characters. */
+    size_t *lineStarts;             /** The offsets where the lines start. */
+    size_t lineCount;               /** The number of lines. */
+} SourceFile;
+
+/**
+ * Represents a `SourceLoc` resolved to a file, line and column.
+ *
+ * - `fileName`: The name of the file the location is in.
+ * - `offset`: The offset of the location inside the file.
+ * - `line`: The line of the location, starting from 1.
+ * - `column`: The column of the location, starting from 1.
+ */
+typedef struct sourcePosition
+{
+    const char *fileName;           /** The name of the file. */
+    size_t offset;                  /** The offset inside the file. */
+    size_t line;                    /** The line, starting from 1. */
+    size_t column;                  /** The column, starting from 1. */
+} SourcePosition;
+
+/**
+ * Represents the files of a compilation and maps `SourceLoc`s back to them.
+ *
+ * The files are kept in the order they were added, which is also the order of their
+ * location ranges, so a location is resolved with a binary search. Only the line starts of a
+ * file are kept, the contents can be freed once the file is added.
+ *
+ * - `files`: The registered files.
+ * - `fileCount`: The number of registered files.
+ * - `filesSize`: The allocated size of the `files` array.
+ * - `nextStart`: The location the next file starts at.
+ */
+typedef struct sourceManager
+{
+    SourceFile *files;              /** The registered files. */
+    size_t fileCount;               /** Number of registered files. */
+    size_t filesSize;               /** Allocated size of the files array. */
+    SourceLoc nextStart;            /** The start of the next file. */
+} SourceManager;
+
+/**
+ * Creates a new, empty `SourceManager`.
+ *
+ * @return A pointer to the newly created `SourceManager`, or NULL if memory allocation fails.
+ *
+ * @note The caller is responsible for freeing the manager with `deleteSourceManager`.
+ */
+SourceManager *createSourceManager(void);
+
+/**
+ * Registers a file and reserves a range of locations for it.
+ *
+ * @param manager The manager to add the file to.
+ *
+ * @param name The name of the file. It must stay valid as long as the manager.
+ *
+ * @param contents The contents of the file, used to find the line starts. They are not kept.
+ *
+ * @return The location of the first character of the file, or `SOURCE_LOC_INVALID` if memory
+ *         allocation fails or the location space is exhausted.
+ */
+SourceLoc addSourceFile(SourceManager *const manager, const char *const name, const char *const contents);
+
+/**
+ * Finds the file a location belongs to.
+ *
+ * @param manager The manager the file was added to.
+ *
+ * @param loc The location to look up.
+ *
+ * @return The file, or NULL if the location is invalid or does not belong to any file.
+ */
+const SourceFile *getSourceFile(const SourceManager *const manager, const SourceLoc loc);
+
+/**
+ * Resolves a location to its file, line and column.
+ *
+ * @param manager The manager the file of the location was added to.
+ *
+ * @param loc The location to resolve.
+ *
+ * @param position Set to the resolved position.
+ *
+ * @return 1 on success, 0 if the location does not belong to any file.
+ */
+int getSourcePosition(const SourceManager *const manager, const SourceLoc loc, SourcePosition *const position);
+
+/**
+ * Deletes a `SourceManager` and the line tables of its files.
+ *
+ * @param manager The manager to delete. If NULL, the function does nothing.
+ */
+void deleteSourceManager(SourceManager *const manager);
+
+#endif // SOURCE_MANAGER_H
@@ -0,0 +1,208 @@
+#include "thread_pool.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+/*****************************************************************************************************
+                            PRIVATE THREAD POOL FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+/* Initial capacity of the task array */
+#define INITIAL_TASK_CAPACITY 16
+
+static void *runThreadPoolWorker(void *argument);
+
+/*****************************************************************************************************
+                                PRIVATE THREAD POOL FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Runs the tasks of a pool until the pool is stopping and no task is left.
+ *
+ * @param argument The `ThreadPool` the worker belongs to.
+ *
+ * @return Always NULL.
+ */
+static void *runThreadPoolWorker(void *argument)
+{
+    ThreadPool *pool = argument;
+
+    pthread_mutex_lock(&pool->lock);
+    while (1)
+    {
+        while (pool->nextTask == pool->taskCount && !pool->stopping)
+        {
+            pthread_cond_wait(&pool->taskAvailable, &pool->lock);
+        }
+
+        if (pool->nextTask == pool->taskCount)
+        {
+            break;
+        }
+
+        //The task array may move while the task runs, so copy the task out
+        size_t index = pool->nextTask++;
+        ThreadPoolTask task = pool->tasks[index];
+        pthread_mutex_unlock(&pool->lock);
+
+        task.function(task.argument);
+
+        pthread_mutex_lock(&pool->lock);
+        pool->tasks[index].finished = 1;
+        pthread_cond_broadcast(&pool->taskFinished);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+/*****************************************************************************************************
+                                PUBLIC THREAD POOL FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+size_t getProcessorCount(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    long count = (long)info.dwNumberOfProcessors;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    return count > 0 ? (size_t)count : 1;
+}
+
+ThreadPool *createThreadPool(const size_t threadCount)
+{
+    if (threadCount == 0)
+    {
+        fprintf(stderr, "Thread Pool needs at least one thread!\n");
+        return NULL;
+    }
+
+    ThreadPool *pool = malloc(sizeof(ThreadPool));
+    if (pool == NULL)
+    {
+        fprintf(stderr, "Memory allocation for Thread Pool failed!\n");
+        return NULL;
+    }
+
+    pool->threads = malloc(threadCount * sizeof(pthread_t));
+    pool->tasks = malloc(INITIAL_TASK_CAPACITY * sizeof(ThreadPoolTask));
+    if (pool->threads == NULL || pool->tasks == NULL)
+    {
+        fprintf(stderr, "Memory allocation for Thread Pool arrays failed!\n");
+        free(pool->threads);
+        free(pool->tasks);
+        free(pool);
+        return NULL;
+    }
+    pool->threadCount = threadCount;
+    pool->taskCount = 0;
+    pool->tasksSize = INITIAL_TASK_CAPACITY;
+    pool->nextTask = 0;
+    pool->stopping = 0;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->taskAvailable, NULL);
+    pthread_cond_init(&pool->taskFinished, NULL);
+
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        if (pthread_create(&pool->threads[i], NULL, runThreadPoolWorker, pool) != 0)
+        {
+            fprintf(stderr, "Failed to start Thread Pool worker!\n");
+            pool->threadCount = i;
+            deleteThreadPool(pool);
+            return NULL;
+        }
+    }
+
+    return pool;
+}
+
+size_t submitThreadPoolTask(ThreadPool *const pool, const ThreadPoolFunction function, void *const argument)
+{
+    if (pool == NULL || function == NULL)
+    {
+        fprintf(stderr, "Thread Pool or task function is NULL!\n");
+        return THREAD_POOL_INVALID_TASK;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    if (pool->taskCount >= pool->tasksSize)
+    {
+        ThreadPoolTask *newTasks = realloc(pool->tasks, 2 * pool->tasksSize * sizeof(ThreadPoolTask));
+        if (newTasks == NULL)
+        {
+            pthread_mutex_unlock(&pool->lock);
+            fprintf(stderr, "Memory reallocation for Thread Pool tasks failed!\n");
+            return THREAD_POOL_INVALID_TASK;
+        }
+        pool->tasks = newTasks;
+        pool->tasksSize *= 2;
+    }
+
+    size_t index = pool->taskCount++;
+    pool->tasks[index].function = function;
+    pool->tasks[index].argument = argument;
+    pool->tasks[index].finished = 0;
+    pthread_cond_signal(&pool->taskAvailable);
+    pthread_mutex_unlock(&pool->lock);
+
+    return index;
+}
+
+int waitThreadPoolTask(ThreadPool *const pool, const size_t task)
+{
+    if (pool == NULL)
+    {
+        fprintf(stderr, "Thread Pool is NULL!\n");
+        return 0;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    if (task >= pool->taskCount)
+    {
+        pthread_mutex_unlock(&pool->lock);
+        fprintf(stderr, "Unknown Thread Pool task!\n");
+        return 0;
+    }
+
+    while (!pool->tasks[task].finished)
+    {
+        pthread_cond_wait(&pool->taskFinished, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return 1;
+}
+
+void deleteThreadPool(ThreadPool *const pool)
+{
+    if (pool == NULL)
+    {
+        return;
+    }
+
+    //Let the workers finish the queue and exit
+    pthread_mutex_lock(&pool->lock);
+    pool->stopping = 1;
+    pthread_cond_broadcast(&pool->taskAvailable);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (size_t i = 0; i < pool->threadCount; i++)
+    {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->taskFinished);
+    pthread_cond_destroy(&pool->taskAvailable);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->tasks);
+    free(pool->threads);
+    free(pool);
+}
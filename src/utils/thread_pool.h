@@ -0,0 +1,116 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+/**
+ * Returned by `submitThreadPoolTask` when a task could not be queued.
+ */
+#define THREAD_POOL_INVALID_TASK ((size_t)-1)
+
+/**
+ * A function run by a worker of a `ThreadPool`.
+ *
+ * @param argument The argument the task was submitted with.
+ */
+typedef void (*ThreadPoolFunction)(void *const argument);
+
+/**
+ * Represents a task queued on a `ThreadPool`.
+ *
+ * - `function`: The function to run.
+ * - `argument`: The argument to run the function with.
+ * - `finished`: 1 once a worker has run the function, 0 before.
+ */
+typedef struct threadPoolTask
+{
+    ThreadPoolFunction function;    /** The function to run. */
+    void *argument;                 /** The argument of the function. */
+    int finished;                   /** Whether the task has finished. */
+} ThreadPoolTask;
+
+/**
+ * Represents a fixed set of worker threads running tasks in the order they were submitted.
+ *
+ * Tasks are identified by the order they were submitted in, starting from 0, so the caller
+ * can wait for a single task and consume the results in submission order while the workers
+ * keep running the later tasks.
+ *
+ * - `threads`: The worker threads.
+ * - `threadCount`: The number of worker threads.
+ * - `tasks`: Every task submitted so far.
+ * - `taskCount`: The number of submitted tasks.
+ * - `tasksSize`: The allocated size of the `tasks` array.
+ * - `nextTask`: The index of the next task a worker takes.
+ * - `stopping`: Set when the pool is deleted, the workers exit once the queue is empty.
+ * - `lock`: Guards every other field.
+ * - `taskAvailable`: Signaled when a task is submitted or the pool is stopping.
+ * - `taskFinished`: Signaled when a task finishes.
+ */
+typedef struct threadPool
+{
+    pthread_t *threads;             /** The worker threads. */
+    size_t threadCount;             /** Number of worker threads. */
+    ThreadPoolTask *tasks;          /** The submitted tasks. */
+    size_t taskCount;               /** Number of submitted tasks. */
+    size_t tasksSize;               /** Allocated size of the tasks array. */
+    size_t nextTask;                /** Index of the next task to run. */
+    int stopping;                   /** Whether the workers should exit. */
+    pthread_mutex_t lock;           /** Guards the pool. */
+    pthread_cond_t taskAvailable;   /** Signaled when there is work. */
+    pthread_cond_t taskFinished;    /** Signaled when a task finishes. */
+} ThreadPool;
+
+/**
+ * Returns the number of processors available to the process.
+ *
+ * @return The number of online processors, or 1 if it can not be determined.
+ */
+size_t getProcessorCount(void);
+
+/**
+ * Creates a new `ThreadPool` and starts its workers.
+ *
+ * @param threadCount The number of worker threads. Must be at least 1.
+ *
+ * @return A pointer to the newly created `ThreadPool`, or NULL if the count is 0, memory
+ *         allocation fails or a thread can not be started.
+ *
+ * @note The caller is responsible for freeing the pool with `deleteThreadPool`.
+ */
+ThreadPool *createThreadPool(const size_t threadCount);
+
+/**
+ * Queues a task on a `ThreadPool`.
+ *
+ * @param pool The pool to run the task on.
+ *
+ * @param function The function to run.
+ *
+ * @param argument The argument to run the function with. It must stay valid until the task finishes.
+ *
+ * @return The index of the task, or `THREAD_POOL_INVALID_TASK` if memory allocation fails.
+ */
+size_t submitThreadPoolTask(ThreadPool *const pool, const ThreadPoolFunction function, void *const argument);
+
+/**
+ * Waits until a task of a `ThreadPool` has finished.
+ *
+ * @param pool The pool the task was submitted to.
+ *
+ * @param task The index returned by `submitThreadPoolTask`.
+ *
+ * @return 1 once the task has finished, 0 if the pool is NULL or the index is unknown.
+ */
+int waitThreadPoolTask(ThreadPool *const pool, const size_t task);
+
+/**
+ * Deletes a `ThreadPool`. The queued tasks are run before the workers exit.
+ *
+ * @param pool The pool to delete. If NULL, the function does nothing.
+ */
+void deleteThreadPool(ThreadPool *const pool);
+
+#endif // THREAD_POOL_H
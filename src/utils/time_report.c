@@ -0,0 +1,272 @@
+#include "time_report.h"
+#include "trace.h"
+#include "allocator.h"
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+/*****************************************************************************************************
+                            PRIVATE TIME REPORT FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+static const char *const phaseNames[PHASE_COUNT] = {
+    "read",
+    "lex",
+    "filter tokens",
+    "parse",
+    "collapse AST",
+    "output",
+};
+
+static double getElapsedTime(const struct timespec *const start, const struct timespec *const end);
+
+static long getPeakRSS(void);
+
+static double getProcessCPUTime(void);
+
+/*****************************************************************************************************
+                                PRIVATE TIME REPORT FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Computes the seconds between two readings of a clock.
+ *
+ * @param start The earlier reading.
+ *
+ * @param end The later reading.
+ *
+ * @return The difference in seconds.
+ */
+static double getElapsedTime(const struct timespec *const start, const struct timespec *const end)
+{
+    return (double)(end->tv_sec - start->tv_sec) + (double)(end->tv_nsec - start->tv_nsec) / 1e9;
+}
+
+/**
+ * Reads the peak resident set size of the process.
+ *
+ * @return The peak in KiB, or 0 where `getrusage` is not available.
+ */
+static long getPeakRSS(void)
+{
+#ifdef _WIN32
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+    return usage.ru_maxrss;
+#endif
+}
+
+/**
+ * Reads the CPU time every thread of the process used so far.
+ *
+ * @return The user and system time in seconds.
+ */
+static double getProcessCPUTime(void)
+{
+    struct timespec now;
+    if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now) != 0)
+    {
+        return 0.0;
+    }
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+/*****************************************************************************************************
+                                PUBLIC TIME REPORT FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+void startPhaseTimer(PhaseTimer *const timer)
+{
+    getThreadAllocations(&timer->allocationsStart, &timer->bytesStart);
+    readPerfCounters(&timer->countersStart);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &timer->cpuStart);
+    clock_gettime(CLOCK_MONOTONIC, &timer->wallStart);
+}
+
+void stopPhaseTimer(const PhaseTimer *const timer, TimeReport *const report, const CompilerPhase phase)
+{
+    struct timespec wallEnd;
+    struct timespec cpuEnd;
+    PerfSample countersEnd;
+    clock_gettime(CLOCK_MONOTONIC, &wallEnd);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpuEnd);
+    readPerfCounters(&countersEnd);
+
+    size_t allocations;
+    size_t allocatedBytes;
+    getThreadAllocations(&allocations, &allocatedBytes);
+
+    PhaseStats *stats = &report->phases[phase];
+    stats->runs++;
+    stats->wallTime += getElapsedTime(&timer->wallStart, &wallEnd);
+    stats->cpuTime += getElapsedTime(&timer->cpuStart, &cpuEnd);
+    stats->allocations += allocations - timer->allocationsStart;
+    stats->allocatedBytes += allocatedBytes - timer->bytesStart;
+
+    uint64_t counters[PERF_COUNTER_COUNT];
+    if (getPerfCounterDelta(&timer->countersStart, &countersEnd, counters))
+    {
+        stats->countedRuns++;
+        for (size_t i = 0; i < PERF_COUNTER_COUNT; i++)
+        {
+            stats->counters[i] += counters[i];
+        }
+    }
+
+    long peakRSS = getPeakRSS();
+    if (peakRSS > stats->peakRSS)
+    {
+        stats->peakRSS = peakRSS;
+    }
+
+    if (isTracing())
+    {
+        uint64_t start = (uint64_t)timer->wallStart.tv_sec * 1000000000u + (uint64_t)timer->wallStart.tv_nsec;
+        uint64_t end = (uint64_t)wallEnd.tv_sec * 1000000000u + (uint64_t)wallEnd.tv_nsec;
+        recordTraceSpan(phaseNames[phase], "phase", start, end, NULL, (int64_t)(allocations - timer->allocationsStart));
+    }
+}
+
+void mergeTimeReport(TimeReport *const into, const TimeReport *const from)
+{
+    for (size_t i = 0; i < PHASE_COUNT; i++)
+    {
+        PhaseStats *stats = &into->phases[i];
+        const PhaseStats *added = &from->phases[i];
+        stats->runs += added->runs;
+        stats->wallTime += added->wallTime;
+        stats->cpuTime += added->cpuTime;
+        stats->allocations += added->allocations;
+        stats->allocatedBytes += added->allocatedBytes;
+        stats->countedRuns += added->countedRuns;
+        for (size_t j = 0; j < PERF_COUNTER_COUNT; j++)
+        {
+            stats->counters[j] += added->counters[j];
+        }
+        if (added->peakRSS > stats->peakRSS)
+        {
+            stats->peakRSS = added->peakRSS;
+        }
+    }
+}
+
+void printTimeReport(const TimeReport *const report, const size_t fileCount, const double wallTime, FILE *const stream)
+{
+    if (report == NULL)
+    {
+        fprintf(stderr, "Time Report is NULL!\n");
+        return;
+    }
+
+    PhaseStats total = {0};
+    fprintf(stream, "Time report: %zu files\n", fileCount);
+    fprintf(stream, "%-14s %6s %12s %12s %12s %14s %14s\n", "Phase", "Runs", "Wall ms", "CPU ms", "Allocations", "Alloc bytes", "Peak RSS KiB");
+    for (size_t i = 0; i < PHASE_COUNT; i++)
+    {
+        const PhaseStats *stats = &report->phases[i];
+        fprintf(stream, "%-14s %6zu %12.3f %12.3f %12zu %14zu %14ld\n", phaseNames[i], stats->runs,
+                1000.0 * stats->wallTime, 1000.0 * stats->cpuTime, stats->allocations, stats->allocatedBytes, stats->peakRSS);
+
+        total.wallTime += stats->wallTime;
+        total.cpuTime += stats->cpuTime;
+        total.allocations += stats->allocations;
+        total.allocatedBytes += stats->allocatedBytes;
+    }
+    fprintf(stream, "%-14s %6s %12.3f %12.3f %12zu %14zu %14ld\n", "total", "",
+            1000.0 * total.wallTime, 1000.0 * total.cpuTime, total.allocations, total.allocatedBytes, getPeakRSS());
+
+    //The phases of parallel files overlap, so their sum can exceed the elapsed time
+    fprintf(stream, "Elapsed: %.3f ms wall, %.3f ms CPU in all threads\n", 1000.0 * wallTime, 1000.0 * getProcessCPUTime());
+}
+
+void printPerfCounterReport(const TimeReport *const report, FILE *const stream)
+{
+    if (report == NULL)
+    {
+        fprintf(stderr, "Time Report is NULL!\n");
+        return;
+    }
+
+    PhaseStats total = {0};
+    for (size_t i = 0; i < PHASE_COUNT; i++)
+    {
+        total.countedRuns += report->phases[i].countedRuns;
+    }
+    if (total.countedRuns == 0)
+    {
+        fprintf(stream, "Performance counters: not available\n");
+        return;
+    }
+
+    fprintf(stream, "Performance counters:\n");
+    fprintf(stream, "%-14s", "Phase");
+    for (size_t j = 0; j < PERF_COUNTER_COUNT; j++)
+    {
+        fprintf(stream, " %14s", getPerfCounterName((PerfCounter)j));
+    }
+    fprintf(stream, " %6s %9s %9s %9s\n", "IPC", "L1D/Ki", "LLC/Ki", "Br/Ki");
+
+    for (size_t i = 0; i <= PHASE_COUNT; i++)
+    {
+        //The last row is the sum of the phases
+        const PhaseStats *stats = i < PHASE_COUNT ? &report->phases[i] : &total;
+        if (i < PHASE_COUNT)
+        {
+            for (size_t j = 0; j < PERF_COUNTER_COUNT; j++)
+            {
+                total.counters[j] += stats->counters[j];
+            }
+        }
+
+        fprintf(stream, "%-14s", i < PHASE_COUNT ? phaseNames[i] : "total");
+        for (size_t j = 0; j < PERF_COUNTER_COUNT; j++)
+        {
+            if (isPerfCounterAvailable((PerfCounter)j))
+            {
+                fprintf(stream, " %14llu", (unsigned long long)stats->counters[j]);
+            }
+            else
+            {
+                fprintf(stream, " %14s", "n/a");
+            }
+        }
+
+        //The ratios of the events, per cycle and per thousand instructions
+        uint64_t cycles = stats->counters[PERF_COUNTER_CYCLES];
+        uint64_t instructions = stats->counters[PERF_COUNTER_INSTRUCTIONS];
+        if (cycles > 0 && isPerfCounterAvailable(PERF_COUNTER_INSTRUCTIONS))
+        {
+            fprintf(stream, " %6.2f", (double)instructions / (double)cycles);
+        }
+        else
+        {
+            fprintf(stream, " %6s", "n/a");
+        }
+        const PerfCounter misses[] = {PERF_COUNTER_L1D_MISSES, PERF_COUNTER_LLC_MISSES, PERF_COUNTER_BRANCH_MISSES};
+        for (size_t j = 0; j < sizeof(misses) / sizeof(misses[0]); j++)
+        {
+            if (instructions > 0 && isPerfCounterAvailable(misses[j]))
+            {
+                fprintf(stream, " %9.2f", 1000.0 * (double)stats->counters[misses[j]] / (double)instructions);
+            }
+            else
+            {
+                fprintf(stream, " %9s", "n/a");
+            }
+        }
+        fprintf(stream, "\n");
+    }
+}
+
+double getMonotonicTime(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
@@ -0,0 +1,146 @@
+#ifndef TIME_REPORT_H
+#define TIME_REPORT_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "perf_counters.h"
+
+/**
+ * The phases of compiling a file that `-ftime-report` measures.
+ *
+ * - `PHASE_READ`: Reading the file.
+ * - `PHASE_LEX`: Lexing the file into tokens.
+ * - `PHASE_FILTER`: Creating the parser, which filters the tokens it does not need.
+ * - `PHASE_PARSE`: Parsing the tokens, or only recognizing them with `-fsyntax-only`.
+ * - `PHASE_COLLAPSE`: Collapsing the single-child chains of the AST.
+ * - `PHASE_OUTPUT`: Writing the messages and the tokens or the AST.
+ */
+typedef enum compilerPhase
+{
+    PHASE_READ,
+    PHASE_LEX,
+    PHASE_FILTER,
+    PHASE_PARSE,
+    PHASE_COLLAPSE,
+    PHASE_OUTPUT,
+    PHASE_COUNT,
+} CompilerPhase;
+
+/**
+ * The measurements of one phase, summed over every time it ran.
+ *
+ * - `runs`: The number of times the phase ran.
+ * - `wallTime`: The elapsed time in seconds, on a monotonic clock.
+ * - `cpuTime`: The CPU time of the thread running the phase in seconds.
+ * - `allocations`: The number of allocations, reallocations and arena pieces the thread
+ *                  requested through the allocation layer of `allocator.h`.
+ * - `allocatedBytes`: The number of bytes those requests asked for.
+ * - `peakRSS`: The peak resident set size of the process in KiB when the phase last ended.
+ * - `countedRuns`: The number of runs the hardware counters were read for, with `--perf-counters`.
+ * - `counters`: The hardware events of those runs, indexed by `PerfCounter`.
+ */
+typedef struct phaseStats
+{
+    size_t runs;                /** Number of times the phase ran. */
+    double wallTime;            /** Elapsed seconds. */
+    double cpuTime;             /** CPU seconds. */
+    size_t allocations;         /** Number of allocations. */
+    size_t allocatedBytes;      /** Requested bytes. */
+    long peakRSS;               /** Peak resident set size in KiB. */
+    size_t countedRuns;         /** Number of runs with counters. */
+    uint64_t counters[PERF_COUNTER_COUNT];  /** The hardware events. */
+} PhaseStats;
+
+/**
+ * Represents the measurements of every phase of one or more files.
+ *
+ * - `phases`: The measurements, indexed by `CompilerPhase`.
+ */
+typedef struct timeReport
+{
+    PhaseStats phases[PHASE_COUNT];     /** The measurements of the phases. */
+} TimeReport;
+
+/**
+ * Represents a phase being measured.
+ *
+ * - `wallStart`: The monotonic time the phase started at.
+ * - `cpuStart`: The CPU time of the thread when the phase started.
+ * - `allocationsStart`: The allocation count of the thread when the phase started.
+ * - `bytesStart`: The allocated bytes of the thread when the phase started.
+ * - `countersStart`: The hardware counters of the thread when the phase started.
+ */
+typedef struct phaseTimer
+{
+    struct timespec wallStart;  /** Start on the monotonic clock. */
+    struct timespec cpuStart;   /** Start on the thread CPU clock. */
+    size_t allocationsStart;    /** Allocations before the phase. */
+    size_t bytesStart;          /** Allocated bytes before the phase. */
+    PerfSample countersStart;   /** Hardware counters before the phase. */
+} PhaseTimer;
+
+/**
+ * Starts measuring a phase on the calling thread.
+ *
+ * @param timer The timer to start.
+ */
+void startPhaseTimer(PhaseTimer *const timer);
+
+/**
+ * Stops measuring a phase and adds the measurements to a report. While a trace is being
+ * recorded, the phase is also recorded as a span, with its allocation count as the value.
+ *
+ * Must be called on the thread that started the timer, as the CPU time and the allocations
+ * are counted per thread.
+ *
+ * @param timer The timer started with `startPhaseTimer`.
+ *
+ * @param report The report to add to.
+ *
+ * @param phase The phase that was measured.
+ */
+void stopPhaseTimer(const PhaseTimer *const timer, TimeReport *const report, const CompilerPhase phase);
+
+/**
+ * Adds the measurements of a report to another one.
+ *
+ * @param into The report to add to.
+ *
+ * @param from The report to add.
+ */
+void mergeTimeReport(TimeReport *const into, const TimeReport *const from);
+
+/**
+ * Prints a table of the phases of a report, followed by the elapsed and the CPU time of the
+ * whole compilation and the peak resident set size of the process.
+ *
+ * @param report The report to print.
+ *
+ * @param fileCount The number of compiled files.
+ *
+ * @param wallTime The elapsed time of the whole compilation in seconds.
+ *
+ * @param stream The stream to print to.
+ */
+void printTimeReport(const TimeReport *const report, const size_t fileCount, const double wallTime, FILE *const stream);
+
+/**
+ * Prints a table of the hardware events of each phase of a report, with the instructions per
+ * cycle and the misses per thousand instructions, or a note if no counters were read.
+ *
+ * @param report The report to print.
+ *
+ * @param stream The stream to print to.
+ */
+void printPerfCounterReport(const TimeReport *const report, FILE *const stream);
+
+/**
+ * Reads the monotonic clock.
+ *
+ * @return The time in seconds since an unspecified point.
+ */
+double getMonotonicTime(void);
+
+#endif // TIME_REPORT_H
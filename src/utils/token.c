@@ -9,7 +9,7 @@
  */
 #define KEYWORDS_COUNT (sizeof(keywords) / sizeof(keywords[0]))
 
-static Token *createToken(const char *const text, const int start, const TokenType type, const TokenValue value);
+static Token *createToken(const MemoryTag tag, const char *const text, const SourceLoc loc, const TokenType type, const TokenValue value);
 
 static const char *escapeCharToString(const char escapeChar);
 
@@ -18,17 +18,19 @@ static const char *escapeCharToString(const char escapeChar);
  *****************************************************************************************************/
 
 /**
- * Creates a new `Token` with the given text, start position, type, and value.
+ * Creates a new `Token` with the given text, location, type, and value.
  * The function allocates memory for the `Token` structure.
  *
  * This function assumes that `text` is dynamically allocated by the caller 
  * and takes ownership of it. The `Token` will be responsible for freeing 
  * the `text` when it is no longer needed.
  *
+ * @param tag The tag the `Token` is allocated with, `MEMORY_TOKENS` or `MEMORY_ERRORS` for the
+ *            duplicates errors keep.
+ *
  * @param text The text to be associated with the token (assumed to be dynamically allocated).
- *             If `text` is `NULL`, the `length` field of the token will be set to `0`.
  *
- * @param start The starting position of the token in the source code.
+ * @param loc The location of the first character of the token.
  *
  * @param type The type of the token, indicating its category in the lexical analysis.
  *
@@ -36,31 +38,22 @@ static const char *escapeCharToString(const char escapeChar);
  *
  * @return A pointer to the created `Token`, or `NULL` if allocation fails.
  *
- * @note If memory allocation for the `Token` fails, the function will free the provided `text` to avoid memory leaks.
+ * @note If memory allocation for the `Token` fails, the `text` is left to the caller.
  *
  * @note The caller is responsible for cleaning up the memory allocated for the `Token` object. This
  *       should be done using `deleteToken` for a single token or `deleteTokens` for multiple tokens.
  */
-static Token *createToken(const char *const text, const int start, const TokenType type, const TokenValue value)
+static Token *createToken(const MemoryTag tag, const char *const text, const SourceLoc loc, const TokenType type, const TokenValue value)
 {
-    Token *token = (Token *)malloc(sizeof(Token));
+    Token *token = (Token *)allocateMemory(tag, sizeof(Token));
     if (token == NULL)
     {
         fprintf(stderr, "Memory allocation for Token failed!\n");
-        free((char *)text);
         return NULL;
     }
 
     token->text = text;
-    token->start = start;
-    if (text != NULL)
-    {
-        token->length = strlen(text);
-    }
-    else
-    {
-        token->text = 0;
-    }
+    token->loc = loc;
     token->type = type;
     token->value = value;
 
@@ -249,83 +242,83 @@ static const char *const tokenTypeStrings[] = {
                                 PUBLIC TOKEN FUNCTIONS START HERE                                
  *****************************************************************************************************/
 
-Token *createTokenNone(const char *const text, const int start, const TokenType type)
+Token *createTokenNone(const char *const text, const SourceLoc loc, const TokenType type)
 {
     TokenValue value = {0};
 
-    Token *token = createToken(text, start, type, value);
+    Token *token = createToken(MEMORY_TOKENS, text, loc, type, value);
     if (token == NULL)
     {
-        free((char *)text);
+        releaseMemory(MEMORY_TOKEN_TEXT, (char *)text);
     }
 
     return token;
 }
 
-Token *createTokenNumber(const char *const text, const int start, const TokenType type, const int number)
+Token *createTokenNumber(const char *const text, const SourceLoc loc, const TokenType type, const int number)
 {
     TokenValue value = {.number = number};
 
-    Token *token = createToken(text, start, type, value);
+    Token *token = createToken(MEMORY_TOKENS, text, loc, type, value);
     if (token == NULL)
     {
-        free((char *)text);
+        releaseMemory(MEMORY_TOKEN_TEXT, (char *)text);
     }
 
     return token;
 }
 
-Token *createTokenString(const char *const text, const int start, const TokenType type, const char *const string)
+Token *createTokenString(const char *const text, const SourceLoc loc, const TokenType type, const char *const string)
 {
     TokenValue value = {.string = string};
 
-    Token *token = createToken(text, start, type, value);
+    Token *token = createToken(MEMORY_TOKENS, text, loc, type, value);
     if (token == NULL)
     {
         if (value.string != NULL)
         {
-            free((char *)value.string);
+            releaseMemory(MEMORY_TOKEN_TEXT, (char *)value.string);
         }
-        free((char *)text);
+        releaseMemory(MEMORY_TOKEN_TEXT, (char *)text);
     }
 
     return token;
 }
 
-Token *createTokenChar(const char *const text, const int start, const TokenType type, const char character)
+Token *createTokenChar(const char *const text, const SourceLoc loc, const TokenType type, const char character)
 {
     TokenValue value = {.character = character};
 
-    Token *token = createToken(text, start, type, value);
+    Token *token = createToken(MEMORY_TOKENS, text, loc, type, value);
     if (token == NULL)
     {
-        free((char *)text);
+        releaseMemory(MEMORY_TOKEN_TEXT, (char *)text);
     }
 
     return token;
 }
 
-Token *createTokenFloat(const char *const text, const int start, const TokenType type, const double floatingPoint)
+Token *createTokenFloat(const char *const text, const SourceLoc loc, const TokenType type, const double floatingPoint)
 {
     TokenValue value = {.floatingPoint = floatingPoint};
 
-    Token *token = createToken(text, start, type, value);
+    Token *token = createToken(MEMORY_TOKENS, text, loc, type, value);
     if (token == NULL)
     {
-        free((char *)text);
+        releaseMemory(MEMORY_TOKEN_TEXT, (char *)text);
     }
 
     return token;
 }
 
-Token *createTokenKeyword(const char *const text, const int start, const TokenType type, const Keywords keyword)
+Token *createTokenKeyword(const char *const text, const SourceLoc loc, const TokenType type, const Keywords keyword)
 {
     TokenValue value = {.keyword = keyword};
 
-    Token *token = createToken(text, start, type, value);
+    Token *token = createToken(MEMORY_TOKENS, text, loc, type, value);
     if (token == NULL)
     {
-        free((char *)text);
+        releaseMemory(MEMORY_TOKEN_TEXT, (char *)text);
     }
 
     return token;
@@ -339,12 +332,12 @@ void deleteToken(Token *const token)
         return;
     }
 
-    free((char *)token->text);
+    releaseMemory(MEMORY_TOKEN_TEXT, (char *)token->text);
     if (token->type == TOKEN_STRING)
     {
-        free((char *)token->value.string);
+        releaseMemory(MEMORY_TOKEN_TEXT, (char *)token->value.string);
     }
-    free(token);
+    releaseMemory(MEMORY_TOKENS, token);
 }
 
 void deleteTokens(Token **const tokens, const size_t count)
@@ -363,7 +356,7 @@ void deleteTokens(Token **const tokens, const size_t count)
         }
     }
 
-    free(tokens);
+    releaseMemory(MEMORY_TOKENS, tokens);
 }
 
 Token *duplicateToken(Token *const token)
@@ -374,7 +367,7 @@ Token *duplicateToken(Token *const token)
         return NULL;
     }
 
-    Token *newToken = createToken(token->text, token->start, token->type, token->value);
+    Token *newToken = createToken(MEMORY_ERRORS, token->text, token->loc, token->type, token->value);
     if (newToken == NULL)
     {
         fprintf(stderr, "Memory allocation for new Token failed!\n");
@@ -385,6 +378,11 @@ Token *duplicateToken(Token *const token)
 }
 
 void printToken(const Token *const token)
+{
+    writeToken(token, stdout);
+}
+
+void writeToken(const Token *const token, FILE *const stream)
 {
     if (token == NULL)
     {
@@ -392,51 +390,81 @@ void printToken(const Token *const token)
         return;
     }
 
-    if (token->type == TOKEN_EOF)
+    char buffer[256];
+    int length = formatToken(buffer, sizeof(buffer), token);
+    if (length < 0)
     {
-        printf("%s token\n", getType(token->type));
         return;
     }
 
-    printf("%s token, text: %s", getType(token->type), token->text);
+    if ((size_t)length < sizeof(buffer))
+    {
+        fputs(buffer, stream);
+        return;
+    }
 
+    //The token does not fit the buffer, format it again into one that is large enough
+    char *line = malloc((size_t)length + 1);
+    if (line == NULL)
+    {
+        fprintf(stderr, "Memory allocation for printing Token failed!\n");
+        return;
+    }
+    formatToken(line, (size_t)length + 1, token);
+    fputs(line, stream);
+    free(line);
+}
+
+int formatToken(char *const buffer, const size_t size, const Token *const token)
+{
+    if (token == NULL)
+    {
+        fprintf(stderr, "Token is NULL!\n");
+        return -1;
+    }
+
+    if (token->type == TOKEN_EOF)
+    {
+        return snprintf(buffer, size, "%s token\n", getType(token->type));
+    }
+
+    const char *type = getType(token->type);
     const char *escape = escapeCharToString(token->value.character);
     switch (token->type)
     {
     case TOKEN_INTEGER:
-        printf(", value: %d\n", token->value.number);
-        break;
+        return snprintf(buffer, size, "%s token, text: %s, value: %d\n", type, token->text, token->value.number);
     case TOKEN_FLOATINGPOINT:
-        printf(", value: %f\n", token->value.floatingPoint);
-        break;
+        return snprintf(buffer, size, "%s token, text: %s, value: %f\n", type, token->text, token->value.floatingPoint);
     case TOKEN_CHARACTER:
         if (escape == NULL)
         {
-            printf(", value: %c\n", token->value.character);
+            return snprintf(buffer, size, "%s token, text: %s, value: %c\n", type, token->text, token->value.character);
         }
-        else
-        {
-            printf(", value: %s\n", escape);
-        }
-        break;
+        return snprintf(buffer, size, "%s token, text: %s, value: %s\n", type, token->text, escape);
     case TOKEN_STRING:
-        printf(", value: %s\n", token->value.string);
-        break;
+        return snprintf(buffer, size, "%s token, text: %s, value: %s\n", type, token->text, token->value.string);
     case TOKEN_HEXADECIMAL:
-        printf(", value: %#x\n", token->value.number);
-        break;
+        return snprintf(buffer, size, "%s token, text: %s, value: %#x\n", type, token->text, token->value.number);
     case TOKEN_OCTAL:
-        printf(", value: %#o\n", token->value.number);
-        break;
+        return snprintf(buffer, size, "%s token, text: %s, value: %#o\n", type, token->text, token->value.number);
     case TOKEN_KEYWORD:
-        printf(", value: %s\n", keywords[token->value.keyword]);
-        break;
+        return snprintf(buffer, size, "%s token, text: %s, value: %s\n", type, token->text, keywords[token->value.keyword]);
     default:
-        printf("\n");
-        return;
+        return snprintf(buffer, size, "%s token, text: %s\n", type, token->text);
     }
 }
 
+const char *getKeywordName(const Keywords keyword)
+{
+    if (keyword >= 0 && (size_t)keyword < KEYWORDS_COUNT)
+    {
+        return keywords[keyword];
+    }
+
+    return "UNKNOWN";
+}
+
 char *getType(TokenType type)
 {
     if (type >= 0 && type < TOKEN_TYPE_COUNT)
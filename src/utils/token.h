@@ -4,6 +4,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "source_manager.h"
+#include "allocator.h"
 
 /**
  * Enum representing the different types of tokens recognized by the lexer.
@@ -334,6 +336,9 @@ typedef union tokenValue
  *            of the token. This string is typically dynamically allocated and represents
  *            the content of the token.
  * 
+ * - `loc`: The `SourceLoc` of the first character of the token. It identifies the file
+ *          as well as the position inside it; a `SourceManager` resolves it to a line and column.
+ * 
  * - `type`: An enumeration of type `TokenType` that specifies the category or type
  *           of the token (e.g., keyword, operator, identifier).
  * 
@@ -351,14 +356,13 @@ typedef union tokenValue
 typedef struct token
 {
     const char *text; /**The text of the token. */
-    int start;
-    size_t length;
+    SourceLoc loc;    /**The location of the first character of the token. */
     TokenType type;   /**The type of the token. */
     TokenValue value; /**The value associated with the token. */
 } Token;
 
 /**
- * Creates a new `Token` with the given text, start position, and type.
+ * Creates a new `Token` with the given text, location, and type.
  * The token's value is initialized to a default state (zero-initialized).
  *
  * This function assumes that `text` is dynamically allocated by the caller 
@@ -366,9 +370,8 @@ typedef struct token
  * the `text` when it is no longer needed.
  *
  * @param text The text to be associated with the token (assumed to be dynamically allocated).
- *             If `text` is `NULL`, the function may return a token with a `length` of `0`.
  *
- * @param start The starting position of the token in the source code.
+ * @param loc The location of the first character of the token.
  *
  * @param type The type of the token, indicating its category in the lexical analysis.
  *
@@ -380,19 +383,18 @@ typedef struct token
  * @note The caller is responsible for cleaning up the memory allocated for the `Token` object. This
  *       should be done using `deleteToken` for a single token or `deleteTokens` for multiple tokens.
  */
-Token *createTokenNone(const char *const text, const int start, const TokenType type);
+Token *createTokenNone(const char *const text, const SourceLoc loc, const TokenType type);
 
 /**
- * Creates a new `Token` with the given text, start position, type, and integer value.
+ * Creates a new `Token` with the given text, location, type, and integer value.
  * 
  * This function assumes that `text` is dynamically allocated by the caller 
  * and takes ownership of it. The `Token` will be responsible for freeing 
  * the `text` when it is no longer needed.
  * 
  * @param text The text to be associated with the token (assumed to be dynamically allocated).
- *             If `text` is `NULL`, the function may still return a token with a `length` of `0`.
  * 
- * @param start The starting position of the token in the source code.
+ * @param loc The location of the first character of the token.
  * 
  * @param type The type of the token, indicating its category in the lexical analysis.
  * 
@@ -406,10 +408,10 @@ Token *createTokenNone(const char *const text, const int start, const TokenType
  * @note The caller is responsible for cleaning up the memory allocated for the `Token` object. This
  *       should be done using `deleteToken` for a single token or `deleteTokens` for multiple tokens.
  */
-Token *createTokenNumber(const char *const text, const int start, const TokenType type, const int number);
+Token *createTokenNumber(const char *const text, const SourceLoc loc, const TokenType type, const int number);
 
 /**
- * Creates a new `Token` with the given text, start position, type, and string value.
+ * Creates a new `Token` with the given text, location, type, and string value.
  * 
  * This function assumes that `text` and `string` are dynamically allocated 
  * by the caller and takes ownership of them. The `Token` will be responsible 
@@ -422,7 +424,7 @@ Token *createTokenNumber(const char *const text, const int start, const TokenTyp
  * 
  * @param text The text to be associated with the token (assumed to be dynamically allocated).
  * 
- * @param start The starting position of the token in the source code.
+ * @param loc The location of the first character of the token.
  * 
  * @param type The type of the token, indicating its category in lexical analysis.
  * 
@@ -436,10 +438,10 @@ Token *createTokenNumber(const char *const text, const int start, const TokenTyp
  * @note The caller is responsible for cleaning up the memory allocated for the `Token` object. 
  *       This should be done using `deleteToken` for a single token or `deleteTokens` for multiple tokens.
  */
-Token *createTokenString(const char *const text, const int start, const TokenType type, const char *const string);
+Token *createTokenString(const char *const text, const SourceLoc loc, const TokenType type, const char *const string);
 
 /**
- * Creates a new `Token` with the given text, start position, type, and character value.
+ * Creates a new `Token` with the given text, location, type, and character value.
  * 
  * This function assumes that `text` is dynamically allocated by the caller and takes
  * ownership of it. The `Token` will be responsible for freeing the `text` when it is
@@ -451,7 +453,7 @@ Token *createTokenString(const char *const text, const int start, const TokenTyp
  * 
  * @param text The text to be associated with the token (assumed to be dynamically allocated).
  * 
- * @param start The starting position of the token in the source code.
+ * @param loc The location of the first character of the token.
  * 
  * @param type The type of the token, indicating its category in lexical analysis.
  * 
@@ -465,10 +467,10 @@ Token *createTokenString(const char *const text, const int start, const TokenTyp
  * @note The caller is responsible for cleaning up the memory allocated for the `Token` object. 
  *       This should be done using `deleteToken` for a single token or `deleteTokens` for multiple tokens.
  */
-Token *createTokenChar(const char *const text, const int start, const TokenType type, const char character);
+Token *createTokenChar(const char *const text, const SourceLoc loc, const TokenType type, const char character);
 
 /**
- * Creates a new `Token` with the given text, start position, type, and floating-point value.
+ * Creates a new `Token` with the given text, location, type, and floating-point value.
  * 
  * This function assumes that `text` is dynamically allocated by the caller and takes
  * ownership of it. The `Token` will be responsible for freeing the `text` when it is
@@ -480,7 +482,7 @@ Token *createTokenChar(const char *const text, const int start, const TokenType
  * 
  * @param text The text to be associated with the token (assumed to be dynamically allocated).
  * 
- * @param start The starting position of the token in the source code.
+ * @param loc The location of the first character of the token.
  * 
  * @param type The type of the token, indicating its category in lexical analysis.
  * 
@@ -494,10 +496,10 @@ Token *createTokenChar(const char *const text, const int start, const TokenType
  * @note The caller is responsible for cleaning up the memory allocated for the `Token` object. 
  *       This should be done using `deleteToken` for a single token or `deleteTokens` for multiple tokens.
  */
-Token *createTokenFloat(const char *const text, const int start, const TokenType type, const double floatingPoint);
+Token *createTokenFloat(const char *const text, const SourceLoc loc, const TokenType type, const double floatingPoint);
 
 /**
- * Creates a new `Token` with the given text, start position, type, and keyword value.
+ * Creates a new `Token` with the given text, location, type, and keyword value.
  * 
  * This function creates a `Token` specifically for keywords. It assumes that `text` is dynamically
  * allocated by the caller and takes ownership of it. The `Token` will be responsible for freeing 
@@ -509,7 +511,7 @@ Token *createTokenFloat(const char *const text, const int start, const TokenType
  * 
  * @param text     The text to be associated with the token (assumed to be dynamically allocated).
  * 
- * @param start    The starting position of the token in the source code.
+ * @param loc      The location of the first character of the token.
  * 
  * @param type     The type of the token, which should be `TOKEN_KEYWORD` for keyword tokens.
  * 
@@ -523,7 +525,7 @@ Token *createTokenFloat(const char *const text, const int start, const TokenType
  * @note The caller is responsible for cleaning up the memory allocated for the `Token` object. 
  *       This should be done using `deleteToken` for a single token or `deleteTokens` for multiple tokens.
  */
-Token *createTokenKeyword(const char *const text, const int start, const TokenType type, const Keywords keyword);
+Token *createTokenKeyword(const char *const text, const SourceLoc loc, const TokenType type, const Keywords keyword);
 
 /**
  * Frees the memory associated with a `Token`.
@@ -554,7 +556,7 @@ void deleteTokens(Token **const tokens, const size_t count);
  * Creates a duplicate of an existing `Token`.
  * 
  * This function creates a new `Token` that is a copy of the provided token. 
- * The new `Token` will have the same `text`, `start` position, `type`, and `value`
+ * The new `Token` will have the same `text`, `loc`, `type`, and `value`
  * as the original token. The `text` of the new token is not reallocated but 
  * merely referenced, assuming the `text` is dynamically allocated and managed 
  * elsewhere.
@@ -566,8 +568,8 @@ void deleteTokens(Token **const tokens, const size_t count);
  * 
  * @return A pointer to the newly created duplicate `Token`, or `NULL` if the allocation fails or the input token is `NULL`.
  * 
- * @note The caller is responsible for cleaning up the memory allocated for both the original and duplicate `Token` objects.
- *       This should be done using `deleteToken` for a single token or `deleteTokens` for multiple tokens.
+ * @note The duplicate is meant for an `Error`, which frees it with `deleteError` without its `text`.
+ *       It is allocated with the `MEMORY_ERRORS` tag.
  */
 Token *duplicateToken(Token *const token);
 
@@ -583,6 +585,42 @@ Token *duplicateToken(Token *const token);
  */
 void printToken(const Token *const token);
 
+/**
+ * Writes the representation of a `Token` to a stream, in the same format as `printToken`.
+ * 
+ * @param token The `Token` to be written. This should be a valid pointer to a `Token` structure.
+ * 
+ * @param stream The stream to write to.
+ */
+void writeToken(const Token *const token, FILE *const stream);
+
+/**
+ * Formats the representation of a `Token` into a buffer, exactly as `printToken` prints it.
+ * 
+ * The function follows the rules of `snprintf`: at most `size` bytes are written, including
+ * the terminating zero, and the length of the full representation is returned, so a return
+ * value of `size` or more means the buffer was too small.
+ * 
+ * @param buffer The buffer to write to. Can be NULL if `size` is 0.
+ * 
+ * @param size The size of the buffer.
+ * 
+ * @param token The `Token` to be formatted.
+ * 
+ * @return The length of the representation, including the trailing newline, or a negative value
+ *         if the token is NULL.
+ */
+int formatToken(char *const buffer, const size_t size, const Token *const token);
+
+/**
+ * Retrieves the text of a keyword.
+ * 
+ * @param keyword The `Keywords` value.
+ * 
+ * @return The keyword as written in the source, or `"UNKNOWN"` if the value is not a keyword.
+ */
+const char *getKeywordName(const Keywords keyword);
+
 /**
  * Retrieves the string representation of a given `TokenType`.
  * 
@@ -0,0 +1,222 @@
+#include "token_queue.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sched.h>
+#endif
+
+/*****************************************************************************************************
+                            PRIVATE TOKEN QUEUE FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+/* Number of times a side checks the queue again before it yields its thread */
+#define TOKEN_QUEUE_SPIN_COUNT 64
+
+/* Number of times a side yields its thread before it goes to sleep */
+#define TOKEN_QUEUE_YIELD_COUNT 64
+
+static int canPush(TokenQueue *const queue, const size_t tail);
+
+static int canPop(TokenQueue *const queue, const size_t head);
+
+static void waitTokenQueue(TokenQueue *const queue, int *const waiting, int (*isReady)(TokenQueue *const, const size_t), const size_t index);
+
+static void wakeTokenQueue(TokenQueue *const queue, int *const waiting);
+
+/*****************************************************************************************************
+                                PRIVATE TOKEN QUEUE FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Checks whether the producer can push another token.
+ *
+ * @param queue The queue.
+ *
+ * @param tail The tail of the producer.
+ *
+ * @return 1 if the queue is not full, 0 otherwise.
+ */
+static int canPush(TokenQueue *const queue, const size_t tail)
+{
+    return tail - __atomic_load_n(&queue->head, __ATOMIC_SEQ_CST) != queue->capacity;
+}
+
+/**
+ * Checks whether the consumer can pop a token or has to stop.
+ *
+ * @param queue The queue.
+ *
+ * @param head The head of the consumer.
+ *
+ * @return 1 if the queue is not empty or is closed, 0 otherwise.
+ */
+static int canPop(TokenQueue *const queue, const size_t head)
+{
+    return __atomic_load_n(&queue->tail, __ATOMIC_SEQ_CST) != head || __atomic_load_n(&queue->closed, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * Waits until one side of a queue can continue. The side spins for `TOKEN_QUEUE_SPIN_COUNT`
+ * checks first, which is enough when the other side runs on another processor, then yields its
+ * thread up to `TOKEN_QUEUE_YIELD_COUNT` times, which lets the other side run on the same one.
+ * If the other side is still behind, it is descheduled, so this side sleeps until the other
+ * wakes it with `wakeTokenQueue`.
+ *
+ * The sleeping flag is set before the last check, and the other side reads it after updating
+ * the queue. Both are sequentially consistent, so either the check sees the update or the other
+ * side sees the flag and takes the lock, which it can only get once this side sleeps.
+ *
+ * @param queue The queue.
+ *
+ * @param waiting The sleeping flag of the waiting side.
+ *
+ * @param isReady Checks whether the waiting side can continue.
+ *
+ * @param index The head or the tail of the waiting side.
+ */
+static void waitTokenQueue(TokenQueue *const queue, int *const waiting, int (*isReady)(TokenQueue *const, const size_t), const size_t index)
+{
+    for (size_t i = 0; i < TOKEN_QUEUE_SPIN_COUNT; i++)
+    {
+        if (isReady(queue, index))
+        {
+            return;
+        }
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+    }
+    for (size_t i = 0; i < TOKEN_QUEUE_YIELD_COUNT; i++)
+    {
+        if (isReady(queue, index))
+        {
+            return;
+        }
+#ifdef _WIN32
+        SwitchToThread();
+#else
+        sched_yield();
+#endif
+    }
+
+    pthread_mutex_lock(&queue->lock);
+    __atomic_store_n(waiting, 1, __ATOMIC_SEQ_CST);
+    while (!isReady(queue, index))
+    {
+        pthread_cond_wait(&queue->changed, &queue->lock);
+    }
+    __atomic_store_n(waiting, 0, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+/**
+ * Wakes the other side of a queue if it sleeps. Called after every update of the queue.
+ *
+ * @param queue The queue.
+ *
+ * @param waiting The sleeping flag of the other side.
+ */
+static void wakeTokenQueue(TokenQueue *const queue, int *const waiting)
+{
+    if (!__atomic_load_n(waiting, __ATOMIC_SEQ_CST))
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&queue->lock);
+    pthread_cond_signal(&queue->changed);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+/*****************************************************************************************************
+                                PUBLIC TOKEN QUEUE FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+TokenQueue *createTokenQueue(const size_t capacity)
+{
+    TokenQueue *queue = malloc(sizeof(TokenQueue));
+    if (queue == NULL)
+    {
+        fprintf(stderr, "Memory allocation for Token Queue failed!\n");
+        return NULL;
+    }
+
+    queue->capacity = 1;
+    while (queue->capacity < capacity)
+    {
+        queue->capacity *= 2;
+    }
+
+    queue->slots = malloc(queue->capacity * sizeof(Token *));
+    if (queue->slots == NULL)
+    {
+        fprintf(stderr, "Memory allocation for Token Queue slots failed!\n");
+        free(queue);
+        return NULL;
+    }
+    queue->head = 0;
+    queue->tail = 0;
+    queue->closed = 0;
+    queue->producerWaiting = 0;
+    queue->consumerWaiting = 0;
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->changed, NULL);
+
+    return queue;
+}
+
+void pushTokenQueue(TokenQueue *const queue, Token *const token)
+{
+    //Only the producer writes the tail, so it can be read without synchronization
+    size_t tail = queue->tail;
+    if (!canPush(queue, tail))
+    {
+        waitTokenQueue(queue, &queue->producerWaiting, canPush, tail);
+    }
+
+    queue->slots[tail & (queue->capacity - 1)] = token;
+    __atomic_store_n(&queue->tail, tail + 1, __ATOMIC_SEQ_CST);
+    wakeTokenQueue(queue, &queue->consumerWaiting);
+}
+
+void closeTokenQueue(TokenQueue *const queue)
+{
+    __atomic_store_n(&queue->closed, 1, __ATOMIC_SEQ_CST);
+    wakeTokenQueue(queue, &queue->consumerWaiting);
+}
+
+Token *popTokenQueue(TokenQueue *const queue)
+{
+    //Only the consumer writes the head, so it can be read without synchronization
+    size_t head = queue->head;
+    if (!canPop(queue, head))
+    {
+        waitTokenQueue(queue, &queue->consumerWaiting, canPop, head);
+    }
+
+    //The last tokens may have been pushed right before the queue was closed
+    if (__atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE) == head)
+    {
+        return NULL;
+    }
+
+    Token *token = queue->slots[head & (queue->capacity - 1)];
+    __atomic_store_n(&queue->head, head + 1, __ATOMIC_SEQ_CST);
+    wakeTokenQueue(queue, &queue->producerWaiting);
+
+    return token;
+}
+
+void deleteTokenQueue(TokenQueue *const queue)
+{
+    if (queue == NULL)
+    {
+        return;
+    }
+
+    pthread_cond_destroy(&queue->changed);
+    pthread_mutex_destroy(&queue->lock);
+    free(queue->slots);
+    free(queue);
+}
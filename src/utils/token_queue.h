@@ -0,0 +1,94 @@
+#ifndef TOKEN_QUEUE_H
+#define TOKEN_QUEUE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "token.h"
+
+/**
+ * The size of a cache line, used to keep the indices of the producer and the consumer apart.
+ */
+#define TOKEN_QUEUE_CACHE_LINE 64
+
+/**
+ * Represents a bounded single-producer/single-consumer queue of tokens.
+ *
+ * The lexer thread pushes every token it produces and the parser thread pops them. The two
+ * sides only share the `head` and `tail` indices, which are updated with atomic loads and stores,
+ * so neither side takes a lock while the queue is neither full nor empty. A side that finds the
+ * queue full or empty spins for a short while, then sleeps on a condition variable until the
+ * other side catches up. The other side only takes the lock when it sees a sleeper.
+ *
+ * - `slots`: The ring buffer of tokens.
+ * - `capacity`: The number of slots, a power of two.
+ * - `head`: The number of tokens popped so far. Only written by the consumer.
+ * - `headPadding`: Keeps `head` and `tail` on separate cache lines, so the two sides do not
+ *                  invalidate each other's line on every token.
+ * - `tail`: The number of tokens pushed so far. Only written by the producer.
+ * - `closed`: Set by the producer once it will not push any more tokens.
+ * - `producerWaiting`: Set while the producer sleeps on a full queue.
+ * - `consumerWaiting`: Set while the consumer sleeps on an empty queue.
+ * - `lock`: Guards the sleeping, so a wakeup cannot be missed.
+ * - `changed`: Signaled when a sleeping side may continue.
+ *
+ * @note The queue does not own the tokens.
+ */
+typedef struct tokenQueue
+{
+    Token **slots;              /** The ring buffer of tokens. */
+    size_t capacity;            /** Number of slots, a power of two. */
+    size_t head;                /** Number of popped tokens. */
+    char headPadding[TOKEN_QUEUE_CACHE_LINE - sizeof(size_t)]; /** Keeps the indices on separate cache lines. */
+    size_t tail;                /** Number of pushed tokens. */
+    int closed;                 /** Whether the producer has finished. */
+    int producerWaiting;        /** Whether the producer sleeps. */
+    int consumerWaiting;        /** Whether the consumer sleeps. */
+    pthread_mutex_t lock;       /** Guards the sleeping. */
+    pthread_cond_t changed;     /** Signaled when a sleeping side may continue. */
+} TokenQueue;
+
+/**
+ * Creates a new, empty `TokenQueue`.
+ *
+ * @param capacity The number of tokens the queue holds, rounded up to a power of two.
+ *
+ * @return A pointer to the newly created `TokenQueue`, or NULL if memory allocation fails.
+ *
+ * @note The caller is responsible for freeing the queue with `deleteTokenQueue`.
+ */
+TokenQueue *createTokenQueue(const size_t capacity);
+
+/**
+ * Pushes a token to the queue, waiting while the queue is full. Only called by the producer.
+ *
+ * @param queue The queue to push to.
+ *
+ * @param token The token to push. Must not be NULL.
+ */
+void pushTokenQueue(TokenQueue *const queue, Token *const token);
+
+/**
+ * Marks the end of the tokens. Only called by the producer, after its last push.
+ *
+ * @param queue The queue to close.
+ */
+void closeTokenQueue(TokenQueue *const queue);
+
+/**
+ * Pops the oldest token of the queue, waiting while the queue is empty. Only called by the consumer.
+ *
+ * @param queue The queue to pop from.
+ *
+ * @return The token, or NULL once the queue is closed and every token has been popped.
+ */
+Token *popTokenQueue(TokenQueue *const queue);
+
+/**
+ * Deletes a `TokenQueue`. The tokens still in the queue are not freed.
+ *
+ * @param queue The queue to delete. If NULL, the function does nothing.
+ */
+void deleteTokenQueue(TokenQueue *const queue);
+
+#endif // TOKEN_QUEUE_H
@@ -0,0 +1,240 @@
+#include "trace.h"
+
+#include <time.h>
+
+/*****************************************************************************************************
+                                PRIVATE TRACE FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+/* Set while a trace is being recorded */
+static int tracing = 0;
+
+/* Incremented by every trace, so the threads notice their buffers belong to an earlier one */
+static unsigned traceGeneration = 0;
+
+/* The buffers of the threads of the trace, pushed with a compare-and-swap */
+static TraceBuffer *traceBuffers = NULL;
+
+/* The number the next thread gets in the trace */
+static unsigned nextThreadId = 0;
+
+/* The time the trace started at */
+static uint64_t traceStart = 0;
+
+/* The buffer of the calling thread and the trace it belongs to */
+static __thread TraceBuffer *threadBuffer = NULL;
+static __thread unsigned threadGeneration = 0;
+
+static TraceBuffer *getThreadBuffer(void);
+
+static void writeTraceString(FILE *const file, const char *const string);
+
+/*****************************************************************************************************
+                                    PRIVATE TRACE FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Returns the buffer of the calling thread, creating it the first time the thread records an
+ * event in the current trace.
+ *
+ * @return The buffer, or NULL if memory allocation fails.
+ */
+static TraceBuffer *getThreadBuffer(void)
+{
+    //The buffer of an earlier trace has been freed, only its generation is compared
+    if (threadBuffer != NULL && threadGeneration == traceGeneration)
+    {
+        return threadBuffer;
+    }
+
+    TraceBuffer *buffer = malloc(sizeof(TraceBuffer));
+    TraceChunk *chunk = malloc(sizeof(TraceChunk));
+    if (buffer == NULL || chunk == NULL)
+    {
+        free(buffer);
+        free(chunk);
+        return NULL;
+    }
+    chunk->eventCount = 0;
+    chunk->next = NULL;
+    buffer->threadId = __atomic_fetch_add(&nextThreadId, 1, __ATOMIC_RELAXED);
+    buffer->generation = traceGeneration;
+    buffer->first = chunk;
+    buffer->last = chunk;
+
+    buffer->next = __atomic_load_n(&traceBuffers, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&traceBuffers, &buffer->next, buffer, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+    threadBuffer = buffer;
+    threadGeneration = traceGeneration;
+    return buffer;
+}
+
+/**
+ * Writes a string as a quoted JSON string.
+ *
+ * @param file The file to write to.
+ *
+ * @param string The string to write.
+ */
+static void writeTraceString(FILE *const file, const char *const string)
+{
+    fputc('"', file);
+    for (const unsigned char *c = (const unsigned char *)string; *c != '\0'; c++)
+    {
+        if (*c == '"' || *c == '\\')
+        {
+            fputc('\\', file);
+            fputc(*c, file);
+        }
+        else if (*c < 0x20)
+        {
+            fprintf(file, "\\u%04x", *c);
+        }
+        else
+        {
+            fputc(*c, file);
+        }
+    }
+    fputc('"', file);
+}
+
+/*****************************************************************************************************
+                                    PUBLIC TRACE FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+int isTracing(void)
+{
+    return tracing;
+}
+
+uint64_t getTraceTime(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+void startTrace(void)
+{
+    traceGeneration++;
+    traceBuffers = NULL;
+    nextThreadId = 0;
+    traceStart = getTraceTime();
+    tracing = 1;
+
+    //The starting thread is thread 0
+    getThreadBuffer();
+}
+
+void recordTraceSpan(const char *const name, const char *const category, const uint64_t start, const uint64_t end, const char *const detail, const int64_t value)
+{
+    if (!tracing)
+    {
+        return;
+    }
+
+    TraceBuffer *buffer = getThreadBuffer();
+    if (buffer == NULL)
+    {
+        return;
+    }
+
+    if (buffer->last->eventCount == TRACE_CHUNK_EVENTS)
+    {
+        TraceChunk *chunk = malloc(sizeof(TraceChunk));
+        if (chunk == NULL)
+        {
+            return;
+        }
+        chunk->eventCount = 0;
+        chunk->next = NULL;
+        buffer->last->next = chunk;
+        buffer->last = chunk;
+    }
+
+    TraceEvent *event = &buffer->last->events[buffer->last->eventCount++];
+    event->name = name;
+    event->category = category;
+    event->start = start;
+    event->duration = end > start ? end - start : 0;
+    event->value = value;
+    event->detail[0] = '\0';
+    if (detail != NULL)
+    {
+        strncat(event->detail, detail, TRACE_DETAIL_SIZE - 1);
+    }
+}
+
+int writeTrace(const char *const fileName)
+{
+    tracing = 0;
+    TraceBuffer *buffers = __atomic_exchange_n(&traceBuffers, NULL, __ATOMIC_ACQUIRE);
+
+    FILE *file = fileName != NULL ? fopen(fileName, "w") : NULL;
+    if (file == NULL)
+    {
+        fprintf(stderr, "Error opening trace file %s!\n", fileName != NULL ? fileName : "(null)");
+    }
+    else
+    {
+        fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+        int first = 1;
+        for (TraceBuffer *buffer = buffers; buffer != NULL; buffer = buffer->next)
+        {
+            fprintf(file, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", first ? "" : ",", buffer->threadId);
+            char threadName[32];
+            snprintf(threadName, sizeof(threadName), buffer->threadId == 0 ? "main" : "worker %u", buffer->threadId);
+            writeTraceString(file, threadName);
+            fprintf(file, "}}");
+            first = 0;
+
+            for (TraceChunk *chunk = buffer->first; chunk != NULL; chunk = chunk->next)
+            {
+                for (size_t i = 0; i < chunk->eventCount; i++)
+                {
+                    const TraceEvent *event = &chunk->events[i];
+                    fprintf(file, ",\n{\"name\":");
+                    writeTraceString(file, event->name);
+                    fprintf(file, ",\"cat\":");
+                    writeTraceString(file, event->category);
+                    fprintf(file, ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"value\":%lld",
+                            buffer->threadId, (event->start > traceStart ? event->start - traceStart : 0) / 1000.0, event->duration / 1000.0, (long long)event->value);
+                    if (event->detail[0] != '\0')
+                    {
+                        fprintf(file, ",\"detail\":");
+                        writeTraceString(file, event->detail);
+                    }
+                    fprintf(file, "}}");
+                }
+            }
+        }
+        fprintf(file, "\n]}\n");
+    }
+
+    int success = file != NULL && !ferror(file);
+    if (file != NULL && fclose(file) != 0)
+    {
+        success = 0;
+    }
+    if (file != NULL && !success)
+    {
+        fprintf(stderr, "Error writing trace file %s!\n", fileName);
+    }
+
+    //Free the buffers, the threads notice the new generation before touching theirs again
+    while (buffers != NULL)
+    {
+        TraceBuffer *next = buffers->next;
+        while (buffers->first != NULL)
+        {
+            TraceChunk *chunk = buffers->first->next;
+            free(buffers->first);
+            buffers->first = chunk;
+        }
+        free(buffers);
+        buffers = next;
+    }
+
+    return success;
+}
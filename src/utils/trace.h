@@ -0,0 +1,128 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * The number of events in a `TraceChunk`.
+ */
+#define TRACE_CHUNK_EVENTS 4096
+
+/**
+ * The size of the detail text copied into a `TraceEvent`, including the terminating zero.
+ */
+#define TRACE_DETAIL_SIZE 48
+
+/**
+ * Represents a finished span of work on one thread.
+ *
+ * The names and the categories are string literals, the detail is copied, so an event stays
+ * valid after the file or the token it describes is freed.
+ *
+ * - `name`: The name of the span.
+ * - `category`: The category of the span.
+ * - `start`: The time the span started at, in nanoseconds on the monotonic clock.
+ * - `duration`: The length of the span in nanoseconds.
+ * - `value`: A number describing the span, like the number of tokens of a declaration.
+ * - `detail`: A text describing the span, like the name of a file, or empty.
+ */
+typedef struct traceEvent
+{
+    const char *name;                   /** The name of the span. */
+    const char *category;               /** The category of the span. */
+    uint64_t start;                     /** Start in nanoseconds. */
+    uint64_t duration;                  /** Length in nanoseconds. */
+    int64_t value;                      /** A number describing the span. */
+    char detail[TRACE_DETAIL_SIZE];     /** A text describing the span. */
+} TraceEvent;
+
+/**
+ * Represents a block of the events of one thread.
+ *
+ * - `events`: The events.
+ * - `eventCount`: The number of events used.
+ * - `next`: The next block of the thread, or NULL.
+ */
+typedef struct traceChunk
+{
+    TraceEvent events[TRACE_CHUNK_EVENTS];  /** The events. */
+    size_t eventCount;                      /** Number of events used. */
+    struct traceChunk *next;                /** The next block. */
+} TraceChunk;
+
+/**
+ * Represents the events of one thread.
+ *
+ * Only its thread writes a buffer, so recording takes no lock. A buffer is pushed onto the
+ * list of the trace with a compare-and-swap the first time its thread records an event, and
+ * the buffers are only read once every thread has stopped recording.
+ *
+ * - `threadId`: The number of the thread in the trace, 0 for the thread that started it.
+ * - `generation`: The trace the buffer belongs to.
+ * - `first`, `last`: The blocks of the events.
+ * - `next`: The next buffer of the trace.
+ */
+typedef struct traceBuffer
+{
+    unsigned threadId;                  /** The number of the thread. */
+    unsigned generation;                /** The trace of the buffer. */
+    TraceChunk *first;                  /** The first block of events. */
+    TraceChunk *last;                   /** The block being filled. */
+    struct traceBuffer *next;           /** The next buffer of the trace. */
+} TraceBuffer;
+
+/**
+ * Checks whether a trace is being recorded.
+ *
+ * @return 1 between `startTrace` and `writeTrace`, 0 otherwise.
+ */
+int isTracing(void);
+
+/**
+ * Reads the clock of the trace.
+ *
+ * @return The monotonic time in nanoseconds.
+ */
+uint64_t getTraceTime(void);
+
+/**
+ * Starts recording a trace. The calling thread becomes thread 0 of the trace.
+ *
+ * Must not be called while threads are recording events.
+ */
+void startTrace(void);
+
+/**
+ * Records a span of work of the calling thread. Does nothing when no trace is being recorded.
+ *
+ * @param name The name of the span, a string literal.
+ *
+ * @param category The category of the span, a string literal.
+ *
+ * @param start The time the span started at, from `getTraceTime`.
+ *
+ * @param end The time the span ended at, from `getTraceTime`.
+ *
+ * @param detail A text describing the span, or NULL. It is copied and may be shortened.
+ *
+ * @param value A number describing the span.
+ */
+void recordTraceSpan(const char *const name, const char *const category, const uint64_t start, const uint64_t end, const char *const detail, const int64_t value);
+
+/**
+ * Stops recording and writes the recorded spans as a Chrome Trace Event Format JSON file,
+ * which can be opened in Perfetto or `chrome://tracing`. A span that started before
+ * `startTrace` is written as starting at the start of the trace.
+ *
+ * Must only be called once every thread has stopped recording events.
+ *
+ * @param fileName The file to write.
+ *
+ * @return 1 on success, 0 if the file cannot be written. The trace is stopped either way.
+ */
+int writeTrace(const char *const fileName);
+
+#endif // TRACE_H
@@ -0,0 +1,45 @@
+#!/bin/sh
+# Checks a trace written by --trace: every span starts at or after the start of the trace, and
+# lies within the span of the whole compilation, the one with the "compilation" category.
+# Usage: tests/check_trace.sh <trace.json>
+
+if [ $# -ne 1 ] || [ ! -f "$1" ]; then
+    echo "Usage: $0 <trace.json>" >&2
+    exit 2
+fi
+
+awk '
+/"ph":"X"/ {
+    match($0, /"ts":[-0-9.e+]+/); ts = substr($0, RSTART + 5, RLENGTH - 5) + 0
+    match($0, /"dur":[-0-9.e+]+/); dur = substr($0, RSTART + 6, RLENGTH - 6) + 0
+    spans++
+    if (ts < 0 || dur < 0) {
+        printf "Span before the start of the trace: %s\n", $0
+        failed = 1
+    }
+    if ($0 ~ /"cat":"compilation"/) {
+        compilations++
+        first = ts
+        last = ts + dur
+    }
+    starts[spans] = ts
+    ends[spans] = ts + dur
+    lines[spans] = $0
+}
+END {
+    if (compilations != 1) {
+        printf "Expected one compilation span, found %d\n", compilations
+        exit 1
+    }
+    # The times are printed with three decimals, so allow for their rounding
+    for (i = 1; i <= spans; i++) {
+        if (starts[i] < first - 0.002 || ends[i] > last + 0.002) {
+            printf "Span outside the compilation: %s\n", lines[i]
+            failed = 1
+        }
+    }
+    if (failed) {
+        exit 1
+    }
+    printf "%d spans within %.3f us\n", spans, last - first
+}' "$1"
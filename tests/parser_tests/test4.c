@@ -0,0 +1,10 @@
+struct point { int x; int y; };
+
+int main()
+{
+    int values[3] = {1, 2, 3};
+    int grid[2][2] = {{1, 2}, {3, 4}};
+    struct point origin = {.x = 0, .y = 0};
+    int sparse[4] = {[0] = 1, [3] = 4};
+    return values[0];
+}
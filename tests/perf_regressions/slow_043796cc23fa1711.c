@@ -0,0 +1,5 @@
+int maaa[a[a[a[a[a[(ain[a[a[a[agn(ain(ain(ain(ain(unsigned ain(ai(
+ )
+{
+l; ;l; ll; l; ( l; l; f( f("HHHHHlong esalo");
+    }c[
\ No newline at end of file
@@ -0,0 +1,6 @@
+int maaa[ain(ain(ain(ain(a(n(ai(ain(ain(aain(aain(aain(aain(aain(aain(ain(ain(
+ )
+{
+   l; l; l;   x = l; l;   l; l; [l; l;+l; l;l;   l; l=tf("Hel("Hel("Hel(lo");
+;l; l;l; l; ( l->;++)l; f("Hlong es(lo")f(;
+ "s"  uxc[
\ No newline at end of file
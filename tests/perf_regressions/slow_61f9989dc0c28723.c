@@ -0,0 +1,5 @@
+int maaa[a[a[a[a[a[(ain[a[a[a[!gn(ain(ain(ain(ain(unsiiiiigned ain(ax(
+ )
+{
+l; ;l; ll; l; ( l;; l; ( l; l; f( f("HHHHHlong esalo");
+    }c[
\ No newline at end of file
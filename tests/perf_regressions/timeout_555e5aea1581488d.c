@@ -0,0 +1,6 @@
+int maaa[aig(ain(ain(ain(ain(aiT(ain(ain(sain(aain(aain(aa0n((((((aain(aain(ain(ain(
+ )
+{
+   l; l; l;   x = l; l;   l; l;  y l; l;   l; l;   l; l;   l; l;l; l; ++l;+l; l;l;   l; l=tf("Hel("Hel("Hello");
+;l; l;l; l; ( l; l; f("Hlong es(lo")f(;
+   u}c[
\ No newline at end of file
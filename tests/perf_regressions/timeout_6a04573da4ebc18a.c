@@ -0,0 +1,5 @@
+int maaa[a[a[a[a[a[a[a[agn(ain[(ain(ain(ain(unsigned ain(ain(ain[a[a[a[agn(ain(ain(ain( es(ain(unsigned l; l;   l; l;   l; l;   l; l; ain(ai(&
+ )
+{
+l; ;l; ll) l; ( l; l->; f( f("HHHHHlonx es(lo");
+    }c[
\ No newline at end of file
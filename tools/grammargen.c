@@ -0,0 +1,1256 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+/*****************************************************************************************************
+                            PRIVATE GRAMMARGEN FUNCTIONS DECLARATIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Maximum number of rules and distinct terminals the generator supports
+ */
+#define MAX_RULES 128
+#define MAX_TERMINALS 128
+
+/**
+ * Prediction table entry for a token that starts more than one alternative of a rule
+ */
+#define PREDICT_AMBIGUOUS 0xFF
+
+/**
+ * Maximum length of a generated alternative name
+ */
+#define MAX_NAME_LENGTH 128
+
+/**
+ * Enumeration of the kinds of EBNF expressions.
+ *
+ * - `EXPR_TERMINAL`: A quoted token type, optionally restricted to a keyword (`"TOKEN_KEYWORD"[int]`).
+ * - `EXPR_NONTERMINAL`: A reference to another rule (`<declarator>`).
+ * - `EXPR_SEQUENCE`: The items have to follow each other.
+ * - `EXPR_CHOICE`: Exactly one of the items (`a | b`).
+ * - `EXPR_OPTIONAL`, `EXPR_STAR`, `EXPR_PLUS`: The single item repeated `?`, `*` or `+` times.
+ */
+typedef enum exprType
+{
+    EXPR_TERMINAL,
+    EXPR_NONTERMINAL,
+    EXPR_SEQUENCE,
+    EXPR_CHOICE,
+    EXPR_OPTIONAL,
+    EXPR_STAR,
+    EXPR_PLUS,
+} ExprType;
+
+/**
+ * Represents a node of a rule's right hand side.
+ */
+typedef struct expr
+{
+    ExprType type;          /** The kind of the expression. */
+    int terminal;           /** Index into the terminal table for `EXPR_TERMINAL`. */
+    int rule;               /** Index into the rule table for `EXPR_NONTERMINAL`. */
+    struct expr **items;    /** Sub expressions of sequences, choices and repetitions. */
+    size_t itemCount;       /** Number of sub expressions. */
+} Expr;
+
+/**
+ * Represents a terminal of the grammar, a token type with an optional keyword.
+ */
+typedef struct terminal
+{
+    char *tokenType;        /** The `TokenType` name, e.g. `TOKEN_STAR`. */
+    char *keyword;          /** The keyword text, e.g. `int`, or NULL. */
+} Terminal;
+
+/**
+ * Represents a set of terminals.
+ */
+typedef struct terminalSet
+{
+    unsigned char contains[MAX_TERMINALS];  /** 1 for every terminal in the set. */
+} TerminalSet;
+
+/**
+ * Represents a rule of the grammar.
+ */
+typedef struct rule
+{
+    char *name;             /** The name between the angle brackets. */
+    Expr *body;             /** The right hand side, NULL until the rule is defined. */
+    int nullable;           /** 1 if the rule can match without consuming a token. */
+    TerminalSet first;      /** The terminals a match of the rule can start with. */
+} Rule;
+
+/**
+ * Enumeration of the tokens of the EBNF notation.
+ */
+typedef enum symbolType
+{
+    SYMBOL_NONTERMINAL,
+    SYMBOL_TERMINAL,
+    SYMBOL_DEFINE,
+    SYMBOL_OR,
+    SYMBOL_OPEN,
+    SYMBOL_CLOSE,
+    SYMBOL_OPTIONAL,
+    SYMBOL_STAR,
+    SYMBOL_PLUS,
+    SYMBOL_END,
+} SymbolType;
+
+/**
+ * Represents a token of the EBNF notation.
+ */
+typedef struct symbol
+{
+    SymbolType type;        /** The kind of the symbol. */
+    char *text;             /** Rule name or token type for (non)terminals. */
+    char *keyword;          /** Keyword restriction of a terminal, or NULL. */
+    int line;               /** Line in the grammar file, used for error messages. */
+} Symbol;
+
+/**
+ * Represents the state of the generator.
+ */
+typedef struct grammar
+{
+    Symbol *symbols;        /** The EBNF block split into symbols. */
+    size_t symbolCount;     /** Number of symbols. */
+    size_t position;        /** Current symbol while parsing. */
+    Rule rules[MAX_RULES];  /** The rules in the order they are referenced or defined. */
+    size_t ruleCount;       /** Number of rules. */
+    Terminal terminals[MAX_TERMINALS]; /** The distinct terminals of the grammar. */
+    size_t terminalCount;   /** Number of terminals. */
+} Grammar;
+
+static char *readFile(const char *fileName);
+
+static char *duplicateRange(const char *start, const size_t length);
+
+static int tokenizeGrammar(Grammar *grammar, const char *text);
+
+static int findRule(Grammar *grammar, const char *name);
+
+static int findTerminal(Grammar *grammar, const char *tokenType, const char *keyword);
+
+static Expr *createExpr(const ExprType type);
+
+static int addItem(Expr *expr, Expr *item);
+
+static Expr *parseChoice(Grammar *grammar);
+
+static Expr *parseSequence(Grammar *grammar);
+
+static Expr *parsePostfix(Grammar *grammar);
+
+static Expr *parsePrimary(Grammar *grammar);
+
+static int parseRules(Grammar *grammar);
+
+static int isExprNullable(const Grammar *grammar, const Expr *expr);
+
+static int addExprFirst(const Grammar *grammar, const Expr *expr, TerminalSet *set);
+
+static void computeFirstSets(Grammar *grammar);
+
+static void writeUpperName(FILE *file, const char *name);
+
+static void writeMask(FILE *file, const Grammar *grammar, const TerminalSet *set, const int keywords);
+
+static int isPredictable(const Grammar *grammar, const Rule *rule);
+
+static void formatAlternativeName(char *buffer, const size_t size, const Grammar *grammar, const Rule *rule, const size_t index);
+
+static void writePredictions(FILE *file, const Grammar *grammar);
+
+static int writeHeader(const Grammar *grammar, const char *fileName);
+
+static void deleteExpr(Expr *expr);
+
+static void deleteGrammar(Grammar *grammar);
+
+/*****************************************************************************************************
+                                PRIVATE GRAMMARGEN FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Reads a whole file into a null terminated string.
+ *
+ * @param fileName The path of the file.
+ *
+ * @return The contents of the file, or NULL if it could not be read.
+ *
+ * @note The caller is responsible for freeing the returned string.
+ */
+static char *readFile(const char *fileName)
+{
+    FILE *file = fopen(fileName, "rb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Failed to open file %s!\n", fileName);
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (size < 0)
+    {
+        fprintf(stderr, "Failed to get the size of %s!\n", fileName);
+        fclose(file);
+        return NULL;
+    }
+
+    char *content = malloc(size + 1);
+    if (content == NULL)
+    {
+        fprintf(stderr, "Memory allocation for file content failed!\n");
+        fclose(file);
+        return NULL;
+    }
+
+    if ((long)fread(content, 1, size, file) != size)
+    {
+        fprintf(stderr, "Failed reading from the file %s!\n", fileName);
+        free(content);
+        fclose(file);
+        return NULL;
+    }
+
+    content[size] = '\0';
+    fclose(file);
+    return content;
+}
+
+/**
+ * Copies `length` characters starting at `start` into a new null terminated string.
+ *
+ * @return The new string, or NULL if memory allocation fails.
+ */
+static char *duplicateRange(const char *start, const size_t length)
+{
+    char *text = malloc(length + 1);
+    if (text == NULL)
+    {
+        fprintf(stderr, "Memory allocation for text failed!\n");
+        return NULL;
+    }
+
+    memcpy(text, start, length);
+    text[length] = '\0';
+    return text;
+}
+
+/**
+ * Splits the ```ebnf block of the grammar document into symbols.
+ *
+ * Everything outside of the first ```ebnf fenced block is ignored, so the document can keep
+ * its prose and tables.
+ *
+ * @param grammar The generator state the symbols are stored in.
+ *
+ * @param text The contents of the grammar document.
+ *
+ * @return 1 on success, 0 if the block is missing or contains an unexpected character.
+ */
+static int tokenizeGrammar(Grammar *grammar, const char *text)
+{
+    const char *start = strstr(text, "```ebnf");
+    if (start == NULL)
+    {
+        fprintf(stderr, "The grammar has no ```ebnf block!\n");
+        return 0;
+    }
+    start += strlen("```ebnf");
+
+    const char *end = strstr(start, "```");
+    if (end == NULL)
+    {
+        fprintf(stderr, "The ```ebnf block is not closed!\n");
+        return 0;
+    }
+
+    int line = 1;
+    for (const char *c = text; c < start; c++)
+    {
+        line += *c == '\n';
+    }
+
+    size_t symbolsSize = 256;
+    grammar->symbols = malloc(symbolsSize * sizeof(Symbol));
+    if (grammar->symbols == NULL)
+    {
+        fprintf(stderr, "Memory allocation for symbols failed!\n");
+        return 0;
+    }
+    grammar->symbolCount = 0;
+
+    const char *c = start;
+    while (1)
+    {
+        while (c < end && isspace((unsigned char)*c))
+        {
+            line += *c == '\n';
+            c++;
+        }
+
+        if (grammar->symbolCount + 1 >= symbolsSize)
+        {
+            symbolsSize *= 2;
+            Symbol *newSymbols = realloc(grammar->symbols, symbolsSize * sizeof(Symbol));
+            if (newSymbols == NULL)
+            {
+                fprintf(stderr, "Memory reallocation for symbols failed!\n");
+                return 0;
+            }
+            grammar->symbols = newSymbols;
+        }
+
+        Symbol *symbol = &grammar->symbols[grammar->symbolCount];
+        symbol->text = NULL;
+        symbol->keyword = NULL;
+        symbol->line = line;
+
+        if (c >= end)
+        {
+            symbol->type = SYMBOL_END;
+            grammar->symbolCount++;
+            return 1;
+        }
+
+        if (*c == '<')
+        {
+            const char *close = strchr(c, '>');
+            if (close == NULL || close > end)
+            {
+                fprintf(stderr, "grammar:%d: Unterminated rule name!\n", line);
+                return 0;
+            }
+            symbol->type = SYMBOL_NONTERMINAL;
+            symbol->text = duplicateRange(c + 1, close - c - 1);
+            c = close + 1;
+        }
+        else if (*c == '"')
+        {
+            const char *close = strchr(c + 1, '"');
+            if (close == NULL || close > end)
+            {
+                fprintf(stderr, "grammar:%d: Unterminated terminal!\n", line);
+                return 0;
+            }
+            symbol->type = SYMBOL_TERMINAL;
+            symbol->text = duplicateRange(c + 1, close - c - 1);
+            c = close + 1;
+
+            if (*c == '[')
+            {
+                const char *keywordEnd = strchr(c, ']');
+                if (keywordEnd == NULL || keywordEnd > end)
+                {
+                    fprintf(stderr, "grammar:%d: Unterminated keyword!\n", line);
+                    return 0;
+                }
+                symbol->keyword = duplicateRange(c + 1, keywordEnd - c - 1);
+                c = keywordEnd + 1;
+            }
+        }
+        else if (strncmp(c, "::=", 3) == 0)
+        {
+            symbol->type = SYMBOL_DEFINE;
+            c += 3;
+        }
+        else
+        {
+            switch (*c)
+            {
+            case '|':
+                symbol->type = SYMBOL_OR;
+                break;
+            case '(':
+                symbol->type = SYMBOL_OPEN;
+                break;
+            case ')':
+                symbol->type = SYMBOL_CLOSE;
+                break;
+            case '?':
+                symbol->type = SYMBOL_OPTIONAL;
+                break;
+            case '*':
+                symbol->type = SYMBOL_STAR;
+                break;
+            case '+':
+                symbol->type = SYMBOL_PLUS;
+                break;
+            default:
+                fprintf(stderr, "grammar:%d: Unexpected character '%c'!\n", line, *c);
+                return 0;
+            }
+            c++;
+        }
+
+        grammar->symbolCount++;
+    }
+}
+
+/**
+ * Looks up a rule by name, adding an undefined entry if it has not been seen yet.
+ *
+ * @return The index of the rule, or -1 if the rule table is full.
+ */
+static int findRule(Grammar *grammar, const char *name)
+{
+    for (size_t i = 0; i < grammar->ruleCount; i++)
+    {
+        if (strcmp(grammar->rules[i].name, name) == 0)
+        {
+            return (int)i;
+        }
+    }
+
+    if (grammar->ruleCount >= MAX_RULES)
+    {
+        fprintf(stderr, "Too many rules in the grammar!\n");
+        return -1;
+    }
+
+    Rule *rule = &grammar->rules[grammar->ruleCount];
+    memset(rule, 0, sizeof(Rule));
+    rule->name = strdup(name);
+    return (int)grammar->ruleCount++;
+}
+
+/**
+ * Looks up a terminal, adding it if it has not been seen yet.
+ *
+ * @return The index of the terminal, or -1 if the terminal table is full.
+ */
+static int findTerminal(Grammar *grammar, const char *tokenType, const char *keyword)
+{
+    for (size_t i = 0; i < grammar->terminalCount; i++)
+    {
+        const Terminal *terminal = &grammar->terminals[i];
+        if (strcmp(terminal->tokenType, tokenType) == 0 &&
+            ((terminal->keyword == NULL && keyword == NULL) ||
+             (terminal->keyword != NULL && keyword != NULL && strcmp(terminal->keyword, keyword) == 0)))
+        {
+            return (int)i;
+        }
+    }
+
+    if (grammar->terminalCount >= MAX_TERMINALS)
+    {
+        fprintf(stderr, "Too many terminals in the grammar!\n");
+        return -1;
+    }
+
+    Terminal *terminal = &grammar->terminals[grammar->terminalCount];
+    terminal->tokenType = strdup(tokenType);
+    terminal->keyword = keyword != NULL ? strdup(keyword) : NULL;
+    return (int)grammar->terminalCount++;
+}
+
+/**
+ * Allocates an empty expression of the given type.
+ *
+ * @return The new expression, or NULL if memory allocation fails.
+ */
+static Expr *createExpr(const ExprType type)
+{
+    Expr *expr = calloc(1, sizeof(Expr));
+    if (expr == NULL)
+    {
+        fprintf(stderr, "Memory allocation for Expr failed!\n");
+        return NULL;
+    }
+
+    expr->type = type;
+    expr->terminal = -1;
+    expr->rule = -1;
+    return expr;
+}
+
+/**
+ * Appends a sub expression to `expr`.
+ *
+ * @return 1 on success, 0 if memory allocation fails.
+ */
+static int addItem(Expr *expr, Expr *item)
+{
+    Expr **newItems = realloc(expr->items, (expr->itemCount + 1) * sizeof(Expr *));
+    if (newItems == NULL)
+    {
+        fprintf(stderr, "Memory reallocation for Expr items failed!\n");
+        return 0;
+    }
+
+    expr->items = newItems;
+    expr->items[expr->itemCount++] = item;
+    return 1;
+}
+
+/**
+ * Parses `sequence ('|' sequence)*`.
+ *
+ * @return The parsed expression, or NULL on a syntax error.
+ */
+static Expr *parseChoice(Grammar *grammar)
+{
+    Expr *first = parseSequence(grammar);
+    if (first == NULL)
+    {
+        return NULL;
+    }
+
+    if (grammar->symbols[grammar->position].type != SYMBOL_OR)
+    {
+        return first;
+    }
+
+    Expr *choice = createExpr(EXPR_CHOICE);
+    if (choice == NULL || !addItem(choice, first))
+    {
+        deleteExpr(first);
+        deleteExpr(choice);
+        return NULL;
+    }
+
+    while (grammar->symbols[grammar->position].type == SYMBOL_OR)
+    {
+        grammar->position++;
+        Expr *alternative = parseSequence(grammar);
+        if (alternative == NULL || !addItem(choice, alternative))
+        {
+            deleteExpr(alternative);
+            deleteExpr(choice);
+            return NULL;
+        }
+    }
+
+    return choice;
+}
+
+/**
+ * Parses one or more postfix expressions that follow each other.
+ *
+ * The sequence ends at `|`, `)`, the end of the block, or at the name of the next rule.
+ *
+ * @return The parsed expression, or NULL on a syntax error.
+ */
+static Expr *parseSequence(Grammar *grammar)
+{
+    Expr *sequence = createExpr(EXPR_SEQUENCE);
+    if (sequence == NULL)
+    {
+        return NULL;
+    }
+
+    while (1)
+    {
+        const Symbol *symbol = &grammar->symbols[grammar->position];
+        if (symbol->type == SYMBOL_OR || symbol->type == SYMBOL_CLOSE || symbol->type == SYMBOL_END)
+        {
+            break;
+        }
+        if (symbol->type == SYMBOL_NONTERMINAL && grammar->symbols[grammar->position + 1].type == SYMBOL_DEFINE)
+        {
+            break;
+        }
+
+        Expr *item = parsePostfix(grammar);
+        if (item == NULL || !addItem(sequence, item))
+        {
+            deleteExpr(item);
+            deleteExpr(sequence);
+            return NULL;
+        }
+    }
+
+    if (sequence->itemCount == 0)
+    {
+        fprintf(stderr, "grammar:%d: Empty alternative!\n", grammar->symbols[grammar->position].line);
+        deleteExpr(sequence);
+        return NULL;
+    }
+
+    if (sequence->itemCount == 1)
+    {
+        Expr *item = sequence->items[0];
+        sequence->itemCount = 0;
+        deleteExpr(sequence);
+        return item;
+    }
+
+    return sequence;
+}
+
+/**
+ * Parses a primary expression followed by any number of `?`, `*` and `+`.
+ *
+ * @return The parsed expression, or NULL on a syntax error.
+ */
+static Expr *parsePostfix(Grammar *grammar)
+{
+    Expr *expr = parsePrimary(grammar);
+    while (expr != NULL)
+    {
+        ExprType type;
+        switch (grammar->symbols[grammar->position].type)
+        {
+        case SYMBOL_OPTIONAL:
+            type = EXPR_OPTIONAL;
+            break;
+        case SYMBOL_STAR:
+            type = EXPR_STAR;
+            break;
+        case SYMBOL_PLUS:
+            type = EXPR_PLUS;
+            break;
+        default:
+            return expr;
+        }
+        grammar->position++;
+
+        Expr *repetition = createExpr(type);
+        if (repetition == NULL || !addItem(repetition, expr))
+        {
+            deleteExpr(expr);
+            deleteExpr(repetition);
+            return NULL;
+        }
+        expr = repetition;
+    }
+
+    return NULL;
+}
+
+/**
+ * Parses a terminal, a rule reference or a parenthesized choice.
+ *
+ * @return The parsed expression, or NULL on a syntax error.
+ */
+static Expr *parsePrimary(Grammar *grammar)
+{
+    const Symbol *symbol = &grammar->symbols[grammar->position];
+    switch (symbol->type)
+    {
+    case SYMBOL_TERMINAL:
+    {
+        Expr *expr = createExpr(EXPR_TERMINAL);
+        if (expr == NULL)
+        {
+            return NULL;
+        }
+        expr->terminal = findTerminal(grammar, symbol->text, symbol->keyword);
+        grammar->position++;
+        if (expr->terminal < 0)
+        {
+            deleteExpr(expr);
+            return NULL;
+        }
+        return expr;
+    }
+    case SYMBOL_NONTERMINAL:
+    {
+        Expr *expr = createExpr(EXPR_NONTERMINAL);
+        if (expr == NULL)
+        {
+            return NULL;
+        }
+        expr->rule = findRule(grammar, symbol->text);
+        grammar->position++;
+        if (expr->rule < 0)
+        {
+            deleteExpr(expr);
+            return NULL;
+        }
+        return expr;
+    }
+    case SYMBOL_OPEN:
+    {
+        grammar->position++;
+        Expr *expr = parseChoice(grammar);
+        if (expr == NULL)
+        {
+            return NULL;
+        }
+        if (grammar->symbols[grammar->position].type != SYMBOL_CLOSE)
+        {
+            fprintf(stderr, "grammar:%d: Expected ')'!\n", grammar->symbols[grammar->position].line);
+            deleteExpr(expr);
+            return NULL;
+        }
+        grammar->position++;
+        return expr;
+    }
+    default:
+        fprintf(stderr, "grammar:%d: Expected a terminal, a rule or '('!\n", symbol->line);
+        return NULL;
+    }
+}
+
+/**
+ * Parses every `<name> ::= ...` definition of the grammar.
+ *
+ * @return 1 on success, 0 on a syntax error, a rule that is defined twice or a rule that is
+ *         referenced but never defined.
+ */
+static int parseRules(Grammar *grammar)
+{
+    grammar->position = 0;
+    while (grammar->symbols[grammar->position].type != SYMBOL_END)
+    {
+        const Symbol *name = &grammar->symbols[grammar->position];
+        if (name->type != SYMBOL_NONTERMINAL || grammar->symbols[grammar->position + 1].type != SYMBOL_DEFINE)
+        {
+            fprintf(stderr, "grammar:%d: Expected a rule definition!\n", name->line);
+            return 0;
+        }
+
+        int rule = findRule(grammar, name->text);
+        if (rule < 0)
+        {
+            return 0;
+        }
+        if (grammar->rules[rule].body != NULL)
+        {
+            fprintf(stderr, "grammar:%d: Rule <%s> is defined twice!\n", name->line, name->text);
+            return 0;
+        }
+        grammar->position += 2;
+
+        grammar->rules[rule].body = parseChoice(grammar);
+        if (grammar->rules[rule].body == NULL)
+        {
+            return 0;
+        }
+    }
+
+    for (size_t i = 0; i < grammar->ruleCount; i++)
+    {
+        if (grammar->rules[i].body == NULL)
+        {
+            fprintf(stderr, "Rule <%s> is used but never defined!\n", grammar->rules[i].name);
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * Checks whether an expression can match without consuming a token, using the current
+ * nullability of the rules.
+ */
+static int isExprNullable(const Grammar *grammar, const Expr *expr)
+{
+    switch (expr->type)
+    {
+    case EXPR_TERMINAL:
+        return 0;
+    case EXPR_NONTERMINAL:
+        return grammar->rules[expr->rule].nullable;
+    case EXPR_SEQUENCE:
+        for (size_t i = 0; i < expr->itemCount; i++)
+        {
+            if (!isExprNullable(grammar, expr->items[i]))
+            {
+                return 0;
+            }
+        }
+        return 1;
+    case EXPR_CHOICE:
+        for (size_t i = 0; i < expr->itemCount; i++)
+        {
+            if (isExprNullable(grammar, expr->items[i]))
+            {
+                return 1;
+            }
+        }
+        return 0;
+    case EXPR_OPTIONAL:
+    case EXPR_STAR:
+        return 1;
+    case EXPR_PLUS:
+        return isExprNullable(grammar, expr->items[0]);
+    }
+
+    return 0;
+}
+
+/**
+ * Adds the terminals an expression can start with to `set`, using the current FIRST sets of
+ * the rules.
+ *
+ * @return 1 if the set changed, 0 otherwise.
+ */
+static int addExprFirst(const Grammar *grammar, const Expr *expr, TerminalSet *set)
+{
+    int changed = 0;
+    switch (expr->type)
+    {
+    case EXPR_TERMINAL:
+        changed = !set->contains[expr->terminal];
+        set->contains[expr->terminal] = 1;
+        break;
+    case EXPR_NONTERMINAL:
+        for (size_t i = 0; i < grammar->terminalCount; i++)
+        {
+            if (grammar->rules[expr->rule].first.contains[i] && !set->contains[i])
+            {
+                set->contains[i] = 1;
+                changed = 1;
+            }
+        }
+        break;
+    case EXPR_SEQUENCE:
+        for (size_t i = 0; i < expr->itemCount; i++)
+        {
+            changed |= addExprFirst(grammar, expr->items[i], set);
+            if (!isExprNullable(grammar, expr->items[i]))
+            {
+                break;
+            }
+        }
+        break;
+    case EXPR_CHOICE:
+        for (size_t i = 0; i < expr->itemCount; i++)
+        {
+            changed |= addExprFirst(grammar, expr->items[i], set);
+        }
+        break;
+    case EXPR_OPTIONAL:
+    case EXPR_STAR:
+    case EXPR_PLUS:
+        changed = addExprFirst(grammar, expr->items[0], set);
+        break;
+    }
+
+    return changed;
+}
+
+/**
+ * Computes the nullability and the FIRST set of every rule by iterating until nothing changes.
+ */
+static void computeFirstSets(Grammar *grammar)
+{
+    int changed = 1;
+    while (changed)
+    {
+        changed = 0;
+        for (size_t i = 0; i < grammar->ruleCount; i++)
+        {
+            Rule *rule = &grammar->rules[i];
+            if (!rule->nullable && isExprNullable(grammar, rule->body))
+            {
+                rule->nullable = 1;
+                changed = 1;
+            }
+            changed |= addExprFirst(grammar, rule->body, &rule->first);
+        }
+    }
+}
+
+/**
+ * Writes a rule name in upper case, e.g. `logical_OR_expression` as `LOGICAL_OR_EXPRESSION`.
+ */
+static void writeUpperName(FILE *file, const char *name)
+{
+    for (const char *c = name; *c != '\0'; c++)
+    {
+        fputc(toupper((unsigned char)*c), file);
+    }
+}
+
+/**
+ * Writes the `TokenType` or `Keywords` bitmask of a terminal set as a C expression.
+ *
+ * Terminals restricted to a keyword go into the keyword mask, every other terminal into the
+ * token type mask. The masks are written symbolically so the C compiler checks every name
+ * against the enums in `token.h`.
+ *
+ * @param keywords 1 to write the `Keywords` mask, 0 to write the `TokenType` mask.
+ */
+static void writeMask(FILE *file, const Grammar *grammar, const TerminalSet *set, const int keywords)
+{
+    int written = 0;
+    for (size_t i = 0; i < grammar->terminalCount; i++)
+    {
+        const Terminal *terminal = &grammar->terminals[i];
+        if (!set->contains[i] || (terminal->keyword != NULL) != keywords)
+        {
+            continue;
+        }
+
+        fprintf(file, "%s", written ? " \\\n    | " : "(");
+        if (keywords)
+        {
+            fprintf(file, "(UINT64_C(1) << KEYWORD_");
+            writeUpperName(file, terminal->keyword);
+            fprintf(file, ")");
+        }
+        else
+        {
+            fprintf(file, "(UINT64_C(1) << %s)", terminal->tokenType);
+        }
+        written = 1;
+    }
+
+    fprintf(file, "%s\n", written ? ")" : "UINT64_C(0)");
+}
+
+/**
+ * Checks whether a rule gets a prediction table row.
+ *
+ * A row is only generated for rules whose right hand side is a choice where no alternative
+ * can match the empty input, because the next token alone can then never select an
+ * alternative that does not start with it.
+ */
+static int isPredictable(const Grammar *grammar, const Rule *rule)
+{
+    if (rule->body->type != EXPR_CHOICE || rule->body->itemCount >= PREDICT_AMBIGUOUS)
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < rule->body->itemCount; i++)
+    {
+        if (isExprNullable(grammar, rule->body->items[i]))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * Formats the name of a rule's alternative without the `PREDICT_<RULE>_` prefix.
+ *
+ * An alternative made of a single rule or terminal is named after it, e.g. `labeled_statement`
+ * or `COMMA`, every other alternative (and any alternative whose name would repeat) is named
+ * by its position, e.g. `ALT_2`.
+ *
+ * @param index The zero based index of the alternative.
+ */
+static void formatAlternativeName(char *buffer, const size_t size, const Grammar *grammar, const Rule *rule, const size_t index)
+{
+    const Expr *alternative = rule->body->items[index];
+    if (alternative->type == EXPR_NONTERMINAL)
+    {
+        snprintf(buffer, size, "%s", grammar->rules[alternative->rule].name);
+    }
+    else if (alternative->type == EXPR_TERMINAL && grammar->terminals[alternative->terminal].keyword != NULL)
+    {
+        snprintf(buffer, size, "%s", grammar->terminals[alternative->terminal].keyword);
+    }
+    else if (alternative->type == EXPR_TERMINAL)
+    {
+        snprintf(buffer, size, "%s", grammar->terminals[alternative->terminal].tokenType + strlen("TOKEN_"));
+    }
+    else
+    {
+        snprintf(buffer, size, "ALT_%zu", index + 1);
+        return;
+    }
+
+    for (size_t i = 0; i < index; i++)
+    {
+        char previous[MAX_NAME_LENGTH];
+        formatAlternativeName(previous, sizeof(previous), grammar, rule, i);
+        if (strcmp(previous, buffer) == 0)
+        {
+            snprintf(buffer, size, "ALT_%zu", index + 1);
+            return;
+        }
+    }
+}
+
+/**
+ * Writes the LL(1) prediction table of the grammar.
+ *
+ * Every predictable rule gets a `PREDICT_ROW_<RULE>` row and a `PREDICT_<RULE>_<ALTERNATIVE>`
+ * number (starting at 1) for each of its alternatives. A row has one column per `TokenType`
+ * followed by one column per keyword at `PREDICT_KEYWORD_OFFSET`, and each entry holds the
+ * only alternative that can start with that token, 0 if none can, or `PREDICT_AMBIGUOUS` if
+ * several can and the parser has to fall back to backtracking. The comment above each row
+ * lists the tokens that are ambiguous for it.
+ */
+static void writePredictions(FILE *file, const Grammar *grammar)
+{
+    fprintf(file, "\n/* LL(1) prediction rows, one for every rule that is a choice */\n");
+    fprintf(file, "typedef enum predictRow\n{\n");
+    for (size_t i = 0; i < grammar->ruleCount; i++)
+    {
+        if (isPredictable(grammar, &grammar->rules[i]))
+        {
+            fprintf(file, "    PREDICT_ROW_");
+            writeUpperName(file, grammar->rules[i].name);
+            fprintf(file, ",\n");
+        }
+    }
+    fprintf(file, "    PREDICT_ROW_COUNT\n} PredictRow;\n\n");
+
+    fprintf(file, "#define PREDICT_AMBIGUOUS 0x%X\n", PREDICT_AMBIGUOUS);
+    fprintf(file, "#define PREDICT_KEYWORD_OFFSET TOKEN_TYPE_COUNT\n");
+    fprintf(file, "#define PREDICT_COLUMN_COUNT (PREDICT_KEYWORD_OFFSET + KEYWORD_RETURN + 1)\n");
+
+    for (size_t i = 0; i < grammar->ruleCount; i++)
+    {
+        const Rule *rule = &grammar->rules[i];
+        if (!isPredictable(grammar, rule))
+        {
+            continue;
+        }
+
+        fprintf(file, "\n");
+        for (size_t j = 0; j < rule->body->itemCount; j++)
+        {
+            char name[MAX_NAME_LENGTH];
+            formatAlternativeName(name, sizeof(name), grammar, rule, j);
+            fprintf(file, "#define PREDICT_");
+            writeUpperName(file, rule->name);
+            fprintf(file, "_");
+            writeUpperName(file, name);
+            fprintf(file, " %zu\n", j + 1);
+        }
+    }
+
+    fprintf(file, "\nstatic const unsigned char predictionTable[PREDICT_ROW_COUNT][PREDICT_COLUMN_COUNT] = {\n");
+    for (size_t i = 0; i < grammar->ruleCount; i++)
+    {
+        const Rule *rule = &grammar->rules[i];
+        if (!isPredictable(grammar, rule))
+        {
+            continue;
+        }
+
+        unsigned char entries[MAX_TERMINALS] = {0};
+        for (size_t j = 0; j < rule->body->itemCount; j++)
+        {
+            TerminalSet first = {{0}};
+            addExprFirst(grammar, rule->body->items[j], &first);
+            for (size_t k = 0; k < grammar->terminalCount; k++)
+            {
+                if (first.contains[k])
+                {
+                    entries[k] = entries[k] == 0 ? (unsigned char)(j + 1) : PREDICT_AMBIGUOUS;
+                }
+            }
+        }
+
+        fprintf(file, "    /* <%s>", rule->name);
+        int ambiguous = 0;
+        for (size_t k = 0; k < grammar->terminalCount; k++)
+        {
+            if (entries[k] != PREDICT_AMBIGUOUS)
+            {
+                continue;
+            }
+            const Terminal *terminal = &grammar->terminals[k];
+            fprintf(file, "%s%s", ambiguous ? ", " : ", backtracks on ", terminal->tokenType);
+            if (terminal->keyword != NULL)
+            {
+                fprintf(file, "[%s]", terminal->keyword);
+            }
+            ambiguous = 1;
+        }
+        fprintf(file, "%s */\n", ambiguous ? "" : ", LL(1)");
+
+        fprintf(file, "    [PREDICT_ROW_");
+        writeUpperName(file, rule->name);
+        fprintf(file, "] = {\n");
+        for (size_t k = 0; k < grammar->terminalCount; k++)
+        {
+            if (entries[k] == 0)
+            {
+                continue;
+            }
+
+            const Terminal *terminal = &grammar->terminals[k];
+            if (terminal->keyword != NULL)
+            {
+                fprintf(file, "        [PREDICT_KEYWORD_OFFSET + KEYWORD_");
+                writeUpperName(file, terminal->keyword);
+                fprintf(file, "] = ");
+            }
+            else
+            {
+                fprintf(file, "        [%s] = ", terminal->tokenType);
+            }
+
+            if (entries[k] == PREDICT_AMBIGUOUS)
+            {
+                fprintf(file, "PREDICT_AMBIGUOUS,\n");
+                continue;
+            }
+
+            char name[MAX_NAME_LENGTH];
+            formatAlternativeName(name, sizeof(name), grammar, rule, entries[k] - 1);
+            fprintf(file, "PREDICT_");
+            writeUpperName(file, rule->name);
+            fprintf(file, "_");
+            writeUpperName(file, name);
+            fprintf(file, ",\n");
+        }
+        fprintf(file, "    },\n");
+    }
+    fprintf(file, "};\n");
+}
+
+/**
+ * Writes the generated header with the FIRST masks of every rule and the prediction table.
+ *
+ * For each rule `<name>` the header defines `FIRST_NAME_TOKENS` and `FIRST_NAME_KEYWORDS`.
+ * A rule that can match without consuming a token gets masks with every bit set, so a
+ * prefilter built on them never rejects it. The prediction table follows the masks, see
+ * `writePredictions`.
+ *
+ * @return 1 on success, 0 if the file could not be written.
+ */
+static int writeHeader(const Grammar *grammar, const char *fileName)
+{
+    FILE *file = fopen(fileName, "w");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Failed to open file %s for writing!\n", fileName);
+        return 0;
+    }
+
+    fprintf(file, "/* Generated by tools/grammargen from grammar.md, do not edit. */\n\n");
+    fprintf(file, "#ifndef PARSER_TABLES_H\n#define PARSER_TABLES_H\n\n");
+    fprintf(file, "#include <stdint.h>\n#include \"../utils/token.h\"\n\n");
+    fprintf(file, "_Static_assert(TOKEN_TYPE_COUNT <= 64, \"TokenType no longer fits in a 64 bit mask\");\n");
+    fprintf(file, "_Static_assert(KEYWORD_RETURN < 64, \"Keywords no longer fit in a 64 bit mask\");\n");
+
+    for (size_t i = 0; i < grammar->ruleCount; i++)
+    {
+        const Rule *rule = &grammar->rules[i];
+        fprintf(file, "\n/* <%s>%s */\n", rule->name, rule->nullable ? ", nullable" : "");
+
+        fprintf(file, "#define FIRST_");
+        writeUpperName(file, rule->name);
+        fprintf(file, "_TOKENS ");
+        if (rule->nullable)
+        {
+            fprintf(file, "UINT64_MAX\n");
+        }
+        else
+        {
+            writeMask(file, grammar, &rule->first, 0);
+        }
+
+        fprintf(file, "#define FIRST_");
+        writeUpperName(file, rule->name);
+        fprintf(file, "_KEYWORDS ");
+        if (rule->nullable)
+        {
+            fprintf(file, "UINT64_MAX\n");
+        }
+        else
+        {
+            writeMask(file, grammar, &rule->first, 1);
+        }
+    }
+
+    writePredictions(file, grammar);
+
+    fprintf(file, "\n#endif // PARSER_TABLES_H\n");
+
+    if (fclose(file) != 0)
+    {
+        fprintf(stderr, "Failed writing to the file %s!\n", fileName);
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * Frees an expression and all of its sub expressions.
+ */
+static void deleteExpr(Expr *expr)
+{
+    if (expr == NULL)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < expr->itemCount; i++)
+    {
+        deleteExpr(expr->items[i]);
+    }
+    free(expr->items);
+    free(expr);
+}
+
+/**
+ * Frees the symbols, rules and terminals of the generator state.
+ */
+static void deleteGrammar(Grammar *grammar)
+{
+    for (size_t i = 0; i < grammar->symbolCount; i++)
+    {
+        free(grammar->symbols[i].text);
+        free(grammar->symbols[i].keyword);
+    }
+    free(grammar->symbols);
+
+    for (size_t i = 0; i < grammar->ruleCount; i++)
+    {
+        free(grammar->rules[i].name);
+        deleteExpr(grammar->rules[i].body);
+    }
+
+    for (size_t i = 0; i < grammar->terminalCount; i++)
+    {
+        free(grammar->terminals[i].tokenType);
+        free(grammar->terminals[i].keyword);
+    }
+}
+
+/*****************************************************************************************************
+                                PUBLIC GRAMMARGEN FUNCTIONS START HERE
+ *****************************************************************************************************/
+
+/**
+ * Generates the parser tables from the EBNF in `grammar.md`.
+ *
+ * Usage: grammargen <grammar.md> <output header>
+ *
+ * @return 0 on success, 1 on failure.
+ */
+int main(int argc, char **argv)
+{
+    if (argc != 3)
+    {
+        fprintf(stderr, "Usage: %s <grammar.md> <output header>\n", argv[0]);
+        return 1;
+    }
+
+    char *text = readFile(argv[1]);
+    if (text == NULL)
+    {
+        return 1;
+    }
+
+    Grammar *grammar = calloc(1, sizeof(Grammar));
+    if (grammar == NULL)
+    {
+        fprintf(stderr, "Memory allocation for Grammar failed!\n");
+        free(text);
+        return 1;
+    }
+
+    int success = tokenizeGrammar(grammar, text) && parseRules(grammar);
+    if (success)
+    {
+        computeFirstSets(grammar);
+        success = writeHeader(grammar, argv[2]);
+    }
+
+    deleteGrammar(grammar);
+    free(grammar);
+    free(text);
+    return success ? 0 : 1;
+}